@@ -1,7 +1,7 @@
 //
 // NotificationQueueBench.cpp
 //
-// Benchmarks for NotificationQueue, SPSCQueue, and MPSCQueue
+// Benchmarks for NotificationQueue, LockFreeNotificationQueue, SPSCQueue, and MPSCQueue
 //
 // Copyright (c) 2004-2024, Applied Informatics Software Engineering GmbH.,
 // Aleph ONE Software Engineering LLC
@@ -13,6 +13,7 @@
 
 #include <benchmark/benchmark.h>
 #include "Poco/NotificationQueue.h"
+#include "Poco/LockFreeNotificationQueue.h"
 #include "Poco/SPSCQueue.h"
 #include "Poco/MPSCQueue.h"
 #include "Poco/Notification.h"
@@ -25,6 +26,7 @@
 
 
 using Poco::NotificationQueue;
+using Poco::LockFreeNotificationQueue;
 using Poco::SPSCQueue;
 using Poco::MPSCQueue;
 using Poco::Notification;
@@ -339,6 +341,85 @@ static void Queues_MPSCQueue_Threaded(benchmark::State& state)
 BENCHMARK(Queues_MPSCQueue_Threaded);
 
 
+//
+// Multi-producer benchmarks
+// Producers are the benchmark threads, two consumer threads drain the queue.
+// These show how the queues scale with the number of producers.
+//
+
+template <class Q>
+class MultiProducerFixture
+{
+public:
+	class Consumer : public Poco::Runnable
+	{
+	public:
+		Consumer(Q& q) : queue(q) {}
+
+		void run() override
+		{
+			Notification::Ptr pNf = queue.waitDequeueNotification();
+			while (pNf)
+			{
+				pNf = queue.waitDequeueNotification();
+			}
+		}
+
+		Q& queue;
+	};
+
+	static void run(benchmark::State& state)
+	{
+		static Q* pQueue = nullptr;
+		static Consumer* pConsumer = nullptr;
+		static Thread* pConsumerThreads = nullptr;
+
+		if (state.thread_index() == 0)
+		{
+			pQueue = new Q;
+			pConsumer = new Consumer(*pQueue);
+			pConsumerThreads = new Thread[2];
+			pConsumerThreads[0].start(*pConsumer);
+			pConsumerThreads[1].start(*pConsumer);
+		}
+
+		for (auto _ : state)
+		{
+			pQueue->enqueueNotification(new BenchNotification(42));
+		}
+
+		if (state.thread_index() == 0)
+		{
+			while (!pQueue->empty()) Thread::yield();
+			pQueue->wakeUpAll();
+			pConsumerThreads[0].join();
+			pConsumerThreads[1].join();
+			delete [] pConsumerThreads;
+			delete pConsumer;
+			delete pQueue;
+		}
+
+		state.counters["items_per_second"] = benchmark::Counter(
+			static_cast<double>(state.iterations()),
+			benchmark::Counter::kIsRate);
+	}
+};
+
+
+static void Queues_NotificationQueue_MultiProducer(benchmark::State& state)
+{
+	MultiProducerFixture<NotificationQueue>::run(state);
+}
+BENCHMARK(Queues_NotificationQueue_MultiProducer)->ThreadRange(1, 32)->UseRealTime();
+
+
+static void Queues_LockFreeNotificationQueue_MultiProducer(benchmark::State& state)
+{
+	MultiProducerFixture<LockFreeNotificationQueue>::run(state);
+}
+BENCHMARK(Queues_LockFreeNotificationQueue_MultiProducer)->ThreadRange(1, 32)->UseRealTime();
+
+
 //
 // String payload benchmarks
 // Tests memory allocation overhead with realistic message types
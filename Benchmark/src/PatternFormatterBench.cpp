@@ -235,4 +235,28 @@ static void BM_PatternFormatter_LocalTime(benchmark::State& state)
 BENCHMARK(BM_PatternFormatter_LocalTime);
 
 
+//
+// Typical pattern with a timestamp advancing by one millisecond per message
+//
+
+static void BM_PatternFormatter_AdvancingTime(benchmark::State& state)
+{
+	PatternFormatter formatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t");
+	Message msg("TestSource", "This is a test log message", Message::PRIO_INFORMATION);
+	Poco::Timestamp time = msg.getTime();
+	std::string result;
+
+	for (auto _ : state)
+	{
+		time += 1000;
+		msg.setTime(time);
+		result.clear();
+		formatter.format(msg, result);
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.SetBytesProcessed(state.iterations() * result.size());
+}
+BENCHMARK(BM_PatternFormatter_AdvancingTime);
+
+
 } // namespace
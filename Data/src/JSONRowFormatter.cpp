@@ -26,6 +26,31 @@ using Poco::toJSON;
 namespace Poco::Data {
 
 
+namespace {
+
+
+void formatValue(const Poco::Dynamic::Var& val, std::string& formattedValue)
+{
+	if (val.isEmpty())
+	{
+		formattedValue += "null";
+	}
+	else if (val.isString() || val.isDate() || val.isTime())
+	{
+		std::string str = val.convert<std::string>();
+		trimInPlace(str);
+		toJSON(std::string_view(str), formattedValue);
+	}
+	else
+	{
+		formattedValue += val.convert<std::string>();
+	}
+}
+
+
+} // namespace
+
+
 const int JSONRowFormatter::JSON_FMT_MODE_SMALL;
 const int JSONRowFormatter::JSON_FMT_MODE_ROW_COUNT;
 const int JSONRowFormatter::JSON_FMT_MODE_COLUMN_NAMES;
@@ -87,73 +112,52 @@ void JSONRowFormatter::setJSONMode(int mode)
 
 std::string& JSONRowFormatter::formatValues(const ValueVec& vals, std::string& formattedValues)
 {
-	std::ostringstream str;
-	if (!_firstTime) str << ',';
+	formattedValues.clear();
+	if (!_firstTime) formattedValues += ',';
 	if (isSmall())
 	{
 		if (_firstTime)
 		{
 			if (printColumnNames())
-				str << ",\"values\":";
+				formattedValues += ",\"values\":";
 
-			str << '[';
+			formattedValues += '[';
 		}
 
-		str << '[';
+		formattedValues += '[';
 		ValueVec::const_iterator it = vals.begin();
 		ValueVec::const_iterator end = vals.end();
 		for (; it != end;)
 		{
-			if (!it->isEmpty())
-			{
-				if (it->isString() || it->isDate() || it->isTime())
-				{
-					std::string val = it->convert<std::string>();
-					trimInPlace(val);
-					str << toJSON(val);
-				}
-				else
-					str << it->convert<std::string>();
-			}
-			else
-				str << "null";
+			formatValue(*it, formattedValues);
 
 			if (++it == end) break;
-			
-			str << ',';
+
+			formattedValues += ',';
 		}
-		str << ']';
+		formattedValues += ']';
 	}
 	else if (isFull())
 	{
-		str << '{';
+		formattedValues += '{';
 		ValueVec::const_iterator it = vals.begin();
 		ValueVec::const_iterator end = vals.end();
 		NameVec::iterator nIt = _pNames->begin();
 		NameVec::iterator nEnd = _pNames->end();
 		for (; it != end && nIt != nEnd; ++nIt)
 		{
-			if (!it->isEmpty())
-			{
-				if (it->isString() || it->isDate() || it->isTime())
-				{
-					std::string val = it->convert<std::string>();
-					trimInPlace(val);
-					str << '"' << *nIt << "\":" << toJSON(val);
-				}
-				else
-					str << '"' << *nIt << "\":" << it->convert<std::string>();
-			}
-			else
-				str << '"' << *nIt << "\":null";
-
-			if (++it != end) str << ',';
+			formattedValues += '"';
+			formattedValues += *nIt;
+			formattedValues += "\":";
+			formatValue(*it, formattedValues);
+
+			if (++it != end) formattedValues += ',';
 		}
-		str << '}';
+		formattedValues += '}';
 	}
 
 	_firstTime = false;
-	return formattedValues = str.str();
+	return formattedValues;
 }
 
 
@@ -168,17 +172,18 @@ std::string& JSONRowFormatter::formatNames(const NameVecPtr pNames, std::string&
 	}
 	else if (printColumnNames())
 	{
-		std::ostringstream ostr;
-		ostr << "\"names\":[";
+		formattedNames = "\"names\":[";
 		for (NameVec::const_iterator it = pNames->begin(),
 			end = pNames->end();;)
 		{
-			ostr << '"' << *it << '"';
+			formattedNames += '"';
+			formattedNames += *it;
+			formattedNames += '"';
 			if (++it == end) break;
-			ostr << ',';
+			formattedNames += ',';
 		}
-		ostr << "]";
-		return formattedNames = ostr.str();
+		formattedNames += ']';
+		return formattedNames;
 	}
 
 	return formattedNames = "";
@@ -29,9 +29,10 @@ template <
 	class TKey,
 	class TValue,
 	class TMutex = FastMutex,
-	class TEventMutex = FastMutex
+	class TEventMutex = FastMutex,
+	class TStrategy = AccessExpireStrategy<TKey, TValue>
 >
-class AccessExpireCache: public AbstractCache<TKey, TValue, AccessExpireStrategy<TKey, TValue>, TMutex, TEventMutex>
+class AccessExpireCache: public AbstractCache<TKey, TValue, TStrategy, TMutex, TEventMutex>
 	/// An AccessExpireCache caches entries for a fixed time period (per default 10 minutes).
 	/// Entries expire when they are not accessed with get() during this time period. Each access resets
 	/// the start time for expiration.
@@ -40,10 +41,13 @@ class AccessExpireCache: public AbstractCache<TKey, TValue, AccessExpireStrategy
 	/// that the "has" call works, then the current execution thread gets descheduled, time passes,
 	/// the entry gets invalid, thus leading to an empty SharedPtr being returned
 	/// when "get" is invoked.
+	///
+	/// For caches with many entries, TimingWheelAccessExpireStrategy can be
+	/// specified as TStrategy to keep expiration times in a TimingWheel.
 {
 public:
 	AccessExpireCache(Timestamp::TimeDiff expire = 600000):
-		AbstractCache<TKey, TValue, AccessExpireStrategy<TKey, TValue>, TMutex, TEventMutex>(AccessExpireStrategy<TKey, TValue>(expire))
+		AbstractCache<TKey, TValue, TStrategy, TMutex, TEventMutex>(TStrategy(expire))
 	{
 	}
 
@@ -58,9 +58,11 @@ union Placeholder
 	///
 	/// If Holder<Type> fits into POCO_SMALL_OBJECT_SIZE bytes of storage,
 	/// it will be placement-new-allocated into the local buffer
-	/// (i.e. there will be no heap-allocation). The local buffer size is one byte
-	/// larger - [POCO_SMALL_OBJECT_SIZE + 1], additional byte value indicating
-	/// where the object was allocated. See enum Allocation.
+	/// (i.e. there will be no heap-allocation). The local buffer size is two bytes
+	/// larger - [POCO_SMALL_OBJECT_SIZE + 2], the first additional byte value
+	/// indicating where the object was allocated (see enum Allocation), the
+	/// second one holding a tag the owner can use to identify the held type
+	/// without calling into the holder (see tag()).
 	///
 	/// Important: for SOO builds, only same-type (or trivial both-empty no-op)
 	/// swap operation is allowed.
@@ -140,6 +142,20 @@ public:
 			return pHolder;
 	}
 
+	unsigned char tag() const
+		/// Returns the tag set with setTag(), or 0 if
+		/// the Placeholder is empty.
+	{
+		return holder[SizeV + 1];
+	}
+
+	void setTag(unsigned char tag)
+		/// Sets the tag. The tag is reset to 0 when the
+		/// content is erased or replaced.
+	{
+		holder[SizeV + 1] = tag;
+	}
+
 private:
 	using AlignerType = std::max_align_t;
 #ifndef POCO_DOC
@@ -187,6 +203,7 @@ private:
 			break;
 		}
 		setAllocation(Allocation::POCO_ANY_EMPTY);
+		setTag(0);
 		if (clear)
 		{
 			// Force to use optimised memset internally
@@ -194,7 +211,7 @@ private:
 		}
 	}
 
-	mutable unsigned char holder[SizeV+1];
+	mutable unsigned char holder[SizeV+2];
 	AlignerType           aligner;
 
 #else // POCO_NO_SOO
@@ -241,6 +258,18 @@ private:
 		return pHolder;
 	}
 
+	unsigned char tag() const
+		/// Always returns 0; there is no room for a tag
+		/// without small object optimization.
+	{
+		return 0;
+	}
+
+	void setTag(unsigned char)
+		/// Does nothing.
+	{
+	}
+
 private:
 #endif // POCO_NO_SOO
 	PlaceholderT* pHolder;
@@ -0,0 +1,214 @@
+//
+// Arena.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  Arena
+//
+// Definition of the Arena, ArenaScope and ArenaResource classes.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Arena_INCLUDED
+#define Foundation_Arena_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <memory_resource>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Arena
+	/// A monotonic memory arena for variable-sized allocations
+	/// with a common lifetime, e.g. all allocations made while
+	/// handling a single request.
+	///
+	/// Memory is handed out from large chunks by bumping a pointer.
+	/// Individual allocations are not freed (except for the most
+	/// recent one, see deallocate()); instead, all allocations are
+	/// released at once with reset() or when the Arena is destroyed.
+	/// reset() keeps the most recently allocated (and thus largest)
+	/// chunk, so an Arena that is reset after every request
+	/// eventually serves all allocations without calling
+	/// operator new.
+	///
+	/// Objects created in memory obtained from an Arena are not
+	/// destroyed by the Arena.
+	///
+	/// An Arena is not thread safe. However, every thread has a
+	/// current Arena (see current() and ArenaScope), which code
+	/// running in that thread can use for temporary allocations.
+	///
+	/// Use ArenaResource to use an Arena with std::pmr containers.
+{
+public:
+	enum
+	{
+		DEFAULT_CHUNK_SIZE = 4096,
+		MAX_CHUNK_SIZE = 1024*1024
+	};
+
+	explicit Arena(std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+		/// Creates the Arena. The first chunk, which is allocated
+		/// with the first allocation, has the given size. Every
+		/// further chunk is twice as large as the previous one,
+		/// up to MAX_CHUNK_SIZE, or as large as required for the
+		/// allocation.
+
+	~Arena();
+		/// Destroys the Arena and releases all memory.
+
+	void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+		/// Allocates size bytes of memory with the given alignment,
+		/// which must be a power of two.
+		///
+		/// Throws std::bad_alloc if no memory is available.
+
+	void* reallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment = alignof(std::max_align_t));
+		/// Resizes the block of oldSize bytes at ptr, which must have
+		/// been allocated from this Arena, to newSize bytes. The most
+		/// recent allocation is resized in place if possible, otherwise
+		/// a new block is allocated and the contents are copied.
+		///
+		/// If ptr is null, allocates newSize bytes.
+
+	void deallocate(void* ptr, std::size_t size);
+		/// Returns the block of size bytes at ptr to the Arena, if it
+		/// is the most recent allocation. Otherwise, does nothing;
+		/// the memory is released with the next reset().
+
+	void reset();
+		/// Releases all allocations, but keeps the current chunk
+		/// for further allocations.
+
+	void release();
+		/// Releases all allocations and frees all memory.
+
+	std::size_t allocated() const;
+		/// Returns the number of bytes allocated since
+		/// the last reset().
+
+	std::size_t capacity() const;
+		/// Returns the total size of all chunks.
+
+	static Arena* current();
+		/// Returns the current Arena of the calling thread,
+		/// or nullptr if the thread has no current Arena.
+
+private:
+	struct Chunk
+	{
+		Chunk* pNext;
+		std::size_t size;
+	};
+
+	void addChunk(std::size_t minSize);
+	static char* alignUp(char* ptr, std::size_t alignment);
+
+	Arena(const Arena&) = delete;
+	Arena& operator = (const Arena&) = delete;
+
+	Chunk* _pChunks;
+	char* _pPos;
+	char* _pEnd;
+	char* _pLast;
+	std::size_t _chunkSize;
+	std::size_t _allocated;
+	std::size_t _capacity;
+
+	friend class ArenaScope;
+};
+
+
+class Foundation_API ArenaScope
+	/// ArenaScope makes an Arena the current Arena of the calling
+	/// thread, and restores the previous one when it is destroyed.
+	///
+	/// Usage:
+	///     Arena arena;
+	///     {
+	///         ArenaScope scope(arena, true);
+	///         handleRequest(); // may use Arena::current()
+	///     } // arena is reset here
+{
+public:
+	explicit ArenaScope(Arena& arena, bool resetOnExit = false);
+		/// Makes arena the current Arena of the calling thread.
+		/// If resetOnExit is true, the arena is reset when
+		/// the ArenaScope is destroyed.
+
+	~ArenaScope();
+		/// Restores the previous current Arena.
+
+private:
+	ArenaScope(const ArenaScope&) = delete;
+	ArenaScope& operator = (const ArenaScope&) = delete;
+
+	Arena& _arena;
+	Arena* _pPrevious;
+	bool _resetOnExit;
+};
+
+
+class Foundation_API ArenaResource: public std::pmr::memory_resource
+	/// A std::pmr::memory_resource that allocates from an Arena.
+	///
+	/// Example:
+	///     Arena arena;
+	///     ArenaResource resource(arena);
+	///     std::pmr::vector<std::pmr::string> strings(&resource);
+{
+public:
+	explicit ArenaResource(Arena& arena);
+		/// Creates the ArenaResource for the given Arena,
+		/// which must outlive the ArenaResource.
+
+	~ArenaResource() override;
+		/// Destroys the ArenaResource.
+
+	Arena& arena() const;
+		/// Returns the Arena.
+
+protected:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+	Arena& _arena;
+};
+
+
+//
+// inlines
+//
+inline std::size_t Arena::allocated() const
+{
+	return _allocated;
+}
+
+
+inline std::size_t Arena::capacity() const
+{
+	return _capacity;
+}
+
+
+inline Arena& ArenaResource::arena() const
+{
+	return _arena;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Arena_INCLUDED
@@ -25,12 +25,19 @@
 #include "Poco/Runnable.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/NotificationQueue.h"
+#include "Poco/Event.h"
+#include "Poco/Condition.h"
 #include <atomic>
+#include <memory>
+#include <vector>
 
 
 namespace Poco {
 
 
+class AsyncChannelBuffer;
+
+
 class Foundation_API AsyncChannel: public Channel, public Runnable
 	/// A channel uses a separate thread for logging.
 	///
@@ -40,6 +47,12 @@ class Foundation_API AsyncChannel: public Channel, public Runnable
 	///
 	/// All log messages are put into a queue and this queue is
 	/// then processed by a separate thread.
+	///
+	/// In ring buffer mode (see the "mode" property), every thread
+	/// logging to the channel gets its own lock-free single-producer
+	/// single-consumer ring buffer instead of sharing a queue guarded
+	/// by a mutex. The background thread merges the messages from all
+	/// ring buffers in timestamp order.
 {
 public:
 	using Ptr = AutoPtr<AsyncChannel>;
@@ -109,6 +122,29 @@ public:
 	/// Only supported on Linux and Windows.
 	///
 	/// The "enableCpuAffinity" property is set-only.
+	///
+	/// The "mode" property selects how messages are passed to
+	/// the background thread:
+	///    * queue (default): a single queue shared by all threads
+	///    * ringBuffer: a ring buffer per logging thread
+	///
+	/// In ringBuffer mode, the "queueSize" property specifies the
+	/// capacity of each ring buffer (default 1024 messages).
+	/// The mode cannot be changed once messages have been logged.
+	///
+	/// The "mode" property is set-only.
+	///
+	/// The "overflowPolicy" property specifies what happens when a
+	/// ring buffer is full. It is only used in ringBuffer mode.
+	///    * block: wait until the background thread has made room
+	///    * drop (default): discard the new message
+	///    * dropOldest: discard the oldest message in the buffer
+	///
+	/// As with a limited queue, a message indicating the number
+	/// of discarded messages is logged. The overflow policy must
+	/// be set before messages are logged.
+	///
+	/// The "overflowPolicy" property is set-only.
 
 protected:
 	~AsyncChannel() override;
@@ -116,9 +152,35 @@ protected:
 	void setPriority(const std::string& value);
 
 private:
+	enum Mode
+	{
+		MODE_QUEUE,
+		MODE_RING_BUFFER
+	};
+
+	enum OverflowPolicy
+	{
+		OVERFLOW_BLOCK,
+		OVERFLOW_DROP,
+		OVERFLOW_DROP_OLDEST
+	};
+
+	using BufferPtr = std::shared_ptr<AsyncChannelBuffer>;
+
 	template <typename M>
 	void logImpl(M&& msg);
 
+	template <typename M>
+	void logRingBuffer(M&& msg);
+
+	AsyncChannelBuffer& threadBuffer();
+		/// Returns the calling thread's ring buffer,
+		/// creating it if necessary.
+
+	void runRingBuffer();
+		/// Merges and delivers the messages from all ring buffers
+		/// until the channel is closed.
+
 	Channel::Ptr _pChannel;
 	Thread    _thread;
 	FastMutex _threadMutex;
@@ -128,6 +190,17 @@ private:
 	std::size_t _dropCount = 0;
 	std::atomic<bool> _closed;
 	bool _enableCpuAffinity = false;
+	Mode _mode = MODE_QUEUE;
+	OverflowPolicy _overflowPolicy = OVERFLOW_DROP;
+	const UInt64 _id;
+	FastMutex _buffersMutex;
+	std::vector<BufferPtr> _buffers;
+	std::atomic<std::size_t> _buffersVersion;
+	std::atomic<bool> _idle;
+	Event _wakeUp;
+	std::atomic<int> _blocked;
+	FastMutex _blockedMutex;
+	Condition _spaceAvailable;
 };
 
 
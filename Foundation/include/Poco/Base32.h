@@ -0,0 +1,100 @@
+//
+// Base32.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32
+//
+// Definition of class Base32.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base32_INCLUDED
+#define Foundation_Base32_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Base32Encoder.h"
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Base32
+	/// This class provides buffer-to-buffer Base32 encoding and
+	/// decoding, as specified in RFC 4648, with support for the
+	/// Extended Hex and Crockford alphabets.
+	///
+	/// The options are the same as for Base32Encoder and Base32Decoder
+	/// (see Base32EncodingOptions).
+	///
+	/// Base32Encoder and Base32Decoder use this class for processing
+	/// blocks of data.
+{
+public:
+	static std::size_t encodedLength(std::size_t length, int options = BASE32_USE_PADDING);
+		/// Returns the number of characters encode() produces
+		/// for length bytes of data.
+
+	static std::size_t encode(const void* data, std::size_t length, char* out, int options = BASE32_USE_PADDING);
+		/// Encodes length bytes at data and writes the result to out,
+		/// which must have room for at least encodedLength(length, options)
+		/// characters. Returns the number of characters written.
+
+	static std::string encode(std::string_view data, int options = BASE32_USE_PADDING);
+		/// Encodes data and returns the result.
+
+	static std::size_t decodedLength(std::size_t length);
+		/// Returns the maximum number of bytes decode() produces
+		/// for length characters of encoded data.
+
+	static std::size_t decode(const char* data, std::size_t length, void* out, int options = 0);
+		/// Decodes length characters at data and writes the result to out,
+		/// which must have room for at least decodedLength(length) bytes.
+		/// Returns the number of bytes written.
+		///
+		/// Padding characters are optional at the end of the data.
+		///
+		/// Throws a DataFormatException if the data is not valid
+		/// Base32 encoded data.
+
+	static std::string decode(std::string_view data, int options = 0);
+		/// Decodes data and returns the result.
+		///
+		/// Throws a DataFormatException if the data is not valid
+		/// Base32 encoded data.
+};
+
+
+//
+// inlines
+//
+inline std::size_t Base32::encodedLength(std::size_t length, int options)
+{
+	static const std::size_t PARTIAL_LENGTH[5] = {0, 2, 4, 5, 7};
+
+	if (options & BASE32_USE_PADDING)
+		return ((length + 4)/5)*8;
+	else
+		return (length/5)*8 + PARTIAL_LENGTH[length % 5];
+}
+
+
+inline std::size_t Base32::decodedLength(std::size_t length)
+{
+	return ((length + 7)/8)*5;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base32_INCLUDED
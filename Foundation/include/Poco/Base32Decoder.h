@@ -35,27 +35,42 @@ class Foundation_API Base32DecoderBuf: public UnbufferedStreamBuf
 	/// underlying streambuf, so the state
 	/// of the istream will not reflect that of
 	/// its streambuf.
+	///
+	/// Characters are read and decoded in blocks, as far as
+	/// they are available from the underlying streambuf
+	/// without blocking.
 {
 public:
 	Base32DecoderBuf(std::istream& istr, int options = 0);
 	~Base32DecoderBuf() override;
 
 private:
+	enum
+	{
+		BUFFER_SIZE = 1024
+	};
+
 	int readFromDevice() override;
-	int readOne();
+	std::streamsize xsgetn(char* s, std::streamsize n) override;
+	bool decodeBlock();
 
 	static const unsigned char* encoding(int options);
 
-	unsigned char   _group[8];
-	int             _groupLength;
-	int             _groupIndex;
+	int             _options;
+	char            _encoded[BUFFER_SIZE];
+	std::size_t     _encodedLength;
+	char            _decoded[BUFFER_SIZE/8*5];
+	std::size_t     _decodedLength;
+	std::size_t     _decodedIndex;
+	bool            _error;
 	std::streambuf& _buf;
-	const unsigned char* _encoding;
 
 	static const unsigned char REVERSE_DEFAULT_ENCODING[256];
 	static const unsigned char REVERSE_HEX_ENCODING[256];
 	static const unsigned char REVERSE_CROCKFORD_ENCODING[256];
 
+	friend class Base32;
+
 private:
 	Base32DecoderBuf(const Base32DecoderBuf&);
 	Base32DecoderBuf& operator = (const Base32DecoderBuf&);
@@ -77,7 +77,9 @@ protected:
 
 private:
 	int writeToDevice(char c) override;
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
 
+	int             _options;
 	unsigned char   _group[5];
 	int             _groupLength;
 	std::streambuf& _buf;
@@ -89,6 +91,7 @@ private:
 	static const unsigned char CROCKFORD_ENCODING[32];
 
 	friend class Base32DecoderBuf;
+	friend class Base32;
 
 	Base32EncoderBuf(const Base32EncoderBuf&);
 	Base32EncoderBuf& operator = (const Base32EncoderBuf&);
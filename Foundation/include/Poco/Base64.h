@@ -0,0 +1,106 @@
+//
+// Base64.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Definition of class Base64.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base64_INCLUDED
+#define Foundation_Base64_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Base64Encoder.h"
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Base64
+	/// This class provides buffer-to-buffer Base64 encoding and
+	/// decoding, as specified in RFC 4648.
+	///
+	/// Large inputs are processed with SIMD instructions (SSE2/SSSE3
+	/// on x86, NEON on ARM64) where available; the remaining data,
+	/// and all data on other platforms, is processed by a table-driven
+	/// scalar implementation.
+	///
+	/// The options are the same as for Base64Encoder and Base64Decoder
+	/// (see Base64EncodingOptions). Unlike Base64Encoder, encode()
+	/// never inserts line breaks.
+	///
+	/// Base64Encoder and Base64Decoder use this class for processing
+	/// blocks of data.
+{
+public:
+	static std::size_t encodedLength(std::size_t length, int options = 0);
+		/// Returns the number of characters encode() produces
+		/// for length bytes of data.
+
+	static std::size_t encode(const void* data, std::size_t length, char* out, int options = 0);
+		/// Encodes length bytes at data and writes the result to out,
+		/// which must have room for at least encodedLength(length, options)
+		/// characters. Returns the number of characters written.
+
+	static std::string encode(std::string_view data, int options = 0);
+		/// Encodes data and returns the result.
+
+	static std::size_t decodedLength(std::size_t length);
+		/// Returns the maximum number of bytes decode() produces
+		/// for length characters of encoded data.
+
+	static std::size_t decode(const char* data, std::size_t length, void* out, int options = 0);
+		/// Decodes length characters at data and writes the result to out,
+		/// which must have room for at least decodedLength(length) bytes.
+		/// Returns the number of bytes written.
+		///
+		/// Whitespace (space, tab, CR and LF) is ignored, unless
+		/// BASE64_URL_ENCODING is given. Padding characters are
+		/// required at the end of the data, unless BASE64_NO_PADDING
+		/// is given.
+		///
+		/// Throws a DataFormatException if the data is not valid
+		/// Base64 encoded data.
+
+	static std::string decode(std::string_view data, int options = 0);
+		/// Decodes data and returns the result.
+		///
+		/// Throws a DataFormatException if the data is not valid
+		/// Base64 encoded data.
+};
+
+
+//
+// inlines
+//
+inline std::size_t Base64::encodedLength(std::size_t length, int options)
+{
+	if (options & BASE64_NO_PADDING)
+		return (length/3)*4 + (length % 3 ? length % 3 + 1 : 0);
+	else
+		return ((length + 2)/3)*4;
+}
+
+
+inline std::size_t Base64::decodedLength(std::size_t length)
+{
+	return ((length + 3)/4)*3;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base64_INCLUDED
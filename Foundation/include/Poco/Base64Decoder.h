@@ -35,28 +35,34 @@ class Foundation_API Base64DecoderBuf: public UnbufferedStreamBuf
 	/// underlying streambuf, so the state
 	/// of the istream will not reflect that of
 	/// its streambuf.
+	///
+	/// Characters are read and decoded in blocks, as far as
+	/// they are available from the underlying streambuf
+	/// without blocking.
 {
 public:
 	Base64DecoderBuf(std::istream& istr, int options = 0);
 	~Base64DecoderBuf() override;
 
 private:
+	enum
+	{
+		BUFFER_SIZE = 1024
+	};
+
 	int readFromDevice() override;
-	int readOne();
+	std::streamsize xsgetn(char* s, std::streamsize n) override;
+	bool decodeBlock();
 
 	int             _options;
-	unsigned char   _group[3];
-	int             _groupLength;
-	int             _groupIndex;
+	char            _encoded[BUFFER_SIZE];
+	std::size_t     _encodedLength;
+	char            _decoded[BUFFER_SIZE/4*3];
+	std::size_t     _decodedLength;
+	std::size_t     _decodedIndex;
+	bool            _error;
 	std::streambuf& _buf;
-	const unsigned char* _pInEncoding;
 
-	static unsigned char IN_ENCODING[256];
-	static bool          IN_ENCODING_INIT;
-	static unsigned char IN_ENCODING_URL[256];
-	static bool          IN_ENCODING_URL_INIT;
-
-private:
 	Base64DecoderBuf(const Base64DecoderBuf&);
 	Base64DecoderBuf& operator = (const Base64DecoderBuf&);
 };
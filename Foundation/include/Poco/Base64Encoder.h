@@ -69,6 +69,7 @@ public:
 
 private:
 	int writeToDevice(char c) override;
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
 
 	int             _options;
 	unsigned char   _group[3];
@@ -0,0 +1,444 @@
+//
+// ConcurrentCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ConcurrentCache
+//
+// Definition of the ConcurrentCache class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ConcurrentCache_INCLUDED
+#define Foundation_ConcurrentCache_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/RWLock.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Clock.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Exception.h"
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <class TKey, class TValue, class THash = std::hash<TKey>>
+class ConcurrentCache
+	/// A size-limited cache, optionally with expiring entries, for
+	/// caches that are accessed by many threads concurrently.
+	///
+	/// Unlike the caches based on AbstractCache, which protect all
+	/// entries with a single mutex and notify the strategy via events
+	/// on every access, a ConcurrentCache splits its entries into a
+	/// number of independent shards, each with its own read/write lock.
+	/// A key is assigned to a shard based on its hash value.
+	///
+	/// Two eviction policies are supported:
+	///   - EVICT_CLOCK (default): an approximation of LRU. get() only
+	///     marks an entry as referenced and therefore just needs the
+	///     read lock of the shard, so concurrent readers do not block
+	///     each other. When a shard is full, the clock hand evicts the
+	///     first entry that has not been referenced since it was last
+	///     visited.
+	///   - EVICT_LRU: strict least-recently-used order within a shard.
+	///     get() moves the entry to the front of the shard's LRU list
+	///     and therefore needs the write lock of the shard.
+	///
+	/// Capacity and eviction are per shard, so the cache evicts the
+	/// least recently used entry of a shard, which is not necessarily
+	/// the least recently used entry of the whole cache.
+	///
+	/// If an expiration time is given, entries expire that time after
+	/// they have been added, like with ExpireCache. Expired entries are
+	/// no longer returned, but they keep their place in the cache until
+	/// forceReplace() or size() is called, or until they are evicted to
+	/// make room in a full shard. With EVICT_CLOCK, the clock hand evicts
+	/// an expired entry it comes across regardless of its reference bit.
+	/// With EVICT_LRU, get() also removes the expired entry it finds.
+	///
+	/// ConcurrentCache does not provide the events of AbstractCache.
+{
+public:
+	using ValuePtr = SharedPtr<TValue>;
+
+	enum Eviction
+	{
+		EVICT_CLOCK, /// CLOCK (second chance) eviction; get() takes a read lock.
+		EVICT_LRU    /// Strict LRU eviction; get() takes a write lock.
+	};
+
+	enum
+	{
+		DEFAULT_SHARDS = 16
+	};
+
+	explicit ConcurrentCache(std::size_t capacity = 1024, Timestamp::TimeDiff expire = 0, Eviction eviction = EVICT_CLOCK, std::size_t shards = DEFAULT_SHARDS):
+		/// Creates the ConcurrentCache for the given maximum number
+		/// of entries.
+		///
+		/// If expire is greater than zero, entries expire after the
+		/// given number of milliseconds.
+		///
+		/// The number of shards is rounded up to the next power of two,
+		/// and the capacity is evenly distributed among the shards.
+		///
+		/// Throws an InvalidArgumentException if capacity or shards is 0
+		/// or expire is negative.
+		_expire(expire*1000),
+		_eviction(eviction),
+		_shardShift(0)
+	{
+		if (capacity == 0) throw InvalidArgumentException("Invalid cache capacity");
+		if (shards == 0) throw InvalidArgumentException("Invalid number of cache shards");
+		if (expire < 0) throw InvalidArgumentException("Invalid cache expiration time");
+
+		int bits = 0;
+		while ((std::size_t(1) << bits) < shards) ++bits;
+		shards = std::size_t(1) << bits;
+		_shardShift = bits == 0 ? 0 : 64 - bits;
+		_shardCapacity = (capacity + shards - 1)/shards;
+		_shards.reserve(shards);
+		for (std::size_t i = 0; i < shards; ++i)
+		{
+			_shards.push_back(std::make_unique<Shard>());
+		}
+	}
+
+	~ConcurrentCache() = default;
+
+	ConcurrentCache(const ConcurrentCache&) = delete;
+	ConcurrentCache& operator = (const ConcurrentCache&) = delete;
+
+	void add(const TKey& key, const TValue& val)
+		/// Adds the key value pair to the cache.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		add(key, ValuePtr(new TValue(val)));
+	}
+
+	void add(const TKey& key, ValuePtr val)
+		/// Adds the key value pair to the cache. Note that adding a nullptr SharedPtr will fail!
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		poco_check_ptr (val.get());
+
+		Shard& shard = shardFor(key);
+		RWLock::ScopedWriteLock lock(shard.lock);
+		auto it = shard.map.find(key);
+		if (it != shard.map.end())
+		{
+			it->second.value = std::move(val);
+			if (_expire > 0) it->second.expiry = expiryTime();
+			touch(shard, &*it);
+			return;
+		}
+		while (shard.map.size() >= _shardCapacity)
+		{
+			evict(shard);
+		}
+		it = shard.map.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first;
+		it->second.value = std::move(val);
+		if (_expire > 0) it->second.expiry = expiryTime();
+		link(shard, &*it);
+	}
+
+	void remove(const TKey& key)
+		/// Removes an entry from the cache. If the entry is not found,
+		/// the remove is ignored.
+	{
+		Shard& shard = shardFor(key);
+		RWLock::ScopedWriteLock lock(shard.lock);
+		auto it = shard.map.find(key);
+		if (it != shard.map.end())
+		{
+			erase(shard, &*it);
+		}
+	}
+
+	bool has(const TKey& key) const
+		/// Returns true if the cache contains a valid value for the key.
+	{
+		const Shard& shard = shardFor(key);
+		RWLock::ScopedReadLock lock(shard.lock);
+		auto it = shard.map.find(key);
+		return it != shard.map.end() && isValid(it->second);
+	}
+
+	ValuePtr get(const TKey& key)
+		/// Returns a SharedPtr of the value. The SharedPtr will remain valid
+		/// even when cache replacement removes the element.
+		/// If for the key no valid value exists, an empty SharedPtr is returned.
+	{
+		Shard& shard = shardFor(key);
+		if (_eviction == EVICT_CLOCK)
+		{
+			RWLock::ScopedReadLock lock(shard.lock);
+			auto it = shard.map.find(key);
+			if (it == shard.map.end() || !isValid(it->second)) return ValuePtr();
+
+			// avoid writing to the cache line if the flag is already set
+			if (!it->second.referenced.load(std::memory_order_relaxed))
+			{
+				it->second.referenced.store(true, std::memory_order_relaxed);
+			}
+			return it->second.value;
+		}
+		else
+		{
+			RWLock::ScopedWriteLock lock(shard.lock);
+			auto it = shard.map.find(key);
+			if (it == shard.map.end()) return ValuePtr();
+			if (!isValid(it->second))
+			{
+				erase(shard, &*it);
+				return ValuePtr();
+			}
+			touch(shard, &*it);
+			return it->second.value;
+		}
+	}
+
+	void clear()
+		/// Removes all elements from the cache.
+	{
+		for (auto& pShard: _shards)
+		{
+			RWLock::ScopedWriteLock lock(pShard->lock);
+			pShard->ring.clear();
+			pShard->holes.clear();
+			pShard->lru.clear();
+			pShard->hand = 0;
+			pShard->map.clear();
+		}
+	}
+
+	std::size_t size()
+		/// Removes expired entries and returns the number
+		/// of cached elements.
+	{
+		forceReplace();
+		std::size_t n = 0;
+		for (auto& pShard: _shards)
+		{
+			RWLock::ScopedReadLock lock(pShard->lock);
+			n += pShard->map.size();
+		}
+		return n;
+	}
+
+	void forceReplace()
+		/// Removes all expired entries from the cache.
+	{
+		if (_expire == 0) return;
+
+		const Clock now;
+		for (auto& pShard: _shards)
+		{
+			RWLock::ScopedWriteLock lock(pShard->lock);
+			for (auto it = pShard->map.begin(); it != pShard->map.end();)
+			{
+				Item* pItem = &*it;
+				++it;
+				if (pItem->second.expiry <= now) erase(*pShard, pItem);
+			}
+		}
+	}
+
+	std::set<TKey> getAllKeys() const
+		/// Returns a copy of all keys with a valid value stored in the cache.
+	{
+		std::set<TKey> result;
+		forEachItem([&result](const TKey& key, const TValue&) { result.insert(key); });
+		return result;
+	}
+
+	template <typename Fn>
+	void forEach(Fn&& fn) const
+		/// Iterates over all valid key-value pairs in the
+		/// cache, using a functor or lambda expression.
+		///
+		/// The given functor must take the key and value
+		/// as parameters. It is called while holding the
+		/// read lock of the respective shard, and therefore
+		/// must not modify the cache.
+	{
+		forEachItem(fn);
+	}
+
+	std::size_t capacity() const
+		/// Returns the maximum number of entries in the cache.
+	{
+		return _shardCapacity*_shards.size();
+	}
+
+	std::size_t shards() const
+		/// Returns the number of shards.
+	{
+		return _shards.size();
+	}
+
+	Eviction eviction() const
+		/// Returns the eviction policy.
+	{
+		return _eviction;
+	}
+
+private:
+	struct Entry;
+	using Map = std::unordered_map<TKey, Entry, THash>;
+	using Item = typename Map::value_type;
+
+	struct Entry
+	{
+		ValuePtr value;
+		Clock expiry;
+		mutable std::atomic<bool> referenced{false};
+		std::size_t position = 0;
+		typename std::list<Item*>::iterator lruPos;
+	};
+
+	struct Shard
+	{
+		mutable RWLock lock;
+		Map map;
+		std::vector<Item*> ring;
+		std::vector<std::size_t> holes;
+		std::size_t hand = 0;
+		std::list<Item*> lru;
+	};
+
+	Shard& shardFor(const TKey& key) const
+	{
+		if (_shardShift == 0) return *_shards[0];
+
+		// the upper bits of the multiplied hash are well mixed, even
+		// for hash functions like std::hash<int> that return the key
+		const UInt64 h = static_cast<UInt64>(_hash(key))*0x9E3779B97F4A7C15ULL;
+		return *_shards[static_cast<std::size_t>(h >> _shardShift)];
+	}
+
+	Clock expiryTime() const
+	{
+		Clock expiry;
+		expiry += _expire;
+		return expiry;
+	}
+
+	bool isValid(const Entry& entry) const
+	{
+		return _expire == 0 || !entry.expiry.isElapsed(0);
+	}
+
+	void link(Shard& shard, Item* pItem)
+	{
+		if (_eviction == EVICT_CLOCK)
+		{
+			if (shard.holes.empty())
+			{
+				pItem->second.position = shard.ring.size();
+				shard.ring.push_back(pItem);
+			}
+			else
+			{
+				pItem->second.position = shard.holes.back();
+				shard.holes.pop_back();
+				shard.ring[pItem->second.position] = pItem;
+			}
+		}
+		else
+		{
+			shard.lru.push_front(pItem);
+			pItem->second.lruPos = shard.lru.begin();
+		}
+	}
+
+	void touch(Shard& shard, Item* pItem)
+	{
+		if (_eviction == EVICT_CLOCK)
+			pItem->second.referenced.store(true, std::memory_order_relaxed);
+		else
+			shard.lru.splice(shard.lru.begin(), shard.lru, pItem->second.lruPos);
+	}
+
+	void erase(Shard& shard, Item* pItem)
+	{
+		if (_eviction == EVICT_CLOCK)
+		{
+			// the next new entry takes the position, so
+			// that the ring keeps the insertion order
+			shard.ring[pItem->second.position] = nullptr;
+			shard.holes.push_back(pItem->second.position);
+		}
+		else
+		{
+			shard.lru.erase(pItem->second.lruPos);
+		}
+		shard.map.erase(pItem->first);
+	}
+
+	void evict(Shard& shard)
+		/// Removes one entry from the full shard. With EVICT_CLOCK,
+		/// an expired entry is evicted even if it has been referenced.
+	{
+		if (_eviction == EVICT_CLOCK)
+		{
+			// terminates after at most two rounds, as
+			// referenced entries are reset on the way
+			for (;;)
+			{
+				if (shard.hand >= shard.ring.size()) shard.hand = 0;
+				Item* pItem = shard.ring[shard.hand++];
+				if (pItem && (!isValid(pItem->second) || !pItem->second.referenced.exchange(false, std::memory_order_relaxed)))
+				{
+					erase(shard, pItem);
+					return;
+				}
+			}
+		}
+		else
+		{
+			erase(shard, shard.lru.back());
+		}
+	}
+
+	template <typename Fn>
+	void forEachItem(Fn&& fn) const
+	{
+		for (const auto& pShard: _shards)
+		{
+			RWLock::ScopedReadLock lock(pShard->lock);
+			for (const auto& item: pShard->map)
+			{
+				if (isValid(item.second)) fn(item.first, *item.second.value);
+			}
+		}
+	}
+
+	Clock::ClockDiff _expire;
+	Eviction _eviction;
+	int _shardShift;
+	std::size_t _shardCapacity;
+	std::vector<std::unique_ptr<Shard>> _shards;
+	THash _hash;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ConcurrentCache_INCLUDED
@@ -27,6 +27,7 @@
 #include "Poco/Dynamic/VarHolder.h"
 #include "Poco/Dynamic/VarIterator.h"
 #include <typeinfo>
+#include <type_traits>
 #include <map>
 #include <set>
 
@@ -79,6 +80,11 @@ class Foundation_API Var
 	///
 	/// A Var can be created from and converted to a value of any type for which a specialization of
 	/// VarHolderImpl is available. For supported types, see VarHolder documentation.
+	///
+	/// The fixed-size integer types, bool, float, double, char and std::string are
+	/// stored together with a type tag (unless POCO_NO_SOO is defined). Conversions
+	/// between these types, extract() and comparisons then use the tag to call the
+	/// VarHolderImpl directly instead of going through virtual functions.
 {
 public:
 	using Ptr = SharedPtr<Var>;
@@ -139,6 +145,8 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if (convertTagged(val)) return;
+
 		pHolder->convert(val);
 	}
 
@@ -161,6 +169,12 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if constexpr (tagOf<T>() != TAG_NONE)
+		{
+			T result;
+			if (convertTagged(result)) return result;
+		}
+
 		if (typeid(T) == pHolder->type()) return extract<T>();
 
 		T result;
@@ -187,6 +201,12 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if constexpr (tagOf<T>() != TAG_NONE)
+		{
+			T result;
+			if (convertTagged(result)) return result;
+		}
+
 		if (typeid(T) == pHolder->type())
 			return extract<T>();
 
@@ -204,6 +224,12 @@ public:
 		/// is thrown.
 		/// Throws InvalidAccessException if Var is empty.
 	{
+		if constexpr (tagOf<T>() != TAG_NONE)
+		{
+			if (tag() == tagOf<T>())
+				return static_cast<VarHolderImpl<T>*>(content())->value();
+		}
+
 		VarHolder* pHolder = content();
 
 		if ( (pHolder != nullptr) && pHolder->type() == typeid(T))
@@ -535,6 +561,90 @@ public:
 		/// a different result than Var::convert<std::string>() and Var::toString()!
 
 private:
+	enum Tag: unsigned char
+		/// Identifies the held type, if it is one of the
+		/// types that do not need virtual function calls.
+	{
+		TAG_NONE = 0, /// empty, or any other type
+		TAG_INT8,
+		TAG_INT16,
+		TAG_INT32,
+		TAG_INT64,
+		TAG_UINT8,
+		TAG_UINT16,
+		TAG_UINT32,
+		TAG_UINT64,
+		TAG_BOOL,
+		TAG_FLOAT,
+		TAG_DOUBLE,
+		TAG_CHAR,
+		TAG_STRING
+	};
+
+	template <typename T>
+	static constexpr Tag tagOf()
+	{
+		if constexpr (std::is_same_v<T, Int8>) return TAG_INT8;
+		else if constexpr (std::is_same_v<T, Int16>) return TAG_INT16;
+		else if constexpr (std::is_same_v<T, Int32>) return TAG_INT32;
+		else if constexpr (std::is_same_v<T, Int64>) return TAG_INT64;
+		else if constexpr (std::is_same_v<T, UInt8>) return TAG_UINT8;
+		else if constexpr (std::is_same_v<T, UInt16>) return TAG_UINT16;
+		else if constexpr (std::is_same_v<T, UInt32>) return TAG_UINT32;
+		else if constexpr (std::is_same_v<T, UInt64>) return TAG_UINT64;
+		else if constexpr (std::is_same_v<T, bool>) return TAG_BOOL;
+		else if constexpr (std::is_same_v<T, float>) return TAG_FLOAT;
+		else if constexpr (std::is_same_v<T, double>) return TAG_DOUBLE;
+		else if constexpr (std::is_same_v<T, char>) return TAG_CHAR;
+		else if constexpr (std::is_same_v<T, std::string>) return TAG_STRING;
+		else return TAG_NONE;
+	}
+
+	Tag tag() const
+	{
+		return static_cast<Tag>(_placeholder.tag());
+	}
+
+	template <typename H, typename T>
+	void convertHeld(T& val) const
+		/// Calls VarHolderImpl<H>::convert() without virtual dispatch.
+	{
+		static_cast<VarHolderImpl<H>*>(content())->VarHolderImpl<H>::convert(val);
+	}
+
+	template <typename T>
+	bool convertTagged(T& val) const
+		/// Converts the held value to val if both have tagged types.
+		/// Returns false if the conversion must be done through VarHolder.
+	{
+		if constexpr (tagOf<T>() != TAG_NONE)
+		{
+			switch (tag())
+			{
+			case TAG_INT8:   convertHeld<Int8>(val); return true;
+			case TAG_INT16:  convertHeld<Int16>(val); return true;
+			case TAG_INT32:  convertHeld<Int32>(val); return true;
+			case TAG_INT64:  convertHeld<Int64>(val); return true;
+			case TAG_UINT8:  convertHeld<UInt8>(val); return true;
+			case TAG_UINT16: convertHeld<UInt16>(val); return true;
+			case TAG_UINT32: convertHeld<UInt32>(val); return true;
+			case TAG_UINT64: convertHeld<UInt64>(val); return true;
+			case TAG_BOOL:   convertHeld<bool>(val); return true;
+			case TAG_FLOAT:  convertHeld<float>(val); return true;
+			case TAG_DOUBLE: convertHeld<double>(val); return true;
+			case TAG_CHAR:   convertHeld<char>(val); return true;
+			case TAG_STRING: convertHeld<std::string>(val); return true;
+			default:         return false;
+			}
+		}
+		else return false;
+	}
+
+	bool equalsTagged(const Var& other, bool& result) const;
+		/// Compares two non-empty values of tagged types where this
+		/// gives the same result as comparing their string conversions.
+		/// Returns false if the values must be compared as strings.
+
 	Var& getAt(std::size_t n);
 	Var& getAt(const std::string& n);
 
@@ -604,6 +714,7 @@ private:
 	void construct(const ValueType& value)
 	{
 		_placeholder.assign<VarHolderImpl<ValueType>, ValueType>(value);
+		_placeholder.setTag(tagOf<ValueType>());
 	}
 
 	void construct(const char* value);
@@ -626,13 +737,17 @@ inline void Var::construct(const char* value)
 {
 	const std::string val(value);
 	_placeholder.assign<VarHolderImpl<std::string>, std::string>(val);
+	_placeholder.setTag(TAG_STRING);
 }
 
 
 inline void Var::construct(const Var& other)
 {
 	if (!other.isEmpty())
+	{
 		(void) other.content()->clone(&_placeholder);
+		_placeholder.setTag(other._placeholder.tag());
+	}
 }
 
 
@@ -663,6 +778,23 @@ inline void Var::swap(Var& other)
 
 inline const std::type_info& Var::type() const
 {
+	switch (tag())
+	{
+	case TAG_INT8:   return typeid(Int8);
+	case TAG_INT16:  return typeid(Int16);
+	case TAG_INT32:  return typeid(Int32);
+	case TAG_INT64:  return typeid(Int64);
+	case TAG_UINT8:  return typeid(UInt8);
+	case TAG_UINT16: return typeid(UInt16);
+	case TAG_UINT32: return typeid(UInt32);
+	case TAG_UINT64: return typeid(UInt64);
+	case TAG_BOOL:   return typeid(bool);
+	case TAG_FLOAT:  return typeid(float);
+	case TAG_DOUBLE: return typeid(double);
+	case TAG_CHAR:   return typeid(char);
+	case TAG_STRING: return typeid(std::string);
+	default:         break;
+	}
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->type() : typeid(void);
 }
@@ -782,6 +914,14 @@ inline bool Var::isOrdered() const
 
 inline bool Var::isInteger() const
 {
+	switch (tag())
+	{
+	case TAG_NONE:   break;
+	case TAG_FLOAT:
+	case TAG_DOUBLE:
+	case TAG_STRING: return false;
+	default:         return true;
+	}
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isInteger() : false;
 }
@@ -789,6 +929,18 @@ inline bool Var::isInteger() const
 
 inline bool Var::isSigned() const
 {
+	switch (tag())
+	{
+	case TAG_NONE:   break;
+	case TAG_INT8:
+	case TAG_INT16:
+	case TAG_INT32:
+	case TAG_INT64:
+	case TAG_FLOAT:
+	case TAG_DOUBLE: return true;
+	case TAG_CHAR:   return std::numeric_limits<char>::is_signed;
+	default:         return false;
+	}
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isSigned() : false;
 }
@@ -796,6 +948,12 @@ inline bool Var::isSigned() const
 
 inline bool Var::isNumeric() const
 {
+	switch (tag())
+	{
+	case TAG_NONE:   break;
+	case TAG_STRING: return false;
+	default:         return true;
+	}
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isNumeric() : false;
 }
@@ -803,6 +961,8 @@ inline bool Var::isNumeric() const
 
 inline bool Var::isBoolean() const
 {
+	if (tag() != TAG_NONE) return tag() == TAG_BOOL;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isBoolean() : false;
 }
@@ -810,6 +970,8 @@ inline bool Var::isBoolean() const
 
 inline bool Var::isString() const
 {
+	if (tag() != TAG_NONE) return tag() == TAG_STRING;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isString() : false;
 }
@@ -29,9 +29,10 @@ template <
 	class TKey,
 	class TValue,
 	class TMutex = FastMutex,
-	class TEventMutex = FastMutex
+	class TEventMutex = FastMutex,
+	class TStrategy = ExpireStrategy<TKey, TValue>
 >
-class ExpireCache: public AbstractCache<TKey, TValue, ExpireStrategy<TKey, TValue>, TMutex, TEventMutex>
+class ExpireCache: public AbstractCache<TKey, TValue, TStrategy, TMutex, TEventMutex>
 	/// An ExpireCache caches entries for a fixed time period (per default 10 minutes).
 	/// Entries expire independently of the access pattern, i.e. after a constant time.
 	/// If you require your objects to expire after they were not accessed for a given time
@@ -42,10 +43,13 @@ class ExpireCache: public AbstractCache<TKey, TValue, ExpireStrategy<TKey, TValu
 	/// that the "has" call works, then the current execution thread gets descheduled, time passes,
 	/// the entry gets invalid, thus leading to an empty SharedPtr being returned
 	/// when "get" is invoked.
+	///
+	/// For caches with many entries, TimingWheelExpireStrategy can be
+	/// specified as TStrategy to keep expiration times in a TimingWheel.
 {
 public:
 	ExpireCache(Timestamp::TimeDiff expire = 600000):
-		AbstractCache<TKey, TValue, ExpireStrategy<TKey, TValue>, TMutex, TEventMutex>(ExpireStrategy<TKey, TValue>(expire))
+		AbstractCache<TKey, TValue, TStrategy, TMutex, TEventMutex>(TStrategy(expire))
 	{
 	}
 
@@ -0,0 +1,715 @@
+//
+// FlatHashTable.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  FlatHashTable
+//
+// Definition of the FlatHashTable class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FlatHashTable_INCLUDED
+#define Foundation_FlatHashTable_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Hash.h"
+#include "Poco/ByteOrder.h"
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <cstring>
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_FLATHASHTABLE_SSE2 1
+	#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace Impl {
+
+
+using FlatHashCtrl = Int8;
+	/// A control byte of a FlatHashTable. The control byte of a
+	/// slot holding a value stores the lower 7 bits of the value's
+	/// hash, and is therefore never negative.
+
+static constexpr FlatHashCtrl FLAT_HASH_EMPTY = -128;
+static constexpr FlatHashCtrl FLAT_HASH_DELETED = -2;
+
+
+inline int lowestBit(UInt64 mask)
+	/// Returns the index of the lowest set bit of the non-zero mask.
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, static_cast<unsigned long>(mask))) return static_cast<int>(index);
+	_BitScanForward(&index, static_cast<unsigned long>(mask >> 32));
+	return static_cast<int>(index) + 32;
+#else
+	return __builtin_ctzll(mask);
+#endif
+}
+
+
+#if defined(POCO_FLATHASHTABLE_SSE2)
+
+
+class FlatHashGroup
+	/// The control bytes of 16 consecutive slots, compared
+	/// with SSE2 instructions.
+{
+public:
+	enum
+	{
+		WIDTH = 16,
+		SHIFT = 0
+	};
+
+	explicit FlatHashGroup(const FlatHashCtrl* pCtrl):
+		_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl)))
+	{
+	}
+
+	UInt64 match(FlatHashCtrl h2) const
+		/// Returns a bit mask of the slots with the given control byte.
+	{
+		return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl)));
+	}
+
+	UInt64 matchEmpty() const
+		/// Returns a bit mask of the empty slots.
+	{
+		return match(FLAT_HASH_EMPTY);
+	}
+
+	UInt64 matchAvailable() const
+		/// Returns a bit mask of the empty or deleted slots.
+	{
+		return static_cast<UInt32>(_mm_movemask_epi8(_ctrl));
+	}
+
+private:
+	__m128i _ctrl;
+};
+
+
+#else
+
+
+class FlatHashGroup
+	/// The control bytes of 8 consecutive slots, compared
+	/// within a 64-bit word.
+{
+public:
+	enum
+	{
+		WIDTH = 8,
+		SHIFT = 3
+	};
+
+	explicit FlatHashGroup(const FlatHashCtrl* pCtrl)
+	{
+		std::memcpy(&_ctrl, pCtrl, sizeof(_ctrl));
+		_ctrl = ByteOrder::fromLittleEndian(_ctrl);
+	}
+
+	UInt64 match(FlatHashCtrl h2) const
+		/// Returns a bit mask of the slots with the given control byte.
+		/// May report false positives, which are rejected when the
+		/// values are compared.
+	{
+		const UInt64 x = _ctrl ^ (LSBS*static_cast<UInt8>(h2));
+		return (x - LSBS) & ~x & MSBS;
+	}
+
+	UInt64 matchEmpty() const
+		/// Returns a bit mask of the empty slots.
+	{
+		return _ctrl & ~(_ctrl << 6) & MSBS;
+	}
+
+	UInt64 matchAvailable() const
+		/// Returns a bit mask of the empty or deleted slots.
+	{
+		return _ctrl & MSBS;
+	}
+
+private:
+	static constexpr UInt64 LSBS = 0x0101010101010101ULL;
+	static constexpr UInt64 MSBS = 0x8080808080808080ULL;
+
+	UInt64 _ctrl;
+};
+
+
+#endif // POCO_FLATHASHTABLE_SSE2
+
+
+} // namespace Impl
+
+
+template <class Value, class HashFunc = Hash<Value>>
+class FlatHashTable
+	/// This class implements an open addressing hash table
+	/// with a flat memory layout, following the design of
+	/// the "Swiss tables" from Google's Abseil library.
+	///
+	/// All values are stored in a single array of slots, and
+	/// every slot has a control byte that marks it as empty,
+	/// deleted or full. The control byte of a full slot holds
+	/// 7 bits of the value's hash. A lookup compares the control
+	/// bytes of a group of 16 (with SSE2, otherwise 8) slots at
+	/// once and only compares the values of slots whose control
+	/// bytes match, so most lookups touch just one cache line of
+	/// control bytes and one slot.
+	///
+	/// Compared to LinearHashTable, which stores every bucket in
+	/// a separate std::vector, a FlatHashTable needs less memory
+	/// and far fewer cache misses per lookup. In turn, inserting
+	/// values may move existing values, invalidating all iterators,
+	/// pointers and references to values in the table. Erasing a
+	/// value only invalidates iterators to the erased value.
+	///
+	/// The table is kept at most 7/8 full and doubles its capacity
+	/// when it grows beyond that.
+	///
+	/// The FlatHashTable is not thread safe.
+	///
+	/// Value must support comparison for equality.
+{
+public:
+	using ValueType = Value;
+	using Reference = Value &;
+	using ConstReference = const Value &;
+	using Pointer = Value *;
+	using ConstPointer = const Value *;
+	using Hash = HashFunc;
+
+	class ConstIterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Value;
+		using difference_type = ptrdiff_t;
+		using pointer = const Value*;
+		using reference = const Value&;
+
+		ConstIterator():
+			_pCtrl(nullptr),
+			_pSlot(nullptr),
+			_pEnd(nullptr)
+		{
+		}
+
+		ConstIterator(const Impl::FlatHashCtrl* pCtrl, Value* pSlot, const Impl::FlatHashCtrl* pEnd):
+			_pCtrl(pCtrl),
+			_pSlot(pSlot),
+			_pEnd(pEnd)
+		{
+			skipFree();
+		}
+
+		bool operator == (const ConstIterator& it) const
+		{
+			return _pCtrl == it._pCtrl;
+		}
+
+		bool operator != (const ConstIterator& it) const
+		{
+			return _pCtrl != it._pCtrl;
+		}
+
+		const Value& operator * () const
+		{
+			return *_pSlot;
+		}
+
+		const Value* operator -> () const
+		{
+			return _pSlot;
+		}
+
+		ConstIterator& operator ++ () // prefix
+		{
+			++_pCtrl;
+			++_pSlot;
+			skipFree();
+			return *this;
+		}
+
+		ConstIterator operator ++ (int) // postfix
+		{
+			ConstIterator tmp(*this);
+			++*this;
+			return tmp;
+		}
+
+	protected:
+		void skipFree()
+		{
+			while (_pCtrl != _pEnd && *_pCtrl < 0)
+			{
+				++_pCtrl;
+				++_pSlot;
+			}
+		}
+
+		const Impl::FlatHashCtrl* _pCtrl;
+		Value* _pSlot;
+		const Impl::FlatHashCtrl* _pEnd;
+
+		friend class FlatHashTable;
+	};
+
+	class Iterator: public ConstIterator
+	{
+	public:
+		using pointer = Value*;
+		using reference = Value&;
+
+		Iterator() = default;
+
+		Iterator(const Impl::FlatHashCtrl* pCtrl, Value* pSlot, const Impl::FlatHashCtrl* pEnd):
+			ConstIterator(pCtrl, pSlot, pEnd)
+		{
+		}
+
+		Value& operator * ()
+		{
+			return *this->_pSlot;
+		}
+
+		const Value& operator * () const
+		{
+			return *this->_pSlot;
+		}
+
+		Value* operator -> ()
+		{
+			return this->_pSlot;
+		}
+
+		const Value* operator -> () const
+		{
+			return this->_pSlot;
+		}
+
+		Iterator& operator ++ () // prefix
+		{
+			ConstIterator::operator ++ ();
+			return *this;
+		}
+
+		Iterator operator ++ (int) // postfix
+		{
+			Iterator tmp(*this);
+			++*this;
+			return tmp;
+		}
+	};
+
+	FlatHashTable(std::size_t initialReserve = 0):
+		/// Creates the FlatHashTable, with room for
+		/// initialReserve values.
+		_ctrl(nullptr),
+		_slots(nullptr),
+		_capacity(0),
+		_size(0),
+		_growthLeft(0)
+	{
+		reserve(initialReserve);
+	}
+
+	FlatHashTable(const FlatHashTable& table):
+		/// Creates the FlatHashTable by copying another one.
+		_ctrl(nullptr),
+		_slots(nullptr),
+		_capacity(0),
+		_size(0),
+		_growthLeft(0),
+		_hash(table._hash)
+	{
+		reserve(table._size);
+		for (const auto& value: table)
+		{
+			const std::size_t index = prepareInsert(hashOf(value));
+			new (_slots + index) Value(value);
+		}
+	}
+
+	FlatHashTable(FlatHashTable&& table) noexcept:
+		/// Creates the FlatHashTable by moving another one.
+		_ctrl(table._ctrl),
+		_slots(table._slots),
+		_capacity(table._capacity),
+		_size(table._size),
+		_growthLeft(table._growthLeft),
+		_hash(std::move(table._hash))
+	{
+		table._ctrl = nullptr;
+		table._slots = nullptr;
+		table._capacity = 0;
+		table._size = 0;
+		table._growthLeft = 0;
+	}
+
+	~FlatHashTable()
+		/// Destroys the FlatHashTable.
+	{
+		release();
+	}
+
+	FlatHashTable& operator = (const FlatHashTable& table)
+		/// Assigns another FlatHashTable.
+	{
+		FlatHashTable tmp(table);
+		swap(tmp);
+		return *this;
+	}
+
+	FlatHashTable& operator = (FlatHashTable&& table) noexcept
+		/// Move-assigns another FlatHashTable.
+	{
+		FlatHashTable tmp(std::move(table));
+		swap(tmp);
+		return *this;
+	}
+
+	void swap(FlatHashTable& table) noexcept
+		/// Swaps the FlatHashTable with another one.
+	{
+		using std::swap;
+		swap(_ctrl, table._ctrl);
+		swap(_slots, table._slots);
+		swap(_capacity, table._capacity);
+		swap(_size, table._size);
+		swap(_growthLeft, table._growthLeft);
+		swap(_hash, table._hash);
+	}
+
+	ConstIterator begin() const
+		/// Returns an iterator pointing to the first entry, if one exists.
+	{
+		return ConstIterator(_ctrl, _slots, _ctrl + _capacity);
+	}
+
+	ConstIterator end() const
+		/// Returns an iterator pointing to the end of the table.
+	{
+		return ConstIterator(_ctrl + _capacity, _slots + _capacity, _ctrl + _capacity);
+	}
+
+	Iterator begin()
+		/// Returns an iterator pointing to the first entry, if one exists.
+	{
+		return Iterator(_ctrl, _slots, _ctrl + _capacity);
+	}
+
+	Iterator end()
+		/// Returns an iterator pointing to the end of the table.
+	{
+		return Iterator(_ctrl + _capacity, _slots + _capacity, _ctrl + _capacity);
+	}
+
+	ConstIterator find(const Value& value) const
+		/// Finds an entry in the table.
+	{
+		const std::size_t index = findIndex(value, hashOf(value));
+		return index == NOT_FOUND ? end() : ConstIterator(_ctrl + index, _slots + index, _ctrl + _capacity);
+	}
+
+	Iterator find(const Value& value)
+		/// Finds an entry in the table.
+	{
+		const std::size_t index = findIndex(value, hashOf(value));
+		return index == NOT_FOUND ? end() : Iterator(_ctrl + index, _slots + index, _ctrl + _capacity);
+	}
+
+	std::size_t count(const Value& value) const
+		/// Returns the number of elements with the given
+		/// value, with is either 1 or 0.
+	{
+		return findIndex(value, hashOf(value)) != NOT_FOUND ? 1 : 0;
+	}
+
+	std::pair<Iterator, bool> insert(const Value& value)
+		/// Inserts an element into the table.
+		///
+		/// If the element already exists in the table,
+		/// a pair(iterator, false) with iterator pointing to the
+		/// existing element is returned.
+		/// Otherwise, the element is inserted an a
+		/// pair(iterator, true) with iterator
+		/// pointing to the new element is returned.
+	{
+		const std::size_t hash = hashOf(value);
+		std::size_t index = findIndex(value, hash);
+		if (index != NOT_FOUND)
+		{
+			return std::make_pair(Iterator(_ctrl + index, _slots + index, _ctrl + _capacity), false);
+		}
+		index = prepareInsert(hash);
+		try
+		{
+			new (_slots + index) Value(value);
+		}
+		catch (...)
+		{
+			setCtrl(index, Impl::FLAT_HASH_DELETED);
+			--_size;
+			throw;
+		}
+		return std::make_pair(Iterator(_ctrl + index, _slots + index, _ctrl + _capacity), true);
+	}
+
+	void erase(Iterator it)
+		/// Erases the element pointed to by it.
+	{
+		if (it != end())
+		{
+			const std::size_t index = static_cast<std::size_t>(it._pSlot - _slots);
+			_slots[index].~Value();
+			setCtrl(index, Impl::FLAT_HASH_DELETED);
+			--_size;
+		}
+	}
+
+	void erase(const Value& value)
+		/// Erases the element with the given value, if it exists.
+	{
+		erase(find(value));
+	}
+
+	void clear()
+		/// Erases all elements, but keeps the allocated memory.
+	{
+		destroyValues();
+		if (_capacity > 0)
+		{
+			std::memset(_ctrl, static_cast<UInt8>(Impl::FLAT_HASH_EMPTY), _capacity + GROUP_WIDTH);
+		}
+		_size = 0;
+		_growthLeft = maxLoad(_capacity);
+	}
+
+	std::size_t size() const
+		/// Returns the number of elements in the table.
+	{
+		return _size;
+	}
+
+	bool empty() const
+		/// Returns true iff the table is empty.
+	{
+		return _size == 0;
+	}
+
+	std::size_t capacity() const
+		/// Returns the number of slots in the table.
+	{
+		return _capacity;
+	}
+
+	void reserve(std::size_t n)
+		/// Makes room for at least n elements,
+		/// so that inserting them does not move
+		/// any values.
+	{
+		if (n == 0) return;
+
+		std::size_t capacity = GROUP_WIDTH;
+		while (maxLoad(capacity) < n) capacity *= 2;
+		if (capacity > _capacity) rehash(capacity);
+	}
+
+private:
+	using Group = Impl::FlatHashGroup;
+
+	static constexpr std::size_t GROUP_WIDTH = Group::WIDTH;
+	static constexpr std::size_t NOT_FOUND = ~std::size_t(0);
+
+	static std::size_t maxLoad(std::size_t capacity)
+	{
+		return capacity - capacity/8;
+	}
+
+	std::size_t hashOf(const Value& value) const
+	{
+		// spread the bits, as hash functions like Poco::hash(int)
+		// are not random in the lower bits used for H2
+		const UInt64 h = static_cast<UInt64>(_hash(value))*0x9E3779B97F4A7C15ULL;
+		return static_cast<std::size_t>(h ^ (h >> 32));
+	}
+
+	static Impl::FlatHashCtrl h2(std::size_t hash)
+	{
+		return static_cast<Impl::FlatHashCtrl>(hash & 0x7F);
+	}
+
+	std::size_t findIndex(const Value& value, std::size_t hash) const
+		/// Returns the index of the slot holding value, or NOT_FOUND.
+	{
+		if (_capacity == 0) return NOT_FOUND;
+
+		const std::size_t mask = _capacity - 1;
+		std::size_t pos = (hash >> 7) & mask;
+		std::size_t step = 0;
+		for (;;)
+		{
+			const Group group(_ctrl + pos);
+			for (UInt64 bits = group.match(h2(hash)); bits != 0; bits &= bits - 1)
+			{
+				const std::size_t index = (pos + (Impl::lowestBit(bits) >> Group::SHIFT)) & mask;
+				if (_slots[index] == value) return index;
+			}
+			// a value is never stored behind an empty slot
+			// of its probe sequence
+			if (group.matchEmpty() != 0) return NOT_FOUND;
+			step += GROUP_WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	std::size_t findAvailable(std::size_t hash) const
+		/// Returns the index of the first empty or deleted
+		/// slot in the probe sequence for hash.
+	{
+		const std::size_t mask = _capacity - 1;
+		std::size_t pos = (hash >> 7) & mask;
+		std::size_t step = 0;
+		for (;;)
+		{
+			const UInt64 bits = Group(_ctrl + pos).matchAvailable();
+			if (bits != 0)
+			{
+				return (pos + (Impl::lowestBit(bits) >> Group::SHIFT)) & mask;
+			}
+			step += GROUP_WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	std::size_t prepareInsert(std::size_t hash)
+		/// Reserves a slot for a new value with the given hash
+		/// and returns its index. The caller must construct
+		/// the value in the slot.
+	{
+		std::size_t index = _capacity > 0 ? findAvailable(hash) : NOT_FOUND;
+		if (index == NOT_FOUND || (_growthLeft == 0 && _ctrl[index] != Impl::FLAT_HASH_DELETED))
+		{
+			grow();
+			index = findAvailable(hash);
+		}
+		if (_ctrl[index] == Impl::FLAT_HASH_EMPTY) --_growthLeft;
+		setCtrl(index, h2(hash));
+		++_size;
+		return index;
+	}
+
+	void setCtrl(std::size_t index, Impl::FlatHashCtrl ctrl)
+		/// Sets the control byte of the given slot. The control bytes
+		/// of the first group are mirrored behind the last slot, so
+		/// that groups can be loaded from any position.
+	{
+		_ctrl[index] = ctrl;
+		if (index < GROUP_WIDTH) _ctrl[_capacity + index] = ctrl;
+	}
+
+	void grow()
+	{
+		if (_capacity == 0)
+			rehash(GROUP_WIDTH);
+		else if (_size*32 <= _capacity*25)
+			// many deleted slots, which are reclaimed by
+			// rehashing without growing the table
+			rehash(_capacity);
+		else
+			rehash(_capacity*2);
+	}
+
+	void rehash(std::size_t capacity)
+	{
+		std::allocator<Value> alloc;
+		Impl::FlatHashCtrl* pOldCtrl = _ctrl;
+		Value* pOldSlots = _slots;
+		const std::size_t oldCapacity = _capacity;
+
+		_slots = alloc.allocate(capacity);
+		try
+		{
+			_ctrl = new Impl::FlatHashCtrl[capacity + GROUP_WIDTH];
+		}
+		catch (...)
+		{
+			alloc.deallocate(_slots, capacity);
+			_slots = pOldSlots;
+			throw;
+		}
+		std::memset(_ctrl, static_cast<UInt8>(Impl::FLAT_HASH_EMPTY), capacity + GROUP_WIDTH);
+		_capacity = capacity;
+		_growthLeft = maxLoad(capacity) - _size;
+
+		for (std::size_t i = 0; i < oldCapacity; ++i)
+		{
+			if (pOldCtrl[i] >= 0)
+			{
+				const std::size_t hash = hashOf(pOldSlots[i]);
+				const std::size_t index = findAvailable(hash);
+				setCtrl(index, h2(hash));
+				new (_slots + index) Value(std::move(pOldSlots[i]));
+				pOldSlots[i].~Value();
+			}
+		}
+		if (oldCapacity > 0)
+		{
+			delete [] pOldCtrl;
+			alloc.deallocate(pOldSlots, oldCapacity);
+		}
+	}
+
+	void destroyValues()
+	{
+		for (std::size_t i = 0; i < _capacity; ++i)
+		{
+			if (_ctrl[i] >= 0) _slots[i].~Value();
+		}
+	}
+
+	void release()
+	{
+		if (_capacity > 0)
+		{
+			destroyValues();
+			delete [] _ctrl;
+			std::allocator<Value>().deallocate(_slots, _capacity);
+		}
+	}
+
+	Impl::FlatHashCtrl* _ctrl;
+	Value* _slots;
+	std::size_t _capacity;
+	std::size_t _size;
+	std::size_t _growthLeft;
+	HashFunc _hash;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FlatHashTable_INCLUDED
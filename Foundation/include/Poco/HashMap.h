@@ -20,6 +20,7 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/LinearHashTable.h"
+#include "Poco/FlatHashTable.h"
 #include "Poco/Exception.h"
 #include <utility>
 
@@ -78,11 +79,16 @@ private:
 };
 
 
-template <class Key, class Mapped, class HashFunc = Hash<Key>>
+template <class Key, class Mapped, class HashFunc = Hash<Key>, template <class, class> class TTable = LinearHashTable>
 class HashMap
 	/// This class implements a map using a LinearHashTable.
 	///
 	/// A HashMap can be used just like a std::map.
+	///
+	/// The underlying hash table can be changed with the TTable
+	/// template parameter. FlatHashMap uses a FlatHashTable,
+	/// which is considerably faster and more memory efficient,
+	/// but invalidates iterators when inserting elements.
 {
 public:
 	using KeyType = Key;
@@ -96,7 +102,7 @@ public:
 	using PairType = std::pair<KeyType, MappedType>;
 
 	using HashType = HashMapEntryHash<ValueType, HashFunc>;
-	using HashTable = LinearHashTable<ValueType, HashType>;
+	using HashTable = TTable<ValueType, HashType>;
 
 	using Iterator = typename HashTable::Iterator;
 	using ConstIterator = typename HashTable::ConstIterator;
@@ -219,6 +225,11 @@ private:
 };
 
 
+template <class Key, class Mapped, class HashFunc = Hash<Key>>
+using FlatHashMap = HashMap<Key, Mapped, HashFunc, FlatHashTable>;
+	/// A HashMap using a FlatHashTable.
+
+
 } // namespace Poco
 
 
@@ -20,16 +20,22 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/LinearHashTable.h"
+#include "Poco/FlatHashTable.h"
 
 
 namespace Poco {
 
 
-template <class Value, class HashFunc = Hash<Value>>
+template <class Value, class HashFunc = Hash<Value>, template <class, class> class TTable = LinearHashTable>
 class HashSet
 	/// This class implements a set using a LinearHashTable.
 	///
 	/// A HashSet can be used just like a std::set.
+	///
+	/// The underlying hash table can be changed with the TTable
+	/// template parameter. FlatHashSet uses a FlatHashTable,
+	/// which is considerably faster and more memory efficient,
+	/// but invalidates iterators when inserting elements.
 {
 public:
 	using ValueType = Value;
@@ -39,7 +45,7 @@ public:
 	using ConstPointer = const Value *;
 	using Hash = HashFunc;
 
-	using HashTable = LinearHashTable<ValueType, Hash>;
+	using HashTable = TTable<ValueType, Hash>;
 
 	using Iterator = typename HashTable::Iterator;
 	using ConstIterator = typename HashTable::ConstIterator;
@@ -167,6 +173,11 @@ private:
 };
 
 
+template <class Value, class HashFunc = Hash<Value>>
+using FlatHashSet = HashSet<Value, HashFunc, FlatHashTable>;
+	/// A HashSet using a FlatHashTable.
+
+
 } // namespace Poco
 
 
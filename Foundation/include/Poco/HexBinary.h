@@ -0,0 +1,97 @@
+//
+// HexBinary.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinary
+//
+// Definition of the HexBinary class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_HexBinary_INCLUDED
+#define Foundation_HexBinary_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API HexBinary
+	/// This class provides buffer-to-buffer hexBinary encoding
+	/// and decoding, as specified in XML Schema Part 2: Datatypes
+	/// (http://www.w3.org/TR/xmlschema-2/), section 3.2.15.
+	///
+	/// Large inputs are processed with SIMD instructions (SSE2 on x86,
+	/// NEON on ARM64) where available.
+	///
+	/// HexBinaryEncoder and HexBinaryDecoder use this class for
+	/// processing blocks of data.
+{
+public:
+	static std::size_t encodedLength(std::size_t length);
+		/// Returns the number of characters encode() produces
+		/// for length bytes of data.
+
+	static std::size_t encode(const void* data, std::size_t length, char* out, bool uppercase = false);
+		/// Encodes length bytes at data and writes the result to out,
+		/// which must have room for at least encodedLength(length)
+		/// characters. Returns the number of characters written.
+		///
+		/// If uppercase is true, hex digits A-F are written in upper case.
+
+	static std::string encode(std::string_view data, bool uppercase = false);
+		/// Encodes data and returns the result.
+
+	static std::size_t decodedLength(std::size_t length);
+		/// Returns the maximum number of bytes decode() produces
+		/// for length characters of encoded data.
+
+	static std::size_t decode(const char* data, std::size_t length, void* out);
+		/// Decodes length characters at data and writes the result to out,
+		/// which must have room for at least decodedLength(length) bytes.
+		/// Returns the number of bytes written.
+		///
+		/// Hex digits may be in upper or lower case. Whitespace
+		/// (space, tab, CR and LF) is ignored.
+		///
+		/// Throws a DataFormatException if the data is not valid
+		/// hexBinary encoded data.
+
+	static std::string decode(std::string_view data);
+		/// Decodes data and returns the result.
+		///
+		/// Throws a DataFormatException if the data is not valid
+		/// hexBinary encoded data.
+};
+
+
+//
+// inlines
+//
+inline std::size_t HexBinary::encodedLength(std::size_t length)
+{
+	return 2*length;
+}
+
+
+inline std::size_t HexBinary::decodedLength(std::size_t length)
+{
+	return length/2;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_HexBinary_INCLUDED
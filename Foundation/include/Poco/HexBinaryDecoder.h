@@ -39,15 +39,31 @@ class Foundation_API HexBinaryDecoderBuf: public UnbufferedStreamBuf
 	/// underlying streambuf, so the state
 	/// of the istream will not reflect that of
 	/// its streambuf.
+	///
+	/// Characters are read and decoded in blocks, as far as
+	/// they are available from the underlying streambuf
+	/// without blocking.
 {
 public:
 	HexBinaryDecoderBuf(std::istream& istr);
 	~HexBinaryDecoderBuf() override;
 
 private:
-	int readFromDevice() override;
-	int readOne();
+	enum
+	{
+		BUFFER_SIZE = 1024
+	};
 
+	int readFromDevice() override;
+	std::streamsize xsgetn(char* s, std::streamsize n) override;
+	bool decodeBlock();
+
+	char            _encoded[BUFFER_SIZE];
+	std::size_t     _encodedLength;
+	char            _decoded[BUFFER_SIZE/2];
+	std::size_t     _decodedLength;
+	std::size_t     _decodedIndex;
+	bool            _error;
 	std::streambuf& _buf;
 };
 
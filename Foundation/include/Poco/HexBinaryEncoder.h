@@ -63,6 +63,7 @@ public:
 
 private:
 	int writeToDevice(char c) override;
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
 
 	int _pos;
 	int _lineLength;
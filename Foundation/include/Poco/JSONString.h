@@ -19,6 +19,7 @@
 
 
 #include "Poco/Foundation.h"
+#include <string_view>
 
 
 namespace Poco {
@@ -57,6 +58,14 @@ void Foundation_API toJSON(const std::string& value, std::ostream& out, int opti
 	/// only the compulsory ones.
 
 
+void Foundation_API toJSON(std::string_view value, std::string& out, int options = Poco::JSON_WRAP_STRINGS);
+	/// Formats string value by escaping control characters and
+	/// appends the result to out.
+	/// If JSON_WRAP_STRINGS is in options, the resulting string is enclosed in double quotes
+	/// If JSON_ESCAPE_UNICODE is in options, all unicode characters will be escaped, otherwise
+	/// only the compulsory ones.
+
+
 std::string Foundation_API toJSON(const std::string& value, int options = Poco::JSON_WRAP_STRINGS);
 	/// Formats string value by escaping control characters.
 	/// If JSON_WRAP_STRINGS is in options, the resulting string is enclosed in double quotes
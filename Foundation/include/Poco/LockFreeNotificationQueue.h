@@ -0,0 +1,200 @@
+//
+// LockFreeNotificationQueue.h
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  LockFreeNotificationQueue
+//
+// Definition of the LockFreeNotificationQueue class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_LockFreeNotificationQueue_INCLUDED
+#define Foundation_LockFreeNotificationQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Notification.h"
+#include "Poco/MPMCQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+
+namespace Poco {
+
+
+class NotificationCenter;
+
+
+class Foundation_API LockFreeNotificationQueue
+	/// A bounded NotificationQueue variant for many concurrent
+	/// producers and consumers.
+	///
+	/// Notifications are stored in a lock-free MPMCQueue, so enqueueing
+	/// and dequeueing do not take a lock as long as no thread has to
+	/// wait. Consumers that find the queue empty (and producers that
+	/// find it full) park on a condition variable; a lock is only taken
+	/// to wake up a parked thread, if there is one.
+	///
+	/// The interface follows NotificationQueue, with the following
+	/// differences:
+	///   - The queue has a fixed capacity. enqueueNotification() waits
+	///     until space becomes available if the queue is full, while
+	///     tryEnqueueNotification() fails instead.
+	///   - Notifications are always dequeued in FIFO order; there is
+	///     no enqueueUrgentNotification() and no remove().
+	///   - size() and empty() return approximate values if the queue
+	///     is modified concurrently.
+	///
+	/// Shutting down a queue with worker threads works like for
+	/// NotificationQueue:
+	///   1. set a termination flag for every worker thread
+	///   2. call the wakeUpAll() method
+	///   3. join each worker thread
+	///   4. destroy the notification queue.
+{
+public:
+	enum
+	{
+		DEFAULT_CAPACITY = 16384
+	};
+
+	explicit LockFreeNotificationQueue(std::size_t capacity = DEFAULT_CAPACITY);
+		/// Creates the LockFreeNotificationQueue with the given capacity,
+		/// which is rounded up to the next power of two.
+
+	~LockFreeNotificationQueue();
+		/// Destroys the LockFreeNotificationQueue.
+
+	void enqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO). If the queue is full,
+		/// waits until a notification has been dequeued.
+		/// The queue takes ownership of the notification, thus
+		/// a call like
+		///     notificationQueue.enqueueNotification(new MyNotification);
+		/// does not result in a memory leak.
+
+	bool tryEnqueueNotification(Notification::Ptr pNotification);
+		/// Enqueues the given notification by adding it to
+		/// the end of the queue (FIFO), if the queue is not full.
+		/// Returns true if the notification has been enqueued,
+		/// or false if the queue is full.
+
+	Notification* dequeueNotification();
+		/// Dequeues the next pending notification.
+		/// Returns nullptr if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	Notification* waitDequeueNotification();
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		/// This method returns nullptr if wakeUpAll()
+		/// has been called by another thread.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	Notification* waitDequeueNotification(long milliseconds);
+		/// Dequeues the next pending notification.
+		/// If no notification is available, waits for a notification
+		/// to be enqueued up to the specified time.
+		/// Returns nullptr if no notification is available.
+		/// The caller gains ownership of the notification and
+		/// is expected to release it when done with it.
+		///
+		/// It is highly recommended that the result is immediately
+		/// assigned to a Notification::Ptr, to avoid potential
+		/// memory management issues.
+
+	void dispatch(NotificationCenter& notificationCenter);
+		/// Dispatches all queued notifications to the given
+		/// notification center.
+
+	void wakeUpAll();
+		/// Wakes up all threads that wait for a notification.
+		/// Threads calling waitDequeueNotification() on the empty
+		/// queue afterwards return immediately, until the next
+		/// notification is enqueued.
+
+	bool empty() const;
+		/// Returns true iff the queue is empty.
+
+	int size() const;
+		/// Returns the number of notifications in the queue.
+
+	std::size_t capacity() const;
+		/// Returns the maximum number of notifications in the queue.
+
+	void clear();
+		/// Removes all notifications from the queue.
+
+	bool hasIdleThreads() const;
+		/// Returns true if the queue has at least one thread waiting
+		/// for a notification.
+
+private:
+	Notification* waitDequeueImpl(long milliseconds);
+	void notifyConsumer();
+	void notifyProducer();
+
+	LockFreeNotificationQueue(const LockFreeNotificationQueue&) = delete;
+	LockFreeNotificationQueue& operator = (const LockFreeNotificationQueue&) = delete;
+
+	MPMCQueue<Notification*> _queue;
+	std::atomic<int>  _waitingConsumers;
+	std::atomic<int>  _waitingProducers;
+	std::atomic<bool> _wokeUp;
+	int _wakeUpCount;
+	std::mutex _mutex;
+	std::condition_variable _nfAvailable;
+	std::condition_variable _spaceAvailable;
+};
+
+
+//
+// inlines
+//
+inline bool LockFreeNotificationQueue::empty() const
+{
+	return _queue.empty();
+}
+
+
+inline int LockFreeNotificationQueue::size() const
+{
+	return static_cast<int>(_queue.size());
+}
+
+
+inline std::size_t LockFreeNotificationQueue::capacity() const
+{
+	return _queue.capacity();
+}
+
+
+inline bool LockFreeNotificationQueue::hasIdleThreads() const
+{
+	return _waitingConsumers.load(std::memory_order_relaxed) > 0;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_LockFreeNotificationQueue_INCLUDED
@@ -0,0 +1,257 @@
+//
+// MPMCQueue.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  MPMCQueue
+//
+// Definition of the MPMCQueue class template.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_MPMCQueue_INCLUDED
+#define Foundation_MPMCQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace Poco {
+
+
+template <typename T>
+class MPMCQueue
+	/// A lock-free multi-producer multi-consumer (MPMC) bounded queue.
+	///
+	/// This queue can be used by any number of producer and consumer
+	/// threads concurrently. Like MPSCQueue, it is based on a bounded
+	/// ring buffer where every slot carries a sequence number; in addition
+	/// to producers, consumers also use compare-and-swap to claim slots.
+	///
+	/// The queue has a fixed capacity specified at construction time.
+	/// When full, tryPush() returns false. When empty, tryPop() returns false.
+	///
+	/// Usage:
+	///     MPMCQueue<Message> queue(1024);
+	///
+	///     // Producer threads (any number):
+	///     if (queue.tryPush(msg)) { /* success */ }
+	///
+	///     // Consumer threads (any number):
+	///     Message msg;
+	///     if (queue.tryPop(msg)) { /* got message */ }
+	///
+	/// Thread safety:
+	///   - Multiple threads may call tryPush/emplace concurrently (producers)
+	///   - Multiple threads may call tryPop concurrently (consumers)
+	///   - size(), empty(), capacity() may be called from any thread
+	///
+	/// Note: This queue does not provide blocking operations. For blocking
+	/// behavior, combine with a semaphore or condition variable.
+{
+public:
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	explicit MPMCQueue(std::size_t capacity):
+		/// Creates the queue with the given capacity.
+		/// Capacity will be rounded up to the next power of two
+		/// (and at least 2) for efficient indexing.
+		_capacity(nextPowerOfTwo(capacity < 2 ? 2 : capacity)),
+		_mask(_capacity - 1),
+		_slots(static_cast<Slot*>(::operator new(_capacity * sizeof(Slot))))
+	{
+		for (std::size_t i = 0; i < _capacity; ++i)
+		{
+			new (&_slots[i].sequence) std::atomic<std::size_t>(i);
+		}
+	}
+
+	~MPMCQueue()
+		/// Destroys the queue.
+	{
+		std::size_t tail = _tail.load(std::memory_order_relaxed);
+		std::size_t head = _head.load(std::memory_order_relaxed);
+		while (tail != head)
+		{
+			_slots[index(tail)].ptr()->~T();
+			++tail;
+		}
+		for (std::size_t i = 0; i < _capacity; ++i)
+		{
+			_slots[i].sequence.~atomic();
+		}
+		::operator delete(_slots);
+	}
+
+	MPMCQueue(const MPMCQueue&) = delete;
+	MPMCQueue& operator=(const MPMCQueue&) = delete;
+	MPMCQueue(MPMCQueue&&) = delete;
+	MPMCQueue& operator=(MPMCQueue&&) = delete;
+
+	bool tryPush(const T& item)
+		/// Attempts to push a copy of item onto the queue.
+		/// Returns true if successful, false if the queue is full.
+	{
+		return emplace(item);
+	}
+
+	bool tryPush(T&& item)
+		/// Attempts to push item onto the queue using move semantics.
+		/// Returns true if successful, false if the queue is full.
+	{
+		return emplace(std::move(item));
+	}
+
+	template <typename... Args>
+	bool emplace(Args&&... args)
+		/// Attempts to construct an item in-place at the back of the queue.
+		/// Returns true if successful, false if the queue is full.
+	{
+		std::size_t head = _head.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Slot& slot = _slots[index(head)];
+			std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+			std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(head);
+
+			if (diff == 0)
+			{
+				// Slot is free in this lap; try to claim it
+				if (_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+				{
+					new (slot.ptr()) T(std::forward<Args>(args)...);
+					// Publish: allow consumers to read this slot
+					slot.sequence.store(head + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				// Slot still holds an item from the previous lap: full
+				return false;
+			}
+			else
+			{
+				// Another producer got ahead of us
+				head = _head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool tryPop(T& item)
+		/// Attempts to pop an item from the queue.
+		/// If successful, moves the item into the provided reference
+		/// and returns true. Returns false if the queue is empty.
+	{
+		std::size_t tail = _tail.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Slot& slot = _slots[index(tail)];
+			std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+			std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(tail + 1);
+
+			if (diff == 0)
+			{
+				// Slot has been published; try to claim it
+				if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+				{
+					item = std::move(*slot.ptr());
+					slot.ptr()->~T();
+					// Release the slot for the producers' next lap
+					slot.sequence.store(tail + _capacity, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				// Queue is empty or the producer has not finished writing yet
+				return false;
+			}
+			else
+			{
+				// Another consumer got ahead of us
+				tail = _tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	std::size_t size() const
+		/// Returns an approximate count of items in the queue.
+		/// This is approximate because producers and consumers
+		/// may be modifying the queue concurrently.
+	{
+		std::size_t tail = _tail.load(std::memory_order_acquire);
+		std::size_t head = _head.load(std::memory_order_acquire);
+		return head > tail ? head - tail : 0;
+	}
+
+	bool empty() const
+		/// Returns true if the queue appears to be empty.
+		/// This is approximate for the same reason as size().
+	{
+		return size() == 0;
+	}
+
+	std::size_t capacity() const
+		/// Returns the capacity of the queue.
+	{
+		return _capacity;
+	}
+
+private:
+	struct Slot
+	{
+		std::atomic<std::size_t> sequence;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+		T* ptr() { return reinterpret_cast<T*>(&storage); }
+		const T* ptr() const { return reinterpret_cast<const T*>(&storage); }
+	};
+
+	static std::size_t nextPowerOfTwo(std::size_t n)
+	{
+		--n;
+		n |= n >> 1;
+		n |= n >> 2;
+		n |= n >> 4;
+		n |= n >> 8;
+		n |= n >> 16;
+		if constexpr (sizeof(std::size_t) > 4)
+		{
+			n |= n >> 32;
+		}
+		return n + 1;
+	}
+
+	std::size_t index(std::size_t pos) const
+	{
+		return pos & _mask;
+	}
+
+	const std::size_t _capacity;
+	const std::size_t _mask;
+	Slot* const _slots;
+
+	// Align head and tail to separate cache lines to avoid false sharing
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _head{0}; // written by producers (CAS)
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _tail{0}; // written by consumers (CAS)
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_MPMCQueue_INCLUDED
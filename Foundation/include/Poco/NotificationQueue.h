@@ -23,6 +23,7 @@
 #include "Poco/Mutex.h"
 #include "Poco/Event.h"
 #include <deque>
+#include <vector>
 
 
 namespace Poco {
@@ -72,6 +73,13 @@ public:
 		///     notificationQueue.enqueueUrgentNotification(new MyNotification);
 		/// does not result in a memory leak.
 
+	void enqueueBatch(const std::vector<Notification::Ptr>& notifications);
+		/// Enqueues all given notifications, in order, by adding them
+		/// to the end of the queue (FIFO).
+		///
+		/// The queue lock is acquired only once for the whole batch.
+		/// Waiting threads are served first, one notification each.
+
 	Notification* dequeueNotification();
 		/// Dequeues the next pending notification.
 		/// Returns nullptr if no notification is available.
@@ -107,6 +115,30 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
+	std::size_t dequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector, under a single lock acquisition.
+		/// Does not wait if no notification is available.
+		///
+		/// Returns the number of notifications dequeued.
+
+	std::size_t waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector. If no notification is available,
+		/// waits for a notification to be enqueued, then takes it
+		/// together with any other notifications enqueued in the meantime.
+		///
+		/// Returns the number of notifications dequeued, which is 0
+		/// only if wakeUpAll() has been called by another thread.
+
+	std::size_t waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount, long milliseconds);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector. If no notification is available,
+		/// waits for a notification to be enqueued up to the specified time.
+		///
+		/// Returns the number of notifications dequeued, or 0 if
+		/// no notification became available in time.
+
 	void dispatch(NotificationCenter& notificationCenter);
 		/// Dispatches all queued notifications to the given
 		/// notification center.
@@ -137,6 +169,7 @@ public:
 
 protected:
 	Notification::Ptr dequeueOne();
+	std::size_t dequeueMany(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
 
 private:
 	using NfQueue = std::deque<Notification::Ptr>;
@@ -293,6 +293,26 @@ public:
 		/// right justified in a field of the specified width,
 		/// with the number of fractional digits given in precision.
 
+	static char* format(char* first, char* last, float value);
+		/// Formats a float value into the character range [first, last),
+		/// like format(float), but without allocating memory.
+		/// The result is the shortest representation that parses back
+		/// to the same value. No terminating zero is written.
+		///
+		/// Returns a pointer past the last character written, or
+		/// nullptr if the range is too small. POCO_MAX_FLT_STRING_LEN
+		/// characters are always sufficient.
+
+	static char* format(char* first, char* last, double value);
+		/// Formats a double value into the character range [first, last),
+		/// like format(double), but without allocating memory.
+		/// The result is the shortest representation that parses back
+		/// to the same value. No terminating zero is written.
+		///
+		/// Returns a pointer past the last character written, or
+		/// nullptr if the range is too small. POCO_MAX_FLT_STRING_LEN
+		/// characters are always sufficient.
+
 	static std::string format(const void* ptr);
 		/// Formats a pointer in an eight (32-bit architectures) or
 		/// sixteen (64-bit architectures) characters wide
@@ -1004,8 +1024,7 @@ inline std::string NumberFormatter::formatHex(UInt64 value, int width, Options o
 inline std::string NumberFormatter::format(float value)
 {
 	char buffer[POCO_MAX_FLT_STRING_LEN];
-	floatToStr(buffer, POCO_MAX_FLT_STRING_LEN, value);
-	return std::string(buffer);
+	return std::string(buffer, floatToChars(buffer, buffer + POCO_MAX_FLT_STRING_LEN, value));
 }
 
 
@@ -1032,8 +1051,7 @@ inline std::string NumberFormatter::format(float value, int width, int precision
 inline std::string NumberFormatter::format(double value)
 {
 	char buffer[POCO_MAX_FLT_STRING_LEN];
-	doubleToStr(buffer, POCO_MAX_FLT_STRING_LEN, value);
-	return std::string(buffer);
+	return std::string(buffer, doubleToChars(buffer, buffer + POCO_MAX_FLT_STRING_LEN, value));
 }
 
 
@@ -1057,6 +1075,18 @@ inline std::string NumberFormatter::format(double value, int width, int precisio
 }
 
 
+inline char* NumberFormatter::format(char* first, char* last, float value)
+{
+	return floatToChars(first, last, value);
+}
+
+
+inline char* NumberFormatter::format(char* first, char* last, double value)
+{
+	return doubleToChars(first, last, value);
+}
+
+
 inline std::string NumberFormatter::format(const void* ptr)
 {
 	std::string result;
@@ -132,6 +132,22 @@ public:
 		/// false otherwise.
 		/// If parsing was not successful, value is undefined.
 
+	static double parseFloat(const char* first, const char* last, char decimalSeparator = '.', char thousandSeparator = ',');
+		/// Parses a double value in decimal floating point notation
+		/// from the character range [first, last).
+		/// Throws a SyntaxException if the range does not hold a floating-point
+		/// number in decimal notation.
+
+	static bool tryParseFloat(const char* first, const char* last, double& value, char decimalSeparator = '.', char thousandSeparator = ',');
+		/// Parses a double value in decimal floating point notation
+		/// from the character range [first, last).
+		/// Returns true if a valid floating point number has been found,
+		/// false otherwise.
+		/// If parsing was not successful, value is undefined.
+		///
+		/// Plain numbers using '.' as decimal separator and no thousand
+		/// separators are parsed in place, without allocating memory.
+
 	static bool parseBool(const std::string& s);
 		/// Parses a bool value in decimal or string notation
 		/// from the given string.
@@ -668,6 +668,18 @@ Foundation_API void floatToStr(char* buffer,
 	/// the input number. Depending on lowDec and highDec values, the function returns
 	/// decimal or exponential representation.
 
+
+Foundation_API char* floatToChars(char* first,
+	char* last,
+	float value,
+	int lowDec = -std::numeric_limits<float>::digits10,
+	int highDec = std::numeric_limits<float>::digits10);
+	/// Converts a float value to string like floatToStr(), in the style of std::to_chars().
+	/// The result is written to [first, last), without a terminating zero.
+	/// Returns a pointer past the last character written, or nullptr
+	/// if the range is too small.
+
+
 Foundation_API void floatToFixedStr(char* buffer,
 	int bufferSize,
 	float value,
@@ -711,6 +723,17 @@ Foundation_API void doubleToStr(char* buffer,
 	/// decimal or exponential representation.
 
 
+Foundation_API char* doubleToChars(char* first,
+	char* last,
+	double value,
+	int lowDec = -std::numeric_limits<double>::digits10,
+	int highDec = std::numeric_limits<double>::digits10);
+	/// Converts a double value to string like doubleToStr(), in the style of std::to_chars().
+	/// The result is written to [first, last), without a terminating zero.
+	/// Returns a pointer past the last character written, or nullptr
+	/// if the range is too small.
+
+
 Foundation_API void doubleToFixedStr(char* buffer,
 	int bufferSize,
 	double value,
@@ -746,7 +769,6 @@ Foundation_API std::string& doubleToFixedStr(std::string& str,
 Foundation_API float strToFloat(const char* str,
 	const char* inf = POCO_FLT_INF, const char* nan = POCO_FLT_NAN);
 	/// Converts the string of characters into single-precision floating point number.
-	/// Function uses double_conversion::DoubleToStringConverter to do the conversion.
 
 
 Foundation_API bool strToFloat(const std::string&, float& result,
@@ -760,6 +782,15 @@ Foundation_API bool strToFloat(const std::string&, float& result,
 	/// Returns true if successful, false otherwise.
 
 
+Foundation_API bool strToFloat(const char* first, const char* last, float& result,
+	char decSep = '.', char thSep = ',',
+	const char* inf = POCO_FLT_INF, const char* nan = POCO_FLT_NAN);
+	/// Converts the characters in [first, last) into single-precision floating point number,
+	/// like strToFloat(const std::string&, float&, char, char, const char*, const char*).
+	///
+	/// Returns true if successful, false otherwise.
+
+
 Foundation_API double strToDouble(const char* str,
 	const char* inf = POCO_FLT_INF, const char* nan = POCO_FLT_NAN);
 	/// Converts the string of characters into double-precision floating point number.
@@ -776,6 +807,15 @@ Foundation_API bool strToDouble(const std::string& str, double& result,
 	/// Returns true if successful, false otherwise.
 
 
+Foundation_API bool strToDouble(const char* first, const char* last, double& result,
+	char decSep = '.', char thSep = ',',
+	const char* inf = POCO_FLT_INF, const char* nan = POCO_FLT_NAN);
+	/// Converts the characters in [first, last) into double-precision floating point number,
+	/// like strToDouble(const std::string&, double&, char, char, const char*, const char*).
+	///
+	/// Returns true if successful, false otherwise.
+
+
 } // namespace Poco
 
 
@@ -76,6 +76,10 @@ class Foundation_API PatternFormatter: public Formatter
 	///   * %v[width] - the message source (%s) but text length is padded/cropped to 'width'
 	///   * %[name] - the value of the message parameter with the given name
 	///   * %% - percent sign
+	///
+	/// The pattern is parsed once, when it is set. The broken-down
+	/// date and time of a message are cached per thread and only
+	/// recomputed when the second changes.
 
 {
 public:
@@ -151,6 +155,10 @@ private:
 		/// Will parse the _pattern string into the vector of PatternActions,
 		/// which contains the message key, any text that needs to be written first
 		/// a property in case of %[] and required length.
+		///
+		/// A "%Y-%m-%d %H:%M:%S" sequence (with either a space or a 'T'
+		/// between date and time) is combined into a single action,
+		/// which is rendered only once per second.
 
 	void parsePriorityNames();
 
@@ -160,6 +168,8 @@ private:
 	static const std::string DEFAULT_PRIORITY_NAMES;
 
 	std::vector<PatternAction> _patternActions;
+	std::size_t _sizeHint;
+	bool _needsDateTime;
 	bool _localTime;
 	bool _localTimeSet;
 	std::string _pattern;
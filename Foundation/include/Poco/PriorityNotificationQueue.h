@@ -24,6 +24,7 @@
 #include "Poco/Event.h"
 #include <map>
 #include <deque>
+#include <vector>
 
 
 namespace Poco {
@@ -75,6 +76,13 @@ public:
 		///     notificationQueue.enqueueNotification(new MyNotification, 1);
 		/// does not result in a memory leak.
 
+	void enqueueBatch(const std::vector<Notification::Ptr>& notifications, int priority);
+		/// Enqueues all given notifications, in order, with the
+		/// given priority.
+		///
+		/// The queue lock is acquired only once for the whole batch.
+		/// Waiting threads are served first, one notification each.
+
 	Notification* dequeueNotification();
 		/// Dequeues the next pending notification.
 		/// Returns 0 (null) if no notification is available.
@@ -110,6 +118,31 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
+	std::size_t dequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
+		/// Dequeues up to maxCount pending notifications in order of
+		/// their priority and appends them to the given vector, under
+		/// a single lock acquisition. Does not wait if no notification
+		/// is available.
+		///
+		/// Returns the number of notifications dequeued.
+
+	std::size_t waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector. If no notification is available,
+		/// waits for a notification to be enqueued, then takes it
+		/// together with any other notifications enqueued in the meantime.
+		///
+		/// Returns the number of notifications dequeued, which is 0
+		/// only if wakeUpAll() has been called by another thread.
+
+	std::size_t waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount, long milliseconds);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector. If no notification is available,
+		/// waits for a notification to be enqueued up to the specified time.
+		///
+		/// Returns the number of notifications dequeued, or 0 if
+		/// no notification became available in time.
+
 	void dispatch(NotificationCenter& notificationCenter);
 		/// Dispatches all queued notifications to the given
 		/// notification center.
@@ -136,6 +169,7 @@ public:
 
 protected:
 	Notification::Ptr dequeueOne();
+	std::size_t dequeueMany(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
 
 private:
 	using NfQueue = std::multimap<int, Notification::Ptr>;
@@ -32,6 +32,7 @@ namespace Poco {
 
 class Notification;
 class ThreadPool;
+class WorkStealingThreadPool;
 class Exception;
 
 
@@ -62,6 +63,17 @@ public:
 		/// given ThreadPool (should be used
 		/// by this TaskManager exclusively).
 
+	TaskManager(WorkStealingThreadPool& pool);
+		/// Creates the TaskManager, using the
+		/// given WorkStealingThreadPool (should be used
+		/// by this TaskManager exclusively).
+		///
+		/// Tasks are queued until a worker thread is
+		/// available, so start() never fails for lack of
+		/// a thread. This is suitable for a large number of
+		/// short tasks; long-running tasks occupy a worker
+		/// thread for their whole lifetime.
+
 	~TaskManager();
 		/// Destroys the TaskManager.
 
@@ -124,7 +136,8 @@ private:
 	using MutexT = FastMutex;
 	using ScopedLockT = MutexT::ScopedLock;
 
-	ThreadPool&        _threadPool;
+	ThreadPool*        _pThreadPool;
+	WorkStealingThreadPool* _pWorkStealingPool;
 	bool               _ownPool;
 	TaskList           _taskList;
 	Timestamp          _lastProgressNotification;
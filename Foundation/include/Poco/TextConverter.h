@@ -30,6 +30,11 @@ class TextEncoding;
 class Foundation_API TextConverter
 	/// A TextConverter converts strings from one encoding
 	/// into another.
+	///
+	/// Conversions without a transform function between UTF-8
+	/// and UTF-8, UTF-16, UTF-32 (in native byte order) or Latin-1
+	/// are performed with UTFTranscoder, which processes blocks of
+	/// well-formed text instead of single characters.
 {
 public:
 	using Transform = int (*)(int);
@@ -81,6 +86,10 @@ private:
 	TextConverter(const TextConverter&);
 	TextConverter& operator = (const TextConverter&);
 
+	int convertChar(const unsigned char*& it, const unsigned char* end, std::string& destination, Transform trans);
+		/// Converts the character at it, advances it and returns
+		/// the number of encoding errors (0 or 1).
+
 	const TextEncoding& _inEncoding;
 	const TextEncoding& _outEncoding;
 	int                 _defaultChar;
@@ -25,6 +25,7 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Clock.h"
 #include <map>
+#include <vector>
 
 
 namespace Poco {
@@ -78,6 +79,16 @@ public:
 		///     notificationQueue.enqueueNotification(new MyNotification, someTime);
 		/// does not result in a memory leak.
 
+	void enqueueBatch(const std::vector<Notification::Ptr>& notifications, Timestamp timestamp);
+		/// Enqueues all given notifications with the given timestamp,
+		/// acquiring the queue lock only once for the whole batch.
+		///
+		/// The Timestamp is converted to an equivalent Clock value.
+
+	void enqueueBatch(const std::vector<Notification::Ptr>& notifications, Clock clock);
+		/// Enqueues all given notifications with the given clock value,
+		/// acquiring the queue lock only once for the whole batch.
+
 	Notification* dequeueNotification();
 		/// Dequeues the next pending notification with a timestamp
 		/// less than or equal to the current time.
@@ -122,6 +133,29 @@ public:
 		/// assigned to a Notification::Ptr, to avoid potential
 		/// memory management issues.
 
+	std::size_t dequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
+		/// Dequeues up to maxCount pending notifications with a timestamp
+		/// less than or equal to the current time and appends them to
+		/// the given vector, under a single lock acquisition.
+		///
+		/// Returns the number of notifications dequeued.
+
+	std::size_t waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector. If no notification is due, waits
+		/// for the next one, then takes it together with all other
+		/// notifications that are due by then.
+		///
+		/// Returns the number of notifications dequeued.
+
+	std::size_t waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount, long milliseconds);
+		/// Dequeues up to maxCount pending notifications and appends
+		/// them to the given vector. If no notification is due, waits
+		/// for the next one up to the specified time.
+		///
+		/// Returns the number of notifications dequeued, or 0 if
+		/// no notification became due in time.
+
 	bool empty() const;
 		/// Returns true iff the queue is empty.
 
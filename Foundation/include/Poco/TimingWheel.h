@@ -0,0 +1,450 @@
+//
+// TimingWheel.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  TimingWheel
+//
+// Definition of the TimingWheel class template.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TimingWheel_INCLUDED
+#define Foundation_TimingWheel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Clock.h"
+#include "Poco/Exception.h"
+#include <optional>
+#include <utility>
+#include <vector>
+
+
+namespace Poco {
+
+
+template <typename T>
+class TimingWheel
+	/// A hashed hierarchical timing wheel.
+	///
+	/// A TimingWheel stores values together with an expiration time
+	/// and hands them out again once that time has been reached.
+	/// In contrast to a sorted container like the std::multimap used
+	/// by TimedNotificationQueue, scheduling, rescheduling and
+	/// cancelling an entry take constant time, and entries are kept
+	/// in a single pool with no per-entry allocation.
+	///
+	/// Time is divided into ticks of a fixed resolution. The wheel
+	/// consists of LEVELS levels of SLOTS slots each; level 0 holds
+	/// entries expiring within the next SLOTS ticks, level 1 those
+	/// expiring within the next SLOTS^2 ticks, and so on. Whenever
+	/// level 0 wraps around, the entries of the next slot of the
+	/// level above are moved down ("cascaded"). With the default
+	/// resolution of one millisecond, the wheel covers about 49 days;
+	/// entries expiring even later are parked in the last level and
+	/// cascaded until they are due.
+	///
+	/// Entries never expire early, but may expire up to one tick
+	/// late.
+	///
+	/// The TimingWheel does not have its own notion of the current
+	/// time. It is driven by calling advance() periodically; the
+	/// time until the next call can be obtained from nextExpiry().
+	///
+	/// Usage:
+	///     TimingWheel<Socket> wheel;
+	///     TimingWheel<Socket>::TimerId id = wheel.schedule(Clock() + 5000000, socket);
+	///     ...
+	///     wheel.cancel(id); // socket has been active
+	///     ...
+	///     std::vector<Socket> expired;
+	///     wheel.advance(Clock(), expired);
+	///
+	/// The TimingWheel is not thread-safe.
+{
+public:
+	using TimerId = UInt64;
+		/// Identifies a scheduled entry. A TimerId stays unique
+		/// even after the entry has expired or has been cancelled,
+		/// so stale ids can be safely passed to cancel().
+
+	static constexpr TimerId INVALID_TIMER_ID = 0;
+
+	enum
+	{
+		SLOT_BITS = 8,
+		SLOTS     = 1 << SLOT_BITS,
+		LEVELS    = 4
+	};
+
+	explicit TimingWheel(Clock::ClockDiff resolution = 1000, const Clock& start = Clock()):
+		/// Creates the TimingWheel, using the given tick resolution
+		/// in microseconds. The first tick starts at the given time.
+		_resolution(resolution),
+		_start(start),
+		_currentTick(0),
+		_size(0),
+		_freeList(NIL),
+		_heads(LEVELS*SLOTS, NIL),
+		_tails(LEVELS*SLOTS, NIL)
+	{
+		if (resolution <= 0) throw InvalidArgumentException("TimingWheel resolution must be positive");
+		for (int i = 0; i < LEVELS; ++i) _levelCount[i] = 0;
+	}
+
+	~TimingWheel() = default;
+		/// Destroys the TimingWheel.
+
+	TimerId schedule(const Clock& expiry, const T& value)
+		/// Schedules the given value for the given expiration time.
+		/// If the time lies in the past, the value expires with the
+		/// next tick.
+		///
+		/// Returns the id of the new entry.
+	{
+		return scheduleImpl(expiry, T(value));
+	}
+
+	TimerId schedule(const Clock& expiry, T&& value)
+		/// Schedules the given value for the given expiration time.
+		/// If the time lies in the past, the value expires with the
+		/// next tick.
+		///
+		/// Returns the id of the new entry.
+	{
+		return scheduleImpl(expiry, std::move(value));
+	}
+
+	bool reschedule(TimerId id, const Clock& expiry)
+		/// Changes the expiration time of the entry with the given id.
+		///
+		/// Returns false if the entry has already expired or
+		/// has been cancelled.
+	{
+		if (!valid(id)) return false;
+
+		const UInt32 i = indexOf(id);
+		unlink(i);
+		_nodes[i].expiry = expiryTick(expiry);
+		place(i, _currentTick + 1);
+		return true;
+	}
+
+	bool cancel(TimerId id)
+		/// Removes the entry with the given id.
+		///
+		/// Returns false if the entry has already expired or
+		/// has been cancelled.
+	{
+		if (!valid(id)) return false;
+
+		const UInt32 i = indexOf(id);
+		unlink(i);
+		release(i);
+		return true;
+	}
+
+	bool scheduled(TimerId id) const
+		/// Returns true if the entry with the given id is still pending.
+	{
+		return valid(id);
+	}
+
+	std::size_t advance(const Clock& now, std::vector<T>& expired)
+		/// Advances the wheel to the given time and appends the values
+		/// of all entries that have expired in the meantime to expired.
+		///
+		/// Returns the number of expired entries.
+	{
+		const Int64 target = (now - _start)/_resolution;
+		std::size_t n = 0;
+		while (_currentTick < target)
+		{
+			if (_size == 0)
+			{
+				_currentTick = target;
+				break;
+			}
+			int emptyLevels = 0;
+			while (emptyLevels < LEVELS - 1 && _levelCount[emptyLevels] == 0) ++emptyLevels;
+			if (emptyLevels > 0)
+			{
+				// nothing can expire before the first non-empty
+				// level is cascaded
+				const Int64 last = _currentTick | ((Int64(1) << (emptyLevels*SLOT_BITS)) - 1);
+				if (last >= target)
+				{
+					_currentTick = target;
+					break;
+				}
+				_currentTick = last;
+			}
+			++_currentTick;
+			if ((_currentTick & SLOT_MASK) == 0) cascade(1);
+			n += expire(static_cast<UInt32>(_currentTick & SLOT_MASK), expired);
+		}
+		return n;
+	}
+
+	bool nextExpiry(Clock& expiry) const
+		/// Stores the earliest time at which advance() may return
+		/// expired entries in expiry. This is exact for entries due
+		/// within the current rotation of level 0, and a lower bound
+		/// otherwise.
+		///
+		/// Returns false if the wheel is empty.
+	{
+		if (_size == 0) return false;
+
+		const Int64 last = _currentTick | SLOT_MASK;
+		if (_levelCount[0] > 0)
+		{
+			for (Int64 tick = _currentTick + 1; tick <= last; ++tick)
+			{
+				if (_heads[tick & SLOT_MASK] != NIL)
+				{
+					expiry = clockOf(tick);
+					return true;
+				}
+			}
+		}
+		expiry = clockOf(last + 1);
+		return true;
+	}
+
+	std::size_t drain(std::vector<T>& values)
+		/// Removes all entries, regardless of their expiration time,
+		/// and appends their values to values.
+		///
+		/// Returns the number of removed entries.
+	{
+		std::size_t n = 0;
+		for (UInt32 slot = 0; slot < LEVELS*SLOTS; ++slot)
+		{
+			UInt32 i = _heads[slot];
+			while (i != NIL)
+			{
+				const UInt32 next = _nodes[i].next;
+				values.push_back(std::move(*_nodes[i].value));
+				release(i);
+				i = next;
+				++n;
+			}
+			_heads[slot] = _tails[slot] = NIL;
+		}
+		for (int i = 0; i < LEVELS; ++i) _levelCount[i] = 0;
+		return n;
+	}
+
+	void clear()
+		/// Removes all entries.
+	{
+		for (UInt32 slot = 0; slot < LEVELS*SLOTS; ++slot)
+		{
+			UInt32 i = _heads[slot];
+			while (i != NIL)
+			{
+				const UInt32 next = _nodes[i].next;
+				release(i);
+				i = next;
+			}
+			_heads[slot] = _tails[slot] = NIL;
+		}
+		for (int i = 0; i < LEVELS; ++i) _levelCount[i] = 0;
+	}
+
+	std::size_t size() const
+		/// Returns the number of pending entries.
+	{
+		return _size;
+	}
+
+	bool empty() const
+		/// Returns true iff there are no pending entries.
+	{
+		return _size == 0;
+	}
+
+	Clock::ClockDiff resolution() const
+		/// Returns the tick resolution in microseconds.
+	{
+		return _resolution;
+	}
+
+private:
+	static constexpr UInt32 NIL = 0xFFFFFFFF;
+	static constexpr Int64 SLOT_MASK = SLOTS - 1;
+	static constexpr Int64 MAX_DELTA = (Int64(1) << (LEVELS*SLOT_BITS)) - 1;
+
+	struct Node
+	{
+		std::optional<T> value;
+		Int64  expiry = 0;
+		UInt32 prev = NIL;
+		UInt32 next = NIL;
+		UInt32 slot = NIL;
+		UInt32 generation = 0;
+	};
+
+	TimerId scheduleImpl(const Clock& expiry, T&& value)
+	{
+		UInt32 i;
+		if (_freeList != NIL)
+		{
+			i = _freeList;
+			_freeList = _nodes[i].next;
+		}
+		else
+		{
+			if (_nodes.size() >= NIL - 1) throw PoolOverflowException("TimingWheel is full");
+			i = static_cast<UInt32>(_nodes.size());
+			_nodes.emplace_back();
+		}
+		Node& node = _nodes[i];
+		node.value.emplace(std::move(value));
+		node.expiry = expiryTick(expiry);
+		place(i, _currentTick + 1);
+		++_size;
+		return (static_cast<TimerId>(node.generation) << 32) | (i + 1);
+	}
+
+	Int64 expiryTick(const Clock& expiry) const
+		/// Rounds up, so that entries never expire early.
+	{
+		const Clock::ClockDiff diff = expiry - _start;
+		if (diff <= 0) return 0;
+		return (diff + _resolution - 1)/_resolution;
+	}
+
+	Clock clockOf(Int64 tick) const
+	{
+		return _start + tick*_resolution;
+	}
+
+	static UInt32 indexOf(TimerId id)
+	{
+		return static_cast<UInt32>(id & 0xFFFFFFFF) - 1;
+	}
+
+	bool valid(TimerId id) const
+	{
+		if (id == INVALID_TIMER_ID) return false;
+		const UInt32 i = indexOf(id);
+		return i < _nodes.size() && _nodes[i].slot != NIL && _nodes[i].generation == static_cast<UInt32>(id >> 32);
+	}
+
+	void place(UInt32 i, Int64 earliest)
+		/// Links the node into the slot matching its expiration tick,
+		/// but not before the given earliest tick.
+	{
+		Node& node = _nodes[i];
+		Int64 tick = node.expiry < earliest ? earliest : node.expiry;
+		Int64 delta = tick - _currentTick;
+		if (delta > MAX_DELTA)
+		{
+			// park in the last level, the node is placed
+			// again when the slot is cascaded
+			delta = MAX_DELTA;
+			tick = _currentTick + MAX_DELTA;
+		}
+		int level = 0;
+		while (level < LEVELS - 1 && delta >= (Int64(1) << ((level + 1)*SLOT_BITS))) ++level;
+
+		const UInt32 slot = static_cast<UInt32>(level*SLOTS + ((tick >> (level*SLOT_BITS)) & SLOT_MASK));
+		node.slot = slot;
+		node.next = NIL;
+		node.prev = _tails[slot];
+		if (_tails[slot] != NIL)
+			_nodes[_tails[slot]].next = i;
+		else
+			_heads[slot] = i;
+		_tails[slot] = i;
+		++_levelCount[level];
+	}
+
+	void unlink(UInt32 i)
+	{
+		Node& node = _nodes[i];
+		if (node.prev != NIL)
+			_nodes[node.prev].next = node.next;
+		else
+			_heads[node.slot] = node.next;
+		if (node.next != NIL)
+			_nodes[node.next].prev = node.prev;
+		else
+			_tails[node.slot] = node.prev;
+		--_levelCount[node.slot/SLOTS];
+	}
+
+	void release(UInt32 i)
+		/// Returns an unlinked node to the free list.
+	{
+		Node& node = _nodes[i];
+		node.value.reset();
+		node.slot = NIL;
+		node.prev = NIL;
+		node.next = _freeList;
+		++node.generation;
+		_freeList = i;
+		--_size;
+	}
+
+	void cascade(int level)
+		/// Moves the entries of the current slot of the given
+		/// level to the levels below.
+	{
+		const UInt32 index = static_cast<UInt32>((_currentTick >> (level*SLOT_BITS)) & SLOT_MASK);
+		if (index == 0 && level + 1 < LEVELS) cascade(level + 1);
+
+		const UInt32 slot = level*SLOTS + index;
+		UInt32 i = _heads[slot];
+		_heads[slot] = _tails[slot] = NIL;
+		while (i != NIL)
+		{
+			const UInt32 next = _nodes[i].next;
+			--_levelCount[level];
+			// the current tick is expired right after cascading
+			place(i, _currentTick);
+			i = next;
+		}
+	}
+
+	std::size_t expire(UInt32 slot, std::vector<T>& expired)
+	{
+		std::size_t n = 0;
+		UInt32 i = _heads[slot];
+		_heads[slot] = _tails[slot] = NIL;
+		while (i != NIL)
+		{
+			const UInt32 next = _nodes[i].next;
+			expired.push_back(std::move(*_nodes[i].value));
+			--_levelCount[0];
+			release(i);
+			i = next;
+			++n;
+		}
+		return n;
+	}
+
+	Clock::ClockDiff _resolution;
+	Clock _start;
+	Int64 _currentTick;
+	std::size_t _size;
+	UInt32 _freeList;
+	std::vector<Node> _nodes;
+	std::vector<UInt32> _heads;
+	std::vector<UInt32> _tails;
+	std::size_t _levelCount[LEVELS];
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TimingWheel_INCLUDED
@@ -0,0 +1,73 @@
+//
+// TimingWheelAccessExpireStrategy.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  TimingWheelAccessExpireStrategy
+//
+// Definition of the TimingWheelAccessExpireStrategy class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TimingWheelAccessExpireStrategy_INCLUDED
+#define Foundation_TimingWheelAccessExpireStrategy_INCLUDED
+
+
+#include "Poco/TimingWheelExpireStrategy.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue
+>
+class TimingWheelAccessExpireStrategy: public TimingWheelExpireStrategy<TKey, TValue>
+	/// A TimingWheelAccessExpireStrategy implements time and access based
+	/// expiration of cache entries, like AccessExpireStrategy, but keeps
+	/// expiration times in a TimingWheel (see TimingWheelExpireStrategy).
+	///
+	/// To use it with an AccessExpireCache, specify it as the strategy:
+	///
+	///     AccessExpireCache<int, std::string, FastMutex, FastMutex, TimingWheelAccessExpireStrategy<int, std::string>> cache;
+{
+public:
+	TimingWheelAccessExpireStrategy(Timestamp::TimeDiff expireTimeInMilliSec): TimingWheelExpireStrategy<TKey, TValue>(expireTimeInMilliSec)
+		/// Create an expire strategy. Note that the smallest allowed caching time is 25ms.
+		/// Anything lower than that is not useful with current operating systems.
+	{
+	}
+
+	~TimingWheelAccessExpireStrategy() = default;
+
+	void onGet(const void*, const TKey& key)
+	{
+		// get triggers an update to the expiration time
+		typename TimingWheelExpireStrategy<TKey, TValue>::Iterator it = this->_keys.find(key);
+		if (it != this->_keys.end())
+		{
+			if (it->second.expiry.elapsed() < 0) // don't extend if already expired
+			{
+				Clock expiry;
+				expiry += this->_expireTime;
+				it->second.expiry = expiry;
+				if (!this->_wheel.reschedule(it->second.id, expiry))
+				{
+					it->second.id = this->_wheel.schedule(expiry, key);
+				}
+			}
+		}
+	}
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TimingWheelAccessExpireStrategy_INCLUDED
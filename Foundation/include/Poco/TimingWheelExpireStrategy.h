@@ -0,0 +1,160 @@
+//
+// TimingWheelExpireStrategy.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  TimingWheelExpireStrategy
+//
+// Definition of the TimingWheelExpireStrategy class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TimingWheelExpireStrategy_INCLUDED
+#define Foundation_TimingWheelExpireStrategy_INCLUDED
+
+
+#include "Poco/Exception.h"
+#include "Poco/KeyValueArgs.h"
+#include "Poco/ValidArgs.h"
+#include "Poco/AbstractStrategy.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Clock.h"
+#include "Poco/TimingWheel.h"
+#include "Poco/EventArgs.h"
+#include <set>
+#include <map>
+#include <vector>
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue
+>
+class TimingWheelExpireStrategy: public AbstractStrategy<TKey, TValue>
+	/// A TimingWheelExpireStrategy implements time based expiration of
+	/// cache entries, like ExpireStrategy.
+	///
+	/// Instead of a time-ordered std::multimap, expiration times are kept
+	/// in a TimingWheel, so adding and removing entries takes constant time
+	/// apart from the key lookup. This pays off for caches with many entries
+	/// and frequent updates.
+	///
+	/// To use it with an ExpireCache, specify it as the strategy:
+	///
+	///     ExpireCache<int, std::string, FastMutex, FastMutex, TimingWheelExpireStrategy<int, std::string>> cache;
+{
+public:
+	using Wheel = TimingWheel<TKey>;
+	struct Entry
+	{
+		typename Wheel::TimerId id;
+		Clock expiry;
+	};
+	using Keys = std::map<TKey, Entry>;
+	using Iterator = typename Keys::iterator;
+
+public:
+	TimingWheelExpireStrategy(Timestamp::TimeDiff expireTimeInMilliSec):
+		/// Create an expire strategy. Note that the smallest allowed caching time is 25ms.
+		/// Anything lower than that is not useful with current operating systems.
+		_expireTime(expireTimeInMilliSec * 1000),
+		_wheel(RESOLUTION)
+	{
+		if (_expireTime < 25000) throw InvalidArgumentException("expireTime must be at least 25 ms");
+	}
+
+	~TimingWheelExpireStrategy() = default;
+
+	void onAdd(const void*, const KeyValueArgs <TKey, TValue>& args)
+	{
+		Clock expiry;
+		expiry += _expireTime;
+		Iterator it = _keys.find(args.key());
+		if (it != _keys.end())
+		{
+			it->second.expiry = expiry;
+			if (!_wheel.reschedule(it->second.id, expiry))
+			{
+				it->second.id = _wheel.schedule(expiry, args.key());
+			}
+		}
+		else
+		{
+			Entry entry{_wheel.schedule(expiry, args.key()), expiry};
+			_keys.insert(typename Keys::value_type(args.key(), entry));
+		}
+	}
+
+	void onRemove(const void*, const TKey& key)
+	{
+		Iterator it = _keys.find(key);
+		if (it != _keys.end())
+		{
+			_wheel.cancel(it->second.id);
+			_keys.erase(it);
+		}
+	}
+
+	void onGet(const void*, const TKey& key)
+	{
+		// get triggers no changes in an expire
+	}
+
+	void onClear(const void*, const EventArgs& args)
+	{
+		_keys.clear();
+		_wheel.clear();
+	}
+
+	void onIsValid(const void*, ValidArgs<TKey>& args)
+	{
+		Iterator it = _keys.find(args.key());
+		if (it != _keys.end())
+		{
+			if (it->second.expiry.elapsed() >= 0)
+			{
+				args.invalidate();
+			}
+		}
+		else //not found: probably removed by onReplace
+			args.invalidate();
+	}
+
+	void onReplace(const void*, std::set<TKey>& elemsToRemove)
+	{
+		// Note: replace only informs the cache which elements
+		// it would like to remove!
+		// it does not remove them on its own!
+		_wheel.advance(Clock(), _expired);
+		for (auto& key: _expired)
+		{
+			elemsToRemove.insert(std::move(key));
+		}
+		_expired.clear();
+	}
+
+protected:
+	enum
+	{
+		RESOLUTION = 1000 /// TimingWheel resolution in microseconds
+	};
+
+	Clock::ClockDiff _expireTime;
+	Keys  _keys;    /// Maps keys to their expiration time and TimingWheel entry
+	Wheel _wheel;
+	std::vector<TKey> _expired;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TimingWheelExpireStrategy_INCLUDED
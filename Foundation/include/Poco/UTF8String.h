@@ -36,6 +36,8 @@ struct Foundation_API UTF8
 	///
 	/// removeBOM() removes the UTF-8 Byte Order Mark sequence (0xEF, 0xBB, 0xBF)
 	/// from the beginning of the given string, if it's there.
+	///
+	/// isValid() checks whether a string is well-formed UTF-8.
 {
 	enum NormalizationForm
 		/// Normalization form for normalize().
@@ -66,6 +68,14 @@ struct Foundation_API UTF8
 		/// Remove the UTF-8 Byte Order Mark sequence (0xEF, 0xBB, 0xBF)
 		/// from the beginning of the string, if it's there.
 
+	static bool isValid(const std::string& str);
+		/// Returns true if the string consists of well-formed
+		/// UTF-8 sequences only (see UTFTranscoder::validUTF8Length()).
+
+	static bool isValid(const char* str, std::size_t length);
+		/// Returns true if the character sequence consists of well-formed
+		/// UTF-8 sequences only (see UTFTranscoder::validUTF8Length()).
+
 	static std::string escape(const std::string& s, bool strictJSON = false);
 		/// Escapes a string. Special characters like tab, backslash, ... are
 		/// escaped. Unicode characters are escaped to \uxxxx.
@@ -0,0 +1,99 @@
+//
+// UTFTranscoder.h
+//
+// Library: Foundation
+// Package: Text
+// Module:  UTFTranscoder
+//
+// Definition of the UTFTranscoder class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_UTFTranscoder_INCLUDED
+#define Foundation_UTFTranscoder_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/UTFString.h"
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API UTFTranscoder
+	/// This class provides fast buffer-to-buffer UTF-8 validation,
+	/// and conversion between UTF-8 and UTF-16, UTF-32 (both in
+	/// native byte order) and ISO 8859-1 (Latin-1).
+	///
+	/// Runs of ASCII characters are processed with SIMD instructions
+	/// (SSE2 on x86, NEON on ARM64) where available. UTF-8 validation
+	/// additionally uses SSSE3 if the CPU supports it.
+	///
+	/// The conversion functions convert the longest prefix of the input
+	/// that consists of well-formed, complete characters that can be
+	/// represented in the target encoding. They return the number of
+	/// input units (bytes, or UTF-16 and UTF-32 code units) converted
+	/// and store the number of output units written in outLength.
+	/// A return value less than length indicates an invalid or
+	/// incomplete sequence, or a character that cannot be represented,
+	/// at that position, which the caller must deal with.
+	///
+	/// TextConverter and UnicodeConverter use this class if both
+	/// encodings are supported.
+{
+public:
+	static std::size_t asciiLength(const char* data, std::size_t length);
+		/// Returns the number of ASCII characters at the beginning of data.
+
+	static std::size_t validUTF8Length(const char* data, std::size_t length);
+		/// Returns the length of the longest prefix of data that consists
+		/// of well-formed, complete UTF-8 sequences, as specified in
+		/// RFC 3629. Overlong encodings, surrogates and code points above
+		/// U+10FFFF are not well-formed.
+
+	static bool isValidUTF8(const char* data, std::size_t length);
+		/// Returns true if data consists of well-formed UTF-8 sequences only.
+
+	static std::size_t utf8ToUTF16(const char* data, std::size_t length, UTF16Char* out, std::size_t& outLength);
+		/// Converts UTF-8 to UTF-16. out must have room for length code units.
+
+	static std::size_t utf8ToUTF32(const char* data, std::size_t length, UTF32Char* out, std::size_t& outLength);
+		/// Converts UTF-8 to UTF-32. out must have room for length code units.
+
+	static std::size_t utf8ToLatin1(const char* data, std::size_t length, char* out, std::size_t& outLength);
+		/// Converts UTF-8 to Latin-1. out must have room for length bytes.
+		/// Conversion stops at characters above U+00FF.
+
+	static std::size_t utf16ToUTF8(const UTF16Char* data, std::size_t length, char* out, std::size_t& outLength);
+		/// Converts UTF-16 to UTF-8. out must have room for 3*length bytes.
+		/// Conversion stops at unpaired surrogates.
+
+	static std::size_t utf32ToUTF8(const UTF32Char* data, std::size_t length, char* out, std::size_t& outLength);
+		/// Converts UTF-32 to UTF-8. out must have room for 4*length bytes.
+		/// Conversion stops at surrogates and values above U+10FFFF.
+
+	static std::size_t latin1ToUTF8(const char* data, std::size_t length, char* out);
+		/// Converts Latin-1 to UTF-8 and returns the number of bytes
+		/// written. out must have room for 2*length bytes.
+};
+
+
+//
+// inlines
+//
+inline bool UTFTranscoder::isValidUTF8(const char* data, std::size_t length)
+{
+	return validUTF8Length(data, length) == length;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_UTFTranscoder_INCLUDED
@@ -0,0 +1,232 @@
+//
+// WorkStealingQueue.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  WorkStealingQueue
+//
+// Definition of the WorkStealingQueue class template.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingQueue_INCLUDED
+#define Foundation_WorkStealingQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace Poco {
+
+
+template <typename T>
+class WorkStealingQueue
+	/// A lock-free, unbounded work-stealing deque
+	/// (Chase-Lev deque, using the memory orderings given by
+	/// Le, Pop, Cohen and Zappa Nardelli: "Correct and Efficient
+	/// Work-Stealing for Weak Memory Models", PPoPP 2013).
+	///
+	/// The queue has a single owner thread, which pushes and pops
+	/// items at the bottom end (LIFO order, for cache locality).
+	/// Any number of other threads (thieves) may concurrently steal
+	/// items from the top end (FIFO order).
+	///
+	/// The ring buffer grows as needed when the owner pushes items.
+	/// Buffers that have been replaced are kept until the queue
+	/// is destroyed, since thieves may still be reading from them.
+	///
+	/// T must be trivially copyable; typically it is a pointer.
+	///
+	/// Thread safety:
+	///   - Exactly one thread (the owner) may call push() and pop()
+	///   - Multiple threads may call steal() concurrently
+	///   - size() and empty() may be called from any thread
+{
+public:
+	static_assert(std::is_trivially_copyable<T>::value, "WorkStealingQueue requires a trivially copyable type");
+
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	explicit WorkStealingQueue(std::size_t capacity = 256):
+		/// Creates the queue with the given initial capacity,
+		/// rounded up to the next power of two.
+		_pBuffer(new Buffer(nextPowerOfTwo(capacity), nullptr))
+	{
+	}
+
+	~WorkStealingQueue()
+		/// Destroys the queue. Items still in the queue are discarded.
+	{
+		Buffer* pBuffer = _pBuffer.load(std::memory_order_relaxed);
+		while (pBuffer)
+		{
+			Buffer* pPrevious = pBuffer->pPrevious;
+			delete pBuffer;
+			pBuffer = pPrevious;
+		}
+	}
+
+	WorkStealingQueue(const WorkStealingQueue&) = delete;
+	WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+	void push(T item)
+		/// Pushes an item to the bottom of the queue,
+		/// growing the buffer if necessary.
+		/// Must only be called by the owner thread.
+	{
+		std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+		std::int64_t top = _top.load(std::memory_order_acquire);
+		Buffer* pBuffer = _pBuffer.load(std::memory_order_relaxed);
+		if (bottom - top > static_cast<std::int64_t>(pBuffer->mask))
+		{
+			pBuffer = grow(pBuffer, top, bottom);
+		}
+		pBuffer->put(bottom, item);
+		std::atomic_thread_fence(std::memory_order_release);
+		_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	bool pop(T& item)
+		/// Pops the most recently pushed item from the bottom of the
+		/// queue. Returns false if the queue is empty, or if the last
+		/// item has been stolen concurrently.
+		/// Must only be called by the owner thread.
+	{
+		std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+		Buffer* pBuffer = _pBuffer.load(std::memory_order_relaxed);
+		_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t top = _top.load(std::memory_order_relaxed);
+
+		bool result = true;
+		if (top <= bottom)
+		{
+			item = pBuffer->get(bottom);
+			if (top == bottom)
+			{
+				// last item: race against thieves for it
+				result = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			result = false;
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return result;
+	}
+
+	bool steal(T& item)
+		/// Steals the least recently pushed item from the top of the
+		/// queue. Returns false if the queue is empty, or if another
+		/// thread has taken the item concurrently.
+		/// May be called by any thread.
+	{
+		std::int64_t top = _top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+		if (top < bottom)
+		{
+			Buffer* pBuffer = _pBuffer.load(std::memory_order_acquire);
+			T stolen = pBuffer->get(top);
+			if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return false;
+			item = stolen;
+			return true;
+		}
+		return false;
+	}
+
+	std::size_t size() const
+		/// Returns an approximate count of items in the queue.
+	{
+		std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+		std::int64_t top = _top.load(std::memory_order_relaxed);
+		return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+	}
+
+	bool empty() const
+		/// Returns true if the queue appears to be empty.
+	{
+		return size() == 0;
+	}
+
+private:
+	struct Buffer
+	{
+		Buffer(std::size_t capacity, Buffer* pPrev):
+			mask(capacity - 1),
+			items(new std::atomic<T>[capacity]),
+			pPrevious(pPrev)
+		{
+		}
+
+		~Buffer()
+		{
+			delete [] items;
+		}
+
+		T get(std::int64_t i) const
+		{
+			return items[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed);
+		}
+
+		void put(std::int64_t i, T item)
+		{
+			items[static_cast<std::size_t>(i) & mask].store(item, std::memory_order_relaxed);
+		}
+
+		const std::size_t mask;
+		std::atomic<T>* const items;
+		Buffer* const pPrevious;
+	};
+
+	Buffer* grow(Buffer* pBuffer, std::int64_t top, std::int64_t bottom)
+	{
+		Buffer* pNewBuffer = new Buffer(2*(pBuffer->mask + 1), pBuffer);
+		for (std::int64_t i = top; i < bottom; ++i)
+		{
+			pNewBuffer->put(i, pBuffer->get(i));
+		}
+		_pBuffer.store(pNewBuffer, std::memory_order_release);
+		return pNewBuffer;
+	}
+
+	static std::size_t nextPowerOfTwo(std::size_t n)
+	{
+		if (n < 2) return 2;
+		--n;
+		n |= n >> 1;
+		n |= n >> 2;
+		n |= n >> 4;
+		n |= n >> 8;
+		n |= n >> 16;
+		if constexpr (sizeof(std::size_t) > 4)
+		{
+			n |= n >> 32;
+		}
+		return n + 1;
+	}
+
+	// top is written by thieves, bottom by the owner only
+	alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> _top{0};
+	alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> _bottom{0};
+	alignas(CACHE_LINE_SIZE) std::atomic<Buffer*> _pBuffer;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingQueue_INCLUDED
@@ -0,0 +1,193 @@
+//
+// WorkStealingThreadPool.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Definition of the WorkStealingThreadPool class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingThreadPool_INCLUDED
+#define Foundation_WorkStealingThreadPool_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/Environment.h"
+#include "Poco/MPMCQueue.h"
+#include "Poco/WorkStealingQueue.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace Poco {
+
+
+class Foundation_API WorkStealingThreadPool
+	/// A thread pool with a fixed number of worker threads
+	/// that executes queued tasks (Runnable objects or functors),
+	/// optimized for a large number of small tasks.
+	///
+	/// Unlike ThreadPool, which hands out a dedicated thread for
+	/// every start() and fails if none is available, the
+	/// WorkStealingThreadPool queues tasks and executes them as
+	/// soon as a worker becomes free. Therefore, tasks should not
+	/// block for long periods of time.
+	///
+	/// Every worker owns a lock-free WorkStealingQueue. Tasks started
+	/// from within a worker (e.g., subtasks of a running task) are
+	/// pushed to the worker's own queue; tasks started from other
+	/// threads go to a lock-free global injection queue (an MPMCQueue,
+	/// with a mutex-protected overflow list used only if it is full).
+	/// A worker runs tasks from its own queue first, then from the
+	/// injection queue; if both are empty, it steals tasks from the
+	/// other workers' queues. Workers without work park on a condition
+	/// variable, so starting a task only takes a lock if a worker
+	/// must be woken up.
+	///
+	/// The order in which tasks are executed is unspecified.
+	///
+	/// Exceptions thrown by a task are passed to the ErrorHandler.
+{
+public:
+	enum
+	{
+		DEFAULT_INJECTION_QUEUE_CAPACITY = 4096
+	};
+
+	WorkStealingThreadPool(int capacity = static_cast<int>(Environment::processorCount()),
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates a thread pool with the given number of worker threads.
+		/// Threads are created with given stack size.
+
+	WorkStealingThreadPool(const std::string& name,
+		int capacity = static_cast<int>(Environment::processorCount()),
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates a thread pool with the given name and number of worker
+		/// threads. Threads are created with given stack size.
+
+	~WorkStealingThreadPool();
+		/// Waits for all queued tasks to complete, then stops
+		/// and joins the worker threads.
+
+	int capacity() const;
+		/// Returns the number of worker threads.
+
+	void start(Runnable& target);
+		/// Queues the given target for execution by one of the
+		/// worker threads. The target must remain valid until
+		/// it has been executed.
+
+	template <class Functor>
+	void startFunc(Functor&& fn)
+		/// Queues the given functor object or lambda for
+		/// execution by one of the worker threads.
+	{
+		using FunctorType = typename std::decay<Functor>::type;
+		startImpl(new FunctorRunnable<FunctorType>(std::forward<Functor>(fn)));
+	}
+
+	void joinAll();
+		/// Waits until all queued and running tasks have completed.
+		/// The worker threads remain available for new tasks.
+
+	int pending() const;
+		/// Returns the number of tasks that have been queued
+		/// but have not completed yet.
+
+	const std::string& name() const;
+		/// Returns the name of the thread pool,
+		/// or an empty string if no name has been
+		/// specified in the constructor.
+
+private:
+	class Worker;
+
+	template <class Functor>
+	class FunctorRunnable: public Runnable
+		/// Runs a functor once, then deletes itself.
+	{
+	public:
+		FunctorRunnable(const Functor& functor):
+			_functor(functor)
+		{
+		}
+
+		FunctorRunnable(Functor&& functor):
+			_functor(std::move(functor))
+		{
+		}
+
+		void run() override
+		{
+			std::unique_ptr<FunctorRunnable> guard(this);
+			_functor();
+		}
+
+	private:
+		Functor _functor;
+	};
+
+	void init(int capacity, int stackSize);
+	void startImpl(Runnable* pTarget);
+	bool findTask(Worker& worker, Runnable*& pTarget);
+	bool popInjected(Runnable*& pTarget);
+	bool hasWork() const;
+	void wakeUp();
+	void park();
+	void taskDone();
+	void stop();
+
+	WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+	WorkStealingThreadPool& operator = (const WorkStealingThreadPool&) = delete;
+
+	std::string _name;
+	std::vector<std::unique_ptr<Worker>> _workers;
+	MPMCQueue<Runnable*> _injected;
+	std::deque<Runnable*> _overflow;
+	std::atomic<int> _overflowCount;
+	std::atomic<int> _pending;
+	std::atomic<int> _parked;
+	std::atomic<bool> _stopped;
+	FastMutex _overflowMutex;
+	std::mutex _parkMutex;
+	std::condition_variable _workAvailable;
+	std::mutex _doneMutex;
+	std::condition_variable _done;
+
+	friend class Worker;
+};
+
+
+//
+// inlines
+//
+inline int WorkStealingThreadPool::pending() const
+{
+	return _pending.load(std::memory_order_relaxed);
+}
+
+
+inline const std::string& WorkStealingThreadPool::name() const
+{
+	return _name;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingThreadPool_INCLUDED
@@ -0,0 +1,227 @@
+//
+// Arena.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  Arena
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Arena.h"
+#include "Poco/Bugcheck.h"
+#include <algorithm>
+#include <new>
+#include <cstdint>
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	thread_local Arena* pCurrentArena = nullptr;
+
+	// keeps the chunk memory following the header aligned
+	const std::size_t CHUNK_HEADER_SIZE = (sizeof(void*) + sizeof(std::size_t) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+
+Arena::Arena(std::size_t chunkSize):
+	_pChunks(nullptr),
+	_pPos(nullptr),
+	_pEnd(nullptr),
+	_pLast(nullptr),
+	_chunkSize(chunkSize > 0 ? chunkSize : std::size_t(DEFAULT_CHUNK_SIZE)),
+	_allocated(0),
+	_capacity(0)
+{
+}
+
+
+Arena::~Arena()
+{
+	poco_assert_dbg (pCurrentArena != this);
+
+	release();
+}
+
+
+void* Arena::allocate(std::size_t size, std::size_t alignment)
+{
+	poco_assert_dbg (alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	char* p = _pPos ? alignUp(_pPos, alignment) : nullptr;
+	if (!p || p > _pEnd || size > static_cast<std::size_t>(_pEnd - p))
+	{
+		addChunk(size + alignment);
+		p = alignUp(_pPos, alignment);
+	}
+	_pLast = p;
+	_pPos = p + size;
+	_allocated += size;
+	return p;
+}
+
+
+void* Arena::reallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment)
+{
+	if (!ptr) return allocate(newSize, alignment);
+
+	char* p = static_cast<char*>(ptr);
+	if (p == _pLast && newSize <= static_cast<std::size_t>(_pEnd - p))
+	{
+		_pPos = p + newSize;
+		_allocated += newSize;
+		_allocated -= oldSize;
+		return p;
+	}
+	void* pNew = allocate(newSize, alignment);
+	std::memcpy(pNew, ptr, std::min(oldSize, newSize));
+	return pNew;
+}
+
+
+void Arena::deallocate(void* ptr, std::size_t size)
+{
+	char* p = static_cast<char*>(ptr);
+	if (p && p == _pLast && p + size == _pPos)
+	{
+		_pPos = p;
+		_pLast = nullptr;
+		_allocated -= size;
+	}
+}
+
+
+void Arena::reset()
+{
+	if (!_pChunks) return;
+
+	// the head of the list is the newest, and largest, chunk
+	Chunk* pChunk = _pChunks->pNext;
+	while (pChunk)
+	{
+		Chunk* pNext = pChunk->pNext;
+		_capacity -= pChunk->size;
+		::operator delete(pChunk);
+		pChunk = pNext;
+	}
+	_pChunks->pNext = nullptr;
+	_pPos = reinterpret_cast<char*>(_pChunks) + CHUNK_HEADER_SIZE;
+	_pEnd = reinterpret_cast<char*>(_pChunks) + _pChunks->size;
+	_pLast = nullptr;
+	_allocated = 0;
+}
+
+
+void Arena::release()
+{
+	Chunk* pChunk = _pChunks;
+	while (pChunk)
+	{
+		Chunk* pNext = pChunk->pNext;
+		::operator delete(pChunk);
+		pChunk = pNext;
+	}
+	_pChunks = nullptr;
+	_pPos = nullptr;
+	_pEnd = nullptr;
+	_pLast = nullptr;
+	_allocated = 0;
+	_capacity = 0;
+}
+
+
+Arena* Arena::current()
+{
+	return pCurrentArena;
+}
+
+
+void Arena::addChunk(std::size_t minSize)
+{
+	std::size_t size = _chunkSize;
+	if (size < minSize + CHUNK_HEADER_SIZE) size = minSize + CHUNK_HEADER_SIZE;
+
+	Chunk* pChunk = static_cast<Chunk*>(::operator new(size));
+	pChunk->pNext = _pChunks;
+	pChunk->size = size;
+	_pChunks = pChunk;
+	_pPos = reinterpret_cast<char*>(pChunk) + CHUNK_HEADER_SIZE;
+	_pEnd = reinterpret_cast<char*>(pChunk) + size;
+	_pLast = nullptr;
+	_capacity += size;
+	if (_chunkSize < MAX_CHUNK_SIZE) _chunkSize = std::min<std::size_t>(2*_chunkSize, MAX_CHUNK_SIZE);
+}
+
+
+char* Arena::alignUp(char* ptr, std::size_t alignment)
+{
+	const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(ptr);
+	return reinterpret_cast<char*>((addr + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+}
+
+
+//
+// ArenaScope
+//
+
+
+ArenaScope::ArenaScope(Arena& arena, bool resetOnExit):
+	_arena(arena),
+	_pPrevious(pCurrentArena),
+	_resetOnExit(resetOnExit)
+{
+	pCurrentArena = &arena;
+}
+
+
+ArenaScope::~ArenaScope()
+{
+	pCurrentArena = _pPrevious;
+	if (_resetOnExit) _arena.reset();
+}
+
+
+//
+// ArenaResource
+//
+
+
+ArenaResource::ArenaResource(Arena& arena):
+	_arena(arena)
+{
+}
+
+
+ArenaResource::~ArenaResource()
+{
+}
+
+
+void* ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	return _arena.allocate(bytes, alignment);
+}
+
+
+void ArenaResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+{
+	_arena.deallocate(p, bytes);
+}
+
+
+bool ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	const ArenaResource* pOther = dynamic_cast<const ArenaResource*>(&other);
+	return pOther && &pOther->_arena == &_arena;
+}
+
+
+} // namespace Poco
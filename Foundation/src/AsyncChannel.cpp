@@ -22,6 +22,10 @@
 #include "Poco/Exception.h"
 #include "Poco/String.h"
 #include "Poco/Format.h"
+#include "Poco/SPSCQueue.h"
+#include "Poco/MPMCQueue.h"
+#include <algorithm>
+#include <vector>
 #if defined(__linux__)
 #include <sched.h>
 #include <unistd.h>
@@ -33,6 +37,88 @@
 namespace Poco {
 
 
+namespace
+{
+	const std::size_t BATCH_SIZE = 64;
+	const std::size_t DEFAULT_RING_BUFFER_SIZE = 1024;
+	const long IDLE_TIMEOUT = 100;
+	std::atomic<UInt64> nextChannelId(1);
+}
+
+
+class AsyncChannelBuffer
+	/// The ring buffer of a single thread logging to an
+	/// AsyncChannel in ring buffer mode.
+	///
+	/// Messages are written by the owning thread and read by the
+	/// channel's background thread. With the dropOldest overflow
+	/// policy, the owning thread also removes messages from a full
+	/// buffer, so a multi-consumer queue is used in that case.
+{
+public:
+	AsyncChannelBuffer(std::size_t capacity, bool dropOldest)
+	{
+		if (dropOldest)
+			_pMPMCQueue = std::make_unique<MPMCQueue<Message>>(capacity);
+		else
+			_pSPSCQueue = std::make_unique<SPSCQueue<Message>>(capacity);
+	}
+
+	template <typename M>
+	bool tryPush(M&& msg)
+		/// Leaves msg untouched if the buffer is full.
+	{
+		return _pSPSCQueue ? _pSPSCQueue->emplace(std::forward<M>(msg)) : _pMPMCQueue->emplace(std::forward<M>(msg));
+	}
+
+	bool tryPop(Message& msg)
+	{
+		return _pSPSCQueue ? _pSPSCQueue->tryPop(msg) : _pMPMCQueue->tryPop(msg);
+	}
+
+	bool dropOldest()
+		/// Removes the oldest message. Called by the owning thread
+		/// if the buffer is full.
+	{
+		return _pMPMCQueue->tryPop(_discarded);
+	}
+
+	bool empty() const
+	{
+		return _pSPSCQueue ? _pSPSCQueue->empty() : _pMPMCQueue->empty();
+	}
+
+	std::atomic<std::size_t> dropCount{0};
+	std::atomic<bool> abandoned{false};
+		/// Set when the owning thread terminates.
+	std::atomic<bool> closed{false};
+		/// Set when the channel is closed.
+
+private:
+	std::unique_ptr<SPSCQueue<Message>> _pSPSCQueue;
+	std::unique_ptr<MPMCQueue<Message>> _pMPMCQueue;
+	Message _discarded;
+};
+
+
+namespace
+{
+	struct ThreadBuffers
+		/// The ring buffers of the current thread, one for every
+		/// AsyncChannel the thread has logged to.
+	{
+		~ThreadBuffers()
+		{
+			for (auto& entry: entries) entry.second->abandoned = true;
+		}
+
+		std::vector<std::pair<UInt64, std::shared_ptr<AsyncChannelBuffer>>> entries;
+	};
+
+	thread_local ThreadBuffers threadBuffers;
+}
+
+
 class MessageNotification: public Notification
 {
 public:
@@ -63,7 +149,11 @@ private:
 AsyncChannel::AsyncChannel(Channel::Ptr pChannel, Thread::Priority prio):
 	_pChannel(pChannel),
 	_thread("AsyncChannel"),
-	_closed(false)
+	_closed(false),
+	_id(nextChannelId++),
+	_buffersVersion(0),
+	_idle(false),
+	_blocked(0)
 {
 	_thread.setPriority(prio);
 }
@@ -110,14 +200,33 @@ void AsyncChannel::close()
 	{
 		if (_thread.isRunning())
 		{
-			while (!_queue.empty()) Thread::sleep(100);
-
-			do
+			if (_mode == MODE_RING_BUFFER)
 			{
-				_queue.wakeUpAll();
+				{
+					FastMutex::ScopedLock lock(_blockedMutex);
+					_spaceAvailable.broadcast();
+				}
+				do
+				{
+					_wakeUp.set();
+				}
+				while (!_thread.tryJoin(100));
+			}
+			else
+			{
+				while (!_queue.empty()) Thread::sleep(100);
+
+				do
+				{
+					_queue.wakeUpAll();
+				}
+				while (!_thread.tryJoin(100));
 			}
-			while (!_thread.tryJoin(100));
 		}
+
+		FastMutex::ScopedLock lock(_buffersMutex);
+		for (auto& pBuffer: _buffers) pBuffer->closed = true;
+		_buffers.clear();
 	}
 }
 
@@ -126,6 +235,11 @@ template <typename M>
 void AsyncChannel::logImpl(M&& msg)
 {
 	if (_closed) return;
+	if (_mode == MODE_RING_BUFFER)
+	{
+		logRingBuffer(std::forward<M>(msg));
+		return;
+	}
 	if (_queueSize != 0 && static_cast<std::size_t>(_queue.size()) >= _queueSize)
 	{
 		++_dropCount;
@@ -144,6 +258,75 @@ void AsyncChannel::logImpl(M&& msg)
 }
 
 
+AsyncChannelBuffer& AsyncChannel::threadBuffer()
+{
+	auto& entries = threadBuffers.entries;
+	for (auto& entry: entries)
+	{
+		if (entry.first == _id) return *entry.second;
+	}
+
+	// release buffers of channels that have been closed in the meantime
+	entries.erase(std::remove_if(entries.begin(), entries.end(),
+		[](const auto& entry) { return entry.second->closed.load(); }), entries.end());
+
+	const std::size_t capacity = _queueSize ? _queueSize : DEFAULT_RING_BUFFER_SIZE;
+	BufferPtr pBuffer = std::make_shared<AsyncChannelBuffer>(capacity, _overflowPolicy == OVERFLOW_DROP_OLDEST);
+	{
+		FastMutex::ScopedLock lock(_buffersMutex);
+
+		_buffers.push_back(pBuffer);
+		++_buffersVersion;
+	}
+	entries.emplace_back(_id, pBuffer);
+
+	open();
+	return *pBuffer;
+}
+
+
+template <typename M>
+void AsyncChannel::logRingBuffer(M&& msg)
+{
+	AsyncChannelBuffer& buffer = threadBuffer();
+	bool pushed = buffer.tryPush(std::forward<M>(msg));
+	while (!pushed)
+	{
+		switch (_overflowPolicy)
+		{
+		case OVERFLOW_BLOCK:
+			{
+				// wait until the background thread has taken messages
+				// from the buffers; the push is retried with the mutex
+				// held, so that the signal cannot get lost
+				++_blocked;
+				_wakeUp.set();
+				FastMutex::ScopedLock lock(_blockedMutex);
+				while (!(pushed = buffer.tryPush(std::forward<M>(msg))) && !_closed)
+				{
+					_spaceAvailable.tryWait(_blockedMutex, IDLE_TIMEOUT);
+				}
+				--_blocked;
+				if (!pushed) return;
+			}
+			break;
+		case OVERFLOW_DROP:
+			++buffer.dropCount;
+			return;
+		case OVERFLOW_DROP_OLDEST:
+			if (buffer.dropOldest()) ++buffer.dropCount;
+			pushed = buffer.tryPush(std::forward<M>(msg));
+			break;
+		}
+	}
+
+	// pairs with the fence in runRingBuffer(), so that either the
+	// background thread sees the message or we see it going idle
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_idle.load(std::memory_order_relaxed)) _wakeUp.set();
+}
+
+
 void AsyncChannel::log(const Message& msg)
 {
 	logImpl(msg);
@@ -177,6 +360,38 @@ void AsyncChannel::setProperty(const std::string& name, const std::string& value
 	{
 		_enableCpuAffinity = (Poco::icompare(value, "true") == 0 || value == "1");
 	}
+	else if (name == "mode")
+	{
+		Mode mode;
+		if (value == "queue")
+			mode = MODE_QUEUE;
+		else if (value == "ringBuffer")
+			mode = MODE_RING_BUFFER;
+		else
+			throw InvalidArgumentException("AsyncChannel mode", value);
+
+		FastMutex::ScopedLock lock(_threadMutex);
+		if (mode != _mode && _thread.isRunning())
+			throw IllegalStateException("Cannot change the mode of a running AsyncChannel");
+		_mode = mode;
+	}
+	else if (name == "overflowPolicy")
+	{
+		OverflowPolicy policy;
+		if (value == "block")
+			policy = OVERFLOW_BLOCK;
+		else if (value == "drop")
+			policy = OVERFLOW_DROP;
+		else if (value == "dropOldest")
+			policy = OVERFLOW_DROP_OLDEST;
+		else
+			throw InvalidArgumentException("AsyncChannel overflow policy", value);
+
+		FastMutex::ScopedLock lock(_buffersMutex);
+		if (policy != _overflowPolicy && !_buffers.empty())
+			throw IllegalStateException("Cannot change the overflow policy of an AsyncChannel in use");
+		_overflowPolicy = policy;
+	}
 	else
 	{
 		Channel::setProperty(name, value);
@@ -209,16 +424,132 @@ void AsyncChannel::run()
 #endif
 	}
 
-	AutoPtr<Notification> nf = _queue.waitDequeueNotification();
-	while (nf)
+	if (_mode == MODE_RING_BUFFER)
+	{
+		runRingBuffer();
+		return;
+	}
+
+	// drain the queue in batches, so that a burst of messages
+	// costs one queue lock and one channel lock per batch
+	std::vector<Notification::Ptr> batch;
+	batch.reserve(BATCH_SIZE);
+	while (_queue.waitDequeueBatch(batch, BATCH_SIZE) > 0)
 	{
-		MessageNotification* pNf = dynamic_cast<MessageNotification*>(nf.get());
 		{
 			FastMutex::ScopedLock lock(_channelMutex);
 
-			if (pNf && _pChannel) _pChannel->log(pNf->message());
+			for (const auto& pNf: batch)
+			{
+				const MessageNotification* pMsgNf = dynamic_cast<const MessageNotification*>(pNf.get());
+				if (pMsgNf && _pChannel) _pChannel->log(pMsgNf->message());
+			}
 		}
-		nf = _queue.waitDequeueNotification();
+		batch.clear();
+	}
+}
+
+
+void AsyncChannel::runRingBuffer()
+{
+	struct Source
+	{
+		BufferPtr pBuffer;
+		Message message;
+		bool pending = false;
+	};
+
+	std::vector<Source> sources;
+	std::size_t version = 0;
+	for (;;)
+	{
+		// read before the buffers are drained, so that messages
+		// logged before close() are delivered in this pass
+		const bool closed = _closed;
+
+		// pick up ring buffers of threads that started logging
+		if (_buffersVersion.load() != version)
+		{
+			FastMutex::ScopedLock lock(_buffersMutex);
+
+			version = _buffersVersion.load();
+			for (const auto& pBuffer: _buffers)
+			{
+				if (std::none_of(sources.begin(), sources.end(), [&](const Source& s) { return s.pBuffer == pBuffer; }))
+				{
+					sources.emplace_back();
+					sources.back().pBuffer = pBuffer;
+				}
+			}
+		}
+
+		for (auto& source: sources)
+		{
+			if (!source.pending) source.pending = source.pBuffer->tryPop(source.message);
+		}
+
+		// deliver the pending messages in timestamp order, in batches
+		// so that the channel lock is released from time to time
+		std::size_t count = 0;
+		{
+			FastMutex::ScopedLock lock(_channelMutex);
+
+			while (count < BATCH_SIZE)
+			{
+				Source* pNext = nullptr;
+				for (auto& source: sources)
+				{
+					if (source.pending && (!pNext || source.message.getTime() < pNext->message.getTime()))
+						pNext = &source;
+				}
+				if (!pNext) break;
+
+				if (_pChannel)
+				{
+					const std::size_t dropCount = pNext->pBuffer->dropCount.exchange(0);
+					if (dropCount != 0)
+						_pChannel->log(Message(pNext->message, Poco::format("Dropped %z messages.", dropCount)));
+					_pChannel->log(pNext->message);
+				}
+				pNext->pending = pNext->pBuffer->tryPop(pNext->message);
+				++count;
+			}
+		}
+		if (count > 0)
+		{
+			// pairs with the increment in logRingBuffer()
+			if (_blocked.load() != 0)
+			{
+				FastMutex::ScopedLock lock(_blockedMutex);
+				_spaceAvailable.broadcast();
+			}
+			continue;
+		}
+
+		// release ring buffers of terminated threads
+		auto it = std::partition(sources.begin(), sources.end(), [](const Source& s)
+			{
+				return !s.pBuffer->abandoned || !s.pBuffer->empty();
+			});
+		if (it != sources.end())
+		{
+			FastMutex::ScopedLock lock(_buffersMutex);
+
+			for (auto itSource = it; itSource != sources.end(); ++itSource)
+			{
+				_buffers.erase(std::remove(_buffers.begin(), _buffers.end(), itSource->pBuffer), _buffers.end());
+			}
+			sources.erase(it, sources.end());
+		}
+
+		if (closed) break;
+
+		_idle.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const bool empty = _buffersVersion.load() == version &&
+			std::all_of(sources.begin(), sources.end(), [](const Source& s) { return s.pBuffer->empty(); });
+		if (empty) _wakeUp.tryWait(IDLE_TIMEOUT);
+		_idle.store(false, std::memory_order_relaxed);
 	}
 }
 
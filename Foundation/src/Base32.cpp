@@ -0,0 +1,152 @@
+//
+// Base32.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base32.h"
+#include "Poco/Base32Decoder.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <cstring>
+
+
+namespace Poco {
+
+
+namespace
+{
+	inline bool hasPadding(const unsigned char* p)
+		/// Returns true if any of the 8 characters at p is a padding character.
+	{
+		UInt64 x;
+		std::memcpy(&x, p, sizeof(x));
+		x ^= 0x3D3D3D3D3D3D3D3DULL;
+		return ((x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL) != 0;
+	}
+}
+
+
+std::size_t Base32::encode(const void* data, std::size_t length, char* out, int options)
+{
+	const unsigned char* alphabet = Base32EncoderBuf::encoding(options);
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	char* q = out;
+
+	while (end - p >= 5)
+	{
+		const UInt64 group = (UInt64(p[0]) << 32) | (UInt64(p[1]) << 24) | (UInt64(p[2]) << 16) | (UInt64(p[3]) << 8) | p[4];
+		q[0] = alphabet[(group >> 35) & 0x1F];
+		q[1] = alphabet[(group >> 30) & 0x1F];
+		q[2] = alphabet[(group >> 25) & 0x1F];
+		q[3] = alphabet[(group >> 20) & 0x1F];
+		q[4] = alphabet[(group >> 15) & 0x1F];
+		q[5] = alphabet[(group >> 10) & 0x1F];
+		q[6] = alphabet[(group >> 5) & 0x1F];
+		q[7] = alphabet[group & 0x1F];
+		p += 5;
+		q += 8;
+	}
+
+	const std::size_t rest = end - p;
+	if (rest > 0)
+	{
+		static const int CHARS[5] = {0, 2, 4, 5, 7};
+
+		UInt64 group = 0;
+		for (std::size_t i = 0; i < rest; i++) group |= UInt64(p[i]) << (32 - 8*i);
+		for (int i = 0; i < CHARS[rest]; i++) *q++ = alphabet[(group >> (35 - 5*i)) & 0x1F];
+		if (options & BASE32_USE_PADDING)
+		{
+			for (int i = CHARS[rest]; i < 8; i++) *q++ = '=';
+		}
+	}
+	return q - out;
+}
+
+
+std::string Base32::encode(std::string_view data, int options)
+{
+	std::string result(encodedLength(data.size(), options), '\0');
+	encode(data.data(), data.size(), result.data(), options);
+	return result;
+}
+
+
+std::size_t Base32::decode(const char* data, std::size_t length, void* out, int options)
+{
+	const unsigned char* table = Base32DecoderBuf::encoding(options);
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	unsigned char* q = static_cast<unsigned char*>(out);
+
+	while (p < end)
+	{
+		while (end - p >= 8 && !hasPadding(p))
+		{
+			UInt64 group = 0;
+			UInt64 error = 0;
+			for (int i = 0; i < 8; i++)
+			{
+				const UInt64 value = table[p[i]];
+				error |= value;
+				group = (group << 5) | (value & 0x1F);
+			}
+			if (error & 0x80) throw DataFormatException("Invalid Base32 character");
+
+			q[0] = static_cast<unsigned char>(group >> 32);
+			q[1] = static_cast<unsigned char>(group >> 24);
+			q[2] = static_cast<unsigned char>(group >> 16);
+			q[3] = static_cast<unsigned char>(group >> 8);
+			q[4] = static_cast<unsigned char>(group);
+			p += 8;
+			q += 5;
+		}
+		if (p == end) break;
+
+		// a group with padding, or the final incomplete group;
+		// per RFC 4648, Section 6, groups of 2, 4, 5 and 7 characters
+		// (followed by padding) are permissible
+		static const int BYTES[9] = {-1, -1, 1, -1, 2, 3, -1, 4, 5};
+
+		const std::size_t n = std::min<std::size_t>(8, end - p);
+		std::size_t chars = 0;
+		UInt64 group = 0;
+		while (chars < n && p[chars] != '=')
+		{
+			const unsigned char value = table[p[chars]];
+			if (value == 0xFF) throw DataFormatException("Invalid Base32 character");
+			group |= UInt64(value) << (35 - 5*chars);
+			++chars;
+		}
+		for (std::size_t i = chars; i < n; i++)
+		{
+			if (p[i] != '=') throw DataFormatException("Invalid Base32 padding");
+		}
+		if ((chars < n && n < 8) || BYTES[chars] < 0) throw DataFormatException("Incomplete Base32 data");
+
+		for (int i = 0; i < BYTES[chars]; i++) *q++ = static_cast<unsigned char>(group >> (32 - 8*i));
+		p += n;
+	}
+	return q - static_cast<unsigned char*>(out);
+}
+
+
+std::string Base32::decode(std::string_view data, int options)
+{
+	std::string result(decodedLength(data.size()), '\0');
+	result.resize(decode(data.data(), data.size(), result.data(), options));
+	return result;
+}
+
+
+} // namespace Poco
@@ -13,8 +13,9 @@
 
 
 #include "Poco/Base32Decoder.h"
-#include "Poco/Base32Encoder.h"
+#include "Poco/Base32.h"
 #include "Poco/Exception.h"
+#include <algorithm>
 #include <cstring>
 
 
@@ -133,10 +134,12 @@ const unsigned char Base32DecoderBuf::REVERSE_CROCKFORD_ENCODING[256] =
 
 
 Base32DecoderBuf::Base32DecoderBuf(std::istream& istr, int options):
-	_groupLength(0),
-	_groupIndex(0),
-	_buf(*istr.rdbuf()),
-	_encoding(encoding(options))
+	_options(options),
+	_encodedLength(0),
+	_decodedLength(0),
+	_decodedIndex(0),
+	_error(false),
+	_buf(*istr.rdbuf())
 {
 }
 
@@ -148,74 +151,99 @@ Base32DecoderBuf::~Base32DecoderBuf()
 
 int Base32DecoderBuf::readFromDevice()
 {
-	if (_groupIndex < _groupLength)
-	{
-		return _group[_groupIndex++];
-	}
-	else
+	if (_decodedIndex == _decodedLength && !decodeBlock()) return -1;
+
+	return static_cast<unsigned char>(_decoded[_decodedIndex++]);
+}
+
+
+std::streamsize Base32DecoderBuf::xsgetn(char* s, std::streamsize n)
+{
+	if (n <= 0) return 0;
+
+	// the first character may have been peeked at or put back
+	const int c = uflow();
+	if (c == std::char_traits<char>::eof()) return 0;
+	*s = static_cast<char>(c);
+
+	std::streamsize copied = 1;
+	while (copied < n)
 	{
-		unsigned char buffer[8];
-		std::memset(buffer, '=', sizeof(buffer));
-		int c;
-
-		// per RFC-4648, Section 6, permissible block lengths are:
-		// 2, 4, 5, 7, and 8 bytes. Any other length is malformed.
-		//
-		do 
-		{
-			if ((c = readOne()) == -1) return -1;
-			buffer[0] = (unsigned char) c;
-			if (_encoding[buffer[0]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[1] = (unsigned char) c;
-			if (_encoding[buffer[1]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[2] = (unsigned char) c;
-			if (_encoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[3] = (unsigned char) c;
-			if (_encoding[buffer[3]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[4] = (unsigned char) c;
-			if (_encoding[buffer[4]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[5] = (unsigned char) c;
-			if (_encoding[buffer[5]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[6] = (unsigned char) c;
-			if (_encoding[buffer[6]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) break;
-			buffer[7] = (unsigned char) c;
-			if (_encoding[buffer[7]] == 0xFF) throw DataFormatException();
-		} 
-		while (false);
-
-		_group[0] = (_encoding[buffer[0]] << 3) | (_encoding[buffer[1]] >> 2);
-		_group[1] = ((_encoding[buffer[1]] & 0x03) << 6) | (_encoding[buffer[2]] << 1) | (_encoding[buffer[3]] >> 4);
-		_group[2] = ((_encoding[buffer[3]] & 0x0F) << 4) | (_encoding[buffer[4]] >> 1);
-		_group[3] = ((_encoding[buffer[4]] & 0x01) << 7) | (_encoding[buffer[5]] << 2) | (_encoding[buffer[6]] >> 3);
-		_group[4] = ((_encoding[buffer[6]] & 0x07) << 5) | _encoding[buffer[7]];
-
-		if (buffer[2] == '=')
-			_groupLength = 1;
-		else if (buffer[4] == '=')
-			_groupLength = 2;
-		else if (buffer[5] == '=')
-			_groupLength = 3;
-		else if (buffer[7] == '=')
-			_groupLength = 4;
-		else
-			_groupLength = 5;
-		_groupIndex = 1;
-		return _group[0];
+		if (_decodedIndex == _decodedLength && !decodeBlock()) break;
+
+		const std::size_t length = std::min<std::size_t>(n - copied, _decodedLength - _decodedIndex);
+		std::memcpy(s + copied, _decoded + _decodedIndex, length);
+		_decodedIndex += length;
+		copied += length;
 	}
+	return copied;
 }
 
 
-int Base32DecoderBuf::readOne()
+bool Base32DecoderBuf::decodeBlock()
 {
-	int ch = _buf.sbumpc();
-	return ch;
+	static const int eof = std::char_traits<char>::eof();
+
+	if (_error) throw DataFormatException();
+
+	_decodedIndex = 0;
+	_decodedLength = 0;
+	while (_decodedLength == 0)
+	{
+		// read as many characters as are available without blocking,
+		// but at least one
+		char* p = _encoded + _encodedLength;
+		std::streamsize n = _buf.in_avail();
+		if (n > 0)
+		{
+			n = _buf.sgetn(p, std::min<std::streamsize>(n, BUFFER_SIZE - _encodedLength));
+		}
+		else
+		{
+			const int c = _buf.sbumpc();
+			if (c == eof)
+			{
+				// per RFC-4648, Section 6, the final group may be incomplete
+				const std::size_t length = _encodedLength;
+				_encodedLength = 0;
+				if (length == 0) return false;
+				_decodedLength = Base32::decode(_encoded, length, _decoded, _options);
+				return _decodedLength > 0;
+			}
+			*p = static_cast<char>(c);
+			n = 1;
+		}
+		_encodedLength += n;
+
+		const std::size_t length = _encodedLength & ~std::size_t(7);
+		if (length > 0)
+		{
+			try
+			{
+				_decodedLength = Base32::decode(_encoded, length, _decoded, _options);
+			}
+			catch (DataFormatException&)
+			{
+				// return the data preceding the invalid group first
+				for (std::size_t i = 0; i < length; i += 8)
+				{
+					try
+					{
+						_decodedLength += Base32::decode(_encoded + i, 8, _decoded + _decodedLength, _options);
+					}
+					catch (DataFormatException&)
+					{
+						break;
+					}
+				}
+				_error = true;
+				if (_decodedLength == 0) throw;
+			}
+			_encodedLength -= length;
+			std::memmove(_encoded, _encoded + length, _encodedLength);
+		}
+	}
+	return true;
 }
 
 
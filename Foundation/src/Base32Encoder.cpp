@@ -13,6 +13,8 @@
 
 
 #include "Poco/Base32Encoder.h"
+#include "Poco/Base32.h"
+#include <algorithm>
 
 
 namespace Poco {
@@ -46,6 +48,7 @@ const unsigned char Base32EncoderBuf::CROCKFORD_ENCODING[32] =
 
 
 Base32EncoderBuf::Base32EncoderBuf(std::ostream& ostr, int options):
+	_options(options),
 	_groupLength(0),
 	_buf(*ostr.rdbuf()),
 	_doPadding((options & BASE32_USE_PADDING) != 0),
@@ -96,6 +99,36 @@ int Base32EncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize Base32EncoderBuf::xsputn(const char* s, std::streamsize n)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	std::streamsize written = 0;
+	while (_groupLength > 0 && written < n)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+
+	// encode complete groups in blocks
+	char buffer[4096];
+	while (n - written >= 5)
+	{
+		const std::size_t groups = std::min(static_cast<std::size_t>(n - written)/5, sizeof(buffer)/8);
+		const std::size_t length = Base32::encode(s + written, groups*5, buffer, _options);
+		if (_buf.sputn(buffer, length) != static_cast<std::streamsize>(length)) return written;
+		written += groups*5;
+	}
+
+	while (written < n)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	return written;
+}
+
+
 int Base32EncoderBuf::close()
 {
 	static const int eof = std::char_traits<char>::eof();
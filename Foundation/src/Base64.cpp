@@ -0,0 +1,436 @@
+//
+// Base64.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base64.h"
+#include "Poco/Exception.h"
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_BASE64_SSE2
+	#include <emmintrin.h>
+	#if defined(__SSSE3__) || defined(__AVX__)
+		#define POCO_BASE64_SSSE3
+		#define POCO_BASE64_SSSE3_TARGET
+		#include <tmmintrin.h>
+	#elif defined(__GNUC__)
+		#define POCO_BASE64_SSSE3
+		#define POCO_BASE64_SSSE3_DISPATCH
+		#define POCO_BASE64_SSSE3_TARGET __attribute__((target("ssse3")))
+		#include <tmmintrin.h>
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_BASE64_NEON
+	#include <arm_neon.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	constexpr char ALPHABET_URL[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+	enum : unsigned char
+	{
+		INVALID    = 0xFF,
+		PADDING    = 0xFE,
+		WHITESPACE = 0xFD
+	};
+
+	struct DecodingTable
+	{
+		unsigned char values[256];
+	};
+
+	constexpr DecodingTable makeDecodingTable(const char* alphabet, bool skipWhitespace)
+	{
+		DecodingTable table{};
+		for (int i = 0; i < 256; i++) table.values[i] = INVALID;
+		for (int i = 0; i < 64; i++) table.values[static_cast<unsigned char>(alphabet[i])] = static_cast<unsigned char>(i);
+		table.values[static_cast<unsigned char>('=')] = PADDING;
+		if (skipWhitespace)
+		{
+			table.values[static_cast<unsigned char>(' ')] = WHITESPACE;
+			table.values[static_cast<unsigned char>('\t')] = WHITESPACE;
+			table.values[static_cast<unsigned char>('\r')] = WHITESPACE;
+			table.values[static_cast<unsigned char>('\n')] = WHITESPACE;
+		}
+		return table;
+	}
+
+	constexpr DecodingTable DECODING = makeDecodingTable(ALPHABET, true);
+	constexpr DecodingTable DECODING_URL = makeDecodingTable(ALPHABET_URL, false);
+
+
+#if defined(POCO_BASE64_SSSE3)
+
+	POCO_BASE64_SSSE3_TARGET std::size_t encodeSSSE3(const unsigned char* p, std::size_t length, char* q, const char* alphabet)
+		/// Encodes 12 bytes per iteration. Reads 16 bytes per iteration,
+		/// so at least 4 bytes of input are always left for the caller.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+
+		const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+		const __m128i mask0 = _mm_set1_epi32(0x0FC0FC00);
+		const __m128i mult0 = _mm_set1_epi32(0x04000040);
+		const __m128i mask1 = _mm_set1_epi32(0x003F03F0);
+		const __m128i mult1 = _mm_set1_epi32(0x01000010);
+		const __m128i shiftUpper = _mm_set1_epi8('A');
+		const __m128i shiftLower = _mm_set1_epi8(('a' - 26) - 'A');
+		const __m128i shiftDigit = _mm_set1_epi8(static_cast<char>(('0' - 52) - ('a' - 26)));
+		const __m128i shift62 = _mm_set1_epi8(static_cast<char>(alphabet[62] - 62 - ('0' - 52)));
+		const __m128i shift63 = _mm_set1_epi8(static_cast<char>(alphabet[63] - 63 - ('0' - 52)));
+
+		while (end - p >= 16)
+		{
+			// spread every three bytes over four bytes, then move each
+			// 6-bit index into its own byte
+			__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			in = _mm_shuffle_epi8(in, shuffle);
+			const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, mask0), mult0);
+			const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, mask1), mult1);
+			const __m128i indices = _mm_or_si128(t0, t1);
+
+			__m128i shift = shiftUpper;
+			shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(25)), shiftLower));
+			shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(51)), shiftDigit));
+			shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpeq_epi8(indices, _mm_set1_epi8(62)), shift62));
+			shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpeq_epi8(indices, _mm_set1_epi8(63)), shift63));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q), _mm_add_epi8(indices, shift));
+
+			p += 12;
+			q += 16;
+		}
+		return p - begin;
+	}
+
+#endif // POCO_BASE64_SSSE3
+
+
+#if defined(POCO_BASE64_SSE2)
+
+	std::size_t decodeSSE2(const unsigned char* p, std::size_t length, unsigned char* q, const char* alphabet)
+		/// Decodes 16 characters per iteration. Stops at the first block
+		/// containing anything but alphabet characters.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+
+		const __m128i char62 = _mm_set1_epi8(alphabet[62]);
+		const __m128i char63 = _mm_set1_epi8(alphabet[63]);
+		const __m128i shiftUpper = _mm_set1_epi8(-'A');
+		const __m128i shiftLower = _mm_set1_epi8(26 - 'a');
+		const __m128i shiftDigit = _mm_set1_epi8(52 - '0');
+		const __m128i shift62 = _mm_set1_epi8(static_cast<char>(62 - alphabet[62]));
+		const __m128i shift63 = _mm_set1_epi8(static_cast<char>(63 - alphabet[63]));
+		const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+		const __m128i mult = _mm_set1_epi32(0x00011000);
+
+		alignas(16) UInt32 groups[4];
+		while (end - p >= 16)
+		{
+			// characters >= 0x80 compare as negative numbers and are rejected
+			const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+			const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+			const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+			const __m128i is62 = _mm_cmpeq_epi8(in, char62);
+			const __m128i is63 = _mm_cmpeq_epi8(in, char63);
+			const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is62)), is63);
+			if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+
+			__m128i shift = _mm_and_si128(upper, shiftUpper);
+			shift = _mm_or_si128(shift, _mm_and_si128(lower, shiftLower));
+			shift = _mm_or_si128(shift, _mm_and_si128(digit, shiftDigit));
+			shift = _mm_or_si128(shift, _mm_and_si128(is62, shift62));
+			shift = _mm_or_si128(shift, _mm_and_si128(is63, shift63));
+			const __m128i values = _mm_add_epi8(in, shift);
+
+			// merge the four 6-bit values of every 32-bit lane into 24 bits
+			const __m128i pairs = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, lowBytes), 6), _mm_srli_epi16(values, 8));
+			_mm_store_si128(reinterpret_cast<__m128i*>(groups), _mm_madd_epi16(pairs, mult));
+			for (int i = 0; i < 4; i++)
+			{
+				q[0] = static_cast<unsigned char>(groups[i] >> 16);
+				q[1] = static_cast<unsigned char>(groups[i] >> 8);
+				q[2] = static_cast<unsigned char>(groups[i]);
+				q += 3;
+			}
+			p += 16;
+		}
+		return p - begin;
+	}
+
+#endif // POCO_BASE64_SSE2
+
+
+#if defined(POCO_BASE64_NEON)
+
+	std::size_t encodeNEON(const unsigned char* p, std::size_t length, char* q, const char* alphabet)
+		/// Encodes 48 bytes per iteration.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+		const unsigned char* a = reinterpret_cast<const unsigned char*>(alphabet);
+
+		uint8x16x4_t table;
+		table.val[0] = vld1q_u8(a);
+		table.val[1] = vld1q_u8(a + 16);
+		table.val[2] = vld1q_u8(a + 32);
+		table.val[3] = vld1q_u8(a + 48);
+		const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+		while (end - p >= 48)
+		{
+			const uint8x16x3_t in = vld3q_u8(p);
+			uint8x16x4_t out;
+			out.val[0] = vshrq_n_u8(in.val[0], 2);
+			out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+			out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+			out.val[3] = vandq_u8(in.val[2], mask);
+			out.val[0] = vqtbl4q_u8(table, out.val[0]);
+			out.val[1] = vqtbl4q_u8(table, out.val[1]);
+			out.val[2] = vqtbl4q_u8(table, out.val[2]);
+			out.val[3] = vqtbl4q_u8(table, out.val[3]);
+			vst4q_u8(reinterpret_cast<unsigned char*>(q), out);
+
+			p += 48;
+			q += 64;
+		}
+		return p - begin;
+	}
+
+
+	std::size_t decodeNEON(const unsigned char* p, std::size_t length, unsigned char* q, const DecodingTable& decoding)
+		/// Decodes 64 characters per iteration. Stops at the first block
+		/// containing anything but alphabet characters.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+
+		uint8x16x4_t tableLow;
+		uint8x16x4_t tableHigh;
+		for (int i = 0; i < 4; i++)
+		{
+			tableLow.val[i] = vld1q_u8(decoding.values + 16*i);
+			tableHigh.val[i] = vld1q_u8(decoding.values + 64 + 16*i);
+		}
+		const uint8x16_t offset = vdupq_n_u8(64);
+
+		while (end - p >= 64)
+		{
+			const uint8x16x4_t in = vld4q_u8(p);
+			uint8x16x4_t values;
+			uint8x16_t error = vdupq_n_u8(0);
+			for (int i = 0; i < 4; i++)
+			{
+				// characters 0-63 are looked up in tableLow, 64-127 in tableHigh;
+				// characters >= 128 are caught by the error check
+				values.val[i] = vqtbx4q_u8(vqtbl4q_u8(tableLow, in.val[i]), tableHigh, vsubq_u8(in.val[i], offset));
+				error = vorrq_u8(error, vorrq_u8(values.val[i], in.val[i]));
+			}
+			if (vmaxvq_u8(error) & 0x80) break;
+
+			uint8x16x3_t out;
+			out.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+			out.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+			out.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+			vst3q_u8(q, out);
+
+			p += 64;
+			q += 48;
+		}
+		return p - begin;
+	}
+
+#endif // POCO_BASE64_NEON
+
+
+	std::size_t encodeBlocks(const unsigned char* p, std::size_t length, char* q, const char* alphabet)
+		/// Encodes as many bytes as possible (always a multiple of three)
+		/// with SIMD instructions, and returns the number of bytes encoded.
+	{
+#if defined(POCO_BASE64_SSSE3_DISPATCH)
+		static const bool haveSSSE3 = __builtin_cpu_supports("ssse3");
+		return haveSSSE3 ? encodeSSSE3(p, length, q, alphabet) : 0;
+#elif defined(POCO_BASE64_SSSE3)
+		return encodeSSSE3(p, length, q, alphabet);
+#elif defined(POCO_BASE64_NEON)
+		return encodeNEON(p, length, q, alphabet);
+#else
+		return 0;
+#endif
+	}
+
+
+	std::size_t decodeBlocks(const unsigned char* p, std::size_t length, unsigned char* q, const char* alphabet, const DecodingTable& decoding)
+		/// Decodes as many characters as possible (always a multiple of four)
+		/// with SIMD instructions, and returns the number of characters decoded.
+	{
+#if defined(POCO_BASE64_SSE2)
+		return decodeSSE2(p, length, q, alphabet);
+#elif defined(POCO_BASE64_NEON)
+		return decodeNEON(p, length, q, decoding);
+#else
+		return 0;
+#endif
+	}
+
+
+	std::size_t decodeGroup(const unsigned char* values, unsigned char* q)
+		/// Decodes a group of four values, which may include padding
+		/// at the end, and returns the number of bytes written.
+	{
+		if (values[0] == PADDING || values[1] == PADDING || (values[2] == PADDING && values[3] != PADDING))
+			throw DataFormatException("Invalid Base64 padding");
+
+		const UInt32 c = values[2] == PADDING ? 0 : values[2];
+		const UInt32 d = values[3] == PADDING ? 0 : values[3];
+		const UInt32 group = (UInt32(values[0]) << 18) | (UInt32(values[1]) << 12) | (c << 6) | d;
+		q[0] = static_cast<unsigned char>(group >> 16);
+		if (values[2] == PADDING) return 1;
+		q[1] = static_cast<unsigned char>(group >> 8);
+		if (values[3] == PADDING) return 2;
+		q[2] = static_cast<unsigned char>(group);
+		return 3;
+	}
+}
+
+
+std::size_t Base64::encode(const void* data, std::size_t length, char* out, int options)
+{
+	const char* alphabet = (options & BASE64_URL_ENCODING) ? ALPHABET_URL : ALPHABET;
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	char* q = out;
+
+	const std::size_t n = encodeBlocks(p, length, q, alphabet);
+	p += n;
+	q += (n/3)*4;
+
+	while (end - p >= 3)
+	{
+		const UInt32 group = (UInt32(p[0]) << 16) | (UInt32(p[1]) << 8) | p[2];
+		q[0] = alphabet[group >> 18];
+		q[1] = alphabet[(group >> 12) & 0x3F];
+		q[2] = alphabet[(group >> 6) & 0x3F];
+		q[3] = alphabet[group & 0x3F];
+		p += 3;
+		q += 4;
+	}
+
+	if (end - p == 1)
+	{
+		*q++ = alphabet[p[0] >> 2];
+		*q++ = alphabet[(p[0] & 0x03) << 4];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			*q++ = '=';
+			*q++ = '=';
+		}
+	}
+	else if (end - p == 2)
+	{
+		*q++ = alphabet[p[0] >> 2];
+		*q++ = alphabet[((p[0] & 0x03) << 4) | (p[1] >> 4)];
+		*q++ = alphabet[(p[1] & 0x0F) << 2];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			*q++ = '=';
+		}
+	}
+	return q - out;
+}
+
+
+std::string Base64::encode(std::string_view data, int options)
+{
+	std::string result(encodedLength(data.size(), options), '\0');
+	encode(data.data(), data.size(), result.data(), options);
+	return result;
+}
+
+
+std::size_t Base64::decode(const char* data, std::size_t length, void* out, int options)
+{
+	const char* alphabet = (options & BASE64_URL_ENCODING) ? ALPHABET_URL : ALPHABET;
+	const DecodingTable& decoding = (options & BASE64_URL_ENCODING) ? DECODING_URL : DECODING;
+	const unsigned char* table = decoding.values;
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	unsigned char* q = static_cast<unsigned char*>(out);
+
+	unsigned char group[4];
+	int groupLength = 0;
+	while (p < end)
+	{
+		if (groupLength == 0)
+		{
+			const std::size_t n = decodeBlocks(p, end - p, q, alphabet, decoding);
+			p += n;
+			q += (n/4)*3;
+
+			while (end - p >= 4)
+			{
+				const UInt32 a = table[p[0]];
+				const UInt32 b = table[p[1]];
+				const UInt32 c = table[p[2]];
+				const UInt32 d = table[p[3]];
+				if ((a | b | c | d) & 0x80) break;
+
+				const UInt32 value = (a << 18) | (b << 12) | (c << 6) | d;
+				q[0] = static_cast<unsigned char>(value >> 16);
+				q[1] = static_cast<unsigned char>(value >> 8);
+				q[2] = static_cast<unsigned char>(value);
+				p += 4;
+				q += 3;
+			}
+			if (p == end) break;
+		}
+
+		// whitespace, padding or invalid characters
+		const unsigned char value = table[*p++];
+		if (value == WHITESPACE) continue;
+		if (value == INVALID) throw DataFormatException("Invalid Base64 character");
+		group[groupLength++] = value;
+		if (groupLength == 4)
+		{
+			q += decodeGroup(group, q);
+			groupLength = 0;
+		}
+	}
+
+	if (groupLength > 0)
+	{
+		if (groupLength == 1 || !(options & BASE64_NO_PADDING))
+			throw DataFormatException("Incomplete Base64 data");
+		while (groupLength < 4) group[groupLength++] = PADDING;
+		q += decodeGroup(group, q);
+	}
+	return q - static_cast<unsigned char*>(out);
+}
+
+
+std::string Base64::decode(std::string_view data, int options)
+{
+	std::string result(decodedLength(data.size()), '\0');
+	result.resize(decode(data.data(), data.size(), result.data(), options));
+	return result;
+}
+
+
+} // namespace Poco
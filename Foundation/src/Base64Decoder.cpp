@@ -13,66 +13,23 @@
 
 
 #include "Poco/Base64Decoder.h"
-#include "Poco/Base64Encoder.h"
+#include "Poco/Base64.h"
 #include "Poco/Exception.h"
-#include "Poco/Mutex.h"
+#include <algorithm>
+#include <cstring>
 
 
 namespace Poco {
 
 
-unsigned char Base64DecoderBuf::IN_ENCODING[256];
-bool Base64DecoderBuf::IN_ENCODING_INIT = false;
-unsigned char Base64DecoderBuf::IN_ENCODING_URL[256];
-bool Base64DecoderBuf::IN_ENCODING_URL_INIT = false;
-
-
-namespace
-{
-	static FastMutex mutex;
-}
-
-
 Base64DecoderBuf::Base64DecoderBuf(std::istream& istr, int options):
 	_options(options),
-	_groupLength(0),
-	_groupIndex(0),
-	_buf(*istr.rdbuf()),
-	_pInEncoding((options & BASE64_URL_ENCODING) ? IN_ENCODING_URL : IN_ENCODING)
+	_encodedLength(0),
+	_decodedLength(0),
+	_decodedIndex(0),
+	_error(false),
+	_buf(*istr.rdbuf())
 {
-	FastMutex::ScopedLock lock(mutex);
-	if (options & BASE64_URL_ENCODING)
-	{
-		if (!IN_ENCODING_URL_INIT)
-		{
-			for (unsigned i = 0; i < sizeof(IN_ENCODING_URL); i++)
-			{
-				IN_ENCODING_URL[i] = 0xFF;
-			}
-			for (unsigned i = 0; i < sizeof(Base64EncoderBuf::OUT_ENCODING_URL); i++)
-			{
-				IN_ENCODING_URL[Base64EncoderBuf::OUT_ENCODING_URL[i]] = static_cast<UInt8>(i);
-			}
-			IN_ENCODING_URL[static_cast<unsigned char>('=')] = '\0';
-			IN_ENCODING_URL_INIT = true;
-		}
-	}
-	else
-	{
-		if (!IN_ENCODING_INIT)
-		{
-			for (unsigned i = 0; i < sizeof(IN_ENCODING); i++)
-			{
-				IN_ENCODING[i] = 0xFF;
-			}
-			for (unsigned i = 0; i < sizeof(Base64EncoderBuf::OUT_ENCODING); i++)
-			{
-				IN_ENCODING[Base64EncoderBuf::OUT_ENCODING[i]] = static_cast<UInt8>(i);
-			}
-			IN_ENCODING[static_cast<unsigned char>('=')] = '\0';
-			IN_ENCODING_INIT = true;
-		}
-	}
 }
 
 
@@ -83,68 +40,111 @@ Base64DecoderBuf::~Base64DecoderBuf()
 
 int Base64DecoderBuf::readFromDevice()
 {
-	if (_groupIndex < _groupLength)
+	if (_decodedIndex == _decodedLength && !decodeBlock()) return -1;
+
+	return static_cast<unsigned char>(_decoded[_decodedIndex++]);
+}
+
+
+std::streamsize Base64DecoderBuf::xsgetn(char* s, std::streamsize n)
+{
+	if (n <= 0) return 0;
+
+	// the first character may have been peeked at or put back
+	const int c = uflow();
+	if (c == std::char_traits<char>::eof()) return 0;
+	*s = static_cast<char>(c);
+
+	std::streamsize copied = 1;
+	while (copied < n)
 	{
-		return _group[_groupIndex++];
+		if (_decodedIndex == _decodedLength && !decodeBlock()) break;
+
+		const std::size_t length = std::min<std::size_t>(n - copied, _decodedLength - _decodedIndex);
+		std::memcpy(s + copied, _decoded + _decodedIndex, length);
+		_decodedIndex += length;
+		copied += length;
 	}
-	else
+	return copied;
+}
+
+
+bool Base64DecoderBuf::decodeBlock()
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	if (_error) throw DataFormatException();
+
+	_decodedIndex = 0;
+	_decodedLength = 0;
+	while (_decodedLength == 0)
 	{
-		unsigned char buffer[4];
-		int c;
-		if ((c = readOne()) == -1) return -1;
-		buffer[0] = static_cast<UInt8>(c);
-		if (_pInEncoding[buffer[0]] == 0xFF) throw DataFormatException();
-		if ((c = readOne()) == -1) return -1;
-		buffer[1] = static_cast<UInt8>(c);
-		if (_pInEncoding[buffer[1]] == 0xFF) throw DataFormatException();
-		if (_options & BASE64_NO_PADDING)
+		// read as many characters as are available without blocking,
+		// but at least one
+		char* p = _encoded + _encodedLength;
+		std::streamsize n = _buf.in_avail();
+		if (n > 0)
 		{
-			if ((c = readOne()) != -1)
-				buffer[2] = static_cast<UInt8>(c);
-			else
-				buffer[2] = '=';
-			if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) != -1)
-				buffer[3] = static_cast<UInt8>(c);
-			else
-				buffer[3] = '=';
-			if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
+			n = _buf.sgetn(p, std::min<std::streamsize>(n, BUFFER_SIZE - _encodedLength));
 		}
 		else
 		{
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[2] = static_cast<UInt8>(c);
-			if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[3] = static_cast<UInt8>(c);
-			if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
+			const int c = _buf.sbumpc();
+			if (c == eof)
+			{
+				// a single trailing character is ignored
+				const std::size_t length = _encodedLength;
+				_encodedLength = 0;
+				if (length < 2) return false;
+				if (!(_options & BASE64_NO_PADDING)) throw DataFormatException();
+				_decodedLength = Base64::decode(_encoded, length, _decoded, _options);
+				return true;
+			}
+			*p = static_cast<char>(c);
+			n = 1;
 		}
 
-		_group[0] = (_pInEncoding[buffer[0]] << 2) | (_pInEncoding[buffer[1]] >> 4);
-		_group[1] = ((_pInEncoding[buffer[1]] & 0x0F) << 4) | (_pInEncoding[buffer[2]] >> 2);
-		_group[2] = (_pInEncoding[buffer[2]] << 6) | _pInEncoding[buffer[3]];
-
-		if (buffer[2] == '=')
-			_groupLength = 1;
-		else if (buffer[3] == '=')
-			_groupLength = 2;
-		else
-			_groupLength = 3;
-		_groupIndex = 1;
-		return _group[0];
-	}
-}
-
+		if (!(_options & BASE64_URL_ENCODING))
+		{
+			char* end = p + n;
+			char* q = p;
+			for (; p < end; ++p)
+			{
+				if (*p != ' ' && *p != '\r' && *p != '\t' && *p != '\n') *q++ = *p;
+			}
+			n = q - (_encoded + _encodedLength);
+		}
+		_encodedLength += n;
 
-int Base64DecoderBuf::readOne()
-{
-	int ch = _buf.sbumpc();
-	if (!(_options & BASE64_URL_ENCODING))
-	{
-		while (ch == ' ' || ch == '\r' || ch == '\t' || ch == '\n')
-			ch = _buf.sbumpc();
+		const std::size_t length = _encodedLength & ~std::size_t(3);
+		if (length > 0)
+		{
+			try
+			{
+				_decodedLength = Base64::decode(_encoded, length, _decoded, _options);
+			}
+			catch (DataFormatException&)
+			{
+				// return the data preceding the invalid group first
+				for (std::size_t i = 0; i < length; i += 4)
+				{
+					try
+					{
+						_decodedLength += Base64::decode(_encoded + i, 4, _decoded + _decodedLength, _options);
+					}
+					catch (DataFormatException&)
+					{
+						break;
+					}
+				}
+				_error = true;
+				if (_decodedLength == 0) throw;
+			}
+			_encodedLength -= length;
+			std::memmove(_encoded, _encoded + length, _encodedLength);
+		}
 	}
-	return ch;
+	return true;
 }
 
 
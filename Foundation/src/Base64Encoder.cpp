@@ -13,6 +13,8 @@
 
 
 #include "Poco/Base64Encoder.h"
+#include "Poco/Base64.h"
+#include <algorithm>
 
 
 namespace Poco {
@@ -108,6 +110,57 @@ int Base64EncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize Base64EncoderBuf::xsputn(const char* s, std::streamsize n)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	std::streamsize written = 0;
+	while (_groupLength > 0 && written < n)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+
+	// encode complete groups in blocks, inserting line breaks as needed
+	char buffer[4096];
+	std::size_t length = 0;
+	std::streamsize flushed = written;
+	while (n - written >= 3)
+	{
+		std::size_t groups = static_cast<std::size_t>(n - written)/3;
+		groups = std::min(groups, (sizeof(buffer) - length - 2)/4);
+		if (_lineLength > 0)
+		{
+			const std::size_t lineGroups = _pos < _lineLength ? (_lineLength - _pos + 3)/4 : 1;
+			groups = std::min(groups, lineGroups);
+		}
+		length += Base64::encode(s + written, groups*3, buffer + length, _options);
+		written += groups*3;
+		_pos += static_cast<int>(groups*4);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			buffer[length++] = '\r';
+			buffer[length++] = '\n';
+			_pos = 0;
+		}
+		if (sizeof(buffer) - length < 6)
+		{
+			if (_buf.sputn(buffer, length) != static_cast<std::streamsize>(length)) return flushed;
+			length = 0;
+			flushed = written;
+		}
+	}
+	if (length > 0 && _buf.sputn(buffer, length) != static_cast<std::streamsize>(length)) return flushed;
+
+	while (written < n)
+	{
+		if (writeToDevice(s[written]) == eof) return written;
+		++written;
+	}
+	return written;
+}
+
+
 int Base64EncoderBuf::close()
 {
 	static const int eof = std::char_traits<char>::eof();
@@ -20,6 +20,15 @@
 namespace Poco {
 
 
+namespace
+{
+	constexpr std::size_t MAX_BUFFER_CAPACITY = 16384;
+		/// Per-thread format buffers growing beyond this are released after use.
+
+	thread_local std::string formatBuffer;
+}
+
+
 FormattingChannel::FormattingChannel():
 	_pFormatter(nullptr),
 	_pChannel(nullptr)
@@ -76,9 +85,14 @@ void FormattingChannel::log(const Message& msg)
 	{
 		if (_pFormatter)
 		{
-			std::string text;
+			// The text is copied into the new Message, so the per-thread
+			// buffer is free again before the channel is called.
+			std::string& text = formatBuffer;
+			text.clear();
 			_pFormatter->format(msg, text);
-			_pChannel->log(Message(msg, text));
+			Message formatted(msg, text);
+			if (text.capacity() > MAX_BUFFER_CAPACITY) std::string().swap(text);
+			_pChannel->log(formatted);
 		}
 		else
 		{
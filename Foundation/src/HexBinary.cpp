@@ -0,0 +1,300 @@
+//
+// HexBinary.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinary
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/HexBinary.h"
+#include "Poco/Exception.h"
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_HEXBINARY_SSE2
+	#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_HEXBINARY_NEON
+	#include <arm_neon.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	constexpr char DIGITS[] = "0123456789abcdef";
+	constexpr char DIGITS_UPPER[] = "0123456789ABCDEF";
+
+	enum : unsigned char
+	{
+		INVALID    = 0xFF,
+		WHITESPACE = 0xFD
+	};
+
+	struct DecodingTable
+	{
+		unsigned char values[256];
+	};
+
+	constexpr DecodingTable makeDecodingTable()
+	{
+		DecodingTable table{};
+		for (int i = 0; i < 256; i++) table.values[i] = INVALID;
+		for (int i = 0; i < 10; i++) table.values['0' + i] = static_cast<unsigned char>(i);
+		for (int i = 0; i < 6; i++)
+		{
+			table.values['a' + i] = static_cast<unsigned char>(10 + i);
+			table.values['A' + i] = static_cast<unsigned char>(10 + i);
+		}
+		table.values[static_cast<unsigned char>(' ')] = WHITESPACE;
+		table.values[static_cast<unsigned char>('\t')] = WHITESPACE;
+		table.values[static_cast<unsigned char>('\r')] = WHITESPACE;
+		table.values[static_cast<unsigned char>('\n')] = WHITESPACE;
+		return table;
+	}
+
+	constexpr DecodingTable DECODING = makeDecodingTable();
+
+
+#if defined(POCO_HEXBINARY_SSE2)
+
+	std::size_t encodeBlocks(const unsigned char* p, std::size_t length, char* q, bool uppercase)
+		/// Encodes 16 bytes per iteration.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i nine = _mm_set1_epi8(9);
+		const __m128i zero = _mm_set1_epi8('0');
+		const __m128i letter = _mm_set1_epi8((uppercase ? 'A' : 'a') - '0' - 10);
+
+		while (end - p >= 16)
+		{
+			const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+			const __m128i low = _mm_and_si128(in, nibble);
+			const __m128i highDigits = _mm_add_epi8(_mm_add_epi8(high, zero), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letter));
+			const __m128i lowDigits = _mm_add_epi8(_mm_add_epi8(low, zero), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letter));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q), _mm_unpacklo_epi8(highDigits, lowDigits));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + 16), _mm_unpackhi_epi8(highDigits, lowDigits));
+			p += 16;
+			q += 32;
+		}
+		return p - begin;
+	}
+
+
+	inline bool decodeDigits(__m128i in, __m128i& values)
+		/// Converts 16 hex digits to their values. Returns false
+		/// if any of the characters is not a hex digit.
+	{
+		// characters >= 0x80 compare as negative numbers and are rejected
+		const __m128i lower = _mm_or_si128(in, _mm_set1_epi8(0x20));
+		const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+		const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+		if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF) return false;
+
+		values = _mm_or_si128(
+			_mm_and_si128(digit, _mm_sub_epi8(in, _mm_set1_epi8('0'))),
+			_mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+		return true;
+	}
+
+
+	std::size_t decodeBlocks(const unsigned char* p, std::size_t length, unsigned char* q)
+		/// Decodes 32 characters per iteration. Stops at the first block
+		/// containing anything but hex digits.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+		const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+
+		while (end - p >= 32)
+		{
+			__m128i values0;
+			__m128i values1;
+			if (!decodeDigits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), values0)) break;
+			if (!decodeDigits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), values1)) break;
+
+			// every 16-bit lane holds the high nibble in its low byte
+			const __m128i bytes0 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values0, lowBytes), 4), _mm_srli_epi16(values0, 8));
+			const __m128i bytes1 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values1, lowBytes), 4), _mm_srli_epi16(values1, 8));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q), _mm_packus_epi16(bytes0, bytes1));
+			p += 32;
+			q += 16;
+		}
+		return p - begin;
+	}
+
+#elif defined(POCO_HEXBINARY_NEON)
+
+	std::size_t encodeBlocks(const unsigned char* p, std::size_t length, char* q, bool uppercase)
+		/// Encodes 16 bytes per iteration.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+
+		const uint8x16_t digits = vld1q_u8(reinterpret_cast<const unsigned char*>(uppercase ? DIGITS_UPPER : DIGITS));
+		const uint8x16_t nibble = vdupq_n_u8(0x0F);
+
+		while (end - p >= 16)
+		{
+			const uint8x16_t in = vld1q_u8(p);
+			uint8x16x2_t out;
+			out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+			out.val[1] = vqtbl1q_u8(digits, vandq_u8(in, nibble));
+			vst2q_u8(reinterpret_cast<unsigned char*>(q), out);
+			p += 16;
+			q += 32;
+		}
+		return p - begin;
+	}
+
+
+	inline uint8x16_t decodeDigits(uint8x16_t in, uint8x16_t& valid)
+		/// Converts 16 hex digits to their values, and sets the
+		/// corresponding lanes of valid for hex digits.
+	{
+		const uint8x16_t digit = vsubq_u8(in, vdupq_n_u8('0'));
+		const uint8x16_t letter = vsubq_u8(vorrq_u8(in, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+		const uint8x16_t isDigit = vcleq_u8(digit, vdupq_n_u8(9));
+		const uint8x16_t isLetter = vcleq_u8(letter, vdupq_n_u8(5));
+		valid = vandq_u8(valid, vorrq_u8(isDigit, isLetter));
+		return vbslq_u8(isDigit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+	}
+
+
+	std::size_t decodeBlocks(const unsigned char* p, std::size_t length, unsigned char* q)
+		/// Decodes 32 characters per iteration. Stops at the first block
+		/// containing anything but hex digits.
+	{
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+
+		while (end - p >= 32)
+		{
+			const uint8x16x2_t in = vld2q_u8(p);
+			uint8x16_t valid = vdupq_n_u8(0xFF);
+			const uint8x16_t high = decodeDigits(in.val[0], valid);
+			const uint8x16_t low = decodeDigits(in.val[1], valid);
+			if (vminvq_u8(valid) == 0) break;
+
+			vst1q_u8(q, vorrq_u8(vshlq_n_u8(high, 4), low));
+			p += 32;
+			q += 16;
+		}
+		return p - begin;
+	}
+
+#else
+
+	std::size_t encodeBlocks(const unsigned char*, std::size_t, char*, bool)
+	{
+		return 0;
+	}
+
+
+	std::size_t decodeBlocks(const unsigned char*, std::size_t, unsigned char*)
+	{
+		return 0;
+	}
+
+#endif
+}
+
+
+std::size_t HexBinary::encode(const void* data, std::size_t length, char* out, bool uppercase)
+{
+	const char* digits = uppercase ? DIGITS_UPPER : DIGITS;
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	char* q = out;
+
+	const std::size_t n = encodeBlocks(p, length, q, uppercase);
+	p += n;
+	q += 2*n;
+
+	while (p < end)
+	{
+		q[0] = digits[*p >> 4];
+		q[1] = digits[*p & 0x0F];
+		++p;
+		q += 2;
+	}
+	return q - out;
+}
+
+
+std::string HexBinary::encode(std::string_view data, bool uppercase)
+{
+	std::string result(encodedLength(data.size()), '\0');
+	encode(data.data(), data.size(), result.data(), uppercase);
+	return result;
+}
+
+
+std::size_t HexBinary::decode(const char* data, std::size_t length, void* out)
+{
+	const unsigned char* table = DECODING.values;
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	unsigned char* q = static_cast<unsigned char*>(out);
+
+	int high = -1;
+	while (p < end)
+	{
+		if (high < 0)
+		{
+			const std::size_t n = decodeBlocks(p, end - p, q);
+			p += n;
+			q += n/2;
+
+			while (end - p >= 2)
+			{
+				const unsigned char a = table[p[0]];
+				const unsigned char b = table[p[1]];
+				if ((a | b) & 0x80) break;
+				*q++ = static_cast<unsigned char>((a << 4) | b);
+				p += 2;
+			}
+			if (p == end) break;
+		}
+
+		// whitespace or invalid characters
+		const unsigned char value = table[*p++];
+		if (value == WHITESPACE) continue;
+		if (value == INVALID) throw DataFormatException("Invalid hexBinary character");
+		if (high < 0)
+		{
+			high = value;
+		}
+		else
+		{
+			*q++ = static_cast<unsigned char>((high << 4) | value);
+			high = -1;
+		}
+	}
+	if (high >= 0) throw DataFormatException("Incomplete hexBinary data");
+
+	return q - static_cast<unsigned char*>(out);
+}
+
+
+std::string HexBinary::decode(std::string_view data)
+{
+	std::string result(decodedLength(data.size()), '\0');
+	result.resize(decode(data.data(), data.size(), result.data()));
+	return result;
+}
+
+
+} // namespace Poco
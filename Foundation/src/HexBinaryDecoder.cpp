@@ -13,13 +13,20 @@
 
 
 #include "Poco/HexBinaryDecoder.h"
+#include "Poco/HexBinary.h"
 #include "Poco/Exception.h"
+#include <algorithm>
+#include <cstring>
 
 
 namespace Poco {
 
 
 HexBinaryDecoderBuf::HexBinaryDecoderBuf(std::istream& istr):
+	_encodedLength(0),
+	_decodedLength(0),
+	_decodedIndex(0),
+	_error(false),
 	_buf(*istr.rdbuf())
 {
 }
@@ -32,35 +39,103 @@ HexBinaryDecoderBuf::~HexBinaryDecoderBuf()
 
 int HexBinaryDecoderBuf::readFromDevice()
 {
-	int c;
-	int n;
-	if ((n = readOne()) == -1) return -1;
-	if (n >= '0' && n <= '9')
-		c = n - '0';
-	else if (n >= 'A' && n <= 'F')
-		c = n - 'A' + 10;
-	else if (n >= 'a' && n <= 'f')
-		c = n - 'a' + 10;
-	else throw DataFormatException();
-	c <<= 4;
-	if ((n = readOne()) == -1) throw DataFormatException();
-	if (n >= '0' && n <= '9')
-		c |= n - '0';
-	else if (n >= 'A' && n <= 'F')
-		c |= n - 'A' + 10;
-	else if (n >= 'a' && n <= 'f')
-		c |= n - 'a' + 10;
-	else throw DataFormatException();
-	return c;
+	if (_decodedIndex == _decodedLength && !decodeBlock()) return -1;
+
+	return static_cast<unsigned char>(_decoded[_decodedIndex++]);
+}
+
+
+std::streamsize HexBinaryDecoderBuf::xsgetn(char* s, std::streamsize n)
+{
+	if (n <= 0) return 0;
+
+	// the first character may have been peeked at or put back
+	const int c = uflow();
+	if (c == std::char_traits<char>::eof()) return 0;
+	*s = static_cast<char>(c);
+
+	std::streamsize copied = 1;
+	while (copied < n)
+	{
+		if (_decodedIndex == _decodedLength && !decodeBlock()) break;
+
+		const std::size_t length = std::min<std::size_t>(n - copied, _decodedLength - _decodedIndex);
+		std::memcpy(s + copied, _decoded + _decodedIndex, length);
+		_decodedIndex += length;
+		copied += length;
+	}
+	return copied;
 }
 
 
-int HexBinaryDecoderBuf::readOne()
+bool HexBinaryDecoderBuf::decodeBlock()
 {
-	int ch = _buf.sbumpc();
-	while (ch == ' ' || ch == '\r' || ch == '\t' || ch == '\n')
-		ch = _buf.sbumpc();
-	return ch;
+	static const int eof = std::char_traits<char>::eof();
+
+	if (_error) throw DataFormatException();
+
+	_decodedIndex = 0;
+	_decodedLength = 0;
+	while (_decodedLength == 0)
+	{
+		// read as many characters as are available without blocking,
+		// but at least one
+		char* p = _encoded + _encodedLength;
+		std::streamsize n = _buf.in_avail();
+		if (n > 0)
+		{
+			n = _buf.sgetn(p, std::min<std::streamsize>(n, BUFFER_SIZE - _encodedLength));
+		}
+		else
+		{
+			const int c = _buf.sbumpc();
+			if (c == eof)
+			{
+				if (_encodedLength > 0) throw DataFormatException();
+				return false;
+			}
+			*p = static_cast<char>(c);
+			n = 1;
+		}
+
+		char* end = p + n;
+		char* q = p;
+		for (; p < end; ++p)
+		{
+			if (*p != ' ' && *p != '\r' && *p != '\t' && *p != '\n') *q++ = *p;
+		}
+		_encodedLength = q - _encoded;
+
+		const std::size_t length = _encodedLength & ~std::size_t(1);
+		if (length > 0)
+		{
+			try
+			{
+				_decodedLength = HexBinary::decode(_encoded, length, _decoded);
+			}
+			catch (DataFormatException&)
+			{
+				// return the data preceding the invalid character first
+				while (_decodedLength < length/2)
+				{
+					try
+					{
+						HexBinary::decode(_encoded + 2*_decodedLength, 2, _decoded + _decodedLength);
+					}
+					catch (DataFormatException&)
+					{
+						break;
+					}
+					++_decodedLength;
+				}
+				_error = true;
+				if (_decodedLength == 0) throw;
+			}
+			_encodedLength -= length;
+			std::memmove(_encoded, _encoded + length, _encodedLength);
+		}
+	}
+	return true;
 }
 
 
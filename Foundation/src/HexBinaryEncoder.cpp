@@ -13,6 +13,8 @@
 
 
 #include "Poco/HexBinaryEncoder.h"
+#include "Poco/HexBinary.h"
+#include <algorithm>
 
 
 namespace Poco {
@@ -74,6 +76,40 @@ int HexBinaryEncoderBuf::writeToDevice(char c)
 }
 
 
+std::streamsize HexBinaryEncoderBuf::xsputn(const char* s, std::streamsize n)
+{
+	// encode in blocks, inserting line breaks as needed
+	char buffer[4096];
+	std::size_t length = 0;
+	std::streamsize written = 0;
+	std::streamsize flushed = 0;
+	while (written < n)
+	{
+		std::size_t bytes = std::min(static_cast<std::size_t>(n - written), (sizeof(buffer) - length - 1)/2);
+		if (_lineLength > 0)
+		{
+			const std::size_t lineBytes = _pos < _lineLength ? (_lineLength - _pos + 1)/2 : 1;
+			bytes = std::min(bytes, lineBytes);
+		}
+		length += HexBinary::encode(s + written, bytes, buffer + length, _uppercase != 0);
+		written += bytes;
+		_pos += static_cast<int>(2*bytes);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			buffer[length++] = '\n';
+			_pos = 0;
+		}
+		if (sizeof(buffer) - length < 3 || written == n)
+		{
+			if (_buf.sputn(buffer, length) != static_cast<std::streamsize>(length)) return flushed;
+			length = 0;
+			flushed = written;
+		}
+	}
+	return written;
+}
+
+
 int HexBinaryEncoderBuf::close()
 {
 	sync();
@@ -16,9 +16,100 @@
 #include <ostream>
 
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_JSONSTRING_SSE2
+	#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_JSONSTRING_NEON
+	#include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
 namespace {
 
 
+inline bool needsEscape(char c)
+{
+	return static_cast<unsigned char>(c) <= 31 || c == '"' || c == '\\';
+}
+
+
+std::size_t plainLength(const char* p, std::size_t length)
+	/// Returns the length of the initial run of characters
+	/// that can be written without escaping.
+{
+	std::size_t i = 0;
+#if defined(POCO_JSONSTRING_SSE2)
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i maxControl = _mm_set1_epi8(0x1F);
+	for (; i + 16 <= length; i += 16)
+	{
+		const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+		const __m128i special = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(in, quote), _mm_cmpeq_epi8(in, backslash)),
+			_mm_cmpeq_epi8(_mm_min_epu8(in, maxControl), in));
+		const int mask = _mm_movemask_epi8(special);
+		if (mask != 0)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, static_cast<unsigned long>(mask));
+			return i + index;
+#else
+			return i + __builtin_ctz(static_cast<unsigned>(mask));
+#endif
+		}
+	}
+#elif defined(POCO_JSONSTRING_NEON)
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	const uint8x16_t minPrintable = vdupq_n_u8(0x20);
+	for (; i + 16 <= length; i += 16)
+	{
+		const uint8x16_t in = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i));
+		const uint8x16_t special = vorrq_u8(
+			vorrq_u8(vceqq_u8(in, quote), vceqq_u8(in, backslash)),
+			vcltq_u8(in, minPrintable));
+		if (vmaxvq_u8(special) != 0) break;
+	}
+#endif
+	while (i < length && !needsEscape(p[i])) ++i;
+	return i;
+}
+
+
+std::size_t escapeChar(char c, bool lowerCaseHex, char* buffer)
+	/// Writes the escape sequence for a character for which
+	/// needsEscape() returns true and returns its length.
+{
+	buffer[0] = '\\';
+	switch (c)
+	{
+	case '"':  buffer[1] = '"'; return 2;
+	case '\\': buffer[1] = '\\'; return 2;
+	case '\b': buffer[1] = 'b'; return 2;
+	case '\f': buffer[1] = 'f'; return 2;
+	case '\n': buffer[1] = 'n'; return 2;
+	case '\r': buffer[1] = 'r'; return 2;
+	case '\t': buffer[1] = 't'; return 2;
+	default:
+		{
+			const char* digits = lowerCaseHex ? "0123456789abcdef" : "0123456789ABCDEF";
+			buffer[1] = 'u';
+			buffer[2] = '0';
+			buffer[3] = '0';
+			buffer[4] = digits[(static_cast<unsigned char>(c) >> 4) & 0x0F];
+			buffer[5] = digits[static_cast<unsigned char>(c) & 0x0F];
+			return 6;
+		}
+	}
+}
+
+
 template<typename T, typename S>
 struct WriteFunc
 {
@@ -28,13 +119,13 @@ struct WriteFunc
 
 
 template<typename T, typename S>
-void writeString(const std::string &value, T& obj, typename WriteFunc<T, S>::Type write, int options)
+void writeString(const char* value, std::size_t length, T& obj, typename WriteFunc<T, S>::Type write, int options)
 {
 	bool wrap = ((options & Poco::JSON_WRAP_STRINGS) != 0);
 	bool escapeAllUnicode = ((options & Poco::JSON_ESCAPE_UNICODE) != 0);
 	bool lowerCaseHex = ((options & Poco::JSON_LOWERCASE_HEX) != 0);
 
-	if (value.size() == 0)
+	if (length == 0)
 	{
 		if(wrap) (obj.*write)("\"\"", 2);
 		return;
@@ -43,19 +134,23 @@ void writeString(const std::string &value, T& obj, typename WriteFunc<T, S>::Typ
 	if(wrap) (obj.*write)("\"", 1);
 	if(escapeAllUnicode)
 	{
-		std::string str = Poco::UTF8::escape(value.begin(), value.end(), true, lowerCaseHex);
+		std::string in(value, length);
+		std::string str = Poco::UTF8::escape(in.begin(), in.end(), true, lowerCaseHex);
 		(obj.*write)(str.c_str(), str.size());
 	}
 	else
 	{
-		for (auto it = value.cbegin(); it != value.cend(); ++it)
+		// write runs of characters that need no escaping at once
+		const char* end = value + length;
+		while (value != end)
 		{
-			if ((static_cast<unsigned char>(*it) <= 31) || (*it == '"') || (*it == '\\'))
-			{
-				std::string str = Poco::UTF8::escape(it, it + 1, true, lowerCaseHex);
-				(obj.*write)(str.c_str(), str.size());
-			}
-			else (obj.*write)(&(*it), 1);
+			const std::size_t n = plainLength(value, end - value);
+			if (n > 0) (obj.*write)(value, static_cast<S>(n));
+			value += n;
+			if (value == end) break;
+
+			char buffer[6];
+			(obj.*write)(buffer, static_cast<S>(escapeChar(*value++, lowerCaseHex, buffer)));
 		}
 	}
 	if(wrap) (obj.*write)("\"", 1);
@@ -70,14 +165,20 @@ namespace Poco {
 
 void toJSON(const std::string& value, std::ostream& out, int options)
 {
-	writeString<std::ostream, std::streamsize>(value, out, &std::ostream::write, options);
+	writeString<std::ostream, std::streamsize>(value.data(), value.size(), out, &std::ostream::write, options);
+}
+
+
+void toJSON(std::string_view value, std::string& out, int options)
+{
+	writeString<std::string, std::string::size_type>(value.data(), value.size(), out, &std::string::append, options);
 }
 
 
 std::string toJSON(const std::string& value, int options)
 {
 	std::string ret;
-	writeString<std::string, std::string::size_type>(value, ret, &std::string::append, options);
+	writeString<std::string, std::string::size_type>(value.data(), value.size(), ret, &std::string::append, options);
 	return ret;
 }
 
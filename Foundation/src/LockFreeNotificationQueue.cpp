@@ -0,0 +1,235 @@
+//
+// LockFreeNotificationQueue.cpp
+//
+// Library: Foundation
+// Package: Notifications
+// Module:  LockFreeNotificationQueue
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/LockFreeNotificationQueue.h"
+#include "Poco/NotificationCenter.h"
+#include "Poco/Thread.h"
+#include <chrono>
+
+
+namespace Poco {
+
+
+namespace
+{
+	const int SPIN_COUNT = 16;
+}
+
+
+LockFreeNotificationQueue::LockFreeNotificationQueue(std::size_t capacity):
+	_queue(capacity),
+	_waitingConsumers(0),
+	_waitingProducers(0),
+	_wokeUp(false),
+	_wakeUpCount(0)
+{
+}
+
+
+LockFreeNotificationQueue::~LockFreeNotificationQueue()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void LockFreeNotificationQueue::enqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+
+	Notification* pNf = pNotification.duplicate();
+	if (!_queue.tryPush(pNf))
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_waitingProducers.fetch_add(1, std::memory_order_relaxed);
+		// pairs with the fence in notifyProducer()
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		while (!_queue.tryPush(pNf))
+		{
+			_spaceAvailable.wait(lock);
+		}
+		_waitingProducers.fetch_sub(1, std::memory_order_relaxed);
+	}
+	if (_wokeUp.load(std::memory_order_relaxed)) _wokeUp.store(false, std::memory_order_relaxed);
+	notifyConsumer();
+}
+
+
+bool LockFreeNotificationQueue::tryEnqueueNotification(Notification::Ptr pNotification)
+{
+	poco_check_ptr (pNotification);
+
+	// the queue's reference must be taken before the push, as
+	// a consumer may dequeue and release the notification at once
+	Notification* pNf = pNotification.duplicate();
+	if (!_queue.tryPush(pNf))
+	{
+		pNf->release();
+		return false;
+	}
+	if (_wokeUp.load(std::memory_order_relaxed)) _wokeUp.store(false, std::memory_order_relaxed);
+	notifyConsumer();
+	return true;
+}
+
+
+Notification* LockFreeNotificationQueue::dequeueNotification()
+{
+	Notification* pNf = nullptr;
+	if (_queue.tryPop(pNf))
+	{
+		notifyProducer();
+		return pNf;
+	}
+	return nullptr;
+}
+
+
+Notification* LockFreeNotificationQueue::waitDequeueNotification()
+{
+	return waitDequeueImpl(-1);
+}
+
+
+Notification* LockFreeNotificationQueue::waitDequeueNotification(long milliseconds)
+{
+	return waitDequeueImpl(milliseconds < 0 ? 0 : milliseconds);
+}
+
+
+void LockFreeNotificationQueue::dispatch(NotificationCenter& notificationCenter)
+{
+	Notification* pNf = nullptr;
+	while (_queue.tryPop(pNf))
+	{
+		notifyProducer();
+		notificationCenter.postNotification(Notification::Ptr(pNf));
+	}
+}
+
+
+void LockFreeNotificationQueue::wakeUpAll()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_wokeUp.store(true, std::memory_order_relaxed);
+	++_wakeUpCount;
+	_nfAvailable.notify_all();
+}
+
+
+void LockFreeNotificationQueue::clear()
+{
+	Notification* pNf = nullptr;
+	bool removed = false;
+	while (_queue.tryPop(pNf))
+	{
+		pNf->release();
+		removed = true;
+	}
+	if (removed)
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (_waitingProducers.load(std::memory_order_relaxed) > 0)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_spaceAvailable.notify_all();
+		}
+	}
+}
+
+
+Notification* LockFreeNotificationQueue::waitDequeueImpl(long milliseconds)
+{
+	Notification* pNf = nullptr;
+	if (_queue.tryPop(pNf))
+	{
+		notifyProducer();
+		return pNf;
+	}
+	if (_wokeUp.load(std::memory_order_relaxed)) return nullptr;
+
+	// briefly yield before parking, as waking up a
+	// parked thread is far more expensive for the producer
+	if (milliseconds != 0)
+	{
+		for (int i = 0; i < SPIN_COUNT; ++i)
+		{
+			Thread::yield();
+			if (_queue.tryPop(pNf))
+			{
+				notifyProducer();
+				return pNf;
+			}
+		}
+	}
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		const int wakeUpCount = _wakeUpCount;
+		_waitingConsumers.fetch_add(1, std::memory_order_relaxed);
+		// pairs with the fence in notifyConsumer(): either we see
+		// the new notification, or the producer sees us waiting
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		while (!_queue.tryPop(pNf))
+		{
+			// a notification enqueued after wakeUpAll() resets _wokeUp,
+			// but threads already waiting must still return
+			if (_wokeUp.load(std::memory_order_relaxed) || _wakeUpCount != wakeUpCount) break;
+			if (milliseconds < 0)
+			{
+				_nfAvailable.wait(lock);
+			}
+			else if (_nfAvailable.wait_until(lock, deadline) == std::cv_status::timeout)
+			{
+				_queue.tryPop(pNf);
+				break;
+			}
+		}
+		_waitingConsumers.fetch_sub(1, std::memory_order_relaxed);
+	}
+	if (pNf) notifyProducer();
+	return pNf;
+}
+
+
+void LockFreeNotificationQueue::notifyConsumer()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_waitingConsumers.load(std::memory_order_relaxed) > 0)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_nfAvailable.notify_one();
+	}
+}
+
+
+void LockFreeNotificationQueue::notifyProducer()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_waitingProducers.load(std::memory_order_relaxed) > 0)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_spaceAvailable.notify_one();
+	}
+}
+
+
+} // namespace Poco
@@ -221,32 +221,38 @@ std::string Logger::format(const std::string& fmt, const std::string& arg0, cons
 
 std::string Logger::format(const std::string& fmt, int argc, std::string argv[])
 {
+	std::size_t size = fmt.size();
+	for (int i = 0; i < argc; i++) size += argv[i].size();
+
 	std::string result;
-	std::string::const_iterator it = fmt.begin();
-	while (it != fmt.end())
+	result.reserve(size);
+	std::string::size_type pos = 0;
+	std::string::size_type next;
+	while ((next = fmt.find('$', pos)) != std::string::npos)
 	{
-		if (*it == '$')
+		result.append(fmt, pos, next - pos);
+		if (++next == fmt.size())
 		{
-			++it;
-			if (*it == '$')
-			{
-				result += '$';
-			}
-			else if (*it >= '0' && *it <= '9')
-			{
-				int i = *it - '0';
-				if (i < argc)
-					result += argv[i];
-			}
-			else
-			{
-				result += '$';
-				result += *it;
-			}
+			result += '$';
+		}
+		else if (fmt[next] == '$')
+		{
+			result += '$';
+		}
+		else if (fmt[next] >= '0' && fmt[next] <= '9')
+		{
+			int i = fmt[next] - '0';
+			if (i < argc)
+				result += argv[i];
+		}
+		else
+		{
+			result += '$';
+			result += fmt[next];
 		}
-		else result += *it;
-		++it;
+		pos = next + 1;
 	}
+	if (pos < fmt.size()) result.append(fmt, pos, std::string::npos);
 	return result;
 }
 
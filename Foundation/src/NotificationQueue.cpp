@@ -74,6 +74,30 @@ void NotificationQueue::enqueueUrgentNotification(Notification::Ptr pNotificatio
 }
 
 
+void NotificationQueue::enqueueBatch(const std::vector<Notification::Ptr>& notifications)
+{
+	if (notifications.empty()) return;
+
+	FastMutex::ScopedLock lock(_mutex);
+	_wokeUp = false;
+	for (const auto& pNotification: notifications)
+	{
+		poco_check_ptr (pNotification);
+		if (_waitQueue.empty())
+		{
+			_nfQueue.push_back(pNotification);
+		}
+		else
+		{
+			WaitInfo* pWI = _waitQueue.front();
+			_waitQueue.pop_front();
+			pWI->pNf = pNotification;
+			pWI->nfAvailable.set();
+		}
+	}
+}
+
+
 Notification* NotificationQueue::dequeueNotification()
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -134,6 +158,41 @@ Notification* NotificationQueue::waitDequeueNotification(long milliseconds)
 }
 
 
+std::size_t NotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return dequeueMany(notifications, maxCount);
+}
+
+
+std::size_t NotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	if (maxCount == 0) return 0;
+
+	std::size_t n = dequeueBatch(notifications, maxCount);
+	if (n > 0) return n;
+
+	Notification::Ptr pNf(waitDequeueNotification());
+	if (!pNf) return 0;
+	notifications.push_back(std::move(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+std::size_t NotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount, long milliseconds)
+{
+	if (maxCount == 0) return 0;
+
+	std::size_t n = dequeueBatch(notifications, maxCount);
+	if (n > 0) return n;
+
+	Notification::Ptr pNf(waitDequeueNotification(milliseconds));
+	if (!pNf) return 0;
+	notifications.push_back(std::move(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
 void NotificationQueue::dispatch(NotificationCenter& notificationCenter)
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -211,6 +270,19 @@ Notification::Ptr NotificationQueue::dequeueOne()
 }
 
 
+std::size_t NotificationQueue::dequeueMany(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	std::size_t n = 0;
+	while (n < maxCount && !_nfQueue.empty())
+	{
+		notifications.push_back(std::move(_nfQueue.front()));
+		_nfQueue.pop_front();
+		++n;
+	}
+	return n;
+}
+
+
 NotificationQueue& NotificationQueue::defaultQueue()
 {
 	static NotificationQueue nq;
@@ -430,8 +430,7 @@ void NumberFormatter::appendHex(std::string& str, UInt64 value, int width, bool
 void NumberFormatter::append(std::string& str, float value)
 {
 	char buffer[NF_MAX_FLT_STRING_LEN];
-	floatToStr(buffer, POCO_MAX_FLT_STRING_LEN, value);
-	str.append(buffer);
+	str.append(buffer, floatToChars(buffer, buffer + POCO_MAX_FLT_STRING_LEN, value));
 }
 
 
@@ -453,8 +452,7 @@ void NumberFormatter::append(std::string& str, float value, int width, int preci
 void NumberFormatter::append(std::string& str, double value)
 {
 	char buffer[NF_MAX_FLT_STRING_LEN];
-	doubleToStr(buffer, POCO_MAX_FLT_STRING_LEN, value);
-	str.append(buffer);
+	str.append(buffer, doubleToChars(buffer, buffer + POCO_MAX_FLT_STRING_LEN, value));
 }
 
 
@@ -196,6 +196,22 @@ bool NumberParser::tryParseFloat(const std::string& s, double& value, char decSe
 }
 
 
+double NumberParser::parseFloat(const char* first, const char* last, char decSep, char thSep)
+{
+	double result;
+	if (tryParseFloat(first, last, result, decSep, thSep))
+		return result;
+	else
+		throw SyntaxException("Not a valid floating-point number", std::string(first, last));
+}
+
+
+bool NumberParser::tryParseFloat(const char* first, const char* last, double& value, char decSep, char thSep)
+{
+	return strToDouble(first, last, value, decSep, thSep);
+}
+
+
 bool NumberParser::parseBool(const std::string& s)
 {
 	bool result;
@@ -38,6 +38,7 @@ poco_static_assert(POCO_MAX_FLT_STRING_LEN == double_conversion::kMaxSignificant
 #include "Poco/String.h"
 #include <cctype>
 #include <cmath>
+#include <cstring>
 
 
 namespace {
@@ -171,55 +172,101 @@ namespace Poco {
 
 namespace {
 
-/// Format a floating-point value using std::to_chars with shortest representation.
-/// Chooses fixed or scientific notation based on the value's exponent and the
-/// [lowDec, highDec] range, matching double-conversion's ToShortest behavior.
+/// Writes the shortest representation of a floating-point value that
+/// round-trips to [first, last), without a terminating zero.
+/// Chooses fixed notation if the decimal exponent is within [lowDec, highDec],
+/// otherwise the shorter of fixed and exponential notation (the format of
+/// std::to_chars without a format argument). Returns a pointer past the last
+/// character written, or nullptr if the range is too small.
+///
+/// A single std::to_chars call in scientific format yields the shortest
+/// digits and the exponent; both notations are laid out from these.
 template <typename T>
-void toShortestStr(char* buffer, int bufferSize, T value, int lowDec, int highDec)
+char* toShortestChars(char* first, char* last, T value, int lowDec, int highDec)
 {
-	// Handle NaN, infinity, and -0 directly -- log10 is undefined for these.
 	if (!std::isfinite(value) || value == T(0))
 	{
-		auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value);
-		if (ec != std::errc()) { buffer[0] = '\0'; return; }
-		*ptr = '\0';
-		return;
+		const auto [ptr, ec] = std::to_chars(first, last, value);
+		return ec == std::errc() ? ptr : nullptr;
 	}
 
-	// Compute the base-10 exponent robustly. std::floor(std::log10(x)) can
-	// be off by one near exact powers of 10 due to floating-point rounding
-	// (e.g. log10(1000.0) may return 2.999..., floor gives 2 instead of 3).
-	// Verify with a power-of-10 multiplication to correct off-by-one.
-	const T absVal = value < 0 ? -value : value;
-	int exp10 = static_cast<int>(std::floor(std::log10(absVal)));
-	// Correct off-by-one: if 10^(exp10+1) <= absVal, we underestimated
-	T threshold = 1;
-	for (int i = 0; i < exp10 + 1 && i < 20; ++i) threshold *= 10;
-	if (threshold <= absVal) ++exp10;
-
-	const bool useFixed = (exp10 >= lowDec && exp10 <= highDec);
+	char sci[32];
+	const auto [sciEnd, sciEc] = std::to_chars(sci, sci + sizeof(sci), value, std::chars_format::scientific);
+	poco_assert_dbg (sciEc == std::errc());
+
+	const char* p = sci;
+	const bool negative = (*p == '-');
+	if (negative) ++p;
+	const char* const mantissa = p;
+	char digits[std::numeric_limits<T>::max_digits10];
+	int nDigits = 0;
+	for (; *p != 'e'; ++p)
+	{
+		if (*p != '.') digits[nDigits++] = *p;
+	}
+	++p;
+	const bool negativeExp = (*p++ == '-');
+	int exp10 = 0;
+	while (p < sciEnd) exp10 = exp10*10 + (*p++ - '0');
+	if (negativeExp) exp10 = -exp10;
+
+	const int fixedLength = exp10 >= 0 ? (nDigits <= exp10 + 1 ? exp10 + 1 : nDigits + 1) : nDigits + 1 - exp10;
+	const int sciLength = static_cast<int>(sciEnd - mantissa);
+	const bool useFixed = (exp10 >= lowDec && exp10 <= highDec) || fixedLength <= sciLength;
+
+	char* q = first;
+	if (!useFixed)
+	{
+		const std::size_t length = sciEnd - sci;
+		if (static_cast<std::size_t>(last - first) < length) return nullptr;
+		std::memcpy(q, sci, length);
+		return q + length;
+	}
 
-	if (useFixed)
+	// Integers padded with zeros are only exact below 2^digits; above,
+	// std::to_chars writes the exact value of the integer part.
+	if (nDigits < exp10 + 1 && (value < 0 ? -value : value) >= std::ldexp(T(1), std::numeric_limits<T>::digits))
 	{
-		// Fixed notation with trailing-zero trimming for shortest output
-		auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value, std::chars_format::fixed);
-		if (ec != std::errc()) { buffer[0] = '\0'; return; }
-		*ptr = '\0';
+		const auto [ptr, ec] = std::to_chars(first, last, value, std::chars_format::fixed);
+		return ec == std::errc() ? ptr : nullptr;
+	}
 
-		char* dot = static_cast<char*>(std::memchr(buffer, '.', ptr - buffer));
-		if (dot != nullptr)
-		{
-			char* last = ptr - 1;
-			while (last > dot && *last == '0') --last;
-			*(last == dot ? last : last + 1) = '\0';
-		}
+	if (last - first < fixedLength + (negative ? 1 : 0)) return nullptr;
+	if (negative) *q++ = '-';
+	if (exp10 < 0)
+	{
+		*q++ = '0';
+		*q++ = '.';
+		for (int i = -1; i > exp10; --i) *q++ = '0';
+		std::memcpy(q, digits, nDigits);
+		q += nDigits;
+	}
+	else if (nDigits <= exp10 + 1)
+	{
+		std::memcpy(q, digits, nDigits);
+		q += nDigits;
+		for (int i = nDigits; i <= exp10; ++i) *q++ = '0';
 	}
 	else
 	{
-		auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value);
-		if (ec != std::errc()) { buffer[0] = '\0'; return; }
-		*ptr = '\0';
+		std::memcpy(q, digits, exp10 + 1);
+		q += exp10 + 1;
+		*q++ = '.';
+		std::memcpy(q, digits + exp10 + 1, nDigits - exp10 - 1);
+		q += nDigits - exp10 - 1;
 	}
+	return q;
+}
+
+
+template <typename T>
+void toShortestStr(char* buffer, int bufferSize, T value, int lowDec, int highDec)
+{
+	char* end = toShortestChars(buffer, buffer + bufferSize - 1, value, lowDec, highDec);
+	if (end)
+		*end = '\0';
+	else
+		buffer[0] = '\0';
 }
 
 /// Adjust a fixed-notation string to the requested precision by truncating
@@ -307,6 +354,12 @@ void floatToStr(char* buffer, int bufferSize, float value, int lowDec, int highD
 }
 
 
+char* floatToChars(char* first, char* last, float value, int lowDec, int highDec)
+{
+	return toShortestChars(first, last, value, lowDec, highDec);
+}
+
+
 // std::to_chars(fixed, precision) is 15-20% slower than std::to_chars(fixed)
 // without precision on both Apple Clang and GCC (benchmarked 2M random values):
 //   auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value, std::chars_format::fixed, precision);
@@ -334,6 +387,17 @@ void floatToStr(char* buffer, int bufferSize, float value, int lowDec, int highD
 }
 
 
+char* floatToChars(char* first, char* last, float value, int lowDec, int highDec)
+{
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+	floatToStr(buffer, POCO_MAX_FLT_STRING_LEN, value, lowDec, highDec);
+	const std::size_t length = std::strlen(buffer);
+	if (static_cast<std::size_t>(last - first) < length) return nullptr;
+	std::memcpy(first, buffer, length);
+	return first + length;
+}
+
+
 void floatToFixedStr(char* buffer, int bufferSize, float value, int precision)
 {
 	using namespace double_conversion;
@@ -408,6 +472,12 @@ void doubleToStr(char* buffer, int bufferSize, double value, int lowDec, int hig
 }
 
 
+char* doubleToChars(char* first, char* last, double value, int lowDec, int highDec)
+{
+	return toShortestChars(first, last, value, lowDec, highDec);
+}
+
+
 void doubleToFixedStr(char* buffer, int bufferSize, double value, int precision)
 {
 	auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value, std::chars_format::fixed);
@@ -430,6 +500,17 @@ void doubleToStr(char* buffer, int bufferSize, double value, int lowDec, int hig
 }
 
 
+char* doubleToChars(char* first, char* last, double value, int lowDec, int highDec)
+{
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+	doubleToStr(buffer, POCO_MAX_FLT_STRING_LEN, value, lowDec, highDec);
+	const std::size_t length = std::strlen(buffer);
+	if (static_cast<std::size_t>(last - first) < length) return nullptr;
+	std::memcpy(first, buffer, length);
+	return first + length;
+}
+
+
 void doubleToFixedStr(char* buffer, int bufferSize, double value, int precision)
 {
 	using namespace double_conversion;
@@ -553,18 +634,49 @@ double strToDouble(const char* str, const char* inf, const char* nan)
 
 namespace {
 
+
+#ifdef POCO_HAS_FLOAT_CHARCONV
+
+/// Parses plain numbers, which need no normalization (whitespace,
+/// thousand separators, decimal separator or 'f' suffix), in place.
+/// Returns false for everything else, which is left to the general path.
+template <typename T>
+bool parsePlainFloat(const char* first, const char* last, T& result, char decSep, char thSep)
+{
+	if (decSep != '.') return false;
+
+	const char* p = (*first == '-') ? first + 1 : first;
+	if (p == last || !(std::isdigit(static_cast<unsigned char>(*p)) || *p == '.')) return false;
+
+	const std::size_t length = last - first;
+	if (std::memchr(first, thSep, length) || std::memchr(first, 'f', length)) return false;
+
+	T value;
+	const auto [ptr, ec] = std::from_chars(first, last, value);
+	if (ec != std::errc() || ptr != last) return false;
+	result = value;
+	return true;
+}
+
+#endif // POCO_HAS_FLOAT_CHARCONV
+
+
 /// Common implementation for string-to-float/double overloads.
 /// Strips whitespace, thousand separators, and the 'f' suffix, replaces
 /// the decimal separator, then delegates to the char* parsing overload.
 /// The 'f' suffix stripping allows C/C++ float literals ("1.23f") to be
 /// parsed. It is also applied for double parsing for backward compatibility.
 template <typename T, typename ParseFn>
-bool strToFloatImpl(const std::string& str, T& result, char decSep, char thSep,
+bool strToFloatImpl(const char* first, const char* last, T& result, char decSep, char thSep,
 	const char* inf, const char* nan, ParseFn parseFn)
 {
-	if (str.empty()) return false;
+	if (first == last) return false;
+
+#ifdef POCO_HAS_FLOAT_CHARCONV
+	if (parsePlainFloat(first, last, result, decSep, thSep)) return true;
+#endif
 
-	std::string tmp(str);
+	std::string tmp(first, last);
 	trimInPlace(tmp);
 	removeInPlace(tmp, thSep);
 	removeInPlace(tmp, 'f');
@@ -579,14 +691,26 @@ bool strToFloatImpl(const std::string& str, T& result, char decSep, char thSep,
 
 bool strToFloat(const std::string& str, float& result, char decSep, char thSep, const char* inf, const char* nan)
 {
-	return strToFloatImpl(str, result, decSep, thSep, inf, nan,
+	return strToFloat(str.data(), str.data() + str.size(), result, decSep, thSep, inf, nan);
+}
+
+
+bool strToFloat(const char* first, const char* last, float& result, char decSep, char thSep, const char* inf, const char* nan)
+{
+	return strToFloatImpl(first, last, result, decSep, thSep, inf, nan,
 		[](const char* s, const char* i, const char* n) -> float { return strToFloat(s, i, n); });
 }
 
 
 bool strToDouble(const std::string& str, double& result, char decSep, char thSep, const char* inf, const char* nan)
 {
-	return strToFloatImpl(str, result, decSep, thSep, inf, nan,
+	return strToDouble(str.data(), str.data() + str.size(), result, decSep, thSep, inf, nan);
+}
+
+
+bool strToDouble(const char* first, const char* last, double& result, char decSep, char thSep, const char* inf, const char* nan)
+{
+	return strToFloatImpl(first, last, result, decSep, thSep, inf, nan,
 		[](const char* s, const char* i, const char* n) -> double { return strToDouble(s, i, n); });
 }
 
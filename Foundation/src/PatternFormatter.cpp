@@ -24,11 +24,136 @@
 #include "Poco/NumberParser.h"
 #include "Poco/StringTokenizer.h"
 #include "Poco/Path.h"
+#include <cstring>
+#include <limits>
 
 
 namespace Poco {
 
 
+namespace
+{
+	constexpr char KEY_DATETIME = '\x01';
+		/// Internal action key for a combined "%Y-%m-%d %H:%M:%S" sequence.
+
+	constexpr char DATETIME_KEYS[] = "wWbBdefmnoyYHhaAMSicF";
+		/// The keys of all actions that need the broken-down date and time.
+
+	struct DateTimeFields
+		/// The broken-down date and time of a whole second, and its
+		/// rendering in "%Y-%m-%d %H:%M:%S" format.
+	{
+		Timestamp::TimeVal seconds = std::numeric_limits<Timestamp::TimeVal>::min();
+		int year = 0;
+		int month = 0;
+		int day = 0;
+		int dayOfWeek = 0;
+		int hour = 0;
+		int hourAMPM = 0;
+		int minute = 0;
+		int second = 0;
+		char text[19] = {};
+	};
+
+	thread_local DateTimeFields cachedFields;
+
+
+	inline void writeDigits(char* p, int value, int width)
+	{
+		while (width-- > 0)
+		{
+			p[width] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		}
+	}
+
+
+	inline void appendDigits(std::string& text, int value, int width)
+		/// Appends the non-negative value, zero-padded to width digits.
+	{
+		char buffer[16];
+		int length = 1;
+		for (int v = value; v >= 10; v /= 10) ++length;
+		if (length < width) length = width;
+		writeDigits(buffer, value, length);
+		text.append(buffer, length);
+	}
+
+
+	const DateTimeFields& dateTimeFields(Timestamp::TimeVal time, int& micros)
+		/// Returns the broken-down date and time for the given epoch
+		/// microseconds, and stores the microseconds within the second
+		/// in micros. The fields are only recomputed if the second differs
+		/// from the one of the previous call in the same thread.
+	{
+		Timestamp::TimeVal seconds = time/Timestamp::resolution();
+		Timestamp::TimeVal fraction = time%Timestamp::resolution();
+		if (fraction < 0)
+		{
+			fraction += Timestamp::resolution();
+			--seconds;
+		}
+		micros = static_cast<int>(fraction);
+
+		DateTimeFields& fields = cachedFields;
+		if (fields.seconds != seconds)
+		{
+			const DateTime dateTime(Timestamp(seconds*Timestamp::resolution()));
+			fields.year = dateTime.year();
+			fields.month = dateTime.month();
+			fields.day = dateTime.day();
+			fields.dayOfWeek = dateTime.dayOfWeek();
+			fields.hour = dateTime.hour();
+			fields.hourAMPM = dateTime.hourAMPM();
+			fields.minute = dateTime.minute();
+			fields.second = dateTime.second();
+
+			char* p = fields.text;
+			writeDigits(p, fields.year, 4);
+			p[4] = '-';
+			writeDigits(p + 5, fields.month, 2);
+			p[7] = '-';
+			writeDigits(p + 8, fields.day, 2);
+			p[10] = ' ';
+			writeDigits(p + 11, fields.hour, 2);
+			p[13] = ':';
+			writeDigits(p + 14, fields.minute, 2);
+			p[16] = ':';
+			writeDigits(p + 17, fields.second, 2);
+			fields.seconds = seconds;
+		}
+		return fields;
+	}
+
+
+	inline Timestamp::TimeVal localTimeOffset()
+	{
+		return static_cast<Timestamp::TimeVal>(Timezone::utcOffset() + Timezone::dst())*Timestamp::resolution();
+	}
+
+
+	template <typename Actions>
+	bool isDateTimeSequence(const Actions& actions, std::size_t i)
+		/// Returns true if the actions starting at index i form
+		/// a "%Y-%m-%d %H:%M:%S" or "%Y-%m-%dT%H:%M:%S" sequence.
+	{
+		static const char KEYS[] = "YmdHMS";
+		static const char* const PREPENDS[] = {"", "-", "-", " ", ":", ":"};
+
+		if (actions.size() - i < 6) return false;
+		for (std::size_t k = 0; k < 6; k++)
+		{
+			const auto& pa = actions[i + k];
+			if (pa.key != KEYS[k]) return false;
+			if (k == 3 && pa.prepend == "T") continue;
+			if (k > 0 && pa.prepend != PREPENDS[k]) return false;
+		}
+		return true;
+	}
+}
+
+
+
 const std::string PatternFormatter::PROP_PATTERN = "pattern";
 const std::string PatternFormatter::PROP_TIMES   = "times";
 const std::string PatternFormatter::PROP_PRIORITY_NAMES = "priorityNames";
@@ -36,6 +161,8 @@ const std::string PatternFormatter::DEFAULT_PRIORITY_NAMES = "Fatal,Critical,Err
 std::string PatternFormatter::_cachedNodeName;
 
 PatternFormatter::PatternFormatter():
+	_sizeHint(0),
+	_needsDateTime(false),
 	_localTime(false),
 	_localTimeSet(false),
 	_priorityNames(DEFAULT_PRIORITY_NAMES)
@@ -45,6 +172,8 @@ PatternFormatter::PatternFormatter():
 
 
 PatternFormatter::PatternFormatter(const std::string& format):
+	_sizeHint(0),
+	_needsDateTime(false),
 	_localTime(false),
 	_localTimeSet(false),
 	_pattern(format),
@@ -62,15 +191,17 @@ PatternFormatter::~PatternFormatter()
 
 void PatternFormatter::format(const Message& msg, std::string& text)
 {
-	text.reserve(text.size() + 128);
-	Timestamp timestamp = msg.getTime();
+	text.reserve(text.size() + _sizeHint + msg.getSource().size() + msg.getText().size());
 	bool localTime = _localTime;
-	if (localTime)
+	Timestamp::TimeVal time = 0;
+	int micros = 0;
+	const DateTimeFields* pFields = nullptr;
+	if (_needsDateTime)
 	{
-		timestamp += Timezone::utcOffset()*Timestamp::resolution();
-		timestamp += Timezone::dst()*Timestamp::resolution();
+		time = msg.getTime().epochMicroseconds();
+		if (localTime) time += localTimeOffset();
+		pFields = &dateTimeFields(time, micros);
 	}
-	DateTime dateTime = timestamp;
 	for (auto& pa:_patternActions)
 	{
 		text.append(pa.prepend);
@@ -93,27 +224,27 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 		case 'U': text.append(msg.getSourceFile() ? msg.getSourceFile() : ""); break;
 		case 'O': text.append(extractBasename(msg.getSourceFile())); break;
 		case 'u': NumberFormatter::append(text, msg.getSourceLine()); break;
-		case 'w': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()], 0, 3); break;
-		case 'W': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()]); break;
-		case 'b': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1], 0, 3); break;
-		case 'B': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1]); break;
-		case 'd': NumberFormatter::append0(text, dateTime.day(), 2); break;
-		case 'e': NumberFormatter::append(text, dateTime.day()); break;
-		case 'f': NumberFormatter::append(text, dateTime.day(), 2); break;
-		case 'm': NumberFormatter::append0(text, dateTime.month(), 2); break;
-		case 'n': NumberFormatter::append(text, dateTime.month()); break;
-		case 'o': NumberFormatter::append(text, dateTime.month(), 2); break;
-		case 'y': NumberFormatter::append0(text, dateTime.year() % 100, 2); break;
-		case 'Y': NumberFormatter::append0(text, dateTime.year(), 4); break;
-		case 'H': NumberFormatter::append0(text, dateTime.hour(), 2); break;
-		case 'h': NumberFormatter::append0(text, dateTime.hourAMPM(), 2); break;
-		case 'a': text.append(dateTime.isAM() ? "am" : "pm"); break;
-		case 'A': text.append(dateTime.isAM() ? "AM" : "PM"); break;
-		case 'M': NumberFormatter::append0(text, dateTime.minute(), 2); break;
-		case 'S': NumberFormatter::append0(text, dateTime.second(), 2); break;
-		case 'i': NumberFormatter::append0(text, dateTime.millisecond(), 3); break;
-		case 'c': NumberFormatter::append0(text, dateTime.millisecond()/10, 2); break;
-		case 'F': NumberFormatter::append0(text, dateTime.millisecond()*1000 + dateTime.microsecond(), 6); break;
+		case 'w': text.append(DateTimeFormat::WEEKDAY_NAMES[pFields->dayOfWeek], 0, 3); break;
+		case 'W': text.append(DateTimeFormat::WEEKDAY_NAMES[pFields->dayOfWeek]); break;
+		case 'b': text.append(DateTimeFormat::MONTH_NAMES[pFields->month - 1], 0, 3); break;
+		case 'B': text.append(DateTimeFormat::MONTH_NAMES[pFields->month - 1]); break;
+		case 'd': appendDigits(text, pFields->day, 2); break;
+		case 'e': NumberFormatter::append(text, pFields->day); break;
+		case 'f': NumberFormatter::append(text, pFields->day, 2); break;
+		case 'm': appendDigits(text, pFields->month, 2); break;
+		case 'n': NumberFormatter::append(text, pFields->month); break;
+		case 'o': NumberFormatter::append(text, pFields->month, 2); break;
+		case 'y': appendDigits(text, pFields->year % 100, 2); break;
+		case 'Y': appendDigits(text, pFields->year, 4); break;
+		case 'H': appendDigits(text, pFields->hour, 2); break;
+		case 'h': appendDigits(text, pFields->hourAMPM, 2); break;
+		case 'a': text.append(pFields->hour < 12 ? "am" : "pm"); break;
+		case 'A': text.append(pFields->hour < 12 ? "AM" : "PM"); break;
+		case 'M': appendDigits(text, pFields->minute, 2); break;
+		case 'S': appendDigits(text, pFields->second, 2); break;
+		case 'i': appendDigits(text, micros/1000, 3); break;
+		case 'c': appendDigits(text, micros/10000, 2); break;
+		case 'F': appendDigits(text, micros, 6); break;
 		case 'z': text.append(DateTimeFormatter::tzdISO(localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
 		case 'Z': text.append(DateTimeFormatter::tzdRFC(localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
 		case 'E': NumberFormatter::append(text, msg.getTime().epochTime()); break;
@@ -138,11 +269,17 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 			if (!localTime)
 			{
 				localTime = true;
-				timestamp += Timezone::utcOffset()*Timestamp::resolution();
-				timestamp += Timezone::dst()*Timestamp::resolution();
-				dateTime = timestamp;
+				if (pFields)
+				{
+					time += localTimeOffset();
+					pFields = &dateTimeFields(time, micros);
+				}
 			}
 			break;
+		case KEY_DATETIME:
+			text.append(pFields->text, sizeof(pFields->text));
+			text[text.size() - 9] = pa.property[0];
+			break;
 		}
 	}
 }
@@ -151,6 +288,8 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 void PatternFormatter::parsePattern()
 {
 	_patternActions.clear();
+	_sizeHint = 0;
+	_needsDateTime = false;
 	std::string::const_iterator it  = _pattern.begin();
 	std::string::const_iterator end = _pattern.end();
 	PatternAction endAct;
@@ -204,6 +343,30 @@ void PatternFormatter::parsePattern()
 	{
 		_patternActions.push_back(endAct);
 	}
+
+	std::vector<PatternAction> actions;
+	actions.reserve(_patternActions.size());
+	for (std::size_t i = 0; i < _patternActions.size(); i++)
+	{
+		if (isDateTimeSequence(_patternActions, i))
+		{
+			PatternAction act;
+			act.key = KEY_DATETIME;
+			act.prepend = _patternActions[i].prepend;
+			act.property = _patternActions[i + 3].prepend;
+			actions.push_back(act);
+			i += 5;
+		}
+		else actions.push_back(_patternActions[i]);
+	}
+	_patternActions.swap(actions);
+
+	for (const auto& pa: _patternActions)
+	{
+		_sizeHint += pa.prepend.size() + 8;
+		if (pa.key == KEY_DATETIME || (pa.key && std::strchr(DATETIME_KEYS, pa.key)))
+			_needsDateTime = true;
+	}
 }
 
 
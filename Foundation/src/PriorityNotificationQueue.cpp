@@ -55,6 +55,30 @@ void PriorityNotificationQueue::enqueueNotification(Notification::Ptr pNotificat
 }
 
 
+void PriorityNotificationQueue::enqueueBatch(const std::vector<Notification::Ptr>& notifications, int priority)
+{
+	if (notifications.empty()) return;
+
+	FastMutex::ScopedLock lock(_mutex);
+	for (const auto& pNotification: notifications)
+	{
+		poco_check_ptr (pNotification);
+		if (_waitQueue.empty())
+		{
+			_nfQueue.insert(NfQueue::value_type(priority, pNotification));
+		}
+		else
+		{
+			poco_assert_dbg(_nfQueue.empty());
+			WaitInfo* pWI = _waitQueue.front();
+			_waitQueue.pop_front();
+			pWI->pNf = pNotification;
+			pWI->nfAvailable.set();
+		}
+	}
+}
+
+
 Notification* PriorityNotificationQueue::dequeueNotification()
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -113,6 +137,41 @@ Notification* PriorityNotificationQueue::waitDequeueNotification(long millisecon
 }
 
 
+std::size_t PriorityNotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	return dequeueMany(notifications, maxCount);
+}
+
+
+std::size_t PriorityNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	if (maxCount == 0) return 0;
+
+	std::size_t n = dequeueBatch(notifications, maxCount);
+	if (n > 0) return n;
+
+	Notification::Ptr pNf(waitDequeueNotification());
+	if (!pNf) return 0;
+	notifications.push_back(std::move(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+std::size_t PriorityNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount, long milliseconds)
+{
+	if (maxCount == 0) return 0;
+
+	std::size_t n = dequeueBatch(notifications, maxCount);
+	if (n > 0) return n;
+
+	Notification::Ptr pNf(waitDequeueNotification(milliseconds));
+	if (!pNf) return 0;
+	notifications.push_back(std::move(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
 void PriorityNotificationQueue::dispatch(NotificationCenter& notificationCenter)
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -177,6 +236,20 @@ Notification::Ptr PriorityNotificationQueue::dequeueOne()
 }
 
 
+std::size_t PriorityNotificationQueue::dequeueMany(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	std::size_t n = 0;
+	auto it = _nfQueue.begin();
+	while (n < maxCount && it != _nfQueue.end())
+	{
+		notifications.push_back(std::move(it->second));
+		it = _nfQueue.erase(it);
+		++n;
+	}
+	return n;
+}
+
+
 PriorityNotificationQueue& PriorityNotificationQueue::defaultQueue()
 {
 	static PriorityNotificationQueue pnq;
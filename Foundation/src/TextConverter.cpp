@@ -15,6 +15,14 @@
 #include "Poco/TextConverter.h"
 #include "Poco/TextIterator.h"
 #include "Poco/TextEncoding.h"
+#include "Poco/UTF8Encoding.h"
+#include "Poco/UTF16Encoding.h"
+#include "Poco/UTF32Encoding.h"
+#include "Poco/Latin1Encoding.h"
+#include "Poco/UTFTranscoder.h"
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
 
 
 namespace {
@@ -28,6 +36,141 @@ namespace {
 namespace Poco {
 
 
+namespace
+{
+	enum EncodingType
+	{
+		ENC_OTHER,
+		ENC_UTF8,
+		ENC_UTF16,
+		ENC_UTF32,
+		ENC_LATIN1
+	};
+
+
+	EncodingType encodingType(const TextEncoding& encoding)
+		/// Identifies the encodings supported by UTFTranscoder.
+		/// UTF-16 and UTF-32 are only supported in native byte order.
+	{
+#if defined(POCO_ARCH_BIG_ENDIAN)
+		const bool bigEndian = true;
+#else
+		const bool bigEndian = false;
+#endif
+		const std::type_info& type = typeid(encoding);
+		if (type == typeid(UTF8Encoding))
+		{
+			return ENC_UTF8;
+		}
+		else if (type == typeid(Latin1Encoding))
+		{
+			return ENC_LATIN1;
+		}
+		else if (type == typeid(UTF16Encoding))
+		{
+			const bool native = (static_cast<const UTF16Encoding&>(encoding).getByteOrder() == UTF16Encoding::BIG_ENDIAN_BYTE_ORDER) == bigEndian;
+			return native ? ENC_UTF16 : ENC_OTHER;
+		}
+		else if (type == typeid(UTF32Encoding))
+		{
+			const bool native = (static_cast<const UTF32Encoding&>(encoding).getByteOrder() == UTF32Encoding::BIG_ENDIAN_BYTE_ORDER) == bigEndian;
+			return native ? ENC_UTF32 : ENC_OTHER;
+		}
+		else return ENC_OTHER;
+	}
+
+
+	bool canTranscode(EncodingType inType, EncodingType outType)
+	{
+		return (inType == ENC_UTF8 && outType != ENC_OTHER) || (outType == ENC_UTF8 && inType != ENC_OTHER);
+	}
+
+
+	const std::size_t CHUNK_SIZE = 1024;
+
+
+	std::size_t transcode(EncodingType inType, EncodingType outType, const unsigned char* source, std::size_t length, std::string& destination)
+		/// Converts the longest well-formed prefix of source, which must not
+		/// be longer than CHUNK_SIZE bytes, with UTFTranscoder, and appends
+		/// the result to destination. Returns the number of bytes converted.
+	{
+		const char* data = reinterpret_cast<const char*>(source);
+		std::size_t outLength = 0;
+		std::size_t n = 0;
+		if (inType == ENC_UTF8)
+		{
+			switch (outType)
+			{
+			case ENC_UTF8:
+				n = UTFTranscoder::validUTF8Length(data, length);
+				destination.append(data, n);
+				break;
+			case ENC_UTF16:
+				{
+					UTF16Char buffer[CHUNK_SIZE];
+					n = UTFTranscoder::utf8ToUTF16(data, length, buffer, outLength);
+					destination.append(reinterpret_cast<const char*>(buffer), outLength*sizeof(UTF16Char));
+				}
+				break;
+			case ENC_UTF32:
+				{
+					UTF32Char buffer[CHUNK_SIZE];
+					n = UTFTranscoder::utf8ToUTF32(data, length, buffer, outLength);
+					destination.append(reinterpret_cast<const char*>(buffer), outLength*sizeof(UTF32Char));
+				}
+				break;
+			case ENC_LATIN1:
+				{
+					char buffer[CHUNK_SIZE];
+					n = UTFTranscoder::utf8ToLatin1(data, length, buffer, outLength);
+					destination.append(buffer, outLength);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		else
+		{
+			switch (inType)
+			{
+			case ENC_UTF16:
+				{
+					// the source may not be suitably aligned
+					UTF16Char units[CHUNK_SIZE/sizeof(UTF16Char)];
+					const std::size_t count = length/sizeof(UTF16Char);
+					std::memcpy(units, source, count*sizeof(UTF16Char));
+					char buffer[3*CHUNK_SIZE/sizeof(UTF16Char)];
+					n = UTFTranscoder::utf16ToUTF8(units, count, buffer, outLength)*sizeof(UTF16Char);
+					destination.append(buffer, outLength);
+				}
+				break;
+			case ENC_UTF32:
+				{
+					UTF32Char units[CHUNK_SIZE/sizeof(UTF32Char)];
+					const std::size_t count = length/sizeof(UTF32Char);
+					std::memcpy(units, source, count*sizeof(UTF32Char));
+					char buffer[4*CHUNK_SIZE/sizeof(UTF32Char)];
+					n = UTFTranscoder::utf32ToUTF8(units, count, buffer, outLength)*sizeof(UTF32Char);
+					destination.append(buffer, outLength);
+				}
+				break;
+			case ENC_LATIN1:
+				{
+					char buffer[2*CHUNK_SIZE];
+					destination.append(buffer, UTFTranscoder::latin1ToUTF8(data, length, buffer));
+					n = length;
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		return n;
+	}
+}
+
+
 TextConverter::TextConverter(const TextEncoding& inEncoding, const TextEncoding& outEncoding, int defaultChar):
 	_inEncoding(inEncoding),
 	_outEncoding(outEncoding),
@@ -70,44 +213,10 @@ int TextConverter::convert(const void* source, int length, std::string& destinat
 	int errors = 0;
 	const unsigned char* it  = (const unsigned char*) source;
 	const unsigned char* end = (const unsigned char*) source + length;
-	unsigned char buffer[TextEncoding::MAX_SEQUENCE_LENGTH];
 
 	while (it < end)
 	{
-		int n = _inEncoding.queryConvert(it, 1);
-		int uc;
-		int read = 1;
-
-		while (-1 > n && (end - it) >= -n)
-		{
-			read = -n;
-			n = _inEncoding.queryConvert(it, read);
-		}
-
-		if (-1 > n)
-		{
-			it = end;
-		}
-		else
-		{
-			it += read;
-		}
-
-		if (-1 >= n)
-		{
-			uc = _defaultChar;
-			++errors;
-		}
-		else
-		{
-			uc = n;
-		}
-
-		uc = trans(uc);
-		n = _outEncoding.convert(uc, buffer, sizeof(buffer));
-		if (n == 0) n = _outEncoding.convert(_defaultChar, buffer, sizeof(buffer));
-		poco_assert (static_cast<std::size_t>(n) <= sizeof(buffer));
-		destination.append((const char*) buffer, n);
+		errors += convertChar(it, end, destination, trans);
 	}
 	return errors;
 }
@@ -115,13 +224,77 @@ int TextConverter::convert(const void* source, int length, std::string& destinat
 
 int TextConverter::convert(const std::string& source, std::string& destination)
 {
-	return convert(source, destination, nullTransform);
+	if (canTranscode(encodingType(_inEncoding), encodingType(_outEncoding)))
+		return convert(source.data(), static_cast<int>(source.size()), destination);
+	else
+		return convert(source, destination, nullTransform);
 }
 
 
 int TextConverter::convert(const void* source, int length, std::string& destination)
 {
-	return convert(source, length, destination, nullTransform);
+	poco_check_ptr (source);
+
+	const EncodingType inType = encodingType(_inEncoding);
+	const EncodingType outType = encodingType(_outEncoding);
+	if (!canTranscode(inType, outType)) return convert(source, length, destination, nullTransform);
+
+	// Convert well-formed text in chunks, and everything
+	// else one character at a time.
+	int errors = 0;
+	const unsigned char* it  = (const unsigned char*) source;
+	const unsigned char* end = (const unsigned char*) source + length;
+
+	while (it < end)
+	{
+		const std::size_t chunk = std::min<std::size_t>(end - it, CHUNK_SIZE);
+		const std::size_t n = transcode(inType, outType, it, chunk, destination);
+		it += n;
+		if (n < chunk) errors += convertChar(it, end, destination, nullTransform);
+	}
+	return errors;
+}
+
+
+int TextConverter::convertChar(const unsigned char*& it, const unsigned char* end, std::string& destination, Transform trans)
+{
+	unsigned char buffer[TextEncoding::MAX_SEQUENCE_LENGTH];
+	int errors = 0;
+	int n = _inEncoding.queryConvert(it, 1);
+	int uc;
+	int read = 1;
+
+	while (-1 > n && (end - it) >= -n)
+	{
+		read = -n;
+		n = _inEncoding.queryConvert(it, read);
+	}
+
+	if (-1 > n)
+	{
+		it = end;
+	}
+	else
+	{
+		it += read;
+	}
+
+	if (-1 >= n)
+	{
+		uc = _defaultChar;
+		++errors;
+	}
+	else
+	{
+		uc = n;
+	}
+
+	uc = trans(uc);
+	n = _outEncoding.convert(uc, buffer, sizeof(buffer));
+	if (n == 0) n = _outEncoding.convert(_defaultChar, buffer, sizeof(buffer));
+	poco_assert (static_cast<std::size_t>(n) <= sizeof(buffer));
+	destination.append((const char*) buffer, n);
+	return errors;
 }
 
 
@@ -61,6 +61,31 @@ void TimedNotificationQueue::enqueueNotification(Notification::Ptr pNotification
 }
 
 
+void TimedNotificationQueue::enqueueBatch(const std::vector<Notification::Ptr>& notifications, Timestamp timestamp)
+{
+	Timestamp tsNow;
+	Clock clock;
+	Timestamp::TimeDiff diff = timestamp - tsNow;
+	clock += diff;
+
+	enqueueBatch(notifications, clock);
+}
+
+
+void TimedNotificationQueue::enqueueBatch(const std::vector<Notification::Ptr>& notifications, Clock clock)
+{
+	if (notifications.empty()) return;
+
+	FastMutex::ScopedLock lock(_mutex);
+	for (const auto& pNotification: notifications)
+	{
+		poco_check_ptr (pNotification);
+		_nfQueue.insert(NfQueue::value_type(clock, pNotification));
+	}
+	_nfAvailable.set();
+}
+
+
 Notification* TimedNotificationQueue::dequeueNotification()
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -167,6 +192,49 @@ Notification* TimedNotificationQueue::waitDequeueNotification(long milliseconds)
 }
 
 
+std::size_t TimedNotificationQueue::dequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	Clock now;
+	std::size_t n = 0;
+	auto it = _nfQueue.begin();
+	while (n < maxCount && it != _nfQueue.end() && it->first <= now)
+	{
+		notifications.push_back(std::move(it->second));
+		it = _nfQueue.erase(it);
+		++n;
+	}
+	return n;
+}
+
+
+std::size_t TimedNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount)
+{
+	if (maxCount == 0) return 0;
+
+	std::size_t n = dequeueBatch(notifications, maxCount);
+	if (n > 0) return n;
+
+	notifications.push_back(Notification::Ptr(waitDequeueNotification()));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
+std::size_t TimedNotificationQueue::waitDequeueBatch(std::vector<Notification::Ptr>& notifications, std::size_t maxCount, long milliseconds)
+{
+	if (maxCount == 0) return 0;
+
+	std::size_t n = dequeueBatch(notifications, maxCount);
+	if (n > 0) return n;
+
+	Notification::Ptr pNf(waitDequeueNotification(milliseconds));
+	if (!pNf) return 0;
+	notifications.push_back(std::move(pNf));
+	return 1 + dequeueBatch(notifications, maxCount - 1);
+}
+
+
 bool TimedNotificationQueue::wait(Clock::ClockDiff interval)
 {
 	const Clock::ClockDiff MAX_SLEEP = 8*60*60*Clock::ClockDiff(1000000); // sleep at most 8 hours at a time
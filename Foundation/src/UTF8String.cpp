@@ -18,6 +18,7 @@
 #include "Poco/TextIterator.h"
 #include "Poco/TextConverter.h"
 #include "Poco/UTF8Encoding.h"
+#include "Poco/UTFTranscoder.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Ascii.h"
 #include "Poco/Buffer.h"
@@ -189,6 +190,18 @@ void UTF8::removeBOM(std::string& str)
 }
 
 
+bool UTF8::isValid(const std::string& str)
+{
+	return UTFTranscoder::isValidUTF8(str.data(), str.size());
+}
+
+
+bool UTF8::isValid(const char* str, std::size_t length)
+{
+	return UTFTranscoder::isValidUTF8(str, length);
+}
+
+
 std::string UTF8::escape(const std::string &s, bool strictJSON)
 {
 	return escape(s.begin(), s.end(), strictJSON);
@@ -0,0 +1,784 @@
+//
+// UTFTranscoder.cpp
+//
+// Library: Foundation
+// Package: Text
+// Module:  UTFTranscoder
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/UTFTranscoder.h"
+#include <cstring>
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_UTF_SSE2
+	#include <emmintrin.h>
+	#if defined(__SSSE3__) || defined(__AVX__)
+		#define POCO_UTF_SSSE3
+		#define POCO_UTF_SSSE3_TARGET
+		#include <tmmintrin.h>
+	#elif defined(__GNUC__)
+		#define POCO_UTF_SSSE3
+		#define POCO_UTF_SSSE3_DISPATCH
+		#define POCO_UTF_SSSE3_TARGET __attribute__((target("ssse3")))
+		#include <tmmintrin.h>
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_UTF_NEON
+	#include <arm_neon.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	inline std::size_t decodeSequence(const unsigned char* p, const unsigned char* end, UInt32& cp)
+		/// Decodes the UTF-8 sequence at p. Returns its length, or 0 if the
+		/// sequence is not well-formed or incomplete. Accepts the same
+		/// sequences as UTF8Encoding::isLegal().
+	{
+		const UInt32 c = p[0];
+		if (c < 0x80)
+		{
+			cp = c;
+			return 1;
+		}
+		else if (c < 0xC2)
+		{
+			return 0;
+		}
+		else if (c < 0xE0)
+		{
+			if (end - p < 2 || (p[1] & 0xC0) != 0x80) return 0;
+			cp = ((c & 0x1F) << 6) | (p[1] & 0x3F);
+			return 2;
+		}
+		else if (c < 0xF0)
+		{
+			if (end - p < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80) return 0;
+			if (c == 0xE0 && p[1] < 0xA0) return 0; // overlong
+			if (c == 0xED && p[1] > 0x9F) return 0; // surrogate
+			cp = ((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+			return 3;
+		}
+		else if (c < 0xF5)
+		{
+			if (end - p < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80) return 0;
+			if (c == 0xF0 && p[1] < 0x90) return 0; // overlong
+			if (c == 0xF4 && p[1] > 0x8F) return 0; // above U+10FFFF
+			cp = ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+			return 4;
+		}
+		else return 0;
+	}
+
+
+	inline char* encodeSequence(UInt32 cp, char* q)
+		/// Writes the UTF-8 sequence for the given code point, which
+		/// must be a valid Unicode scalar value, to q.
+	{
+		if (cp < 0x80)
+		{
+			*q++ = static_cast<char>(cp);
+		}
+		else if (cp < 0x800)
+		{
+			*q++ = static_cast<char>(0xC0 | (cp >> 6));
+			*q++ = static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000)
+		{
+			*q++ = static_cast<char>(0xE0 | (cp >> 12));
+			*q++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			*q++ = static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			*q++ = static_cast<char>(0xF0 | (cp >> 18));
+			*q++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+			*q++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			*q++ = static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		return q;
+	}
+
+
+	std::size_t validateScalar(const unsigned char* p, const unsigned char* end)
+	{
+		const unsigned char* const begin = p;
+		while (p < end)
+		{
+			while (end - p >= 8)
+			{
+				UInt64 x;
+				std::memcpy(&x, p, sizeof(x));
+				if (x & 0x8080808080808080ULL) break;
+				p += 8;
+			}
+			if (p == end) break;
+			if (*p < 0x80)
+			{
+				++p;
+			}
+			else
+			{
+				UInt32 cp;
+				const std::size_t n = decodeSequence(p, end, cp);
+				if (n == 0) break;
+				p += n;
+			}
+		}
+		return p - begin;
+	}
+
+
+	//
+	// The SIMD functions below process complete blocks only and
+	// return the number of input units processed.
+	//
+
+#if defined(POCO_UTF_SSSE3)
+
+	POCO_UTF_SSSE3_TARGET std::size_t validateSSSE3(const unsigned char* p, std::size_t length)
+		/// Validates 16 bytes per iteration, using the lookup algorithm
+		/// by John Keiser and Daniel Lemire ("Validating UTF-8 In Less Than
+		/// One Instruction Per Byte", 2020). Every byte pair is classified
+		/// by three table lookups. Stops at the first block containing an
+		/// error, and before a block that follows an incomplete sequence.
+		/// Sequences ending in the returned block may be incomplete.
+	{
+		// error flags for byte pairs
+		enum : unsigned char
+		{
+			TOO_SHORT      = 1 << 0, // lead byte not followed by continuation
+			TOO_LONG       = 1 << 1, // ASCII followed by continuation
+			OVERLONG_3     = 1 << 2,
+			TOO_LARGE      = 1 << 3,
+			SURROGATE      = 1 << 4,
+			OVERLONG_2     = 1 << 5,
+			TOO_LARGE_1000 = 1 << 6,
+			OVERLONG_4     = 1 << 6,
+			TWO_CONTS      = 1 << 7, // two continuations; an error only if not expected
+			CARRY          = TOO_SHORT | TOO_LONG | TWO_CONTS
+		};
+
+		const __m128i byte1High = _mm_setr_epi8(
+			TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+			static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS),
+			TOO_SHORT | OVERLONG_2,
+			TOO_SHORT,
+			TOO_SHORT | OVERLONG_3 | SURROGATE,
+			TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+		const __m128i byte1Low = _mm_setr_epi8(
+			static_cast<char>(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4),
+			static_cast<char>(CARRY | OVERLONG_2),
+			static_cast<char>(CARRY),
+			static_cast<char>(CARRY),
+			static_cast<char>(CARRY | TOO_LARGE),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000));
+		const __m128i byte2High = _mm_setr_epi8(
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+			static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4),
+			static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+			static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+			static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+		// the last three bytes of a block must not start sequences
+		// that extend beyond the block
+		const __m128i maxValue = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i zero = _mm_setzero_si128();
+
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+		__m128i prev = zero;
+
+		while (end - p >= 16)
+		{
+			const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			if (_mm_movemask_epi8(in) == 0)
+			{
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(prev, maxValue), zero)) != 0xFFFF) break;
+			}
+			else
+			{
+				const __m128i prev1 = _mm_alignr_epi8(in, prev, 15);
+				__m128i error = _mm_and_si128(
+					_mm_and_si128(
+						_mm_shuffle_epi8(byte1High, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+						_mm_shuffle_epi8(byte1Low, _mm_and_si128(prev1, nibble))),
+					_mm_shuffle_epi8(byte2High, _mm_and_si128(_mm_srli_epi16(in, 4), nibble)));
+
+				// continuation bytes must follow three- and four-byte lead bytes
+				const __m128i prev2 = _mm_alignr_epi8(in, prev, 14);
+				const __m128i prev3 = _mm_alignr_epi8(in, prev, 13);
+				const __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+				const __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+				const __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+				error = _mm_xor_si128(error, must23);
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF) break;
+			}
+			prev = in;
+			p += 16;
+		}
+		return p - begin;
+	}
+
+#endif // POCO_UTF_SSSE3
+
+
+#if defined(POCO_UTF_NEON)
+
+	std::size_t validateNEON(const unsigned char* p, std::size_t length)
+		/// NEON variant of validateSSSE3().
+	{
+		enum : unsigned char
+		{
+			TOO_SHORT      = 1 << 0,
+			TOO_LONG       = 1 << 1,
+			OVERLONG_3     = 1 << 2,
+			TOO_LARGE      = 1 << 3,
+			SURROGATE      = 1 << 4,
+			OVERLONG_2     = 1 << 5,
+			TOO_LARGE_1000 = 1 << 6,
+			OVERLONG_4     = 1 << 6,
+			TWO_CONTS      = 1 << 7,
+			CARRY          = TOO_SHORT | TOO_LONG | TWO_CONTS
+		};
+
+		static const unsigned char BYTE1_HIGH[16] =
+		{
+			TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+			TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+			TOO_SHORT | OVERLONG_2,
+			TOO_SHORT,
+			TOO_SHORT | OVERLONG_3 | SURROGATE,
+			TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+		};
+		static const unsigned char BYTE1_LOW[16] =
+		{
+			CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+			CARRY | OVERLONG_2,
+			CARRY,
+			CARRY,
+			CARRY | TOO_LARGE,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000
+		};
+		static const unsigned char BYTE2_HIGH[16] =
+		{
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+		};
+		static const unsigned char MAX_VALUE[16] =
+		{
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+		};
+
+		const uint8x16_t byte1High = vld1q_u8(BYTE1_HIGH);
+		const uint8x16_t byte1Low = vld1q_u8(BYTE1_LOW);
+		const uint8x16_t byte2High = vld1q_u8(BYTE2_HIGH);
+		const uint8x16_t maxValue = vld1q_u8(MAX_VALUE);
+		const uint8x16_t nibble = vdupq_n_u8(0x0F);
+
+		const unsigned char* const begin = p;
+		const unsigned char* const end = p + length;
+		uint8x16_t prev = vdupq_n_u8(0);
+
+		while (end - p >= 16)
+		{
+			const uint8x16_t in = vld1q_u8(p);
+			if (vmaxvq_u8(in) < 0x80)
+			{
+				if (vmaxvq_u8(vqsubq_u8(prev, maxValue)) != 0) break;
+			}
+			else
+			{
+				const uint8x16_t prev1 = vextq_u8(prev, in, 15);
+				uint8x16_t error = vandq_u8(
+					vandq_u8(vqtbl1q_u8(byte1High, vshrq_n_u8(prev1, 4)), vqtbl1q_u8(byte1Low, vandq_u8(prev1, nibble))),
+					vqtbl1q_u8(byte2High, vshrq_n_u8(in, 4)));
+
+				const uint8x16_t prev2 = vextq_u8(prev, in, 14);
+				const uint8x16_t prev3 = vextq_u8(prev, in, 13);
+				const uint8x16_t third = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+				const uint8x16_t fourth = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+				error = veorq_u8(error, vandq_u8(vorrq_u8(third, fourth), vdupq_n_u8(0x80)));
+				if (vmaxvq_u8(error) != 0) break;
+			}
+			prev = in;
+			p += 16;
+		}
+		return p - begin;
+	}
+
+#endif // POCO_UTF_NEON
+
+
+#if defined(POCO_UTF_SSE2)
+
+	inline std::size_t asciiBlocks(const unsigned char* p, std::size_t length)
+	{
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n));
+			if (_mm_movemask_epi8(in) != 0) break;
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t asciiToUTF16Blocks(const unsigned char* p, std::size_t length, UTF16Char* q)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n));
+			if (_mm_movemask_epi8(in) != 0) break;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n), _mm_unpacklo_epi8(in, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n + 8), _mm_unpackhi_epi8(in, zero));
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t asciiToUTF32Blocks(const unsigned char* p, std::size_t length, UTF32Char* q)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n));
+			if (_mm_movemask_epi8(in) != 0) break;
+			const __m128i lo = _mm_unpacklo_epi8(in, zero);
+			const __m128i hi = _mm_unpackhi_epi8(in, zero);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n), _mm_unpacklo_epi16(lo, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n + 4), _mm_unpackhi_epi16(lo, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n + 8), _mm_unpacklo_epi16(hi, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n + 12), _mm_unpackhi_epi16(hi, zero));
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t utf16ToASCIIBlocks(const UTF16Char* p, std::size_t length, char* q)
+	{
+		const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+		const __m128i zero = _mm_setzero_si128();
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n));
+			const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n + 8));
+			const __m128i high = _mm_and_si128(_mm_or_si128(in0, in1), mask);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) break;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n), _mm_packus_epi16(in0, in1));
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t utf32ToASCIIBlocks(const UTF32Char* p, std::size_t length, char* q)
+	{
+		const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+		const __m128i zero = _mm_setzero_si128();
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n));
+			const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n + 4));
+			const __m128i in2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n + 8));
+			const __m128i in3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n + 12));
+			const __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(in0, in1), _mm_or_si128(in2, in3)), mask);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) break;
+			const __m128i lo = _mm_packs_epi32(in0, in1);
+			const __m128i hi = _mm_packs_epi32(in2, in3);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(q + n), _mm_packus_epi16(lo, hi));
+			n += 16;
+		}
+		return n;
+	}
+
+#elif defined(POCO_UTF_NEON)
+
+	inline std::size_t asciiBlocks(const unsigned char* p, std::size_t length)
+	{
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			if (vmaxvq_u8(vld1q_u8(p + n)) >= 0x80) break;
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t asciiToUTF16Blocks(const unsigned char* p, std::size_t length, UTF16Char* q)
+	{
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const uint8x16_t in = vld1q_u8(p + n);
+			if (vmaxvq_u8(in) >= 0x80) break;
+			vst1q_u16(reinterpret_cast<uint16_t*>(q + n), vmovl_u8(vget_low_u8(in)));
+			vst1q_u16(reinterpret_cast<uint16_t*>(q + n + 8), vmovl_high_u8(in));
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t asciiToUTF32Blocks(const unsigned char* p, std::size_t length, UTF32Char* q)
+	{
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const uint8x16_t in = vld1q_u8(p + n);
+			if (vmaxvq_u8(in) >= 0x80) break;
+			const uint16x8_t lo = vmovl_u8(vget_low_u8(in));
+			const uint16x8_t hi = vmovl_high_u8(in);
+			vst1q_u32(reinterpret_cast<uint32_t*>(q + n), vmovl_u16(vget_low_u16(lo)));
+			vst1q_u32(reinterpret_cast<uint32_t*>(q + n + 4), vmovl_high_u16(lo));
+			vst1q_u32(reinterpret_cast<uint32_t*>(q + n + 8), vmovl_u16(vget_low_u16(hi)));
+			vst1q_u32(reinterpret_cast<uint32_t*>(q + n + 12), vmovl_high_u16(hi));
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t utf16ToASCIIBlocks(const UTF16Char* p, std::size_t length, char* q)
+	{
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const uint16x8_t in0 = vld1q_u16(reinterpret_cast<const uint16_t*>(p + n));
+			const uint16x8_t in1 = vld1q_u16(reinterpret_cast<const uint16_t*>(p + n + 8));
+			if (vmaxvq_u16(vorrq_u16(in0, in1)) >= 0x80) break;
+			vst1q_u8(reinterpret_cast<uint8_t*>(q + n), vcombine_u8(vmovn_u16(in0), vmovn_u16(in1)));
+			n += 16;
+		}
+		return n;
+	}
+
+
+	inline std::size_t utf32ToASCIIBlocks(const UTF32Char* p, std::size_t length, char* q)
+	{
+		std::size_t n = 0;
+		while (length - n >= 16)
+		{
+			const uint32x4_t in0 = vld1q_u32(reinterpret_cast<const uint32_t*>(p + n));
+			const uint32x4_t in1 = vld1q_u32(reinterpret_cast<const uint32_t*>(p + n + 4));
+			const uint32x4_t in2 = vld1q_u32(reinterpret_cast<const uint32_t*>(p + n + 8));
+			const uint32x4_t in3 = vld1q_u32(reinterpret_cast<const uint32_t*>(p + n + 12));
+			if (vmaxvq_u32(vorrq_u32(vorrq_u32(in0, in1), vorrq_u32(in2, in3))) >= 0x80) break;
+			const uint16x8_t lo = vcombine_u16(vmovn_u32(in0), vmovn_u32(in1));
+			const uint16x8_t hi = vcombine_u16(vmovn_u32(in2), vmovn_u32(in3));
+			vst1q_u8(reinterpret_cast<uint8_t*>(q + n), vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+			n += 16;
+		}
+		return n;
+	}
+
+#else
+
+	inline std::size_t asciiBlocks(const unsigned char*, std::size_t)
+	{
+		return 0;
+	}
+
+
+	inline std::size_t asciiToUTF16Blocks(const unsigned char*, std::size_t, UTF16Char*)
+	{
+		return 0;
+	}
+
+
+	inline std::size_t asciiToUTF32Blocks(const unsigned char*, std::size_t, UTF32Char*)
+	{
+		return 0;
+	}
+
+
+	inline std::size_t utf16ToASCIIBlocks(const UTF16Char*, std::size_t, char*)
+	{
+		return 0;
+	}
+
+
+	inline std::size_t utf32ToASCIIBlocks(const UTF32Char*, std::size_t, char*)
+	{
+		return 0;
+	}
+
+#endif
+
+
+	std::size_t validateBlocks(const unsigned char* p, std::size_t length)
+	{
+#if defined(POCO_UTF_SSSE3_DISPATCH)
+		static const bool haveSSSE3 = __builtin_cpu_supports("ssse3");
+		return haveSSSE3 ? validateSSSE3(p, length) : asciiBlocks(p, length);
+#elif defined(POCO_UTF_SSSE3)
+		return validateSSSE3(p, length);
+#elif defined(POCO_UTF_NEON)
+		return validateNEON(p, length);
+#else
+		return asciiBlocks(p, length);
+#endif
+	}
+}
+
+
+std::size_t UTFTranscoder::asciiLength(const char* data, std::size_t length)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	std::size_t n = asciiBlocks(p, length);
+	while (n < length && p[n] < 0x80) ++n;
+	return n;
+}
+
+
+std::size_t UTFTranscoder::validUTF8Length(const char* data, std::size_t length)
+{
+	const unsigned char* const begin = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* const end = begin + length;
+
+	// The block validator stops at the block containing an error (or
+	// the end of the data). Everything before is valid, except for a
+	// sequence crossing into that block. Back up to its lead byte
+	// and find the exact position with the scalar validator.
+	const unsigned char* blocksEnd = begin + validateBlocks(begin, length);
+	const unsigned char* p = blocksEnd - (blocksEnd - begin < 3 ? blocksEnd - begin : 3);
+	while (p < blocksEnd && (*p & 0xC0) == 0x80) ++p;
+	return (p - begin) + validateScalar(p, end);
+}
+
+
+std::size_t UTFTranscoder::utf8ToUTF16(const char* data, std::size_t length, UTF16Char* out, std::size_t& outLength)
+{
+	const unsigned char* const begin = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* const end = begin + length;
+	const unsigned char* p = begin;
+	UTF16Char* q = out;
+
+	while (p < end)
+	{
+		if (*p < 0x80)
+		{
+			const std::size_t n = asciiToUTF16Blocks(p, end - p, q);
+			p += n;
+			q += n;
+			while (p < end && *p < 0x80) *q++ = *p++;
+		}
+		else
+		{
+			UInt32 cp;
+			const std::size_t n = decodeSequence(p, end, cp);
+			if (n == 0) break;
+			if (cp < 0x10000)
+			{
+				*q++ = static_cast<UTF16Char>(cp);
+			}
+			else
+			{
+				cp -= 0x10000;
+				*q++ = static_cast<UTF16Char>(0xD800 | (cp >> 10));
+				*q++ = static_cast<UTF16Char>(0xDC00 | (cp & 0x3FF));
+			}
+			p += n;
+		}
+	}
+	outLength = q - out;
+	return p - begin;
+}
+
+
+std::size_t UTFTranscoder::utf8ToUTF32(const char* data, std::size_t length, UTF32Char* out, std::size_t& outLength)
+{
+	const unsigned char* const begin = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* const end = begin + length;
+	const unsigned char* p = begin;
+	UTF32Char* q = out;
+
+	while (p < end)
+	{
+		if (*p < 0x80)
+		{
+			const std::size_t n = asciiToUTF32Blocks(p, end - p, q);
+			p += n;
+			q += n;
+			while (p < end && *p < 0x80) *q++ = *p++;
+		}
+		else
+		{
+			UInt32 cp;
+			const std::size_t n = decodeSequence(p, end, cp);
+			if (n == 0) break;
+			*q++ = static_cast<UTF32Char>(cp);
+			p += n;
+		}
+	}
+	outLength = q - out;
+	return p - begin;
+}
+
+
+std::size_t UTFTranscoder::utf8ToLatin1(const char* data, std::size_t length, char* out, std::size_t& outLength)
+{
+	const unsigned char* const begin = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* const end = begin + length;
+	const unsigned char* p = begin;
+	char* q = out;
+
+	while (p < end)
+	{
+		if (*p < 0x80)
+		{
+			const std::size_t n = asciiBlocks(p, end - p);
+			std::memcpy(q, p, n);
+			p += n;
+			q += n;
+			while (p < end && *p < 0x80) *q++ = static_cast<char>(*p++);
+		}
+		else if ((*p == 0xC2 || *p == 0xC3) && end - p >= 2 && (p[1] & 0xC0) == 0x80)
+		{
+			*q++ = static_cast<char>(((p[0] & 0x1F) << 6) | (p[1] & 0x3F));
+			p += 2;
+		}
+		else break;
+	}
+	outLength = q - out;
+	return p - begin;
+}
+
+
+std::size_t UTFTranscoder::utf16ToUTF8(const UTF16Char* data, std::size_t length, char* out, std::size_t& outLength)
+{
+	const UTF16Char* p = data;
+	const UTF16Char* const end = data + length;
+	char* q = out;
+
+	while (p < end)
+	{
+		const UInt32 c = static_cast<UInt16>(*p);
+		if (c < 0x80)
+		{
+			const std::size_t n = utf16ToASCIIBlocks(p, end - p, q);
+			p += n;
+			q += n;
+			while (p < end && static_cast<UInt16>(*p) < 0x80) *q++ = static_cast<char>(*p++);
+		}
+		else if (c < 0xD800 || c >= 0xE000)
+		{
+			q = encodeSequence(c, q);
+			++p;
+		}
+		else if (c < 0xDC00 && end - p >= 2 && static_cast<UInt16>(p[1]) >= 0xDC00 && static_cast<UInt16>(p[1]) < 0xE000)
+		{
+			q = encodeSequence((((c & 0x3FF) << 10) | (static_cast<UInt16>(p[1]) & 0x3FF)) + 0x10000, q);
+			p += 2;
+		}
+		else break;
+	}
+	outLength = q - out;
+	return p - data;
+}
+
+
+std::size_t UTFTranscoder::utf32ToUTF8(const UTF32Char* data, std::size_t length, char* out, std::size_t& outLength)
+{
+	const UTF32Char* p = data;
+	const UTF32Char* const end = data + length;
+	char* q = out;
+
+	while (p < end)
+	{
+		const UInt32 c = static_cast<UInt32>(*p);
+		if (c < 0x80)
+		{
+			const std::size_t n = utf32ToASCIIBlocks(p, end - p, q);
+			p += n;
+			q += n;
+			while (p < end && static_cast<UInt32>(*p) < 0x80) *q++ = static_cast<char>(*p++);
+		}
+		else if (c < 0xD800 || (c >= 0xE000 && c <= 0x10FFFF))
+		{
+			q = encodeSequence(c, q);
+			++p;
+		}
+		else break;
+	}
+	outLength = q - out;
+	return p - data;
+}
+
+
+std::size_t UTFTranscoder::latin1ToUTF8(const char* data, std::size_t length, char* out)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* const end = p + length;
+	char* q = out;
+
+	while (p < end)
+	{
+		if (*p < 0x80)
+		{
+			const std::size_t n = asciiBlocks(p, end - p);
+			std::memcpy(q, p, n);
+			p += n;
+			q += n;
+			while (p < end && *p < 0x80) *q++ = static_cast<char>(*p++);
+		}
+		else
+		{
+			*q++ = static_cast<char>(0xC0 | (*p >> 6));
+			*q++ = static_cast<char>(0x80 | (*p & 0x3F));
+			++p;
+		}
+	}
+	return q - out;
+}
+
+
+} // namespace Poco
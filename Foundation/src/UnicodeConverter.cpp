@@ -18,6 +18,7 @@
 #include "Poco/UTF8Encoding.h"
 #include "Poco/UTF16Encoding.h"
 #include "Poco/UTF32Encoding.h"
+#include "Poco/UTFTranscoder.h"
 #include <cstring>
 
 
@@ -26,28 +27,32 @@ namespace Poco {
 
 void UnicodeConverter::convert(const std::string& utf8String, UTF32String& utf32String)
 {
-	utf32String.clear();
-	UTF8Encoding utf8Encoding;
-	TextIterator it(utf8String, utf8Encoding);
-	TextIterator end(utf8String);
-
-	while (it != end)
-	{
-		int cc = *it++;
-		utf32String += (UTF32Char) cc;
-	}
+	convert(utf8String.data(), utf8String.size(), utf32String);
 }
 
 
 void UnicodeConverter::convert(const char* utf8String, std::size_t length, UTF32String& utf32String)
 {
-	if (!utf8String || !length)
+	utf32String.clear();
+	if (!utf8String || !length) return;
+
+	utf32String.resize(length);
+	std::size_t outLength = 0;
+	const std::size_t n = UTFTranscoder::utf8ToUTF32(utf8String, length, utf32String.data(), outLength);
+	utf32String.resize(outLength);
+	if (n < length)
 	{
-		utf32String.clear();
-		return;
+		// invalid UTF-8 sequence; convert the rest character by character
+		const std::string rest(utf8String + n, length - n);
+		UTF8Encoding utf8Encoding;
+		TextIterator it(rest, utf8Encoding);
+		TextIterator end(rest);
+		while (it != end)
+		{
+			int cc = *it++;
+			utf32String += (UTF32Char) cc;
+		}
 	}
-
-	convert(std::string(utf8String, utf8String + length), utf32String);
 }
 
 
@@ -65,36 +70,41 @@ void UnicodeConverter::convert(const char* utf8String, UTF32String& utf32String)
 
 void UnicodeConverter::convert(const std::string& utf8String, UTF16String& utf16String)
 {
-	utf16String.clear();
-	UTF8Encoding utf8Encoding;
-	TextIterator it(utf8String, utf8Encoding);
-	TextIterator end(utf8String);
-	while (it != end)
-	{
-		int cc = *it++;
-		if (cc <= 0xffff)
-		{
-			utf16String += (UTF16Char) cc;
-		}
-		else
-		{
-			cc -= 0x10000;
-			utf16String += (UTF16Char) ((cc >> 10) & 0x3ff) | 0xd800;
-			utf16String += (UTF16Char) (cc & 0x3ff) | 0xdc00;
-		}
-	}
+	convert(utf8String.data(), utf8String.size(), utf16String);
 }
 
 
 void UnicodeConverter::convert(const char* utf8String,  std::size_t length, UTF16String& utf16String)
 {
-	if (!utf8String || !length)
+	utf16String.clear();
+	if (!utf8String || !length) return;
+
+	utf16String.resize(length);
+	std::size_t outLength = 0;
+	const std::size_t n = UTFTranscoder::utf8ToUTF16(utf8String, length, utf16String.data(), outLength);
+	utf16String.resize(outLength);
+	if (n < length)
 	{
-		utf16String.clear();
-		return;
+		// invalid UTF-8 sequence; convert the rest character by character
+		const std::string rest(utf8String + n, length - n);
+		UTF8Encoding utf8Encoding;
+		TextIterator it(rest, utf8Encoding);
+		TextIterator end(rest);
+		while (it != end)
+		{
+			int cc = *it++;
+			if (cc <= 0xffff)
+			{
+				utf16String += (UTF16Char) cc;
+			}
+			else
+			{
+				cc -= 0x10000;
+				utf16String += (UTF16Char) ((cc >> 10) & 0x3ff) | 0xd800;
+				utf16String += (UTF16Char) (cc & 0x3ff) | 0xdc00;
+			}
+		}
 	}
-
-	convert(std::string(utf8String, utf8String + length), utf16String);
 }
 
 
@@ -106,7 +116,7 @@ void UnicodeConverter::convert(const char* utf8String, UTF16String& utf16String)
 		return;
 	}
 
-	convert(std::string(utf8String), utf16String);
+	convert(utf8String, std::strlen(utf8String), utf16String);
 }
 
 
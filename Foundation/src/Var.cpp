@@ -233,6 +233,8 @@ bool Var::operator == (const Var& other) const
 {
 	if (isEmpty() != other.isEmpty()) return false;
 	if (isEmpty() && other.isEmpty()) return true;
+	bool result;
+	if (equalsTagged(other, result)) return result;
 	return convert<std::string>() == other.convert<std::string>();
 }
 
@@ -240,29 +242,29 @@ bool Var::operator == (const Var& other) const
 bool Var::operator == (const char* other) const
 {
 	if (isEmpty()) return false;
+	if (tag() == TAG_STRING) return extract<std::string>() == other;
 	return convert<std::string>() == other;
 }
 
 
 bool Var::operator != (const Var& other) const
 {
-	if (isEmpty() && other.isEmpty()) return false;
-	else if (isEmpty() || other.isEmpty()) return true;
-
-	return convert<std::string>() != other.convert<std::string>();
+	return !(*this == other);
 }
 
 
 bool Var::operator != (const char* other) const
 {
 	if (isEmpty()) return true;
-	return convert<std::string>() != other;
+	return !(*this == other);
 }
 
 
 bool Var::operator < (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (tag() == TAG_STRING && other.tag() == TAG_STRING)
+		return extract<std::string>() < other.extract<std::string>();
 	return convert<std::string>() < other.convert<std::string>();
 }
 
@@ -270,6 +272,8 @@ bool Var::operator < (const Var& other) const
 bool Var::operator <= (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (tag() == TAG_STRING && other.tag() == TAG_STRING)
+		return extract<std::string>() <= other.extract<std::string>();
 	return convert<std::string>() <= other.convert<std::string>();
 }
 
@@ -277,6 +281,8 @@ bool Var::operator <= (const Var& other) const
 bool Var::operator > (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (tag() == TAG_STRING && other.tag() == TAG_STRING)
+		return extract<std::string>() > other.extract<std::string>();
 	return convert<std::string>() > other.convert<std::string>();
 }
 
@@ -284,10 +290,67 @@ bool Var::operator > (const Var& other) const
 bool Var::operator >= (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (tag() == TAG_STRING && other.tag() == TAG_STRING)
+		return extract<std::string>() >= other.extract<std::string>();
 	return convert<std::string>() >= other.convert<std::string>();
 }
 
 
+bool Var::equalsTagged(const Var& other, bool& result) const
+{
+	const Tag left = tag();
+	const Tag right = other.tag();
+	if (left == TAG_NONE || right == TAG_NONE) return false;
+
+	const bool leftInteger = left >= TAG_INT8 && left <= TAG_UINT64;
+	const bool rightInteger = right >= TAG_INT8 && right <= TAG_UINT64;
+	if (leftInteger && rightInteger)
+	{
+		// Integers convert to their decimal representation, so
+		// equal strings mean equal values, regardless of type.
+		const bool leftSigned = left <= TAG_INT64;
+		const bool rightSigned = right <= TAG_INT64;
+		if (leftSigned && rightSigned)
+		{
+			result = convert<Int64>() == other.convert<Int64>();
+		}
+		else if (!leftSigned && !rightSigned)
+		{
+			result = convert<UInt64>() == other.convert<UInt64>();
+		}
+		else
+		{
+			const Var& s = leftSigned ? *this : other;
+			const Var& u = leftSigned ? other : *this;
+			const Int64 value = s.convert<Int64>();
+			result = value >= 0 && static_cast<UInt64>(value) == u.convert<UInt64>();
+		}
+		return true;
+	}
+	else if (left != right)
+	{
+		return false;
+	}
+
+	switch (left)
+	{
+	case TAG_BOOL:
+		result = extract<bool>() == other.extract<bool>();
+		return true;
+	case TAG_CHAR:
+		result = extract<char>() == other.extract<char>();
+		return true;
+	case TAG_STRING:
+		result = extract<std::string>() == other.extract<std::string>();
+		return true;
+	default:
+		// float and double are compared as strings, e.g. NaN
+		// is equal to NaN, but 0.0 is not equal to -0.0.
+		return false;
+	}
+}
+
+
 bool Var::operator || (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
@@ -0,0 +1,341 @@
+//
+// WorkStealingThreadPool.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/WorkStealingThreadPool.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include <sstream>
+
+
+namespace Poco {
+
+
+namespace
+{
+	thread_local void* pCurrentWorker = nullptr;
+		// the Worker running in the current thread, if any
+
+	const int INJECTION_CHECK_INTERVAL = 61;
+		// a worker checks the injection queue before its own queue
+		// every INJECTION_CHECK_INTERVAL tasks, so that tasks started from
+		// outside are not starved by tasks that keep spawning subtasks
+
+	const int SPIN_COUNT = 16;
+		// number of attempts to find work (yielding in between)
+		// before an idle worker parks
+}
+
+
+class WorkStealingThreadPool::Worker: public Runnable
+{
+public:
+	Worker(WorkStealingThreadPool& pool, int index, int stackSize):
+		_pool(pool),
+		_random(static_cast<UInt32>(index)*2654435761U + 1),
+		_tick(0)
+	{
+		std::ostringstream name;
+		name << pool._name << "[#" << index + 1 << "]";
+		_thread.setName(name.str());
+		_thread.setStackSize(stackSize);
+	}
+
+	void start()
+	{
+		_thread.start(*this);
+	}
+
+	void join()
+	{
+		_thread.join();
+	}
+
+	void run() override
+	{
+		pCurrentWorker = this;
+		int spins = 0;
+		Runnable* pTarget = nullptr;
+		for (;;)
+		{
+			if (_pool.findTask(*this, pTarget))
+			{
+				spins = 0;
+				try
+				{
+					pTarget->run();
+				}
+				catch (Exception& exc)
+				{
+					ErrorHandler::handle(exc);
+				}
+				catch (std::exception& exc)
+				{
+					ErrorHandler::handle(exc);
+				}
+				catch (...)
+				{
+					ErrorHandler::handle();
+				}
+				_pool.taskDone();
+			}
+			else if (_pool._stopped.load(std::memory_order_acquire))
+			{
+				break;
+			}
+			else if (++spins < SPIN_COUNT)
+			{
+				Thread::yield();
+			}
+			else
+			{
+				spins = 0;
+				_pool.park();
+			}
+		}
+		pCurrentWorker = nullptr;
+	}
+
+	WorkStealingThreadPool& pool()
+	{
+		return _pool;
+	}
+
+	WorkStealingQueue<Runnable*>& queue()
+	{
+		return _queue;
+	}
+
+	UInt32 nextRandom()
+	{
+		// xorshift32
+		_random ^= _random << 13;
+		_random ^= _random >> 17;
+		_random ^= _random << 5;
+		return _random;
+	}
+
+	bool checkInjectedFirst()
+	{
+		return ++_tick % INJECTION_CHECK_INTERVAL == 0;
+	}
+
+private:
+	WorkStealingThreadPool& _pool;
+	WorkStealingQueue<Runnable*> _queue;
+	Thread _thread;
+	UInt32 _random;
+	int _tick;
+};
+
+
+WorkStealingThreadPool::WorkStealingThreadPool(int capacity, int stackSize):
+	_injected(DEFAULT_INJECTION_QUEUE_CAPACITY),
+	_overflowCount(0),
+	_pending(0),
+	_parked(0),
+	_stopped(false)
+{
+	poco_assert (capacity > 0);
+
+	init(capacity, stackSize);
+}
+
+
+WorkStealingThreadPool::WorkStealingThreadPool(const std::string& name, int capacity, int stackSize):
+	_name(name),
+	_injected(DEFAULT_INJECTION_QUEUE_CAPACITY),
+	_overflowCount(0),
+	_pending(0),
+	_parked(0),
+	_stopped(false)
+{
+	poco_assert (capacity > 0);
+
+	init(capacity, stackSize);
+}
+
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+	try
+	{
+		joinAll();
+		stop();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+int WorkStealingThreadPool::capacity() const
+{
+	return static_cast<int>(_workers.size());
+}
+
+
+void WorkStealingThreadPool::start(Runnable& target)
+{
+	startImpl(&target);
+}
+
+
+void WorkStealingThreadPool::joinAll()
+{
+	std::unique_lock<std::mutex> lock(_doneMutex);
+	_done.wait(lock, [this]() { return _pending.load(std::memory_order_acquire) == 0; });
+}
+
+
+void WorkStealingThreadPool::init(int capacity, int stackSize)
+{
+	// all workers must exist before the first one starts stealing
+	_workers.reserve(capacity);
+	for (int i = 0; i < capacity; ++i)
+	{
+		_workers.push_back(std::make_unique<Worker>(*this, i, stackSize));
+	}
+	try
+	{
+		for (auto& pWorker: _workers)
+		{
+			pWorker->start();
+		}
+	}
+	catch (...)
+	{
+		stop();
+		throw;
+	}
+}
+
+
+void WorkStealingThreadPool::startImpl(Runnable* pTarget)
+{
+	_pending.fetch_add(1, std::memory_order_relaxed);
+
+	Worker* pWorker = static_cast<Worker*>(pCurrentWorker);
+	if (pWorker && &pWorker->pool() == this)
+	{
+		pWorker->queue().push(pTarget);
+	}
+	else if (!_injected.tryPush(pTarget))
+	{
+		FastMutex::ScopedLock lock(_overflowMutex);
+		_overflow.push_back(pTarget);
+		_overflowCount.fetch_add(1, std::memory_order_release);
+	}
+	wakeUp();
+}
+
+
+bool WorkStealingThreadPool::findTask(Worker& worker, Runnable*& pTarget)
+{
+	if (worker.checkInjectedFirst() && popInjected(pTarget)) return true;
+	if (worker.queue().pop(pTarget)) return true;
+	if (popInjected(pTarget)) return true;
+
+	const std::size_t n = _workers.size();
+	const std::size_t first = worker.nextRandom() % n;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		Worker& victim = *_workers[(first + i) % n];
+		if (&victim != &worker && victim.queue().steal(pTarget)) return true;
+	}
+	return false;
+}
+
+
+bool WorkStealingThreadPool::popInjected(Runnable*& pTarget)
+{
+	if (_injected.tryPop(pTarget)) return true;
+
+	if (_overflowCount.load(std::memory_order_acquire) > 0)
+	{
+		FastMutex::ScopedLock lock(_overflowMutex);
+		if (!_overflow.empty())
+		{
+			pTarget = _overflow.front();
+			_overflow.pop_front();
+			_overflowCount.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+
+bool WorkStealingThreadPool::hasWork() const
+{
+	if (!_injected.empty() || _overflowCount.load(std::memory_order_relaxed) > 0) return true;
+	for (const auto& pWorker: _workers)
+	{
+		if (!pWorker->queue().empty()) return true;
+	}
+	return false;
+}
+
+
+void WorkStealingThreadPool::wakeUp()
+{
+	// pairs with the fence in park(): either a parking worker
+	// sees the new task, or we see the parking worker
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_parked.load(std::memory_order_relaxed) > 0)
+	{
+		std::lock_guard<std::mutex> lock(_parkMutex);
+		_workAvailable.notify_one();
+	}
+}
+
+
+void WorkStealingThreadPool::park()
+{
+	std::unique_lock<std::mutex> lock(_parkMutex);
+	_parked.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!hasWork() && !_stopped.load(std::memory_order_acquire))
+	{
+		_workAvailable.wait(lock);
+	}
+	_parked.fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+void WorkStealingThreadPool::taskDone()
+{
+	if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		std::lock_guard<std::mutex> lock(_doneMutex);
+		_done.notify_all();
+	}
+}
+
+
+void WorkStealingThreadPool::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(_parkMutex);
+		_stopped.store(true, std::memory_order_release);
+		_workAvailable.notify_all();
+	}
+	for (auto& pWorker: _workers)
+	{
+		pWorker->join();
+	}
+}
+
+
+} // namespace Poco
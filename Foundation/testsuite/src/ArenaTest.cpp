@@ -0,0 +1,225 @@
+//
+// ArenaTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ArenaTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Arena.h"
+#include "Poco/Thread.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+using Poco::Arena;
+using Poco::ArenaScope;
+using Poco::ArenaResource;
+
+
+ArenaTest::ArenaTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ArenaTest::~ArenaTest()
+{
+}
+
+
+void ArenaTest::testAllocate()
+{
+	Arena arena(1024);
+	assertTrue (arena.capacity() == 0);
+	assertTrue (arena.allocated() == 0);
+
+	std::vector<char*> blocks;
+	for (int i = 0; i < 100; ++i)
+	{
+		char* p = static_cast<char*>(arena.allocate(100));
+		std::memset(p, i, 100);
+		blocks.push_back(p);
+	}
+	assertTrue (arena.allocated() == 100*100);
+	assertTrue (arena.capacity() >= 100*100);
+	for (int i = 0; i < 100; ++i)
+	{
+		for (int k = 0; k < 100; ++k)
+		{
+			assertTrue (blocks[i][k] == static_cast<char>(i));
+		}
+	}
+
+	// the most recent allocation can be returned
+	void* p = arena.allocate(16);
+	arena.deallocate(p, 16);
+	assertTrue (arena.allocate(16) == p);
+	arena.deallocate(blocks[0], 100);
+	assertTrue (arena.allocated() == 100*100 + 16);
+
+	arena.release();
+	assertTrue (arena.capacity() == 0);
+	assertTrue (arena.allocated() == 0);
+}
+
+
+void ArenaTest::testAlignment()
+{
+	Arena arena;
+	for (std::size_t alignment = 1; alignment <= 256; alignment *= 2)
+	{
+		arena.allocate(1, 1);
+		void* p = arena.allocate(8, alignment);
+		assertTrue (reinterpret_cast<std::uintptr_t>(p) % alignment == 0);
+	}
+	void* p = arena.allocate(3);
+	assertTrue (reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t) == 0);
+}
+
+
+void ArenaTest::testLargeAllocation()
+{
+	Arena arena(256);
+	arena.allocate(10);
+	char* p = static_cast<char*>(arena.allocate(100000));
+	std::memset(p, 'x', 100000);
+	assertTrue (arena.capacity() >= 100000 + 256);
+	assertTrue (arena.allocated() == 100010);
+}
+
+
+void ArenaTest::testReallocate()
+{
+	Arena arena;
+	char* p = static_cast<char*>(arena.reallocate(nullptr, 0, 10));
+	std::memcpy(p, "0123456789", 10);
+
+	// grows in place
+	char* q = static_cast<char*>(arena.reallocate(p, 10, 20));
+	assertTrue (q == p);
+	assertTrue (arena.allocated() == 20);
+
+	// not the most recent allocation any more
+	arena.allocate(8);
+	q = static_cast<char*>(arena.reallocate(p, 20, 40));
+	assertTrue (q != p);
+	assertTrue (std::memcmp(q, "0123456789", 10) == 0);
+
+	// beyond the chunk size
+	p = static_cast<char*>(arena.reallocate(q, 40, 3*Arena::DEFAULT_CHUNK_SIZE));
+	assertTrue (std::memcmp(p, "0123456789", 10) == 0);
+}
+
+
+void ArenaTest::testReset()
+{
+	Arena arena(1024);
+	for (int i = 0; i < 100; ++i)
+	{
+		arena.allocate(100);
+	}
+	const std::size_t capacity = arena.capacity();
+	arena.reset();
+	assertTrue (arena.allocated() == 0);
+	assertTrue (arena.capacity() < capacity);
+
+	// the largest chunk is kept and serves the same
+	// allocations again, once the arena has grown enough
+	for (int round = 0; round < 3; ++round)
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			arena.allocate(100);
+		}
+		arena.reset();
+	}
+	const std::size_t steadyCapacity = arena.capacity();
+	for (int i = 0; i < 100; ++i)
+	{
+		arena.allocate(100);
+	}
+	assertTrue (arena.capacity() == steadyCapacity);
+}
+
+
+void ArenaTest::testScope()
+{
+	assertNullPtr (Arena::current());
+	Arena outer;
+	Arena inner;
+	{
+		ArenaScope outerScope(outer);
+		assertTrue (Arena::current() == &outer);
+		{
+			ArenaScope innerScope(inner, true);
+			assertTrue (Arena::current() == &inner);
+			inner.allocate(100);
+
+			// the current arena is per thread
+			Arena* pThreadArena = &inner;
+			Poco::Thread thread;
+			thread.startFunc([&pThreadArena]() { pThreadArena = Arena::current(); });
+			thread.join();
+			assertNullPtr (pThreadArena);
+		}
+		assertTrue (Arena::current() == &outer);
+		assertTrue (inner.allocated() == 0);
+	}
+	assertNullPtr (Arena::current());
+}
+
+
+void ArenaTest::testMemoryResource()
+{
+	Arena arena;
+	ArenaResource resource(arena);
+	{
+		std::pmr::vector<std::pmr::string> strings(&resource);
+		for (int i = 0; i < 100; ++i)
+		{
+			strings.emplace_back("a string that is too long for the small string buffer");
+		}
+		assertTrue (strings.size() == 100);
+		assertTrue (strings[99] == "a string that is too long for the small string buffer");
+		assertTrue (strings.get_allocator().resource() == &resource);
+		assertTrue (strings[0].get_allocator().resource() == &resource);
+	}
+	assertTrue (arena.allocated() > 100*50);
+
+	ArenaResource other(arena);
+	assertTrue (resource.is_equal(other));
+	assertTrue (!resource.is_equal(*std::pmr::new_delete_resource()));
+}
+
+
+void ArenaTest::setUp()
+{
+}
+
+
+void ArenaTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ArenaTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ArenaTest");
+
+	CppUnit_addTest(pSuite, ArenaTest, testAllocate);
+	CppUnit_addTest(pSuite, ArenaTest, testAlignment);
+	CppUnit_addTest(pSuite, ArenaTest, testLargeAllocation);
+	CppUnit_addTest(pSuite, ArenaTest, testReallocate);
+	CppUnit_addTest(pSuite, ArenaTest, testReset);
+	CppUnit_addTest(pSuite, ArenaTest, testScope);
+	CppUnit_addTest(pSuite, ArenaTest, testMemoryResource);
+
+	return pSuite;
+}
@@ -0,0 +1,42 @@
+//
+// ArenaTest.h
+//
+// Definition of the ArenaTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ArenaTest_INCLUDED
+#define ArenaTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ArenaTest: public CppUnit::TestCase
+{
+public:
+	ArenaTest(const std::string& name);
+	~ArenaTest();
+
+	void testAllocate();
+	void testAlignment();
+	void testLargeAllocation();
+	void testReallocate();
+	void testReset();
+	void testScope();
+	void testMemoryResource();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ArenaTest_INCLUDED
@@ -13,12 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Base32Encoder.h"
 #include "Poco/Base32Decoder.h"
+#include "Poco/Base32.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::Base32Encoder;
 using Poco::Base32Decoder;
+using Poco::Base32;
 using Poco::DataFormatException;
 
 
@@ -441,6 +443,58 @@ void Base32Test::testEncodeDecodeCrockford()
 }
 
 
+void Base32Test::testEncodeDecodeBuffer()
+{
+	assertTrue (Base32::encode("") == "");
+	assertTrue (Base32::encode("f") == "MY======");
+	assertTrue (Base32::encode("fo") == "MZXQ====");
+	assertTrue (Base32::encode("foo") == "MZXW6===");
+	assertTrue (Base32::encode("foob") == "MZXW6YQ=");
+	assertTrue (Base32::encode("fooba") == "MZXW6YTB");
+	assertTrue (Base32::encode("foobar") == "MZXW6YTBOI======");
+	assertTrue (Base32::encode("foobar", Poco::BASE32_NO_PADDING) == "MZXW6YTBOI");
+	assertTrue (Base32::encode("foobar", Poco::BASE32_USE_HEX_ALPHABET | Poco::BASE32_USE_PADDING) == "CPNMUOJ1E8======");
+
+	assertTrue (Base32::decode("MZXW6YTBOI======") == "foobar");
+	assertTrue (Base32::decode("MZXW6YTBOI") == "foobar");
+	assertTrue (Base32::decode("MY======MZXQ====") == "ffo");
+	assertTrue (Base32::decode("CPNMUOJ1E8======", Poco::BASE32_USE_HEX_ALPHABET) == "foobar");
+
+	const int options[] = {Poco::BASE32_USE_PADDING, Poco::BASE32_NO_PADDING, Poco::BASE32_USE_HEX_ALPHABET, Poco::BASE32_USE_CROCKFORD_ALPHABET | Poco::BASE32_USE_PADDING};
+	for (int opt: options)
+	{
+		for (std::size_t length = 0; length < 100; length++)
+		{
+			std::string data;
+			for (std::size_t i = 0; i < length; i++) data += static_cast<char>((i*37 + length) & 0xFF);
+
+			std::ostringstream ostr;
+			Base32Encoder encoder(ostr, opt);
+			for (char c: data) encoder.put(c);
+			encoder.close();
+
+			std::string encoded = Base32::encode(data, opt);
+			assertTrue (encoded == ostr.str());
+			assertTrue (encoded.size() == Base32::encodedLength(length, opt));
+			assertTrue (Base32::decode(encoded, opt) == data);
+		}
+	}
+
+	const char* invalid[] = {"M", "MZX", "MZXW6Y", "MY=====", "MY==M===", "MZXW6YT1"};
+	for (const char* s: invalid)
+	{
+		try
+		{
+			Base32::decode(s);
+			fail("invalid data - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+	}
+}
+
+
 void Base32Test::setUp()
 {
 }
@@ -464,6 +518,7 @@ CppUnit::Test* Base32Test::suite()
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecode);
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecodeHex);
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecodeCrockford);
+	CppUnit_addTest(pSuite, Base32Test, testEncodeDecodeBuffer);
 
 	return pSuite;
 }
@@ -13,12 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Base64Encoder.h"
 #include "Poco/Base64Decoder.h"
+#include "Poco/Base64.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::Base64Encoder;
 using Poco::Base64Decoder;
+using Poco::Base64;
 using Poco::DataFormatException;
 
 
@@ -377,6 +379,140 @@ void Base64Test::testEncodeDecode()
 }
 
 
+void Base64Test::testEncodeBuffer()
+{
+	assertTrue (Base64::encode("") == "");
+	assertTrue (Base64::encode("f") == "Zg==");
+	assertTrue (Base64::encode("fo") == "Zm8=");
+	assertTrue (Base64::encode("foo") == "Zm9v");
+	assertTrue (Base64::encode("foob") == "Zm9vYg==");
+	assertTrue (Base64::encode("fooba") == "Zm9vYmE=");
+	assertTrue (Base64::encode("foobar") == "Zm9vYmFy");
+	assertTrue (Base64::encode("fo", Poco::BASE64_NO_PADDING) == "Zm8");
+	assertTrue (Base64::encode("!@#$%^&*()_~<>", Poco::BASE64_URL_ENCODING) == "IUAjJCVeJiooKV9-PD4=");
+
+	// long enough for the SIMD code paths, compared with
+	// the character-by-character stream encoder
+	const int options[] = {0, Poco::BASE64_URL_ENCODING, Poco::BASE64_NO_PADDING, Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING};
+	for (int opt: options)
+	{
+		for (std::size_t length = 0; length < 300; length++)
+		{
+			std::string data;
+			for (std::size_t i = 0; i < length; i++) data += static_cast<char>((i*37 + length) & 0xFF);
+
+			std::ostringstream ostr;
+			Base64Encoder encoder(ostr, opt);
+			encoder.rdbuf()->setLineLength(0);
+			for (char c: data) encoder.put(c);
+			encoder.close();
+
+			std::string encoded = Base64::encode(data, opt);
+			assertTrue (encoded == ostr.str());
+			assertTrue (encoded.size() == Base64::encodedLength(length, opt));
+		}
+	}
+}
+
+
+void Base64Test::testDecodeBuffer()
+{
+	assertTrue (Base64::decode("") == "");
+	assertTrue (Base64::decode("Zg==") == "f");
+	assertTrue (Base64::decode("Zm8=") == "fo");
+	assertTrue (Base64::decode("Zm9vYmFy") == "foobar");
+	assertTrue (Base64::decode("Zm9v\r\nYmFy") == "foobar");
+	assertTrue (Base64::decode("Zg==Zm8=") == "ffo");
+	assertTrue (Base64::decode("Zm8", Poco::BASE64_NO_PADDING) == "fo");
+	assertTrue (Base64::decode("IUAjJCVeJiooKV9-PD4=", Poco::BASE64_URL_ENCODING) == "!@#$%^&*()_~<>");
+
+	const int options[] = {0, Poco::BASE64_URL_ENCODING, Poco::BASE64_NO_PADDING, Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING};
+	for (int opt: options)
+	{
+		for (std::size_t length = 0; length < 300; length++)
+		{
+			std::string data;
+			for (std::size_t i = 0; i < length; i++) data += static_cast<char>((i*37 + length) & 0xFF);
+			assertTrue (Base64::decode(Base64::encode(data, opt), opt) == data);
+		}
+	}
+
+	std::string data(1000, 'x');
+	std::string encoded = Base64::encode(data);
+	std::string wrapped;
+	for (std::size_t i = 0; i < encoded.size(); i += 72)
+	{
+		wrapped += encoded.substr(i, 72);
+		wrapped += "\r\n";
+	}
+	assertTrue (Base64::decode(wrapped) == data);
+
+	const char* invalid[] = {"Zm9", "Z===", "Zm=v", "Zm9v#mFy", "Zm9v\xC3\xA9mFy"};
+	for (const char* s: invalid)
+	{
+		try
+		{
+			Base64::decode(s);
+			fail("invalid data - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+	}
+
+	for (std::size_t pos: {std::size_t(0), std::size_t(100), std::size_t(999), encoded.size() - 1})
+	{
+		std::string corrupt(encoded);
+		corrupt[pos] = '*';
+		try
+		{
+			Base64::decode(corrupt);
+			fail("invalid data - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+	}
+
+	try
+	{
+		Base64::decode("Zm9v YmFy", Poco::BASE64_URL_ENCODING);
+		fail("whitespace not allowed with URL encoding - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+}
+
+
+void Base64Test::testLargeStream()
+{
+	std::string data;
+	for (int i = 0; i < 100000; i++) data += static_cast<char>((i*7) & 0xFF);
+
+	std::stringstream str;
+	Base64Encoder encoder(str);
+	encoder.write(data.data(), 10);
+	encoder.write(data.data() + 10, static_cast<std::streamsize>(data.size() - 10));
+	encoder.close();
+
+	std::string encoded = str.str();
+	std::istringstream istr(encoded);
+	std::string line;
+	while (std::getline(istr, line))
+	{
+		assertTrue (line.size() == 73 || istr.peek() == EOF);
+	}
+
+	Base64Decoder decoder(str);
+	std::string decoded(data.size() + 10, '\0');
+	decoder.read(decoded.data(), static_cast<std::streamsize>(decoded.size()));
+	assertTrue (decoder.gcount() == static_cast<std::streamsize>(data.size()));
+	decoded.resize(decoder.gcount());
+	assertTrue (decoded == data);
+}
+
+
 void Base64Test::setUp()
 {
 }
@@ -398,6 +534,9 @@ CppUnit::Test* Base64Test::suite()
 	CppUnit_addTest(pSuite, Base64Test, testDecoderURL);
 	CppUnit_addTest(pSuite, Base64Test, testDecoderNoPadding);
 	CppUnit_addTest(pSuite, Base64Test, testEncodeDecode);
+	CppUnit_addTest(pSuite, Base64Test, testEncodeBuffer);
+	CppUnit_addTest(pSuite, Base64Test, testDecodeBuffer);
+	CppUnit_addTest(pSuite, Base64Test, testLargeStream);
 
 	return pSuite;
 }
@@ -31,6 +31,9 @@ public:
 	void testDecoderURL();
 	void testDecoderNoPadding();
 	void testEncodeDecode();
+	void testEncodeBuffer();
+	void testDecodeBuffer();
+	void testLargeStream();
 
 	void setUp();
 	void tearDown();
@@ -19,8 +19,12 @@
 #include "Poco/FormattingChannel.h"
 #include "Poco/ConsoleChannel.h"
 #include "Poco/StreamChannel.h"
+#include "Poco/Event.h"
+#include "Poco/Format.h"
 #include "TestChannel.h"
 #include <sstream>
+#include <memory>
+#include <vector>
 
 
 using Poco::SplitterChannel;
@@ -73,6 +77,63 @@ private:
 };
 
 
+class GateChannel: public TestChannel
+	/// Blocks in log() until the gate is opened.
+{
+public:
+	GateChannel():
+		_gate(Poco::Event::EVENT_MANUALRESET)
+	{
+	}
+
+	void log(const Message& msg)
+	{
+		_entered.set();
+		_gate.wait();
+		TestChannel::log(msg);
+	}
+
+	void waitEntered()
+	{
+		_entered.wait();
+	}
+
+	void open()
+	{
+		_gate.set();
+	}
+
+private:
+	Poco::Event _gate;
+	Poco::Event _entered;
+};
+
+
+class CountingRunnable: public Runnable
+{
+public:
+	CountingRunnable(AutoPtr<AsyncChannel> pAsync, const std::string& source, int count):
+		_pAsync(pAsync),
+		_source(source),
+		_count(count)
+	{
+	}
+
+	void run()
+	{
+		for (int i = 0; i < _count; i++)
+		{
+			_pAsync->log(Message(_source, std::to_string(i), Message::PRIO_INFORMATION));
+		}
+	}
+
+private:
+	AutoPtr<AsyncChannel> _pAsync;
+	std::string _source;
+	int _count;
+};
+
+
 ChannelTest::ChannelTest(const std::string& name) : CppUnit::TestCase(name)
 {
 }
@@ -131,6 +192,116 @@ void ChannelTest::testAsync()
 }
 
 
+void ChannelTest::testAsyncRingBuffer()
+{
+	const int THREADS = 4;
+	const int COUNT = 1000;
+
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+	pAsync->setProperty("mode", "ringBuffer");
+	pAsync->setProperty("queueSize", "16");
+	pAsync->setProperty("overflowPolicy", "block");
+
+	std::vector<std::unique_ptr<CountingRunnable>> runnables;
+	std::vector<std::unique_ptr<Thread>> threads;
+	for (int i = 0; i < THREADS; i++)
+	{
+		runnables.push_back(std::make_unique<CountingRunnable>(pAsync, std::to_string(i), COUNT));
+		threads.push_back(std::make_unique<Thread>());
+		threads.back()->start(*runnables.back());
+	}
+	for (auto& pThread: threads) pThread->join();
+
+	try
+	{
+		pAsync->setProperty("mode", "queue");
+		fail("running channel - must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+	pAsync->close();
+
+	assertTrue (pChannel->list().size() == THREADS*COUNT);
+	std::vector<int> next(THREADS, 0);
+	for (const auto& msg: pChannel->list())
+	{
+		const int thread = std::stoi(msg.getSource());
+		assertTrue (std::stoi(msg.getText()) == next[thread]);
+		++next[thread];
+	}
+}
+
+
+void ChannelTest::testAsyncRingBufferOverflow()
+{
+	const std::string policies[] = {"drop", "dropOldest"};
+	for (const auto& policy: policies)
+	{
+		AutoPtr<GateChannel> pChannel = new GateChannel;
+		AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+		pAsync->setProperty("mode", "ringBuffer");
+		pAsync->setProperty("queueSize", "8");
+		pAsync->setProperty("overflowPolicy", policy);
+
+		pAsync->log(Message("Source", "0", Message::PRIO_INFORMATION));
+		pChannel->waitEntered();
+		for (int i = 1; i <= 100; i++)
+		{
+			pAsync->log(Message("Source", std::to_string(i), Message::PRIO_INFORMATION));
+		}
+		pChannel->open();
+		pAsync->close();
+
+		// the buffer keeps 7 messages if new messages are dropped,
+		// and 8 if old messages are dropped
+		const int kept = (policy == "drop") ? 7 : 8;
+		const int first = (policy == "drop") ? 1 : 101 - kept;
+		auto it = pChannel->list().begin();
+		assertTrue (pChannel->list().size() == kept + 2);
+		assertTrue ((it++)->getText() == "0");
+		assertTrue ((it++)->getText() == Poco::format("Dropped %d messages.", 100 - kept));
+		for (int i = first; i < first + kept; i++)
+		{
+			assertTrue ((it++)->getText() == std::to_string(i));
+		}
+	}
+}
+
+
+void ChannelTest::testAsyncRingBufferBlock()
+{
+	const int COUNT = 100;
+
+	AutoPtr<GateChannel> pChannel = new GateChannel;
+	AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+	pAsync->setProperty("mode", "ringBuffer");
+	pAsync->setProperty("queueSize", "8");
+	pAsync->setProperty("overflowPolicy", "block");
+
+	CountingRunnable runnable(pAsync, "0", COUNT);
+	Thread thread;
+	thread.start(runnable);
+	pChannel->waitEntered();
+
+	// the logging thread waits until the channel takes messages
+	Thread::sleep(200);
+	assertTrue (thread.isRunning());
+
+	pChannel->open();
+	thread.join();
+	pAsync->close();
+
+	assertTrue (pChannel->list().size() == COUNT);
+	int next = 0;
+	for (const auto& msg: pChannel->list())
+	{
+		assertTrue (std::stoi(msg.getText()) == next++);
+	}
+}
+
+
 void ChannelTest::testFormatting()
 {
 	AutoPtr<TestChannel> pChannel = new TestChannel;
@@ -182,6 +353,9 @@ CppUnit::Test* ChannelTest::suite()
 	CppUnit_addTest(pSuite, ChannelTest, testSplitter);
 	CppUnit_addTest(pSuite, ChannelTest, testSplitterAddSameChannelTwice);
 	CppUnit_addTest(pSuite, ChannelTest, testAsync);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncRingBuffer);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncRingBufferOverflow);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncRingBufferBlock);
 	CppUnit_addTest(pSuite, ChannelTest, testFormatting);
 	CppUnit_addTest(pSuite, ChannelTest, testConsole);
 	CppUnit_addTest(pSuite, ChannelTest, testStream);
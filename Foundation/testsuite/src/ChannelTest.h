@@ -27,6 +27,9 @@ public:
 	void testSplitter();
 	void testSplitterAddSameChannelTwice();
 	void testAsync();
+	void testAsyncRingBuffer();
+	void testAsyncRingBufferOverflow();
+	void testAsyncRingBufferBlock();
 	void testFormatting();
 	void testConsole();
 	void testStream();
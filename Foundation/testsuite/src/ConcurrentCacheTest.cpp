@@ -0,0 +1,265 @@
+//
+// ConcurrentCacheTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ConcurrentCacheTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ConcurrentCache.h"
+#include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+using namespace Poco;
+
+
+ConcurrentCacheTest::ConcurrentCacheTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ConcurrentCacheTest::~ConcurrentCacheTest()
+{
+}
+
+
+void ConcurrentCacheTest::testClear()
+{
+	ConcurrentCache<int, int> aCache(64);
+	assertTrue (aCache.size() == 0);
+	assertTrue (aCache.getAllKeys().size() == 0);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.getAllKeys().size() == 3);
+	assertTrue (aCache.has(1));
+	assertTrue (aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (*aCache.get(1) == 2);
+	assertTrue (*aCache.get(3) == 4);
+	assertTrue (*aCache.get(5) == 6);
+	aCache.remove(3);
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.get(3).isNull());
+	aCache.clear();
+	assertTrue (!aCache.has(1));
+	assertTrue (!aCache.has(5));
+	assertTrue (aCache.size() == 0);
+}
+
+
+void ConcurrentCacheTest::testCacheSize0()
+{
+	try
+	{
+		ConcurrentCache<int, int> aCache(0);
+		failmsg ("cache size of 0 is illegal, test should fail");
+	}
+	catch (InvalidArgumentException&)
+	{
+	}
+}
+
+
+void ConcurrentCacheTest::testClockEviction()
+{
+	// with a single shard, eviction is exact
+	ConcurrentCache<int, int> aCache(3, 0, ConcurrentCache<int, int>::EVICT_CLOCK, 1);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.get(1));
+
+	// 1 has been referenced and gets a second chance
+	aCache.add(7, 8);
+	assertTrue (aCache.has(1));
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (aCache.has(7));
+	assertTrue (aCache.size() == 3);
+
+	aCache.add(9, 10);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.has(9));
+}
+
+
+void ConcurrentCacheTest::testLRUEviction()
+{
+	using Cache = ConcurrentCache<int, int>;
+	Cache aCache(3, 0, Cache::EVICT_LRU, 1);
+	assertTrue (aCache.eviction() == Cache::EVICT_LRU);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.get(1));
+	assertTrue (aCache.get(3));
+
+	aCache.add(7, 8); // replaces 5
+	assertTrue (!aCache.has(5));
+	aCache.add(9, 10); // replaces 1
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.has(3));
+	assertTrue (aCache.has(7));
+	assertTrue (aCache.has(9));
+	assertTrue (aCache.size() == 3);
+}
+
+
+void ConcurrentCacheTest::testDuplicateAdd()
+{
+	ConcurrentCache<std::string, int> aCache(3, 0, ConcurrentCache<std::string, int>::EVICT_LRU, 1);
+	aCache.add("a", 1);
+	aCache.add("b", 2);
+	aCache.add("c", 3);
+	SharedPtr<int> pOld = aCache.get("a");
+	aCache.add("a", 4);
+	assertTrue (*pOld == 1);
+	assertTrue (*aCache.get("a") == 4);
+	assertTrue (aCache.size() == 3);
+
+	// re-adding counts as access
+	aCache.add("b", 5);
+	aCache.add("d", 6); // replaces c
+	assertTrue (!aCache.has("c"));
+	assertTrue (aCache.has("a"));
+	assertTrue (aCache.has("b"));
+}
+
+
+void ConcurrentCacheTest::testExpire()
+{
+	ConcurrentCache<int, int> aCache(64, 100);
+	aCache.add(1, 2);
+	assertTrue (aCache.has(1));
+	SharedPtr<int> pVal = aCache.get(1);
+	Thread::sleep(200);
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.get(1).isNull());
+	assertTrue (*pVal == 2);
+	assertTrue (aCache.getAllKeys().empty());
+	assertTrue (aCache.size() == 0);
+
+	ConcurrentCache<int, int> lruCache(64, 100, ConcurrentCache<int, int>::EVICT_LRU);
+	lruCache.add(1, 2);
+	Thread::sleep(200);
+	assertTrue (lruCache.get(1).isNull());
+	assertTrue (lruCache.size() == 0);
+}
+
+
+void ConcurrentCacheTest::testShards()
+{
+	ConcurrentCache<int, int> aCache(1000, 0, ConcurrentCache<int, int>::EVICT_CLOCK, 10);
+	assertTrue (aCache.shards() == 16);
+	assertTrue (aCache.capacity() == 16*63);
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		aCache.add(i, 2*i);
+	}
+	const std::size_t n = aCache.size();
+	assertTrue (n <= aCache.capacity());
+	// keys must be distributed over all shards
+	assertTrue (n > aCache.capacity()/2);
+	for (int i = 9900; i < 10000; ++i)
+	{
+		assertTrue (aCache.has(i));
+	}
+}
+
+
+void ConcurrentCacheTest::testForEach()
+{
+	ConcurrentCache<int, int> aCache(64);
+	for (int i = 0; i < 10; ++i)
+	{
+		aCache.add(i, i*i);
+	}
+	int sum = 0;
+	bool ok = true;
+	aCache.forEach([&sum, &ok](int key, int value)
+		{
+			if (value != key*key) ok = false;
+			sum += key;
+		});
+	assertTrue (ok);
+	assertTrue (sum == 45);
+}
+
+
+void ConcurrentCacheTest::testThreads()
+{
+	const int THREADS = 8;
+	const int KEYS = 512;
+	ConcurrentCache<int, int> aCache(256);
+	std::atomic<int> errors(0);
+
+	std::vector<std::unique_ptr<Thread>> threads;
+	for (int t = 0; t < THREADS; ++t)
+	{
+		threads.push_back(std::make_unique<Thread>());
+		threads.back()->startFunc([&aCache, &errors, t]()
+			{
+				for (int i = 0; i < 20000; ++i)
+				{
+					const int key = (i*7 + t*13) % KEYS;
+					if (i % 4 == 0)
+					{
+						aCache.add(key, 3*key);
+					}
+					else
+					{
+						SharedPtr<int> pVal = aCache.get(key);
+						if (pVal && *pVal != 3*key) ++errors;
+					}
+					if (i % 1000 == 0) aCache.remove(key);
+				}
+			});
+	}
+	for (auto& pThread: threads)
+	{
+		pThread->join();
+	}
+	assertTrue (errors == 0);
+	assertTrue (aCache.size() <= aCache.capacity());
+}
+
+
+void ConcurrentCacheTest::setUp()
+{
+}
+
+
+void ConcurrentCacheTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ConcurrentCacheTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ConcurrentCacheTest");
+
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testClear);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testCacheSize0);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testClockEviction);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testLRUEviction);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testDuplicateAdd);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testExpire);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testShards);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testForEach);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testThreads);
+
+	return pSuite;
+}
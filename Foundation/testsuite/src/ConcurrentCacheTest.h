@@ -0,0 +1,42 @@
+//
+// ConcurrentCacheTest.h
+//
+// Tests for ConcurrentCache
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+#ifndef ConcurrentCacheTest_INCLUDED
+#define ConcurrentCacheTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ConcurrentCacheTest: public CppUnit::TestCase
+{
+public:
+	ConcurrentCacheTest(const std::string& name);
+	~ConcurrentCacheTest();
+
+	void testClear();
+	void testCacheSize0();
+	void testClockEviction();
+	void testLRUEviction();
+	void testDuplicateAdd();
+	void testExpire();
+	void testShards();
+	void testForEach();
+	void testThreads();
+
+	void setUp();
+	void tearDown();
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ConcurrentCacheTest_INCLUDED
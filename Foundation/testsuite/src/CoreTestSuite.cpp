@@ -26,6 +26,7 @@
 #include "NumberParserTest.h"
 #include "DynamicFactoryTest.h"
 #include "MemoryPoolTest.h"
+#include "ArenaTest.h"
 #include "AnyTest.h"
 #include "VarTest.h"
 #include "FormatTest.h"
@@ -37,6 +38,7 @@
 #include "ObjectPoolTest.h"
 #include "ListMapTest.h"
 #include "OrderedContainersTest.h"
+#include "TimingWheelTest.h"
 
 
 CppUnit::Test* CoreTestSuite::suite()
@@ -60,6 +62,7 @@ CppUnit::Test* CoreTestSuite::suite()
 	pSuite->addTest(NumberParserTest::suite());
 	pSuite->addTest(DynamicFactoryTest::suite());
 	pSuite->addTest(MemoryPoolTest::suite());
+	pSuite->addTest(ArenaTest::suite());
 	pSuite->addTest(AnyTest::suite());
 	pSuite->addTest(VarTest::suite());
 	pSuite->addTest(FormatTest::suite());
@@ -71,6 +74,7 @@ CppUnit::Test* CoreTestSuite::suite()
 	pSuite->addTest(ObjectPoolTest::suite());
 	pSuite->addTest(ListMapTest::suite());
 	pSuite->addTest(OrderedContainersTest::suite());
+	pSuite->addTest(TimingWheelTest::suite());
 
 	return pSuite;
 }
@@ -14,6 +14,7 @@
 #include "Poco/Exception.h"
 #include "Poco/ExpireCache.h"
 #include "Poco/AccessExpireCache.h"
+#include "Poco/TimingWheelAccessExpireStrategy.h"
 #include "Poco/Bugcheck.h"
 #include "Poco/Thread.h"
 
@@ -215,6 +216,50 @@ void ExpireCacheTest::testAccessExpireGet()
 }
 
 
+void ExpireCacheTest::testTimingWheelExpire()
+{
+	ExpireCache<int, int, FastMutex, FastMutex, TimingWheelExpireStrategy<int, int>> aCache(EXPIRE_TIME);
+	aCache.add(1, 2);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 2);
+	aCache.add(1, 3);
+	assertTrue (*aCache.get(1) == 3);
+	assertTrue (aCache.size() == 1);
+
+	Thread::sleep(EXPIRE_TIME / 4);
+	aCache.add(3, 4);
+	assertTrue (waitForCondition([&]{ return !aCache.has(1); }, MAX_WAIT_TIME));
+	assertTrue (aCache.has(3));
+	assertTrue (waitForCondition([&]{ return aCache.size() == 0; }, MAX_WAIT_TIME));
+
+	aCache.add(5, 6);
+	aCache.remove(5);
+	assertTrue (!aCache.has(5));
+	aCache.add(5, 6);
+	aCache.clear();
+	assertTrue (!aCache.has(5));
+}
+
+
+void ExpireCacheTest::testTimingWheelAccessExpire()
+{
+	AccessExpireCache<int, int, FastMutex, FastMutex, TimingWheelAccessExpireStrategy<int, int>> aCache(EXPIRE_TIME);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+
+	// keep item 3 alive by accessing it
+	for (int i = 0; i < 6; ++i)
+	{
+		Thread::sleep(EXPIRE_TIME / 4);
+		assertTrue (*aCache.get(3) == 4);
+	}
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.has(3));
+
+	assertTrue (waitForCondition([&]{ return aCache.size() == 0; }, MAX_WAIT_TIME));
+}
+
+
 void ExpireCacheTest::setUp()
 {
 }
@@ -236,6 +281,8 @@ CppUnit::Test* ExpireCacheTest::suite()
 	CppUnit_addTest(pSuite, ExpireCacheTest, testAccessExpireN);
 	CppUnit_addTest(pSuite, ExpireCacheTest, testExpireWithHas);
 	CppUnit_addTest(pSuite, ExpireCacheTest, testAccessExpireGet);
+	CppUnit_addTest(pSuite, ExpireCacheTest, testTimingWheelExpire);
+	CppUnit_addTest(pSuite, ExpireCacheTest, testTimingWheelAccessExpire);
 
 	return pSuite;
 }
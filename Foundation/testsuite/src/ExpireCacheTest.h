@@ -30,6 +30,8 @@ public:
 	void testAccessExpireN();
 	void testExpireWithHas();
 	void testAccessExpireGet();
+	void testTimingWheelExpire();
+	void testTimingWheelAccessExpire();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,348 @@
+//
+// FlatHashTableTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "FlatHashTableTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/FlatHashTable.h"
+#include "Poco/NumberFormatter.h"
+#include <set>
+#include <string>
+
+
+using Poco::FlatHashTable;
+using Poco::Hash;
+using Poco::NumberFormatter;
+
+
+namespace
+{
+	struct ConstantHash
+		/// Maps all values to the same hash value.
+	{
+		std::size_t operator () (int) const
+		{
+			return 42;
+		}
+	};
+}
+
+
+FlatHashTableTest::FlatHashTableTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+FlatHashTableTest::~FlatHashTableTest()
+{
+}
+
+
+void FlatHashTableTest::testInsert()
+{
+	const int N = 1000;
+
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht;
+
+	assertTrue (ht.empty());
+	assertTrue (ht.find(0) == ht.end());
+	assertTrue (ht.begin() == ht.end());
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntTable::Iterator, bool> res = ht.insert(i);
+		assertTrue (*res.first == i);
+		assertTrue (res.second);
+		IntTable::Iterator it = ht.find(i);
+		assertTrue (it != ht.end());
+		assertTrue (*it == i);
+		assertTrue (ht.size() == i + 1);
+	}
+	assertTrue (ht.capacity() == 2048);
+
+	assertTrue (!ht.empty());
+
+	for (int i = 0; i < N; ++i)
+	{
+		IntTable::Iterator it = ht.find(i);
+		assertTrue (it != ht.end());
+		assertTrue (*it == i);
+		assertTrue (ht.count(i) == 1);
+	}
+	assertTrue (ht.count(N) == 0);
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntTable::Iterator, bool> res = ht.insert(i);
+		assertTrue (*res.first == i);
+		assertTrue (!res.second);
+		assertTrue (ht.size() == N);
+	}
+}
+
+
+void FlatHashTableTest::testErase()
+{
+	const int N = 1000;
+
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht;
+
+	for (int i = 0; i < N; ++i)
+	{
+		ht.insert(i);
+	}
+	assertTrue (ht.size() == N);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		ht.erase(i);
+		IntTable::Iterator it = ht.find(i);
+		assertTrue (it == ht.end());
+	}
+	assertTrue (ht.size() == N/2);
+
+	for (int i = 1; i < N; i += 2)
+	{
+		IntTable::Iterator it = ht.find(i);
+		assertTrue (it != ht.end());
+		assertTrue (*it == i);
+	}
+
+	for (int i = 0; i < N; i += 2)
+	{
+		ht.insert(i);
+	}
+
+	for (int i = 0; i < N; ++i)
+	{
+		IntTable::Iterator it = ht.find(i);
+		assertTrue (it != ht.end());
+		assertTrue (*it == i);
+	}
+
+	ht.erase(ht.end());
+	assertTrue (ht.size() == N);
+	ht.clear();
+	assertTrue (ht.empty());
+	assertTrue (ht.find(1) == ht.end());
+	assertTrue (ht.begin() == ht.end());
+	assertTrue (ht.capacity() == 2048);
+}
+
+
+void FlatHashTableTest::testIterator()
+{
+	const int N = 1000;
+
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht;
+
+	for (int i = 0; i < N; ++i)
+	{
+		ht.insert(i);
+	}
+
+	std::set<int> values;
+	IntTable::Iterator it = ht.begin();
+	while (it != ht.end())
+	{
+		assertTrue (values.find(*it) == values.end());
+		values.insert(*it);
+		++it;
+	}
+
+	assertTrue (values.size() == N);
+}
+
+
+void FlatHashTableTest::testConstIterator()
+{
+	const int N = 1000;
+
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht;
+
+	for (int i = 0; i < N; ++i)
+	{
+		ht.insert(i);
+	}
+
+	std::set<int> values;
+	IntTable::ConstIterator it = ht.begin();
+	while (it != ht.end())
+	{
+		assertTrue (values.find(*it) == values.end());
+		values.insert(*it);
+		++it;
+	}
+
+	assertTrue (values.size() == N);
+
+	values.clear();
+	const IntTable cht(ht);
+
+	IntTable::ConstIterator cit = cht.begin();
+	while (cit != cht.end())
+	{
+		assertTrue (values.find(*cit) == values.end());
+		values.insert(*cit);
+		++cit;
+	}
+
+	assertTrue (values.size() == N);
+}
+
+
+void FlatHashTableTest::testCopy()
+{
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht;
+	for (int i = 0; i < 100; ++i)
+	{
+		ht.insert(i);
+	}
+
+	IntTable copy(ht);
+	ht.erase(5);
+	assertTrue (copy.size() == 100);
+	assertTrue (copy.find(5) != copy.end());
+
+	IntTable assigned;
+	assigned = ht;
+	assertTrue (assigned.size() == 99);
+	assertTrue (assigned.find(5) == assigned.end());
+
+	IntTable moved(std::move(assigned));
+	assertTrue (moved.size() == 99);
+	assertTrue (assigned.empty());
+	assertTrue (assigned.find(1) == assigned.end());
+	assigned.insert(1);
+	assertTrue (assigned.size() == 1);
+
+	moved.swap(assigned);
+	assertTrue (moved.size() == 1);
+	assertTrue (assigned.size() == 99);
+}
+
+
+void FlatHashTableTest::testReserve()
+{
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht(1000);
+	const std::size_t capacity = ht.capacity();
+	assertTrue (capacity >= 1000*8/7);
+
+	ht.insert(0);
+	const int* pFirst = &*ht.find(0);
+	for (int i = 1; i < 1000; ++i)
+	{
+		ht.insert(i);
+	}
+	// no rehash, so values have not been moved
+	assertTrue (ht.capacity() == capacity);
+	assertTrue (&*ht.find(0) == pFirst);
+}
+
+
+void FlatHashTableTest::testTombstones()
+{
+	// repeatedly inserting and erasing must not
+	// grow the table, nor fill it with deleted slots
+	using IntTable = FlatHashTable<int, Hash<int>>;
+	IntTable ht;
+	for (int i = 0; i < 100; ++i)
+	{
+		ht.insert(i);
+	}
+	const std::size_t capacity = ht.capacity();
+	for (int i = 100; i < 100000; ++i)
+	{
+		ht.erase(i - 100);
+		ht.insert(i);
+		assertTrue (ht.size() == 100);
+	}
+	assertTrue (ht.capacity() == capacity);
+	for (int i = 99900; i < 100000; ++i)
+	{
+		assertTrue (ht.find(i) != ht.end());
+	}
+	assertTrue (ht.find(99899) == ht.end());
+}
+
+
+void FlatHashTableTest::testCollisions()
+{
+	// all values share a probe sequence and control byte
+	FlatHashTable<int, ConstantHash> ht;
+	for (int i = 0; i < 200; ++i)
+	{
+		assertTrue (ht.insert(i).second);
+	}
+	for (int i = 0; i < 200; i += 3)
+	{
+		ht.erase(i);
+	}
+	for (int i = 0; i < 200; ++i)
+	{
+		assertTrue ((ht.find(i) != ht.end()) == (i % 3 != 0));
+	}
+}
+
+
+void FlatHashTableTest::testStrings()
+{
+	using StringTable = FlatHashTable<std::string, Hash<std::string>>;
+	StringTable ht;
+	for (int i = 0; i < 1000; ++i)
+	{
+		ht.insert(NumberFormatter::format(i));
+	}
+	assertTrue (ht.size() == 1000);
+	for (int i = 0; i < 1000; ++i)
+	{
+		StringTable::ConstIterator it = ht.find(NumberFormatter::format(i));
+		assertTrue (it != ht.end());
+		assertTrue (*it == NumberFormatter::format(i));
+	}
+	assertTrue (ht.find("1000") == ht.end());
+	ht.erase("500");
+	assertTrue (ht.find("500") == ht.end());
+	assertTrue (ht.size() == 999);
+}
+
+
+void FlatHashTableTest::setUp()
+{
+}
+
+
+void FlatHashTableTest::tearDown()
+{
+}
+
+
+CppUnit::Test* FlatHashTableTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("FlatHashTableTest");
+
+	CppUnit_addTest(pSuite, FlatHashTableTest, testInsert);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testErase);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testIterator);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testConstIterator);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testCopy);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testReserve);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testTombstones);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testCollisions);
+	CppUnit_addTest(pSuite, FlatHashTableTest, testStrings);
+
+	return pSuite;
+}
@@ -0,0 +1,44 @@
+//
+// FlatHashTableTest.h
+//
+// Definition of the FlatHashTableTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef FlatHashTableTest_INCLUDED
+#define FlatHashTableTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class FlatHashTableTest: public CppUnit::TestCase
+{
+public:
+	FlatHashTableTest(const std::string& name);
+	~FlatHashTableTest();
+
+	void testInsert();
+	void testErase();
+	void testIterator();
+	void testConstIterator();
+	void testCopy();
+	void testReserve();
+	void testTombstones();
+	void testCollisions();
+	void testStrings();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // FlatHashTableTest_INCLUDED
@@ -17,6 +17,7 @@
 
 
 using Poco::HashMap;
+using Poco::FlatHashMap;
 
 
 HashMapTest::HashMapTest(const std::string& name): CppUnit::TestCase(name)
@@ -198,6 +199,46 @@ void HashMapTest::testIndex()
 }
 
 
+void HashMapTest::testFlatHashMap()
+{
+	const int N = 1000;
+
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntMap::Iterator, bool> res = hm.insert(IntMap::ValueType(i, i*2));
+		assertTrue (res.first->first == i);
+		assertTrue (res.first->second == i*2);
+		assertTrue (res.second);
+	}
+	assertTrue (hm.size() == N);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		hm.erase(i);
+	}
+	assertTrue (hm.size() == N/2);
+
+	std::map<int, int> values;
+	for (IntMap::ConstIterator it = hm.begin(); it != hm.end(); ++it)
+	{
+		values[it->first] = it->second;
+	}
+	assertTrue (values.size() == N/2);
+	for (int i = 1; i < N; i += 2)
+	{
+		assertTrue (values[i] == i*2);
+	}
+
+	hm[0] = 7;
+	assertTrue (hm[0] == 7);
+	assertTrue (hm.count(0) == 1);
+	assertTrue (hm.count(2) == 0);
+}
+
+
 void HashMapTest::setUp()
 {
 }
@@ -217,6 +258,7 @@ CppUnit::Test* HashMapTest::suite()
 	CppUnit_addTest(pSuite, HashMapTest, testIterator);
 	CppUnit_addTest(pSuite, HashMapTest, testConstIterator);
 	CppUnit_addTest(pSuite, HashMapTest, testIndex);
+	CppUnit_addTest(pSuite, HashMapTest, testFlatHashMap);
 
 	return pSuite;
 }
@@ -29,6 +29,7 @@ public:
 	void testIterator();
 	void testConstIterator();
 	void testIndex();
+	void testFlatHashMap();
 
 	void setUp();
 	void tearDown();
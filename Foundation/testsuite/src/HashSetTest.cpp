@@ -17,6 +17,7 @@
 
 using Poco::Hash;
 using Poco::HashSet;
+using Poco::FlatHashSet;
 
 
 HashSetTest::HashSetTest(const std::string& name): CppUnit::TestCase(name)
@@ -161,6 +162,40 @@ void HashSetTest::testConstIterator()
 }
 
 
+void HashSetTest::testFlatHashSet()
+{
+	const int N = 1000;
+
+	using IntSet = FlatHashSet<int, Hash<int>>;
+	IntSet hs;
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntSet::Iterator, bool> res = hs.insert(i);
+		assertTrue (*res.first == i);
+		assertTrue (res.second);
+	}
+	assertTrue (!hs.insert(0).second);
+	assertTrue (hs.size() == N);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		hs.erase(i);
+	}
+	assertTrue (hs.size() == N/2);
+
+	std::set<int> values;
+	for (IntSet::ConstIterator it = hs.begin(); it != hs.end(); ++it)
+	{
+		assertTrue (*it % 2 == 1);
+		values.insert(*it);
+	}
+	assertTrue (values.size() == N/2);
+	assertTrue (hs.count(1) == 1);
+	assertTrue (hs.count(2) == 0);
+}
+
+
 void HashSetTest::setUp()
 {
 }
@@ -179,6 +214,7 @@ CppUnit::Test* HashSetTest::suite()
 	CppUnit_addTest(pSuite, HashSetTest, testErase);
 	CppUnit_addTest(pSuite, HashSetTest, testIterator);
 	CppUnit_addTest(pSuite, HashSetTest, testConstIterator);
+	CppUnit_addTest(pSuite, HashSetTest, testFlatHashSet);
 
 	return pSuite;
 }
@@ -28,6 +28,7 @@ public:
 	void testErase();
 	void testIterator();
 	void testConstIterator();
+	void testFlatHashSet();
 
 	void setUp();
 	void tearDown();
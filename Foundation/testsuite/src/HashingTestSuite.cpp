@@ -14,6 +14,7 @@
 #include "SimpleHashTableTest.h"
 #endif
 #include "LinearHashTableTest.h"
+#include "FlatHashTableTest.h"
 #include "HashSetTest.h"
 #include "HashMapTest.h"
 
@@ -27,6 +28,7 @@ CppUnit::Test* HashingTestSuite::suite()
 	pSuite->addTest(SimpleHashTableTest::suite());
 #endif
 	pSuite->addTest(LinearHashTableTest::suite());
+	pSuite->addTest(FlatHashTableTest::suite());
 	pSuite->addTest(HashSetTest::suite());
 	pSuite->addTest(HashMapTest::suite());
 
@@ -13,12 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/HexBinaryEncoder.h"
 #include "Poco/HexBinaryDecoder.h"
+#include "Poco/HexBinary.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
 using Poco::HexBinaryEncoder;
 using Poco::HexBinaryDecoder;
+using Poco::HexBinary;
 using Poco::DataFormatException;
 
 
@@ -217,6 +219,84 @@ void HexBinaryTest::testEncodeDecode()
 }
 
 
+void HexBinaryTest::testEncodeDecodeBuffer()
+{
+	assertTrue (HexBinary::encode("") == "");
+	const std::string bytes("\x00\x01\xAB\xFF", 4);
+	assertTrue (HexBinary::encode(bytes) == "0001abff");
+	assertTrue (HexBinary::encode(bytes, true) == "0001ABFF");
+	assertTrue (HexBinary::decode("0001abFF") == bytes);
+	assertTrue (HexBinary::decode("00 01\r\nab ff") == bytes);
+
+	// long enough for the SIMD code paths
+	for (std::size_t length = 0; length < 100; length++)
+	{
+		std::string data;
+		for (std::size_t i = 0; i < length; i++) data += static_cast<char>((i*37 + length) & 0xFF);
+
+		std::ostringstream ostr;
+		HexBinaryEncoder encoder(ostr);
+		encoder.rdbuf()->setLineLength(0);
+		encoder.rdbuf()->setUppercase(length % 2 == 0);
+		for (char c: data) encoder.put(c);
+		encoder.close();
+
+		std::string encoded = HexBinary::encode(data, length % 2 == 0);
+		assertTrue (encoded == ostr.str());
+		assertTrue (HexBinary::decode(encoded) == data);
+	}
+
+	std::string encoded(64, '0');
+	const char* invalid[] = {"0", "0g", "x0", "0\xC3"};
+	for (const char* s: invalid)
+	{
+		try
+		{
+			HexBinary::decode(s);
+			fail("invalid data - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+		try
+		{
+			HexBinary::decode(encoded + s + encoded);
+			fail("invalid data - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+	}
+}
+
+
+void HexBinaryTest::testLargeStream()
+{
+	std::string data;
+	for (int i = 0; i < 100000; i++) data += static_cast<char>((i*7) & 0xFF);
+
+	std::stringstream str;
+	HexBinaryEncoder encoder(str);
+	encoder.write(data.data(), 3);
+	encoder.write(data.data() + 3, static_cast<std::streamsize>(data.size() - 3));
+	encoder.close();
+
+	std::istringstream istr(str.str());
+	std::string line;
+	while (std::getline(istr, line))
+	{
+		assertTrue (line.size() == 72 || istr.peek() == EOF);
+	}
+
+	HexBinaryDecoder decoder(str);
+	std::string decoded(data.size(), '\0');
+	decoder.read(decoded.data(), static_cast<std::streamsize>(decoded.size()));
+	assertTrue (decoder.gcount() == static_cast<std::streamsize>(data.size()));
+	assertTrue (decoded == data);
+	assertTrue (decoder.get() == EOF);
+}
+
+
 void HexBinaryTest::setUp()
 {
 }
@@ -234,6 +314,8 @@ CppUnit::Test* HexBinaryTest::suite()
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testDecoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncodeDecode);
+	CppUnit_addTest(pSuite, HexBinaryTest, testEncodeDecodeBuffer);
+	CppUnit_addTest(pSuite, HexBinaryTest, testLargeStream);
 
 	return pSuite;
 }
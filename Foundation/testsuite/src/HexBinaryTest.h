@@ -27,6 +27,8 @@ public:
 	void testEncoder();
 	void testDecoder();
 	void testEncodeDecode();
+	void testEncodeDecodeBuffer();
+	void testLargeStream();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,362 @@
+//
+// LockFreeNotificationQueueTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "LockFreeNotificationQueueTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/LockFreeNotificationQueue.h"
+#include "Poco/Notification.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+
+using Poco::LockFreeNotificationQueue;
+using Poco::Notification;
+using Poco::Thread;
+
+
+namespace
+{
+	class QTestNotification: public Notification
+	{
+	public:
+		QTestNotification(int value): _value(value)
+		{
+		}
+
+		int value() const
+		{
+			return _value;
+		}
+
+	private:
+		int _value;
+	};
+
+	std::atomic<int> createdCount(0);
+	std::atomic<int> destroyedCount(0);
+
+	class CountingNotification: public QTestNotification
+		/// Counts instances, so that a notification
+		/// released twice is noticed.
+	{
+	public:
+		CountingNotification(int value): QTestNotification(value)
+		{
+			++createdCount;
+		}
+
+		~CountingNotification()
+		{
+			++destroyedCount;
+		}
+	};
+
+	class FunctionRunnable: public Poco::Runnable
+	{
+	public:
+		explicit FunctionRunnable(std::function<void()> fn): _fn(std::move(fn))
+		{
+		}
+
+		void run() override
+		{
+			_fn();
+		}
+
+	private:
+		std::function<void()> _fn;
+	};
+}
+
+
+LockFreeNotificationQueueTest::LockFreeNotificationQueueTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+LockFreeNotificationQueueTest::~LockFreeNotificationQueueTest()
+{
+}
+
+
+void LockFreeNotificationQueueTest::testQueueDequeue()
+{
+	LockFreeNotificationQueue queue(16);
+	assertTrue (queue.empty());
+	assertTrue (queue.size() == 0);
+	assertTrue (queue.capacity() == 16);
+	assertNullPtr (queue.dequeueNotification());
+
+	queue.enqueueNotification(new QTestNotification(1));
+	queue.enqueueNotification(new QTestNotification(2));
+	assertTrue (!queue.empty());
+	assertTrue (queue.size() == 2);
+
+	Notification::Ptr pNf = queue.dequeueNotification();
+	QTestNotification* pTNf = dynamic_cast<QTestNotification*>(pNf.get());
+	assertNotNullPtr (pTNf);
+	assertTrue (pTNf->value() == 1);
+	assertTrue (pTNf->referenceCount() == 1);
+
+	pNf = queue.dequeueNotification();
+	pTNf = dynamic_cast<QTestNotification*>(pNf.get());
+	assertNotNullPtr (pTNf);
+	assertTrue (pTNf->value() == 2);
+	assertTrue (queue.empty());
+	assertNullPtr (queue.dequeueNotification());
+
+	Notification::Ptr pKept = new QTestNotification(3);
+	queue.enqueueNotification(pKept);
+	assertTrue (pKept->referenceCount() == 2);
+	queue.clear();
+	assertTrue (queue.empty());
+	assertTrue (pKept->referenceCount() == 1);
+}
+
+
+void LockFreeNotificationQueueTest::testWaitDequeue()
+{
+	LockFreeNotificationQueue queue;
+	queue.enqueueNotification(new QTestNotification(3));
+	Notification::Ptr pNf = queue.waitDequeueNotification(10);
+	assertNotNullPtr (pNf.get());
+	assertTrue (queue.empty());
+
+	pNf = queue.waitDequeueNotification(10);
+	assertNullPtr (pNf.get());
+
+	// a waiting consumer is woken up by a producer
+	Thread thread;
+	FunctionRunnable producer([&queue]()
+		{
+			Thread::sleep(100);
+			queue.enqueueNotification(new QTestNotification(4));
+		});
+	thread.start(producer);
+	pNf = queue.waitDequeueNotification(5000);
+	thread.join();
+	assertNotNullPtr (pNf.get());
+	assertTrue (dynamic_cast<QTestNotification*>(pNf.get())->value() == 4);
+}
+
+
+void LockFreeNotificationQueueTest::testFull()
+{
+	LockFreeNotificationQueue queue(4);
+	for (int i = 0; i < 4; ++i)
+	{
+		assertTrue (queue.tryEnqueueNotification(new QTestNotification(i)));
+	}
+	Notification::Ptr pNf = new QTestNotification(4);
+	assertFalse (queue.tryEnqueueNotification(pNf));
+	assertTrue (pNf->referenceCount() == 1);
+
+	// a blocked producer continues when a notification is dequeued
+	std::atomic<bool> enqueued(false);
+	Thread thread;
+	FunctionRunnable producer([&queue, &enqueued, pNf]()
+		{
+			queue.enqueueNotification(pNf);
+			enqueued = true;
+		});
+	thread.start(producer);
+	Thread::sleep(100);
+	assertFalse (enqueued);
+
+	Notification::Ptr pFirst = queue.dequeueNotification();
+	assertTrue (dynamic_cast<QTestNotification*>(pFirst.get())->value() == 0);
+	assertTrue (thread.tryJoin(5000));
+	assertTrue (enqueued);
+	assertTrue (queue.size() == 4);
+
+	for (int i = 1; i <= 4; ++i)
+	{
+		pFirst = queue.dequeueNotification();
+		assertTrue (dynamic_cast<QTestNotification*>(pFirst.get())->value() == i);
+	}
+	assertTrue (queue.empty());
+}
+
+
+void LockFreeNotificationQueueTest::testThreads()
+{
+	const int PRODUCERS = 4;
+	const int CONSUMERS = 4;
+	const int COUNT_PER_PRODUCER = 5000;
+	const int TOTAL = PRODUCERS*COUNT_PER_PRODUCER;
+
+	// small capacity, so that producers have to wait, too
+	LockFreeNotificationQueue queue(64);
+	std::vector<std::atomic<int>> received(TOTAL);
+
+	std::vector<std::unique_ptr<FunctionRunnable>> runnables;
+	std::vector<std::unique_ptr<Thread>> consumers;
+	std::vector<std::unique_ptr<Thread>> producers;
+	for (int i = 0; i < CONSUMERS; ++i)
+	{
+		runnables.push_back(std::make_unique<FunctionRunnable>([&queue, &received]()
+			{
+				Notification::Ptr pNf = queue.waitDequeueNotification();
+				while (pNf)
+				{
+					++received[dynamic_cast<QTestNotification*>(pNf.get())->value()];
+					pNf = queue.waitDequeueNotification();
+				}
+			}));
+		consumers.push_back(std::make_unique<Thread>());
+		consumers.back()->start(*runnables.back());
+	}
+	for (int i = 0; i < PRODUCERS; ++i)
+	{
+		runnables.push_back(std::make_unique<FunctionRunnable>([&queue, i, COUNT_PER_PRODUCER]()
+			{
+				for (int k = i*COUNT_PER_PRODUCER; k < (i + 1)*COUNT_PER_PRODUCER; ++k)
+				{
+					queue.enqueueNotification(new QTestNotification(k));
+				}
+			}));
+		producers.push_back(std::make_unique<Thread>());
+		producers.back()->start(*runnables.back());
+	}
+	for (auto& pThread: producers)
+	{
+		pThread->join();
+	}
+	for (int i = 0; i < 500 && !queue.empty(); ++i)
+	{
+		Thread::sleep(10);
+	}
+	Thread::sleep(20);
+	queue.wakeUpAll();
+	for (auto& pThread: consumers)
+	{
+		pThread->join();
+	}
+
+	assertTrue (queue.empty());
+	for (int i = 0; i < TOTAL; ++i)
+	{
+		assertTrue (received[i] == 1);
+	}
+}
+
+
+void LockFreeNotificationQueueTest::testTryEnqueueThreads()
+{
+	const int TOTAL = 20000;
+
+	// the consumer releases notifications as soon as it gets them,
+	// racing with tryEnqueueNotification() returning
+	LockFreeNotificationQueue queue(4);
+	std::vector<std::atomic<int>> received(TOTAL);
+	createdCount = 0;
+	destroyedCount = 0;
+
+	FunctionRunnable consumer([&queue, &received]()
+		{
+			Notification::Ptr pNf = queue.waitDequeueNotification();
+			while (pNf)
+			{
+				++received[dynamic_cast<QTestNotification*>(pNf.get())->value()];
+				pNf = queue.waitDequeueNotification();
+			}
+		});
+	Thread thread;
+	thread.start(consumer);
+	for (int i = 0; i < TOTAL; ++i)
+	{
+		// the argument is the only reference until
+		// the queue has taken its own
+		while (!queue.tryEnqueueNotification(new CountingNotification(i)))
+		{
+			Thread::yield();
+		}
+	}
+	for (int i = 0; i < 500 && !queue.empty(); ++i)
+	{
+		Thread::sleep(10);
+	}
+	Thread::sleep(20);
+	queue.wakeUpAll();
+	thread.join();
+
+	assertTrue (queue.empty());
+	for (int i = 0; i < TOTAL; ++i)
+	{
+		assertTrue (received[i] == 1);
+	}
+	assertTrue (destroyedCount == createdCount);
+}
+
+
+void LockFreeNotificationQueueTest::testWakeUpAll()
+{
+	LockFreeNotificationQueue queue;
+
+	// waiting threads return nullptr
+	std::atomic<int> exited(0);
+	FunctionRunnable consumer([&queue, &exited]()
+		{
+			Notification::Ptr pNf = queue.waitDequeueNotification();
+			if (!pNf) ++exited;
+		});
+	Thread t1;
+	Thread t2;
+	t1.start(consumer);
+	t2.start(consumer);
+	Thread::sleep(100);
+	assertTrue (queue.hasIdleThreads());
+	queue.wakeUpAll();
+	assertTrue (t1.tryJoin(5000));
+	assertTrue (t2.tryJoin(5000));
+	assertTrue (exited == 2);
+	assertFalse (queue.hasIdleThreads());
+
+	// as do threads starting to wait after wakeUpAll()
+	Notification::Ptr pNf = queue.waitDequeueNotification();
+	assertNullPtr (pNf.get());
+
+	// until the next notification is enqueued
+	queue.enqueueNotification(new QTestNotification(1));
+	pNf = queue.waitDequeueNotification();
+	assertNotNullPtr (pNf.get());
+	pNf = queue.waitDequeueNotification(50);
+	assertNullPtr (pNf.get());
+}
+
+
+void LockFreeNotificationQueueTest::setUp()
+{
+}
+
+
+void LockFreeNotificationQueueTest::tearDown()
+{
+}
+
+
+CppUnit::Test* LockFreeNotificationQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("LockFreeNotificationQueueTest");
+
+	CppUnit_addTest(pSuite, LockFreeNotificationQueueTest, testQueueDequeue);
+	CppUnit_addTest(pSuite, LockFreeNotificationQueueTest, testWaitDequeue);
+	CppUnit_addTest(pSuite, LockFreeNotificationQueueTest, testFull);
+	CppUnit_addTest(pSuite, LockFreeNotificationQueueTest, testThreads);
+	CppUnit_addTest(pSuite, LockFreeNotificationQueueTest, testTryEnqueueThreads);
+	CppUnit_addTest(pSuite, LockFreeNotificationQueueTest, testWakeUpAll);
+
+	return pSuite;
+}
@@ -0,0 +1,41 @@
+//
+// LockFreeNotificationQueueTest.h
+//
+// Definition of the LockFreeNotificationQueueTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef LockFreeNotificationQueueTest_INCLUDED
+#define LockFreeNotificationQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class LockFreeNotificationQueueTest: public CppUnit::TestCase
+{
+public:
+	LockFreeNotificationQueueTest(const std::string& name);
+	~LockFreeNotificationQueueTest();
+
+	void testQueueDequeue();
+	void testWaitDequeue();
+	void testFull();
+	void testThreads();
+	void testTryEnqueueThreads();
+	void testWakeUpAll();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // LockFreeNotificationQueueTest_INCLUDED
@@ -195,6 +195,8 @@ void LoggerTest::testFormat()
 	assertTrue (str == "123");
 	str = Logger::format("$0$1$2$3", "1", "2", "3", "4");
 	assertTrue (str == "1234");
+	str = Logger::format("$0 costs 5$", "it");
+	assertTrue (str == "it costs 5$");
 }
 
 void LoggerTest::testFormatAny()
@@ -0,0 +1,217 @@
+//
+// MPMCQueueTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "MPMCQueueTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/MPMCQueue.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+using Poco::MPMCQueue;
+using Poco::Thread;
+
+
+MPMCQueueTest::MPMCQueueTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+MPMCQueueTest::~MPMCQueueTest()
+{
+}
+
+
+void MPMCQueueTest::testBasicPushPop()
+{
+	MPMCQueue<std::string> queue(8);
+
+	assertTrue (queue.empty());
+	assertTrue (queue.capacity() == 8);
+
+	std::string value;
+	assertFalse (queue.tryPop(value));
+
+	assertTrue (queue.tryPush("one"));
+	assertTrue (queue.emplace("two"));
+	assertTrue (queue.size() == 2);
+
+	assertTrue (queue.tryPop(value));
+	assertTrue (value == "one");
+	assertTrue (queue.tryPop(value));
+	assertTrue (value == "two");
+	assertTrue (queue.empty());
+	assertFalse (queue.tryPop(value));
+}
+
+
+void MPMCQueueTest::testFull()
+{
+	MPMCQueue<int> queue(3);
+	assertTrue (queue.capacity() == 4);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		assertTrue (queue.tryPush(i));
+	}
+	assertFalse (queue.tryPush(4));
+	assertTrue (queue.size() == 4);
+
+	int value = 0;
+	assertTrue (queue.tryPop(value));
+	assertTrue (value == 0);
+	assertTrue (queue.tryPush(4));
+	assertFalse (queue.tryPush(5));
+
+	MPMCQueue<int> small(1);
+	assertTrue (small.capacity() == 2);
+}
+
+
+void MPMCQueueTest::testWrapAround()
+{
+	MPMCQueue<int> queue(4);
+	int value = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		assertTrue (queue.tryPush(i));
+		assertTrue (queue.tryPush(i + 1));
+		assertTrue (queue.tryPop(value));
+		assertTrue (value == i);
+		assertTrue (queue.tryPop(value));
+		assertTrue (value == i + 1);
+	}
+	assertTrue (queue.empty());
+}
+
+
+namespace
+{
+	class Producer: public Poco::Runnable
+	{
+	public:
+		Producer(MPMCQueue<int>& queue, int first, int count):
+			_queue(queue),
+			_first(first),
+			_count(count)
+		{
+		}
+
+		void run() override
+		{
+			for (int i = _first; i < _first + _count; ++i)
+			{
+				while (!_queue.tryPush(i)) Thread::yield();
+			}
+		}
+
+	private:
+		MPMCQueue<int>& _queue;
+		int _first;
+		int _count;
+	};
+
+	class Consumer: public Poco::Runnable
+	{
+	public:
+		Consumer(MPMCQueue<int>& queue, std::vector<std::atomic<int>>& received, std::atomic<int>& remaining):
+			_queue(queue),
+			_received(received),
+			_remaining(remaining)
+		{
+		}
+
+		void run() override
+		{
+			int value;
+			while (_remaining.load() > 0)
+			{
+				if (_queue.tryPop(value))
+				{
+					++_received[value];
+					--_remaining;
+				}
+				else Thread::yield();
+			}
+		}
+
+	private:
+		MPMCQueue<int>& _queue;
+		std::vector<std::atomic<int>>& _received;
+		std::atomic<int>& _remaining;
+	};
+}
+
+
+void MPMCQueueTest::testMultipleProducersConsumers()
+{
+	const int PRODUCERS = 4;
+	const int CONSUMERS = 4;
+	const int COUNT_PER_PRODUCER = 25000;
+	const int TOTAL = PRODUCERS*COUNT_PER_PRODUCER;
+
+	MPMCQueue<int> queue(256);
+	std::vector<std::atomic<int>> received(TOTAL);
+	std::atomic<int> remaining(TOTAL);
+
+	std::vector<std::unique_ptr<Producer>> producers;
+	std::vector<std::unique_ptr<Consumer>> consumers;
+	std::vector<std::unique_ptr<Thread>> threads;
+	for (int i = 0; i < CONSUMERS; ++i)
+	{
+		consumers.push_back(std::make_unique<Consumer>(queue, received, remaining));
+		threads.push_back(std::make_unique<Thread>());
+		threads.back()->start(*consumers.back());
+	}
+	for (int i = 0; i < PRODUCERS; ++i)
+	{
+		producers.push_back(std::make_unique<Producer>(queue, i*COUNT_PER_PRODUCER, COUNT_PER_PRODUCER));
+		threads.push_back(std::make_unique<Thread>());
+		threads.back()->start(*producers.back());
+	}
+	for (auto& pThread: threads)
+	{
+		pThread->join();
+	}
+
+	assertTrue (queue.empty());
+	for (int i = 0; i < TOTAL; ++i)
+	{
+		assertTrue (received[i] == 1);
+	}
+}
+
+
+void MPMCQueueTest::setUp()
+{
+}
+
+
+void MPMCQueueTest::tearDown()
+{
+}
+
+
+CppUnit::Test* MPMCQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("MPMCQueueTest");
+
+	CppUnit_addTest(pSuite, MPMCQueueTest, testBasicPushPop);
+	CppUnit_addTest(pSuite, MPMCQueueTest, testFull);
+	CppUnit_addTest(pSuite, MPMCQueueTest, testWrapAround);
+	CppUnit_addTest(pSuite, MPMCQueueTest, testMultipleProducersConsumers);
+
+	return pSuite;
+}
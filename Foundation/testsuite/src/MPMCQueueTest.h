@@ -0,0 +1,39 @@
+//
+// MPMCQueueTest.h
+//
+// Definition of the MPMCQueueTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef MPMCQueueTest_INCLUDED
+#define MPMCQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class MPMCQueueTest: public CppUnit::TestCase
+{
+public:
+	MPMCQueueTest(const std::string& name);
+	~MPMCQueueTest();
+
+	void testBasicPushPop();
+	void testFull();
+	void testWrapAround();
+	void testMultipleProducersConsumers();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // MPMCQueueTest_INCLUDED
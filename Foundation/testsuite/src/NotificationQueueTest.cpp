@@ -154,6 +154,74 @@ void NotificationQueueTest::testWaitDequeue()
 }
 
 
+void NotificationQueueTest::testBatch()
+{
+	NotificationQueue queue;
+	std::vector<Notification::Ptr> batch;
+	assertTrue (queue.dequeueBatch(batch, 10) == 0);
+	assertTrue (batch.empty());
+
+	std::vector<Notification::Ptr> input;
+	for (int i = 0; i < 5; ++i)
+	{
+		input.push_back(new QTestNotification(std::to_string(i)));
+	}
+	queue.enqueueBatch(input);
+	assertTrue (queue.size() == 5);
+
+	assertTrue (queue.dequeueBatch(batch, 3) == 3);
+	assertTrue (batch.size() == 3);
+	assertTrue (queue.size() == 2);
+	assertTrue (queue.dequeueBatch(batch, 10) == 2);
+	assertTrue (batch.size() == 5);
+	assertTrue (queue.empty());
+	for (int i = 0; i < 5; ++i)
+	{
+		QTestNotification* pTNf = dynamic_cast<QTestNotification*>(batch[i].get());
+		assertNotNullPtr(pTNf);
+		assertTrue (pTNf->data() == std::to_string(i));
+	}
+	assertTrue (queue.dequeueBatch(batch, 0) == 0);
+}
+
+
+void NotificationQueueTest::testWaitDequeueBatch()
+{
+	NotificationQueue queue;
+	std::vector<Notification::Ptr> batch;
+	assertTrue (queue.waitDequeueBatch(batch, 10, 10) == 0);
+
+	queue.enqueueNotification(new QTestNotification("first"));
+	queue.enqueueNotification(new QTestNotification("second"));
+	assertTrue (queue.waitDequeueBatch(batch, 10, 10) == 2);
+	assertTrue (batch.size() == 2);
+	batch.clear();
+
+	// a batch enqueued while a thread waits is received in full
+	std::vector<Notification::Ptr> input;
+	for (int i = 0; i < 4; ++i)
+	{
+		input.push_back(new QTestNotification(std::to_string(i)));
+	}
+	Thread thread;
+	thread.startFunc([&queue, &input]()
+		{
+			Thread::sleep(100);
+			queue.enqueueBatch(input);
+		});
+	std::size_t n = queue.waitDequeueBatch(batch, 10, 5000);
+	thread.join();
+	n += queue.dequeueBatch(batch, 10);
+	assertTrue (n == 4);
+	assertTrue (dynamic_cast<QTestNotification*>(batch[0].get())->data() == "0");
+	assertTrue (dynamic_cast<QTestNotification*>(batch[3].get())->data() == "3");
+	batch.clear();
+
+	queue.wakeUpAll();
+	assertTrue (queue.waitDequeueBatch(batch, 10) == 0);
+}
+
+
 void NotificationQueueTest::testThreads()
 {
 	const int NOTIFICATION_COUNT = 2000;
@@ -341,6 +409,8 @@ CppUnit::Test* NotificationQueueTest::suite()
 	CppUnit_addTest(pSuite, NotificationQueueTest, testThreads);
 	CppUnit_addTest(pSuite, NotificationQueueTest, testDefaultQueue);
 	CppUnit_addTest(pSuite, NotificationQueueTest, testWakeUpAllBeforeWait);
+	CppUnit_addTest(pSuite, NotificationQueueTest, testBatch);
+	CppUnit_addTest(pSuite, NotificationQueueTest, testWaitDequeueBatch);
 
 	return pSuite;
 }
@@ -33,6 +33,8 @@ public:
 	void testThreads();
 	void testDefaultQueue();
 	void testWakeUpAllBeforeWait();
+	void testBatch();
+	void testWaitDequeueBatch();
 
 	void setUp();
 	void tearDown();
@@ -16,6 +16,9 @@
 #include "TimedNotificationQueueTest.h"
 #include "SPSCQueueTest.h"
 #include "MPSCQueueTest.h"
+#include "MPMCQueueTest.h"
+#include "WorkStealingQueueTest.h"
+#include "LockFreeNotificationQueueTest.h"
 
 
 CppUnit::Test* NotificationsTestSuite::suite()
@@ -29,6 +32,9 @@ CppUnit::Test* NotificationsTestSuite::suite()
 	pSuite->addTest(TimedNotificationQueueTest::suite());
 	pSuite->addTest(SPSCQueueTest::suite());
 	pSuite->addTest(MPSCQueueTest::suite());
+	pSuite->addTest(MPMCQueueTest::suite());
+	pSuite->addTest(WorkStealingQueueTest::suite());
+	pSuite->addTest(LockFreeNotificationQueueTest::suite());
 
 	return pSuite;
 }
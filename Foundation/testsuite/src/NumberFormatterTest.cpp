@@ -317,6 +317,16 @@ void NumberFormatterTest::testFormatFloat()
 	assertTrue (NumberFormatter::format(50.546f, 0) == "51");
 	assertTrue (NumberFormatter::format(50.546f, 2) == "50.55");
 
+	char buffer[8];
+	char* end = NumberFormatter::format(buffer, buffer + sizeof(buffer), -12.25);
+	assertTrue (end != nullptr);
+	assertTrue (std::string(buffer, end) == "-12.25");
+	end = NumberFormatter::format(buffer, buffer + sizeof(buffer), 0.1f);
+	assertTrue (end != nullptr);
+	assertTrue (std::string(buffer, end) == "0.1");
+	assertTrue (NumberFormatter::format(buffer, buffer + sizeof(buffer), 1.2345678) == nullptr);
+	assertTrue (NumberFormatter::format(buffer, buffer + 5, -12.25) == nullptr);
+
 	try
 	{
 		Poco::NumberFormatter::format(0.1, -1);
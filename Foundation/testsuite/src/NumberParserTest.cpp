@@ -19,6 +19,8 @@
 #include <iostream>
 #include <iomanip>
 #include <cstdio>
+#include <cstring>
+#include <cmath>
 
 
 using Poco::NumberParser;
@@ -328,6 +330,63 @@ void NumberParserTest::testParseError()
 }
 
 
+void NumberParserTest::testParseFloatRange()
+{
+	const std::string str("[1.5,-0.25,1e10,12,345.5]");
+	const char* p = str.data();
+	assertEqualDelta(1.5, NumberParser::parseFloat(p + 1, p + 4), 0.0);
+	assertEqualDelta(-0.25, NumberParser::parseFloat(p + 5, p + 10), 0.0);
+	assertEqualDelta(1e10, NumberParser::parseFloat(p + 11, p + 15), 0.0);
+	assertEqualDelta(12345.5, NumberParser::parseFloat(p + 16, p + 24), 0.0);
+
+	double d;
+	assertTrue (NumberParser::tryParseFloat(p + 1, p + 2, d));
+	assertEqualDelta(1.0, d, 0.0);
+	assertTrue (!NumberParser::tryParseFloat(p, p + 4, d));
+	assertTrue (!NumberParser::tryParseFloat(p + 1, p + 1, d));
+
+	try
+	{
+		NumberParser::parseFloat(p + 1, p + 6);
+		failmsg("must throw SyntaxException");
+	}
+	catch (SyntaxException&)
+	{
+	}
+}
+
+
+void NumberParserTest::testFloatRoundTrip()
+{
+	Poco::UInt64 seed = 0x9E3779B97F4A7C15ULL;
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+	for (int i = 0; i < 100000; i++)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		double value;
+		std::memcpy(&value, &seed, sizeof(value));
+		if (!std::isfinite(value)) continue;
+
+		char* end = NumberFormatter::format(buffer, buffer + sizeof(buffer), value);
+		assertTrue (end != nullptr);
+		assertTrue (std::string(buffer, end) == NumberFormatter::format(value));
+		double result;
+		assertTrue (NumberParser::tryParseFloat(buffer, end, result));
+		assertTrue (result == value);
+
+		float fvalue = static_cast<float>(value);
+		if (!std::isfinite(fvalue)) continue;
+		end = NumberFormatter::format(buffer, buffer + sizeof(buffer), fvalue);
+		assertTrue (end != nullptr);
+		float fresult;
+		assertTrue (Poco::strToFloat(buffer, end, fresult));
+		assertTrue (fresult == fvalue);
+	}
+}
+
+
 void NumberParserTest::setUp()
 {
 }
@@ -345,6 +404,8 @@ CppUnit::Test* NumberParserTest::suite()
 	CppUnit_addTest(pSuite, NumberParserTest, testParse);
 	CppUnit_addTest(pSuite, NumberParserTest, testLimits);
 	CppUnit_addTest(pSuite, NumberParserTest, testParseError);
+	CppUnit_addTest(pSuite, NumberParserTest, testParseFloatRange);
+	CppUnit_addTest(pSuite, NumberParserTest, testFloatRoundTrip);
 
 	return pSuite;
 }
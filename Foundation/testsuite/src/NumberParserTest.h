@@ -31,6 +31,8 @@ public:
 	void testParse();
 	void testLimits();
 	void testParseError();
+	void testParseFloatRange();
+	void testFloatRoundTrip();
 
 	void setUp();
 	void tearDown();
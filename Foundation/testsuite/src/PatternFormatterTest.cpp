@@ -14,11 +14,13 @@
 #include "Poco/PatternFormatter.h"
 #include "Poco/Message.h"
 #include "Poco/DateTime.h"
+#include "Poco/DateTimeFormatter.h"
 
 
 using Poco::PatternFormatter;
 using Poco::Message;
 using Poco::DateTime;
+using Poco::DateTimeFormatter;
 
 
 PatternFormatterTest::PatternFormatterTest(const std::string& name): CppUnit::TestCase(name)
@@ -106,6 +108,42 @@ void PatternFormatterTest::testPatternFormatter()
 }
 
 
+void PatternFormatterTest::testDateTime()
+{
+	const DateTime dateTimes[] =
+	{
+		DateTime(2005, 1, 1, 14, 30, 15, 500),
+		DateTime(2005, 1, 1, 14, 30, 15, 999, 999),
+		DateTime(2005, 1, 1, 14, 30, 16, 0, 1),
+		DateTime(2024, 2, 29, 0, 0, 0),
+		DateTime(2024, 12, 31, 23, 59, 59, 123, 456),
+		DateTime(1969, 12, 31, 23, 59, 59, 500, 1),
+		DateTime(1900, 6, 15, 12, 0, 0, 1)
+	};
+	const std::string patterns[] =
+	{
+		"%Y-%m-%d %H:%M:%S.%i",
+		"[%Y-%m-%dT%H:%M:%S.%F]",
+		"%Y-%m-%d %H:%M",
+		"%Y-%m-%d %H-%M-%S",
+		"%w %W %b %B %d %e %f %m %n %o %y %h %a %A %c"
+	};
+
+	Message msg("TestSource", "Test message text", Message::PRIO_ERROR);
+	for (const auto& pattern: patterns)
+	{
+		PatternFormatter fmt(pattern);
+		for (const auto& dateTime: dateTimes)
+		{
+			msg.setTime(dateTime.timestamp());
+			std::string result;
+			fmt.format(msg, result);
+			assertEqual (DateTimeFormatter::format(dateTime, pattern), result);
+		}
+	}
+}
+
+
 void PatternFormatterTest::testExtractBasename()
 {
 	PatternFormatter fmt;
@@ -193,6 +231,7 @@ CppUnit::Test* PatternFormatterTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("PatternFormatterTest");
 
 	CppUnit_addTest(pSuite, PatternFormatterTest, testPatternFormatter);
+	CppUnit_addTest(pSuite, PatternFormatterTest, testDateTime);
 	CppUnit_addTest(pSuite, PatternFormatterTest, testExtractBasename);
 
 	return pSuite;
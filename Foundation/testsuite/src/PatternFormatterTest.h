@@ -25,6 +25,7 @@ public:
 	~PatternFormatterTest();
 
 	void testPatternFormatter();
+	void testDateTime();
 	void testExtractBasename();
 
 	void setUp();
@@ -17,6 +17,7 @@
 #include "Poco/Runnable.h"
 #include "Poco/RunnableAdapter.h"
 #include "Poco/Random.h"
+#include <vector>
 
 
 using Poco::PriorityNotificationQueue;
@@ -175,6 +176,35 @@ void PriorityNotificationQueueTest::testDefaultQueue()
 }
 
 
+void PriorityNotificationQueueTest::testBatch()
+{
+	PriorityNotificationQueue queue;
+	std::vector<Notification::Ptr> batch;
+	assertTrue (queue.dequeueBatch(batch, 10) == 0);
+	assertTrue (queue.waitDequeueBatch(batch, 10, 10) == 0);
+
+	std::vector<Notification::Ptr> low;
+	low.push_back(new QTestNotification("third"));
+	low.push_back(new QTestNotification("fourth"));
+	std::vector<Notification::Ptr> high;
+	high.push_back(new QTestNotification("first"));
+	high.push_back(new QTestNotification("second"));
+	queue.enqueueBatch(low, 2);
+	queue.enqueueBatch(high, 1);
+	assertTrue (queue.size() == 4);
+
+	assertTrue (queue.dequeueBatch(batch, 3) == 3);
+	assertTrue (queue.size() == 1);
+	assertTrue (queue.waitDequeueBatch(batch, 3, 10) == 1);
+	assertTrue (queue.empty());
+	assertTrue (batch.size() == 4);
+	assertTrue (dynamic_cast<QTestNotification*>(batch[0].get())->data() == "first");
+	assertTrue (dynamic_cast<QTestNotification*>(batch[1].get())->data() == "second");
+	assertTrue (dynamic_cast<QTestNotification*>(batch[2].get())->data() == "third");
+	assertTrue (dynamic_cast<QTestNotification*>(batch[3].get())->data() == "fourth");
+}
+
+
 void PriorityNotificationQueueTest::setUp()
 {
 	_handled.clear();
@@ -211,6 +241,7 @@ CppUnit::Test* PriorityNotificationQueueTest::suite()
 	CppUnit_addTest(pSuite, PriorityNotificationQueueTest, testWaitDequeue);
 	CppUnit_addTest(pSuite, PriorityNotificationQueueTest, testThreads);
 	CppUnit_addTest(pSuite, PriorityNotificationQueueTest, testDefaultQueue);
+	CppUnit_addTest(pSuite, PriorityNotificationQueueTest, testBatch);
 
 	return pSuite;
 }
@@ -31,6 +31,7 @@ public:
 	void testWaitDequeue();
 	void testThreads();
 	void testDefaultQueue();
+	void testBatch();
 
 	void setUp();
 	void tearDown();
@@ -1365,6 +1365,25 @@ void StringTest::testJSONString()
 	toJSON("\xD0\x82", ostr, Poco::JSON_WRAP_STRINGS | Poco::JSON_ESCAPE_UNICODE);
 	assertTrue (ostr.str() == "\"\\u0402\"");
 	ostr.str("");
+
+	// append to string
+	std::string out = "x";
+	toJSON("a\"b", out);
+	assertTrue (out == "x\"a\\\"b\"");
+	toJSON("\v", out, Poco::JSON_LOWERCASE_HEX);
+	assertTrue (out == "x\"a\\\"b\"\\u000b");
+
+	// escapes at every position of longer strings
+	for (std::size_t pos = 0; pos < 40; ++pos)
+	{
+		std::string value(40, 'a');
+		value[pos] = '\x01';
+		std::string expected = std::string(pos, 'a') + "\\u0001" + std::string(39 - pos, 'a');
+		assertTrue (toJSON(value, 0) == expected);
+		value[pos] = '"';
+		expected = std::string(pos, 'a') + "\\\"" + std::string(39 - pos, 'a');
+		assertTrue (toJSON(value, 0) == expected);
+	}
 }
 
 
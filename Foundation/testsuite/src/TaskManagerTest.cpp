@@ -18,6 +18,7 @@
 #include "Poco/NotificationCenter.h"
 #include "Poco/Thread.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/WorkStealingThreadPool.h"
 #include "Poco/Event.h"
 #include "Poco/Stopwatch.h"
 #include "Poco/NObserver.h"
@@ -37,6 +38,7 @@ using Poco::TaskProgressNotification;
 using Poco::TaskCustomNotification;
 using Poco::Thread;
 using Poco::ThreadPool;
+using Poco::WorkStealingThreadPool;
 using Poco::Event;
 using Poco::NObserver;
 using Poco::Exception;
@@ -581,6 +583,25 @@ void TaskManagerTest::testCustomThreadPool()
 	tm.joinAll();
 }
 
+
+void TaskManagerTest::testWorkStealingThreadPool()
+{
+	WorkStealingThreadPool tp(2);
+	TaskManager tm(tp);
+
+	// tasks exceeding the pool's capacity are queued
+	for (int i = 0; i < 3*tp.capacity(); ++i)
+	{
+		tm.start(new SimpleTask);
+	}
+	assertTrue (tm.count() == 3*tp.capacity());
+
+	tm.cancelAll();
+	tm.joinAll();
+	assertTrue (tm.count() == 0);
+}
+
+
 void TaskManagerTest::setUp()
 {
 }
@@ -602,6 +623,7 @@ CppUnit::Test* TaskManagerTest::suite()
 	CppUnit_addTest(pSuite, TaskManagerTest, testMultiTasks);
 	CppUnit_addTest(pSuite, TaskManagerTest, testCustom);
 	CppUnit_addTest(pSuite, TaskManagerTest, testCustomThreadPool);
+	CppUnit_addTest(pSuite, TaskManagerTest, testWorkStealingThreadPool);
 
 	return pSuite;
 }
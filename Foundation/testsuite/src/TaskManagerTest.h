@@ -37,6 +37,7 @@ public:
 	void testCustom();
 	void testMultiTasks();
 	void testCustomThreadPool();
+	void testWorkStealingThreadPool();
 
 	void setUp();
 	void tearDown();
@@ -20,6 +20,9 @@
 #include "Poco/Windows1251Encoding.h"
 #include "Poco/Windows1252Encoding.h"
 #include "Poco/UTF8Encoding.h"
+#include "Poco/UTF16Encoding.h"
+#include "Poco/UTF32Encoding.h"
+#include <vector>
 
 
 using namespace Poco;
@@ -326,6 +329,80 @@ void TextConverterTest::testErrors()
 }
 
 
+namespace
+{
+	int identity(int ch)
+	{
+		return ch;
+	}
+}
+
+
+void TextConverterTest::testTranscode()
+{
+	// Conversions between UTF-8 and UTF-16, UTF-32 or Latin-1 take a
+	// faster path that must give the same results as the conversion
+	// with a transform function, including for invalid input.
+	UTF8Encoding utf8Encoding;
+	UTF16Encoding utf16Encoding;
+	UTF32Encoding utf32Encoding;
+	Latin1Encoding latin1Encoding;
+
+	const std::string pieces[] =
+	{
+		"abcdefghijklmnopqrstuvwxyz", "\xC3\xA4", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xFF", "\xC3", "\xED\xA0\x80", "\xE0\x80\x80", "\x80", std::string("\x00", 1)
+	};
+
+	std::vector<std::string> inputs;
+	for (unsigned seed = 1; seed < 200; seed++)
+	{
+		std::string text;
+		unsigned state = seed;
+		while (text.size() < seed*7)
+		{
+			state = state*1103515245 + 12345;
+			text += pieces[(state >> 16) % 10];
+		}
+		inputs.push_back(text);
+	}
+
+	TextEncoding* encodings[] = {&utf16Encoding, &utf32Encoding, &latin1Encoding, &utf8Encoding};
+	for (TextEncoding* pEncoding: encodings)
+	{
+		TextConverter toOther(utf8Encoding, *pEncoding);
+		TextConverter fromOther(*pEncoding, utf8Encoding);
+		for (const auto& input: inputs)
+		{
+			std::string fast;
+			std::string slow;
+			std::string slowString;
+			int fastErrors = toOther.convert(input.data(), static_cast<int>(input.size()), fast);
+			int slowErrors = toOther.convert(input.data(), static_cast<int>(input.size()), slow, identity);
+			assertTrue (fast == slow);
+			assertTrue (fastErrors == slowErrors);
+			fast.clear();
+			fastErrors = toOther.convert(input, fast);
+			slowErrors = toOther.convert(input, slowString, identity);
+			assertTrue (fast == slowString);
+			assertTrue (fastErrors == slowErrors);
+
+			// back, including an odd number of bytes
+			for (std::size_t cut: {std::size_t(0), std::size_t(1), std::size_t(3)})
+			{
+				if (cut > slow.size()) continue;
+				std::string other(slow, 0, slow.size() - cut);
+				std::string back;
+				std::string backSlow;
+				fastErrors = fromOther.convert(other.data(), static_cast<int>(other.size()), back);
+				slowErrors = fromOther.convert(other.data(), static_cast<int>(other.size()), backSlow, identity);
+				assertTrue (back == backSlow);
+				assertTrue (fastErrors == slowErrors);
+			}
+		}
+	}
+}
+
+
 void TextConverterTest::setUp()
 {
 }
@@ -350,6 +427,7 @@ CppUnit::Test* TextConverterTest::suite()
 	CppUnit_addTest(pSuite, TextConverterTest, testCP1251toUTF8);
 	CppUnit_addTest(pSuite, TextConverterTest, testCP1252toUTF8);
 	CppUnit_addTest(pSuite, TextConverterTest, testErrors);
+	CppUnit_addTest(pSuite, TextConverterTest, testTranscode);
 
 	return pSuite;
 }
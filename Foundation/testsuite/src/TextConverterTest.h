@@ -34,6 +34,7 @@ public:
 	void testCP1251toUTF8();
 	void testCP1252toUTF8();
 	void testErrors();
+	void testTranscode();
 
 	void setUp();
 	void tearDown();
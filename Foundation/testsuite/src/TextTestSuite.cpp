@@ -15,6 +15,7 @@
 #include "StreamConverterTest.h"
 #include "TextEncodingTest.h"
 #include "UTF8StringTest.h"
+#include "UTFTranscoderTest.h"
 #ifndef POCO_NO_WSTRING
 #include "UnicodeConverterTest.h"
 #endif
@@ -29,6 +30,7 @@ CppUnit::Test* TextTestSuite::suite()
 	pSuite->addTest(StreamConverterTest::suite());
 	pSuite->addTest(TextEncodingTest::suite());
 	pSuite->addTest(UTF8StringTest::suite());
+	pSuite->addTest(UTFTranscoderTest::suite());
 #ifndef POCO_NO_WSTRING
 	pSuite->addTest(UnicodeConverterTest::suite());
 #endif
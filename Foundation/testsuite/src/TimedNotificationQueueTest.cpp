@@ -15,6 +15,7 @@
 #include "Poco/Notification.h"
 #include "Poco/Timestamp.h"
 #include "Poco/Clock.h"
+#include <vector>
 
 
 using Poco::TimedNotificationQueue;
@@ -268,6 +269,43 @@ void TimedNotificationQueueTest::testWaitDequeueTimeout()
 }
 
 
+void TimedNotificationQueueTest::testBatch()
+{
+	TimedNotificationQueue queue;
+	std::vector<Notification::Ptr> batch;
+	assertTrue (queue.dequeueBatch(batch, 10) == 0);
+
+	std::vector<Notification::Ptr> now;
+	now.push_back(new QTestNotification("first"));
+	now.push_back(new QTestNotification("second"));
+	std::vector<Notification::Ptr> later;
+	later.push_back(new QTestNotification("third"));
+	later.push_back(new QTestNotification("fourth"));
+
+	Clock clock;
+	clock += 100000;
+	queue.enqueueBatch(later, clock);
+	queue.enqueueBatch(now, Timestamp());
+	assertTrue (queue.size() == 4);
+
+	// only notifications that are due are dequeued
+	assertTrue (queue.dequeueBatch(batch, 10) == 2);
+	assertTrue (queue.size() == 2);
+	assertTrue (dynamic_cast<QTestNotification*>(batch[0].get())->data() == "first");
+	assertTrue (dynamic_cast<QTestNotification*>(batch[1].get())->data() == "second");
+	batch.clear();
+
+	assertTrue (queue.waitDequeueBatch(batch, 10, 1000) == 2);
+	assertTrue (clock.elapsed() >= 0);
+	assertTrue (queue.empty());
+	assertTrue (dynamic_cast<QTestNotification*>(batch[0].get())->data() == "third");
+	assertTrue (dynamic_cast<QTestNotification*>(batch[1].get())->data() == "fourth");
+	batch.clear();
+
+	assertTrue (queue.waitDequeueBatch(batch, 10, 10) == 0);
+}
+
+
 void TimedNotificationQueueTest::setUp()
 {
 }
@@ -286,6 +324,7 @@ CppUnit::Test* TimedNotificationQueueTest::suite()
 	CppUnit_addTest(pSuite, TimedNotificationQueueTest, testDequeueNext);
 	CppUnit_addTest(pSuite, TimedNotificationQueueTest, testWaitDequeue);
 	CppUnit_addTest(pSuite, TimedNotificationQueueTest, testWaitDequeueTimeout);
+	CppUnit_addTest(pSuite, TimedNotificationQueueTest, testBatch);
 
 	return pSuite;
 }
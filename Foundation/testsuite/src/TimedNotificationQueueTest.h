@@ -31,6 +31,7 @@ public:
 	void testDequeueNext();
 	void testWaitDequeue();
 	void testWaitDequeueTimeout();
+	void testBatch();
 
 	void setUp();
 	void tearDown();
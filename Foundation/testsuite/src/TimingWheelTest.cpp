@@ -0,0 +1,302 @@
+//
+// TimingWheelTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "TimingWheelTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/TimingWheel.h"
+#include "Poco/Random.h"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+
+using Poco::TimingWheel;
+using Poco::Clock;
+
+
+namespace
+{
+	// all tests use a wheel starting at Clock(0) with
+	// a resolution of 1 ms, and simulated time
+	Clock at(Clock::ClockDiff milliseconds)
+	{
+		return Clock(milliseconds*1000);
+	}
+}
+
+
+TimingWheelTest::TimingWheelTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+TimingWheelTest::~TimingWheelTest()
+{
+}
+
+
+void TimingWheelTest::testSchedule()
+{
+	TimingWheel<int> wheel(1000, at(0));
+	assertTrue (wheel.empty());
+	assertTrue (wheel.resolution() == 1000);
+
+	TimingWheel<int>::TimerId id1 = wheel.schedule(at(10), 1);
+	TimingWheel<int>::TimerId id2 = wheel.schedule(at(20), 2);
+	wheel.schedule(at(20), 3);
+	assertTrue (id1 != TimingWheel<int>::INVALID_TIMER_ID);
+	assertTrue (id1 != id2);
+	assertTrue (wheel.size() == 3);
+	assertTrue (wheel.scheduled(id1));
+
+	std::vector<int> expired;
+	assertTrue (wheel.advance(at(9), expired) == 0);
+	assertTrue (expired.empty());
+	assertTrue (wheel.advance(at(10), expired) == 1);
+	assertTrue (expired.size() == 1 && expired[0] == 1);
+	assertFalse (wheel.scheduled(id1));
+	assertTrue (wheel.size() == 2);
+
+	expired.clear();
+	assertTrue (wheel.advance(at(100), expired) == 2);
+	std::sort(expired.begin(), expired.end());
+	assertTrue (expired[0] == 2 && expired[1] == 3);
+	assertTrue (wheel.empty());
+
+	// entries in the past expire with the next tick
+	expired.clear();
+	wheel.schedule(at(50), 4);
+	assertTrue (wheel.advance(at(100), expired) == 0);
+	assertTrue (wheel.advance(at(101), expired) == 1);
+	assertTrue (expired[0] == 4);
+
+	// entries never expire early
+	expired.clear();
+	wheel.schedule(Clock(150500), 5);
+	assertTrue (wheel.advance(Clock(150999), expired) == 0);
+	assertTrue (wheel.advance(at(151), expired) == 1);
+}
+
+
+void TimingWheelTest::testCancel()
+{
+	TimingWheel<int> wheel(1000, at(0));
+	TimingWheel<int>::TimerId id1 = wheel.schedule(at(10), 1);
+	TimingWheel<int>::TimerId id2 = wheel.schedule(at(10), 2);
+	TimingWheel<int>::TimerId id3 = wheel.schedule(at(100000), 3);
+	assertTrue (wheel.cancel(id1));
+	assertFalse (wheel.cancel(id1));
+	assertTrue (wheel.cancel(id3));
+	assertTrue (wheel.size() == 1);
+	assertFalse (wheel.cancel(TimingWheel<int>::INVALID_TIMER_ID));
+
+	// the slot of a cancelled entry is reused, but the id stays unique
+	TimingWheel<int>::TimerId id4 = wheel.schedule(at(10), 4);
+	assertTrue (id4 != id1 && id4 != id3);
+	assertFalse (wheel.scheduled(id1));
+
+	std::vector<int> expired;
+	assertTrue (wheel.advance(at(10), expired) == 2);
+	assertTrue (expired[0] == 2 && expired[1] == 4);
+	assertFalse (wheel.cancel(id2));
+	assertTrue (wheel.empty());
+}
+
+
+void TimingWheelTest::testReschedule()
+{
+	TimingWheel<int> wheel(1000, at(0));
+	TimingWheel<int>::TimerId id = wheel.schedule(at(10), 1);
+	assertTrue (wheel.reschedule(id, at(5000)));
+
+	std::vector<int> expired;
+	assertTrue (wheel.advance(at(4999), expired) == 0);
+	assertTrue (wheel.scheduled(id));
+	assertTrue (wheel.reschedule(id, at(4000)));
+	assertTrue (wheel.advance(at(5000), expired) == 1);
+	assertFalse (wheel.reschedule(id, at(6000)));
+	assertTrue (wheel.empty());
+}
+
+
+void TimingWheelTest::testCascade()
+{
+	TimingWheel<int> wheel(1000, at(0));
+	// one entry on each level
+	wheel.schedule(at(100), 0);
+	wheel.schedule(at(1000), 1);
+	wheel.schedule(at(100000), 2);
+	wheel.schedule(at(20000000), 3);
+	assertTrue (wheel.size() == 4);
+
+	std::vector<int> expired;
+	const Clock::ClockDiff times[] = {100, 1000, 100000, 20000000};
+	for (int i = 0; i < 4; ++i)
+	{
+		assertTrue (wheel.advance(at(times[i] - 1), expired) == 0);
+		assertTrue (wheel.advance(at(times[i]), expired) == 1);
+		assertTrue (expired.back() == i);
+	}
+	assertTrue (wheel.empty());
+
+	// advancing in small steps must give the same result
+	TimingWheel<int> wheel2(1000, at(0));
+	wheel2.schedule(at(70000), 1);
+	wheel2.schedule(at(70001), 2);
+	expired.clear();
+	for (Clock::ClockDiff t = 0; t < 70000; t += 7)
+	{
+		wheel2.advance(at(t), expired);
+	}
+	assertTrue (expired.empty());
+	assertTrue (wheel2.advance(at(70000), expired) == 1);
+	assertTrue (wheel2.advance(at(70001), expired) == 1);
+	assertTrue (expired[0] == 1 && expired[1] == 2);
+}
+
+
+void TimingWheelTest::testFarFuture()
+{
+	// beyond the range of the wheel (2^32 ticks)
+	TimingWheel<int> wheel(1000000, at(0));
+	const Clock::ClockDiff farAway = (Clock::ClockDiff(1) << 33)*1000;
+	wheel.schedule(at(farAway), 1);
+
+	std::vector<int> expired;
+	assertTrue (wheel.advance(at(farAway/2), expired) == 0);
+	assertTrue (wheel.advance(at(farAway - 1000), expired) == 0);
+	assertTrue (wheel.size() == 1);
+	assertTrue (wheel.advance(at(farAway), expired) == 1);
+}
+
+
+void TimingWheelTest::testNextExpiry()
+{
+	TimingWheel<int> wheel(1000, at(0));
+	Clock next;
+	assertFalse (wheel.nextExpiry(next));
+
+	wheel.schedule(at(20), 1);
+	wheel.schedule(at(10), 2);
+	assertTrue (wheel.nextExpiry(next));
+	assertTrue (next == at(10));
+
+	// beyond level 0, the next cascade is reported
+	TimingWheel<int> wheel2(1000, at(0));
+	wheel2.schedule(at(1000), 1);
+	assertTrue (wheel2.nextExpiry(next));
+	assertTrue (next == at(256));
+	std::vector<int> expired;
+	wheel2.advance(next, expired);
+	assertTrue (wheel2.nextExpiry(next));
+	assertTrue (next == at(512));
+}
+
+
+void TimingWheelTest::testDrain()
+{
+	TimingWheel<int> wheel(1000, at(0));
+	for (int i = 0; i < 100; ++i)
+	{
+		wheel.schedule(at(i*1000), i);
+	}
+	std::vector<int> values;
+	assertTrue (wheel.drain(values) == 100);
+	assertTrue (wheel.empty());
+	std::sort(values.begin(), values.end());
+	for (int i = 0; i < 100; ++i)
+	{
+		assertTrue (values[i] == i);
+	}
+
+	wheel.schedule(at(10), 1);
+	wheel.clear();
+	assertTrue (wheel.empty());
+	values.clear();
+	assertTrue (wheel.advance(at(1000), values) == 0);
+}
+
+
+void TimingWheelTest::testRandom()
+{
+	// compare against a sorted reference
+	TimingWheel<int> wheel(1000, at(0));
+	std::multimap<Clock::ClockDiff, int> reference;
+	std::map<int, TimingWheel<int>::TimerId> ids;
+	Poco::Random rnd;
+	rnd.seed(42);
+
+	Clock::ClockDiff now = 0;
+	std::vector<int> expired;
+	for (int i = 0; i < 20000; ++i)
+	{
+		const Clock::ClockDiff expiry = now + rnd.next(100000);
+		ids[i] = wheel.schedule(at(expiry), i);
+		reference.insert(std::make_pair(expiry, i));
+		if (rnd.next(4) == 0)
+		{
+			// cancel a random earlier entry
+			int victim = rnd.next(i + 1);
+			if (wheel.cancel(ids[victim]))
+			{
+				for (auto it = reference.begin(); it != reference.end(); ++it)
+				{
+					if (it->second == victim)
+					{
+						reference.erase(it);
+						break;
+					}
+				}
+			}
+		}
+		now += rnd.next(10);
+		expired.clear();
+		wheel.advance(at(now), expired);
+		std::sort(expired.begin(), expired.end());
+
+		std::vector<int> expected;
+		while (!reference.empty() && reference.begin()->first <= now)
+		{
+			expected.push_back(reference.begin()->second);
+			reference.erase(reference.begin());
+		}
+		std::sort(expected.begin(), expected.end());
+		assertTrue (expired == expected);
+	}
+	assertTrue (wheel.size() == reference.size());
+}
+
+
+void TimingWheelTest::setUp()
+{
+}
+
+
+void TimingWheelTest::tearDown()
+{
+}
+
+
+CppUnit::Test* TimingWheelTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TimingWheelTest");
+
+	CppUnit_addTest(pSuite, TimingWheelTest, testSchedule);
+	CppUnit_addTest(pSuite, TimingWheelTest, testCancel);
+	CppUnit_addTest(pSuite, TimingWheelTest, testReschedule);
+	CppUnit_addTest(pSuite, TimingWheelTest, testCascade);
+	CppUnit_addTest(pSuite, TimingWheelTest, testFarFuture);
+	CppUnit_addTest(pSuite, TimingWheelTest, testNextExpiry);
+	CppUnit_addTest(pSuite, TimingWheelTest, testDrain);
+	CppUnit_addTest(pSuite, TimingWheelTest, testRandom);
+
+	return pSuite;
+}
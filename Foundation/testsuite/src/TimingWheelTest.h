@@ -0,0 +1,43 @@
+//
+// TimingWheelTest.h
+//
+// Definition of the TimingWheelTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef TimingWheelTest_INCLUDED
+#define TimingWheelTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class TimingWheelTest: public CppUnit::TestCase
+{
+public:
+	TimingWheelTest(const std::string& name);
+	~TimingWheelTest();
+
+	void testSchedule();
+	void testCancel();
+	void testReschedule();
+	void testCascade();
+	void testFarFuture();
+	void testNextExpiry();
+	void testDrain();
+	void testRandom();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // TimingWheelTest_INCLUDED
@@ -0,0 +1,257 @@
+//
+// UTFTranscoderTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "UTFTranscoderTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/UTFTranscoder.h"
+#include "Poco/UTF8Encoding.h"
+#include "Poco/UTF8String.h"
+#include <vector>
+
+
+using Poco::UTFTranscoder;
+using Poco::UTF16Char;
+using Poco::UTF32Char;
+
+
+namespace
+{
+	std::size_t referenceLength(const std::string& str)
+		/// Returns the length of the valid UTF-8 prefix of str,
+		/// as determined by UTF8Encoding.
+	{
+		Poco::UTF8Encoding encoding;
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(str.data());
+		std::size_t pos = 0;
+		while (pos < str.size())
+		{
+			const int remaining = static_cast<int>(str.size() - pos);
+			if (encoding.queryConvert(p + pos, remaining) < 0) break;
+			pos += encoding.sequenceLength(p + pos, remaining);
+		}
+		return pos;
+	}
+}
+
+
+UTFTranscoderTest::UTFTranscoderTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+UTFTranscoderTest::~UTFTranscoderTest()
+{
+}
+
+
+void UTFTranscoderTest::testASCII()
+{
+	for (std::size_t length = 0; length < 70; length++)
+	{
+		std::string text(length, 'a');
+		assertTrue (UTFTranscoder::asciiLength(text.data(), text.size()) == length);
+		for (std::size_t pos = 0; pos < length; pos++)
+		{
+			std::string mixed(text);
+			mixed[pos] = '\xE4';
+			assertTrue (UTFTranscoder::asciiLength(mixed.data(), mixed.size()) == pos);
+		}
+	}
+}
+
+
+void UTFTranscoderTest::testValidate()
+{
+	const std::string valid[] =
+	{
+		"", "a", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF",
+		"\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF", "K\xC3\xB6nig \xE2\x82\xAC \xF0\x9F\x98\x80"
+	};
+	const std::string invalid[] =
+	{
+		"\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xC2", "\xC2\x41", "\xE0\x80\x80", "\xE0\x9F\xBF",
+		"\xED\xA0\x80", "\xED\xBF\xBF", "\xE1\x80", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF",
+		"\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF8\x88\x80\x80\x80", "\xFE", "\xFF", "\xF1\x80\x80"
+	};
+
+	// place every sequence at all positions relative to a 16 byte block
+	for (std::size_t pad = 0; pad < 40; pad++)
+	{
+		const std::string prefix(pad, 'x');
+		const std::string suffix(40 - pad, 'y');
+		for (const auto& s: valid)
+		{
+			const std::string text = prefix + s + suffix;
+			assertTrue (UTFTranscoder::isValidUTF8(text.data(), text.size()));
+			assertTrue (UTFTranscoder::validUTF8Length(text.data(), text.size()) == text.size());
+			assertTrue (Poco::UTF8::isValid(prefix + s));
+		}
+		for (const auto& s: invalid)
+		{
+			const std::string text = prefix + s + suffix;
+			assertTrue (!UTFTranscoder::isValidUTF8(text.data(), text.size()));
+			assertTrue (UTFTranscoder::validUTF8Length(text.data(), text.size()) == pad);
+			assertTrue (!Poco::UTF8::isValid(prefix + s));
+			assertTrue (UTFTranscoder::validUTF8Length(text.data(), text.size()) == referenceLength(text));
+		}
+	}
+}
+
+
+void UTFTranscoderTest::testValidateRandom()
+{
+	for (unsigned seed = 1; seed < 2000; seed++)
+	{
+		const std::string text = randomText(seed, seed % 300, seed % 4 != 0);
+		assertTrue (UTFTranscoder::validUTF8Length(text.data(), text.size()) == referenceLength(text));
+	}
+}
+
+
+void UTFTranscoderTest::testUTF16()
+{
+	for (unsigned seed = 1; seed < 500; seed++)
+	{
+		const std::string text = randomText(seed, seed % 300, true);
+		std::size_t utf16Length = 0;
+		std::vector<UTF16Char> utf16(text.size());
+		assertTrue (UTFTranscoder::utf8ToUTF16(text.data(), text.size(), utf16.data(), utf16Length) == text.size());
+
+		std::size_t utf8Length = 0;
+		std::string utf8(3*utf16Length, '\0');
+		assertTrue (UTFTranscoder::utf16ToUTF8(utf16.data(), utf16Length, utf8.data(), utf8Length) == utf16Length);
+		utf8.resize(utf8Length);
+		assertTrue (utf8 == text);
+	}
+
+	const std::string text("a\xF0\x9F\x98\x80\xC3\xA4");
+	UTF16Char utf16[8];
+	std::size_t length = 0;
+	assertTrue (UTFTranscoder::utf8ToUTF16(text.data(), text.size(), utf16, length) == text.size());
+	assertTrue (length == 4);
+	assertTrue (utf16[0] == 'a' && utf16[1] == 0xD83D && utf16[2] == 0xDE00 && utf16[3] == 0xE4);
+
+	// conversion stops at invalid sequences and unpaired surrogates
+	assertTrue (UTFTranscoder::utf8ToUTF16("ab\xC3", 3, utf16, length) == 2);
+	assertTrue (length == 2);
+	const UTF16Char unpaired[] = {'a', 0xD83D, 'b'};
+	char utf8[16];
+	assertTrue (UTFTranscoder::utf16ToUTF8(unpaired, 3, utf8, length) == 1);
+	assertTrue (length == 1);
+	const UTF16Char low[] = {'a', 'b', 0xDE00};
+	assertTrue (UTFTranscoder::utf16ToUTF8(low, 3, utf8, length) == 2);
+}
+
+
+void UTFTranscoderTest::testUTF32()
+{
+	for (unsigned seed = 1; seed < 500; seed++)
+	{
+		const std::string text = randomText(seed, seed % 300, true);
+		std::size_t utf32Length = 0;
+		std::vector<UTF32Char> utf32(text.size());
+		assertTrue (UTFTranscoder::utf8ToUTF32(text.data(), text.size(), utf32.data(), utf32Length) == text.size());
+
+		std::size_t utf8Length = 0;
+		std::string utf8(4*utf32Length, '\0');
+		assertTrue (UTFTranscoder::utf32ToUTF8(utf32.data(), utf32Length, utf8.data(), utf8Length) == utf32Length);
+		utf8.resize(utf8Length);
+		assertTrue (utf8 == text);
+	}
+
+	const UTF32Char invalid[] = {'a', 0xD800, 'b'};
+	char utf8[16];
+	std::size_t length = 0;
+	assertTrue (UTFTranscoder::utf32ToUTF8(invalid, 3, utf8, length) == 1);
+	const UTF32Char large[] = {'a', 'b', 0x110000};
+	assertTrue (UTFTranscoder::utf32ToUTF8(large, 3, utf8, length) == 2);
+}
+
+
+void UTFTranscoderTest::testLatin1()
+{
+	std::string latin1;
+	for (int i = 0; i < 3; i++)
+	{
+		for (int c = 1; c < 256; c++) latin1 += static_cast<char>(c);
+	}
+	std::string utf8(2*latin1.size(), '\0');
+	utf8.resize(UTFTranscoder::latin1ToUTF8(latin1.data(), latin1.size(), utf8.data()));
+	assertTrue (utf8.size() == 3*(127 + 2*128));
+	assertTrue (UTFTranscoder::isValidUTF8(utf8.data(), utf8.size()));
+
+	std::string result(utf8.size(), '\0');
+	std::size_t length = 0;
+	assertTrue (UTFTranscoder::utf8ToLatin1(utf8.data(), utf8.size(), result.data(), length) == utf8.size());
+	result.resize(length);
+	assertTrue (result == latin1);
+
+	// conversion stops at characters that cannot be represented
+	assertTrue (UTFTranscoder::utf8ToLatin1("ab\xE2\x82\xAC", 5, result.data(), length) == 2);
+	assertTrue (UTFTranscoder::utf8ToLatin1("ab\xC4\x80", 4, result.data(), length) == 2);
+}
+
+
+void UTFTranscoderTest::setUp()
+{
+}
+
+
+void UTFTranscoderTest::tearDown()
+{
+}
+
+
+std::string UTFTranscoderTest::randomText(unsigned seed, std::size_t length, bool valid)
+{
+	// mostly ASCII with runs of multi-byte characters,
+	// and random bytes unless valid is true
+	static const char* const CHARS[] =
+	{
+		"\xC3\xA4", "\xD0\x96", "\xE2\x82\xAC", "\xE4\xB8\xAD", "\xEF\xBF\xBD", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF"
+	};
+
+	std::string text;
+	Poco::UInt32 state = seed;
+	while (text.size() < length)
+	{
+		state = state*1103515245 + 12345;
+		const unsigned r = (state >> 16) & 0x7FFF;
+		if (r % 3 == 0)
+		{
+			text += CHARS[r % 7];
+		}
+		else if (!valid && r % 29 == 1)
+		{
+			text += static_cast<char>(0x80 + (r >> 5) % 0x80);
+		}
+		else
+		{
+			text.append(r % 20, static_cast<char>('a' + r % 26));
+		}
+	}
+	return text;
+}
+
+
+CppUnit::Test* UTFTranscoderTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("UTFTranscoderTest");
+
+	CppUnit_addTest(pSuite, UTFTranscoderTest, testASCII);
+	CppUnit_addTest(pSuite, UTFTranscoderTest, testValidate);
+	CppUnit_addTest(pSuite, UTFTranscoderTest, testValidateRandom);
+	CppUnit_addTest(pSuite, UTFTranscoderTest, testUTF16);
+	CppUnit_addTest(pSuite, UTFTranscoderTest, testUTF32);
+	CppUnit_addTest(pSuite, UTFTranscoderTest, testLatin1);
+
+	return pSuite;
+}
@@ -3417,6 +3417,107 @@ void VarTest::testVarVisitor()
 }
 
 
+void VarTest::testTaggedTypes()
+{
+	testTaggedType<Poco::Int8>(-8);
+	testTaggedType<Poco::Int16>(-16);
+	testTaggedType<Poco::Int32>(-32);
+	testTaggedType<Poco::Int64>(-64);
+	testTaggedType<Poco::UInt8>(8);
+	testTaggedType<Poco::UInt16>(16);
+	testTaggedType<Poco::UInt32>(32);
+	testTaggedType<Poco::UInt64>(64);
+	testTaggedType<bool>(true);
+	testTaggedType<float>(1.5f);
+	testTaggedType<double>(-2.5);
+	testTaggedType<char>('c');
+	testTaggedType<std::string>("a string");
+	testTaggedType<std::string>(std::string(100, 'x'));
+
+	// conversions between tagged types keep the range checks
+	Var da = Poco::Int64(300);
+	assertTrue (da.convert<Poco::Int16>() == 300);
+	assertTrue (da.convert<double>() == 300.0);
+	try
+	{
+		da.convert<Poco::UInt8>();
+		fail ("must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+	da = -1;
+	try
+	{
+		da.convert<Poco::UInt64>();
+		fail ("must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+	da = "123";
+	assertTrue (da.convert<Poco::Int32>() == 123);
+	da = "abc";
+	try
+	{
+		da.convert<Poco::Int32>();
+		fail ("must throw");
+	}
+	catch (Poco::SyntaxException&)
+	{
+	}
+	try
+	{
+		da.extract<Poco::Int32>();
+		fail ("must throw");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+
+	// comparisons give the same results as comparing string conversions
+	std::vector<Var> values;
+	values.push_back(Poco::Int8(-1));
+	values.push_back(Poco::Int16(1));
+	values.push_back(Poco::Int32(10));
+	values.push_back(Poco::Int64(-1));
+	values.push_back(Poco::UInt8(1));
+	values.push_back(Poco::UInt16(9));
+	values.push_back(Poco::UInt32(10));
+	values.push_back(std::numeric_limits<Poco::UInt64>::max());
+	values.push_back(std::numeric_limits<Poco::Int64>::min());
+	values.push_back(true);
+	values.push_back(false);
+	values.push_back(1.0f);
+	values.push_back(1.0);
+	values.push_back(-0.0);
+	values.push_back(0.0);
+	values.push_back(std::numeric_limits<double>::quiet_NaN());
+	values.push_back('1');
+	values.push_back("1");
+	values.push_back("true");
+	values.push_back("-1");
+	values.push_back(std::string("10"));
+	values.push_back(std::string());
+	for (const auto& a: values)
+	{
+		for (const auto& b: values)
+		{
+			const std::string sa = a.convert<std::string>();
+			const std::string sb = b.convert<std::string>();
+			assertTrue ((a == b) == (sa == sb));
+			assertTrue ((a != b) == (sa != sb));
+			assertTrue ((a < b) == (sa < sb));
+			assertTrue ((a <= b) == (sa <= sb));
+			assertTrue ((a > b) == (sa > sb));
+			assertTrue ((a >= b) == (sa >= sb));
+			assertTrue ((a == sb.c_str()) == (sa == sb));
+			assertTrue ((a != sb.c_str()) == (sa != sb));
+		}
+	}
+}
+
+
 void VarTest::setUp()
 {
 }
@@ -3487,6 +3588,7 @@ CppUnit::Test* VarTest::suite()
 	CppUnit_addTest(pSuite, VarTest, testIterator);
 	CppUnit_addTest(pSuite, VarTest, testVarVisitor);
 	CppUnit_addTest(pSuite, VarTest, testEnumType);
+	CppUnit_addTest(pSuite, VarTest, testTaggedTypes);
 
 	return pSuite;
 }
@@ -82,6 +82,7 @@ public:
 	void testIterator();
 	void testSharedPtr();
 	void testVarVisitor();
+	void testTaggedTypes();
 
 	void setUp();
 	void tearDown();
@@ -185,6 +186,47 @@ private:
 		assertTrue (!(val >= da));
 	}
 
+	template <typename T>
+	void testTaggedType(const T& value)
+	{
+		const Poco::Dynamic::VarHolderImpl<T> holder(value);
+		const Poco::Dynamic::Var da(value);
+
+		assertTrue (da.type() == typeid(T));
+		assertTrue (da.isInteger() == holder.isInteger());
+		assertTrue (da.isSigned() == holder.isSigned());
+		assertTrue (da.isNumeric() == holder.isNumeric());
+		assertTrue (da.isBoolean() == holder.isBoolean());
+		assertTrue (da.isString() == holder.isString());
+		assertTrue (da.extract<T>() == value);
+		assertTrue (da.convert<T>() == value);
+
+		std::string str;
+		holder.convert(str);
+		assertTrue (da.convert<std::string>() == str);
+
+		Poco::Dynamic::Var copy(da);
+		assertTrue (copy.type() == typeid(T));
+		assertTrue (copy.extract<T>() == value);
+
+		Poco::Dynamic::Var other("other");
+		copy.swap(other);
+		assertTrue (copy.extract<std::string>() == "other");
+		assertTrue (other.extract<T>() == value);
+
+		other.clear();
+		assertTrue (other.type() == typeid(void));
+		assertTrue (!other.isNumeric() && !other.isString() && !other.isBoolean());
+		try
+		{
+			other.extract<T>();
+			fail ("must throw");
+		}
+		catch (Poco::InvalidAccessException&)
+		{
+		}
+	}
+
 	template <typename C>
 	void testContainerIterator()
 	{
@@ -0,0 +1,201 @@
+//
+// WorkStealingQueueTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "WorkStealingQueueTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/WorkStealingQueue.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+
+using Poco::WorkStealingQueue;
+using Poco::Thread;
+
+
+WorkStealingQueueTest::WorkStealingQueueTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+WorkStealingQueueTest::~WorkStealingQueueTest()
+{
+}
+
+
+void WorkStealingQueueTest::testPushPop()
+{
+	WorkStealingQueue<int> queue;
+	assertTrue (queue.empty());
+
+	int value = 0;
+	assertFalse (queue.pop(value));
+
+	queue.push(1);
+	queue.push(2);
+	queue.push(3);
+	assertTrue (queue.size() == 3);
+
+	// owner pops in LIFO order
+	assertTrue (queue.pop(value));
+	assertTrue (value == 3);
+	assertTrue (queue.pop(value));
+	assertTrue (value == 2);
+	assertTrue (queue.pop(value));
+	assertTrue (value == 1);
+	assertFalse (queue.pop(value));
+	assertTrue (queue.empty());
+}
+
+
+void WorkStealingQueueTest::testSteal()
+{
+	WorkStealingQueue<int> queue;
+
+	int value = 0;
+	assertFalse (queue.steal(value));
+
+	queue.push(1);
+	queue.push(2);
+	queue.push(3);
+
+	// thieves steal in FIFO order
+	assertTrue (queue.steal(value));
+	assertTrue (value == 1);
+	assertTrue (queue.pop(value));
+	assertTrue (value == 3);
+	assertTrue (queue.steal(value));
+	assertTrue (value == 2);
+	assertFalse (queue.steal(value));
+	assertFalse (queue.pop(value));
+}
+
+
+void WorkStealingQueueTest::testGrow()
+{
+	WorkStealingQueue<int> queue(4);
+	int value = 0;
+	queue.push(-1);
+	assertTrue (queue.steal(value));
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		queue.push(i);
+	}
+	assertTrue (queue.size() == 1000);
+	for (int i = 0; i < 500; ++i)
+	{
+		assertTrue (queue.steal(value));
+		assertTrue (value == i);
+	}
+	for (int i = 999; i >= 500; --i)
+	{
+		assertTrue (queue.pop(value));
+		assertTrue (value == i);
+	}
+	assertTrue (queue.empty());
+}
+
+
+namespace
+{
+	class Thief: public Poco::Runnable
+	{
+	public:
+		Thief(WorkStealingQueue<int>& queue, std::vector<std::atomic<int>>& taken, std::atomic<bool>& done):
+			_queue(queue),
+			_taken(taken),
+			_done(done)
+		{
+		}
+
+		void run() override
+		{
+			int value;
+			while (!_done.load() || !_queue.empty())
+			{
+				if (_queue.steal(value))
+					++_taken[value];
+				else
+					Thread::yield();
+			}
+		}
+
+	private:
+		WorkStealingQueue<int>& _queue;
+		std::vector<std::atomic<int>>& _taken;
+		std::atomic<bool>& _done;
+	};
+}
+
+
+void WorkStealingQueueTest::testConcurrentSteal()
+{
+	const int THIEVES = 4;
+	const int COUNT = 100000;
+
+	WorkStealingQueue<int> queue(16);
+	std::vector<std::atomic<int>> taken(COUNT);
+	std::atomic<bool> done(false);
+
+	std::vector<std::unique_ptr<Thief>> thieves;
+	std::vector<std::unique_ptr<Thread>> threads;
+	for (int i = 0; i < THIEVES; ++i)
+	{
+		thieves.push_back(std::make_unique<Thief>(queue, taken, done));
+		threads.push_back(std::make_unique<Thread>());
+		threads.back()->start(*thieves.back());
+	}
+
+	// the owner pushes and pops concurrently with the thieves
+	int value;
+	for (int i = 0; i < COUNT; ++i)
+	{
+		queue.push(i);
+		if (i % 3 == 0 && queue.pop(value)) ++taken[value];
+	}
+	while (queue.pop(value)) ++taken[value];
+	done = true;
+	for (auto& pThread: threads)
+	{
+		pThread->join();
+	}
+
+	for (int i = 0; i < COUNT; ++i)
+	{
+		assertTrue (taken[i] == 1);
+	}
+}
+
+
+void WorkStealingQueueTest::setUp()
+{
+}
+
+
+void WorkStealingQueueTest::tearDown()
+{
+}
+
+
+CppUnit::Test* WorkStealingQueueTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WorkStealingQueueTest");
+
+	CppUnit_addTest(pSuite, WorkStealingQueueTest, testPushPop);
+	CppUnit_addTest(pSuite, WorkStealingQueueTest, testSteal);
+	CppUnit_addTest(pSuite, WorkStealingQueueTest, testGrow);
+	CppUnit_addTest(pSuite, WorkStealingQueueTest, testConcurrentSteal);
+
+	return pSuite;
+}
@@ -0,0 +1,39 @@
+//
+// WorkStealingQueueTest.h
+//
+// Definition of the WorkStealingQueueTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef WorkStealingQueueTest_INCLUDED
+#define WorkStealingQueueTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class WorkStealingQueueTest: public CppUnit::TestCase
+{
+public:
+	WorkStealingQueueTest(const std::string& name);
+	~WorkStealingQueueTest();
+
+	void testPushPop();
+	void testSteal();
+	void testGrow();
+	void testConcurrentSteal();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // WorkStealingQueueTest_INCLUDED
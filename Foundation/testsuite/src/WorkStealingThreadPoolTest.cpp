@@ -0,0 +1,210 @@
+//
+// WorkStealingThreadPoolTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "WorkStealingThreadPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/WorkStealingThreadPool.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include <atomic>
+#include <set>
+
+
+using Poco::WorkStealingThreadPool;
+using Poco::ErrorHandler;
+using Poco::Runnable;
+using Poco::Thread;
+
+
+namespace
+{
+	class CountingRunnable: public Runnable
+	{
+	public:
+		CountingRunnable(): count(0)
+		{
+		}
+
+		void run() override
+		{
+			++count;
+		}
+
+		std::atomic<int> count;
+	};
+
+	class CountingErrorHandler: public ErrorHandler
+	{
+	public:
+		CountingErrorHandler(): count(0)
+		{
+		}
+
+		void exception(const Poco::Exception&) override
+		{
+			++count;
+		}
+
+		void exception(const std::exception&) override
+		{
+			++count;
+		}
+
+		void exception() override
+		{
+			++count;
+		}
+
+		std::atomic<int> count;
+	};
+
+	void spawn(WorkStealingThreadPool& pool, std::atomic<int>& count, int depth)
+	{
+		++count;
+		if (depth > 0)
+		{
+			pool.startFunc([&pool, &count, depth]() { spawn(pool, count, depth - 1); });
+			pool.startFunc([&pool, &count, depth]() { spawn(pool, count, depth - 1); });
+		}
+	}
+}
+
+
+WorkStealingThreadPoolTest::WorkStealingThreadPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+WorkStealingThreadPoolTest::~WorkStealingThreadPoolTest()
+{
+}
+
+
+void WorkStealingThreadPoolTest::testStart()
+{
+	WorkStealingThreadPool pool("test", 4);
+	assertTrue (pool.capacity() == 4);
+	assertTrue (pool.name() == "test");
+
+	CountingRunnable runnable;
+	for (int i = 0; i < 10000; ++i)
+	{
+		pool.start(runnable);
+	}
+	pool.joinAll();
+	assertTrue (runnable.count == 10000);
+	assertTrue (pool.pending() == 0);
+
+	// workers park when idle and must be woken up again
+	Thread::sleep(100);
+	pool.start(runnable);
+	pool.joinAll();
+	assertTrue (runnable.count == 10001);
+}
+
+
+void WorkStealingThreadPoolTest::testStartFunc()
+{
+	WorkStealingThreadPool pool(4);
+	std::atomic<int> count(0);
+	Poco::FastMutex mutex;
+	std::set<std::string> threadNames;
+	for (int i = 0; i < 1000; ++i)
+	{
+		pool.startFunc([&]()
+			{
+				++count;
+				Poco::FastMutex::ScopedLock lock(mutex);
+				threadNames.insert(Thread::current()->getName());
+			});
+	}
+	pool.joinAll();
+	assertTrue (count == 1000);
+	assertTrue (!threadNames.empty() && threadNames.size() <= 4);
+}
+
+
+void WorkStealingThreadPoolTest::testSubtasks()
+{
+	WorkStealingThreadPool pool(4);
+	std::atomic<int> count(0);
+
+	// subtasks go to the local queues of the workers
+	// and are distributed by stealing
+	pool.startFunc([&pool, &count]() { spawn(pool, count, 12); });
+	pool.joinAll();
+	assertTrue (count == (1 << 13) - 1);
+}
+
+
+void WorkStealingThreadPoolTest::testException()
+{
+	CountingErrorHandler handler;
+	ErrorHandler* pOldHandler = ErrorHandler::set(&handler);
+	try
+	{
+		WorkStealingThreadPool pool(2);
+		std::atomic<int> count(0);
+		pool.startFunc([]() { throw Poco::IOException("test"); });
+		pool.startFunc([]() { throw std::runtime_error("test"); });
+		pool.startFunc([&count]() { ++count; });
+		pool.joinAll();
+		assertTrue (handler.count == 2);
+		assertTrue (count == 1);
+	}
+	catch (...)
+	{
+		ErrorHandler::set(pOldHandler);
+		throw;
+	}
+	ErrorHandler::set(pOldHandler);
+}
+
+
+void WorkStealingThreadPoolTest::testDestroyWithPending()
+{
+	std::atomic<int> count(0);
+	{
+		// more tasks than fit into the injection queue
+		WorkStealingThreadPool pool(2);
+		for (int i = 0; i < 2*WorkStealingThreadPool::DEFAULT_INJECTION_QUEUE_CAPACITY; ++i)
+		{
+			pool.startFunc([&count]() { ++count; });
+		}
+	}
+	assertTrue (count == 2*WorkStealingThreadPool::DEFAULT_INJECTION_QUEUE_CAPACITY);
+}
+
+
+void WorkStealingThreadPoolTest::setUp()
+{
+}
+
+
+void WorkStealingThreadPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* WorkStealingThreadPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WorkStealingThreadPoolTest");
+
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testStart);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testStartFunc);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testSubtasks);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testException);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testDestroyWithPending);
+
+	return pSuite;
+}
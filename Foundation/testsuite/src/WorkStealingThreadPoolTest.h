@@ -0,0 +1,40 @@
+//
+// WorkStealingThreadPoolTest.h
+//
+// Definition of the WorkStealingThreadPoolTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef WorkStealingThreadPoolTest_INCLUDED
+#define WorkStealingThreadPoolTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class WorkStealingThreadPoolTest: public CppUnit::TestCase
+{
+public:
+	WorkStealingThreadPoolTest(const std::string& name);
+	~WorkStealingThreadPoolTest();
+
+	void testStart();
+	void testStartFunc();
+	void testSubtasks();
+	void testException();
+	void testDestroyWithPending();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // WorkStealingThreadPoolTest_INCLUDED
@@ -0,0 +1,350 @@
+//
+// DocumentView.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  DocumentView
+//
+// Definition of the DocumentView class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_DocumentView_INCLUDED
+#define JSON_DocumentView_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Tape.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Dynamic/Var.h"
+#include <string>
+#include <string_view>
+#include <iterator>
+
+
+namespace Poco::JSON {
+
+
+class JSON_API DocumentView
+	/// A lightweight, read-only view of a value in a JSON document.
+	///
+	/// The document is parsed with the two-stage Tape parser, but no
+	/// Object or Array instances are created. Members and elements are
+	/// looked up on demand, and strings without escape sequences refer
+	/// directly to the parsed text. The text therefore must not be changed
+	/// or destroyed as long as any view of the document is in use.
+	///
+	/// Views are cheap to copy; all views of a document share the
+	/// parsed tape. A view that does not refer to a value (e.g., the
+	/// result of looking up a member that does not exist) is invalid.
+	///
+	/// Example:
+	///
+	///    std::string json = "{ \"name\" : \"Franky\", \"children\" : [ { \"name\" : \"Jonas\", \"age\" : 7 } ] }";
+	///    DocumentView doc(json);
+	///    std::string_view name = doc["name"].getStringView();
+	///    Int64 age = doc["children"][0]["age"].getInt64();
+	///    for (auto it = doc.begin(); it != doc.end(); ++it)
+	///    {
+	///        std::cout << it.key() << std::endl;
+	///    }
+	/// ----
+{
+public:
+	static const std::size_t DEFAULT_DEPTH = 128;
+
+	class JSON_API ConstIterator
+		/// Iterates over the elements of an array or
+		/// the members of an object.
+		///
+		/// Like a view, an iterator shares the parsed tape, so it
+		/// remains valid after the view it has been obtained from
+		/// is destroyed.
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = DocumentView;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const DocumentView*;
+		using reference = DocumentView;
+
+		ConstIterator();
+			/// Creates a singular iterator.
+
+		std::string_view key() const;
+			/// Returns the name of the current object member,
+			/// or an empty string for array elements.
+
+		DocumentView value() const;
+			/// Returns the current element or member value.
+
+		DocumentView operator * () const;
+			/// Returns the current element or member value.
+
+		ConstIterator& operator ++ ();
+		ConstIterator operator ++ (int);
+
+		bool operator == (const ConstIterator& other) const;
+		bool operator != (const ConstIterator& other) const;
+
+	private:
+		ConstIterator(const SharedPtr<Tape>& pTape, std::size_t index, bool object);
+
+		SharedPtr<Tape> _pTape;
+		std::size_t _index;
+		bool _object;
+
+		friend class DocumentView;
+	};
+
+	DocumentView();
+		/// Creates an invalid DocumentView.
+
+	explicit DocumentView(const std::string& json, std::size_t maxDepth = DEFAULT_DEPTH);
+		/// Parses the given JSON text and creates a view of its root value.
+		///
+		/// The text must outlive the view and all views derived from it.
+		///
+		/// Throws a JSONException if the text is not valid JSON, or a
+		/// SyntaxException if a number cannot be represented.
+
+	DocumentView(std::string&& json, std::size_t maxDepth = DEFAULT_DEPTH) = delete;
+		/// Views of temporary strings are not allowed.
+
+	DocumentView(const char* json, std::size_t length, std::size_t maxDepth = DEFAULT_DEPTH);
+		/// Parses the given JSON text and creates a view of its root value.
+		///
+		/// The text must outlive the view and all views derived from it.
+		///
+		/// Throws a JSONException if the text is not valid JSON, or a
+		/// SyntaxException if a number cannot be represented.
+
+	~DocumentView();
+		/// Destroys the DocumentView.
+
+	bool isValid() const;
+		/// Returns true if the view refers to a value.
+
+	bool isObject() const;
+		/// Returns true if the value is an object.
+
+	bool isArray() const;
+		/// Returns true if the value is an array.
+
+	bool isString() const;
+		/// Returns true if the value is a string.
+
+	bool isInteger() const;
+		/// Returns true if the value is a number without
+		/// fraction or exponent.
+
+	bool isNumeric() const;
+		/// Returns true if the value is a number.
+
+	bool isBoolean() const;
+		/// Returns true if the value is true or false.
+
+	bool isNull() const;
+		/// Returns true if the value is null.
+
+	std::size_t size() const;
+		/// Returns the number of elements of an array or members of an
+		/// object. Returns 0 for all other values.
+
+	bool has(std::string_view key) const;
+		/// Returns true if the value is an object with a member
+		/// with the given name.
+
+	DocumentView get(std::string_view key) const;
+		/// Returns the member with the given name if the value is an
+		/// object, or an invalid view otherwise or if there is no such
+		/// member. If there are multiple members with the same name, the
+		/// last one is returned, as Object does.
+		///
+		/// Members are found by a linear search.
+
+	DocumentView get(std::size_t index) const;
+		/// Returns the element at the given index if the value is an array,
+		/// or an invalid view otherwise or if the index is out of range.
+
+	DocumentView operator [] (std::string_view key) const;
+		/// Same as get(key).
+
+	DocumentView operator [] (std::size_t index) const;
+		/// Same as get(index).
+
+	ConstIterator begin() const;
+		/// Returns an iterator to the first element of an array
+		/// or member of an object.
+		///
+		/// For all other values, begin() == end().
+
+	ConstIterator end() const;
+		/// Returns the end iterator.
+
+	std::string_view getStringView() const;
+		/// Returns the value of a string.
+		///
+		/// Throws a BadCastException if the value is not a string,
+		/// or an InvalidAccessException if the view is invalid.
+
+	Int64 getInt64() const;
+		/// Returns the value as Int64, converting it as Dynamic::Var does
+		/// if the value is not an integer that fits.
+		///
+		/// Throws an InvalidAccessException if the view is invalid.
+
+	UInt64 getUInt64() const;
+		/// Returns the value as UInt64, converting it as Dynamic::Var does
+		/// if the value is not a non-negative integer.
+		///
+		/// Throws an InvalidAccessException if the view is invalid.
+
+	double getDouble() const;
+		/// Returns the value as double, converting it as Dynamic::Var
+		/// does if the value is not a number.
+		///
+		/// Throws an InvalidAccessException if the view is invalid.
+
+	bool getBool() const;
+		/// Returns the value as bool, converting it as Dynamic::Var
+		/// does if the value is not true or false.
+		///
+		/// Throws an InvalidAccessException if the view is invalid.
+
+	template <typename T>
+	T getValue() const
+		/// Returns the value converted to the given type
+		/// using Dynamic::Var conversion.
+		///
+		/// Throws an InvalidAccessException if the view is invalid.
+	{
+		return asVar().convert<T>();
+	}
+
+	Dynamic::Var asVar() const;
+		/// Returns the value as Dynamic::Var. Objects and arrays
+		/// are converted to Object::Ptr and Array::Ptr, the same
+		/// as Parser does. An invalid view returns an empty Var.
+
+private:
+	DocumentView(const SharedPtr<Tape>& pTape, std::size_t index);
+
+	Tape::Type type() const;
+	void checkValid() const;
+
+	SharedPtr<Tape> _pTape;
+	std::size_t _index;
+};
+
+
+//
+// inlines
+//
+inline bool DocumentView::isValid() const
+{
+	return !_pTape.isNull();
+}
+
+
+inline Tape::Type DocumentView::type() const
+{
+	return _pTape->type(_index);
+}
+
+
+inline bool DocumentView::isObject() const
+{
+	return isValid() && type() == Tape::TYPE_OBJECT;
+}
+
+
+inline bool DocumentView::isArray() const
+{
+	return isValid() && type() == Tape::TYPE_ARRAY;
+}
+
+
+inline bool DocumentView::isString() const
+{
+	return isValid() && type() == Tape::TYPE_STRING;
+}
+
+
+inline bool DocumentView::isInteger() const
+{
+	return isValid() && (type() == Tape::TYPE_INT64 || type() == Tape::TYPE_UINT64);
+}
+
+
+inline bool DocumentView::isNumeric() const
+{
+	return isInteger() || (isValid() && type() == Tape::TYPE_DOUBLE);
+}
+
+
+inline bool DocumentView::isBoolean() const
+{
+	return isValid() && (type() == Tape::TYPE_TRUE || type() == Tape::TYPE_FALSE);
+}
+
+
+inline bool DocumentView::isNull() const
+{
+	return isValid() && type() == Tape::TYPE_NULL;
+}
+
+
+inline bool DocumentView::has(std::string_view key) const
+{
+	return get(key).isValid();
+}
+
+
+inline DocumentView DocumentView::operator [] (std::string_view key) const
+{
+	return get(key);
+}
+
+
+inline DocumentView DocumentView::operator [] (std::size_t index) const
+{
+	return get(index);
+}
+
+
+inline DocumentView DocumentView::ConstIterator::operator * () const
+{
+	return value();
+}
+
+
+inline DocumentView::ConstIterator DocumentView::ConstIterator::operator ++ (int)
+{
+	ConstIterator result(*this);
+	++(*this);
+	return result;
+}
+
+
+inline bool DocumentView::ConstIterator::operator == (const ConstIterator& other) const
+{
+	return _pTape.get() == other._pTape.get() && _index == other._index;
+}
+
+
+inline bool DocumentView::ConstIterator::operator != (const ConstIterator& other) const
+{
+	return !(*this == other);
+}
+
+
+} // namespace Poco::JSON
+
+
+#endif // JSON_DocumentView_INCLUDED
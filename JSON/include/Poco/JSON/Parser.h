@@ -59,6 +59,22 @@ class JSON_API Parser: private ParserImpl
 	/// ----
 {
 public:
+	enum Backend
+		/// The parsing backend used by the Parser.
+	{
+		BACKEND_DEFAULT,
+			/// The default, streaming parser.
+
+		BACKEND_SIMD
+			/// A two-stage parser that first locates all structural
+			/// characters of the document, using SIMD instructions
+			/// where available, and then builds the result from them.
+			/// See the Tape class for details.
+			///
+			/// Usually considerably faster for larger documents.
+			/// When parsing from a std::istream, the whole document
+			/// is read into memory first.
+	};
 
 	Parser(const Handler::Ptr& pHandler = new ParseHandler);
 		/// Creates JSON Parser, using the given Handler and buffer size.
@@ -105,6 +121,15 @@ public:
 	std::size_t getDepth() const;
 		/// Returns the allowed JSON depth.
 
+	void setBackend(Backend backend);
+		/// Sets the parsing backend. Both backends deliver the same
+		/// results to the Handler and accept the same documents.
+		///
+		/// The default is BACKEND_DEFAULT.
+
+	Backend getBackend() const;
+		/// Returns the parsing backend.
+
 	Dynamic::Var parse(const std::string& json);
 		/// Parses JSON from a string.
 
@@ -168,6 +193,18 @@ inline std::size_t Parser::getDepth() const
 }
 
 
+inline void Parser::setBackend(Backend backend)
+{
+	setTapeImpl(backend == BACKEND_SIMD);
+}
+
+
+inline Parser::Backend Parser::getBackend() const
+{
+	return getTapeImpl() ? BACKEND_SIMD : BACKEND_DEFAULT;
+}
+
+
 inline const Handler::Ptr& Parser::getHandler()
 {
 	return getHandlerImpl();
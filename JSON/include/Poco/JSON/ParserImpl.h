@@ -30,6 +30,9 @@ struct json_stream;
 namespace Poco::JSON {
 
 
+class Tape;
+
+
 class JSON_API ParserImpl
 {
 protected:
@@ -68,6 +71,12 @@ protected:
 	std::size_t getDepthImpl() const;
 		/// Returns the allowed JSON depth.
 
+	void setTapeImpl(bool tape);
+		/// Enables or disables the two-stage Tape parser.
+
+	bool getTapeImpl() const;
+		/// Returns true if the two-stage Tape parser is used.
+
 	Dynamic::Var parseImpl(const std::string& json);
 		/// Parses JSON from a string.
 
@@ -95,15 +104,19 @@ private:
 	void handle();
 	void handle(const std::string& json);
 	void handle(std::istream& json);
+	void handleTape(const std::string& json);
 	void stripComments(std::string& json);
 	bool checkError();
+	void setAllocator();
 
 	struct json_stream* _pJSON;
+	Tape*        _pTape;
 	Handler::Ptr _pHandler;
 	std::size_t  _depth;
 	char         _decimalPoint;
 	bool         _allowNullByte;
 	bool         _allowComments;
+	bool         _useTape;
 };
 
 
@@ -156,6 +169,18 @@ inline std::size_t ParserImpl::getDepthImpl() const
 }
 
 
+inline void ParserImpl::setTapeImpl(bool tape)
+{
+	_useTape = tape;
+}
+
+
+inline bool ParserImpl::getTapeImpl() const
+{
+	return _useTape;
+}
+
+
 inline void ParserImpl::setHandlerImpl(const Handler::Ptr& pHandler)
 {
 	_pHandler = pHandler;
@@ -21,6 +21,7 @@
 #include "Poco/JSON/JSON.h"
 #include "Poco/JSON/Object.h"
 #include "Poco/JSON/Array.h"
+#include "Poco/JSON/DocumentView.h"
 
 
 namespace Poco::JSON {
@@ -40,6 +41,12 @@ public:
 		/// Creating Query holding Ptr will typically result in faster
 		/// performance.
 
+	Query(const DocumentView& source);
+		/// Creates a Query searching the given DocumentView.
+		///
+		/// Only the values found are converted to Dynamic::Var,
+		/// Object::Ptr or Array::Ptr; findView() avoids even that.
+
 	virtual ~Query();
 		/// Destroys the Query.
 
@@ -84,6 +91,12 @@ public:
 		/// the name of the first child. When the value can't be found
 		/// an empty value is returned.
 
+	DocumentView findView(const std::string& path) const;
+		/// Searches a value in the DocumentView given to the constructor.
+		///
+		/// When the value can't be found, or if the Query has been
+		/// created for a Dynamic::Var, an invalid view is returned.
+
 	template<typename T>
 	T findValue(const std::string& path, const T& def) const
 		/// Searches for a value will convert it to the given type.
@@ -114,7 +127,12 @@ public:
 	}
 
 private:
+	static void parseToken(const std::string& token, std::string& name, std::vector<int>& indexes);
+		/// Splits a path token like "name[1][2]" into the
+		/// member name and the array indexes.
+
 	Dynamic::Var _source;
+	DocumentView _view;
 };
 
 
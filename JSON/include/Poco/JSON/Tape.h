@@ -0,0 +1,221 @@
+//
+// Tape.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Tape
+//
+// Definition of the Tape class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_Tape_INCLUDED
+#define JSON_Tape_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Handler.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco::JSON {
+
+
+class JSON_API Tape
+	/// A JSON document parsed into a tape, a flat array of
+	/// 64-bit words describing all values in document order.
+	///
+	/// Parsing is done in two stages. The first stage locates all
+	/// structural characters, string delimiters and the beginnings
+	/// of numbers and literals, processing 64 bytes at a time with
+	/// SIMD instructions (SSE2 on x86, NEON on ARM64) where available.
+	/// It also validates UTF-8 and rejects control characters in
+	/// strings. The second stage walks the located positions, checks
+	/// the JSON grammar and records the values on the tape.
+	///
+	/// Strings without escape sequences are not copied; the tape
+	/// refers to them in the parsed text, which therefore must stay
+	/// unchanged as long as the tape is used.
+	///
+	/// Parser uses this class if the BACKEND_SIMD backend is selected,
+	/// DocumentView provides read-only access to the parsed values.
+	///
+	/// Values are addressed by their index on the tape; the root
+	/// value has index 0.
+{
+public:
+	enum Type
+		/// The type of a tape entry.
+	{
+		TYPE_OBJECT = '{',
+		TYPE_OBJECT_END = '}',
+		TYPE_ARRAY = '[',
+		TYPE_ARRAY_END = ']',
+		TYPE_STRING = '"',
+		TYPE_INT64 = 'l',
+		TYPE_UINT64 = 'u',
+		TYPE_DOUBLE = 'd',
+		TYPE_TRUE = 't',
+		TYPE_FALSE = 'f',
+		TYPE_NULL = 'n'
+	};
+
+	Tape();
+		/// Creates an empty Tape.
+
+	~Tape();
+		/// Destroys the Tape.
+
+	void parse(const char* json, std::size_t length, std::size_t maxDepth);
+		/// Parses the given JSON text, which may have at most maxDepth
+		/// nesting levels of objects and arrays.
+		///
+		/// Throws a JSONException if the text is not valid JSON, or a
+		/// SyntaxException if a number cannot be represented.
+
+	void replay(Handler& handler) const;
+		/// Reports the parsed document to the given handler, with the
+		/// same calls Parser makes when using the default backend.
+
+	std::size_t replay(std::size_t i, Handler& handler) const;
+		/// Reports the value at index i to the given handler and
+		/// returns the index of the following value.
+
+	Type type(std::size_t i) const;
+		/// Returns the type of the value at index i.
+
+	std::size_t next(std::size_t i) const;
+		/// Returns the index of the value following the value at index i,
+		/// skipping the contents of arrays and objects.
+
+	std::size_t end(std::size_t i) const;
+		/// Returns the index of the end entry of the array or
+		/// object at index i.
+
+	std::size_t size(std::size_t i) const;
+		/// Returns the number of elements or members of the array
+		/// or object at index i.
+
+	std::string_view getString(std::size_t i) const;
+		/// Returns the unescaped string at index i.
+
+	Int64 getInt64(std::size_t i) const;
+		/// Returns the TYPE_INT64 value at index i.
+
+	UInt64 getUInt64(std::size_t i) const;
+		/// Returns the TYPE_UINT64 value at index i.
+
+	double getDouble(std::size_t i) const;
+		/// Returns the TYPE_DOUBLE value at index i.
+
+	void clear();
+		/// Clears the tape.
+
+	bool empty() const;
+		/// Returns true if the tape is empty.
+
+private:
+	static constexpr int TYPE_SHIFT = 56;
+	static constexpr UInt64 PAYLOAD_MASK = (UInt64(1) << TYPE_SHIFT) - 1;
+	static constexpr UInt64 ESCAPED_FLAG = UInt64(1) << 63;
+	static constexpr UInt64 MAX_COUNT = (UInt64(1) << (TYPE_SHIFT - 32)) - 1;
+
+	Tape(const Tape&);
+	Tape& operator = (const Tape&);
+
+	void index();
+		/// Stage 1: collects the positions of structural characters.
+
+	void build(std::size_t maxDepth);
+		/// Stage 2: validates the structure and fills the tape.
+
+	void appendString(std::size_t open, std::size_t close);
+	std::size_t appendScalar(std::size_t pos);
+	const char* appendNumber(const char* begin, const char* end);
+	void unescape(const char* begin, const char* end);
+	void append(Type type, UInt64 payload = 0);
+
+	const char* _json;
+	std::size_t _length;
+	std::vector<UInt32> _index;
+	std::size_t _indexCount;
+	std::vector<UInt64> _tape;
+	std::string _strings;
+};
+
+
+//
+// inlines
+//
+inline bool Tape::empty() const
+{
+	return _tape.empty();
+}
+
+
+inline Tape::Type Tape::type(std::size_t i) const
+{
+	return static_cast<Type>(_tape[i] >> TYPE_SHIFT);
+}
+
+
+inline std::size_t Tape::end(std::size_t i) const
+{
+	return static_cast<std::size_t>(_tape[i] & 0xFFFFFFFF) - 1;
+}
+
+
+inline std::size_t Tape::next(std::size_t i) const
+{
+	switch (type(i))
+	{
+	case TYPE_OBJECT:
+	case TYPE_ARRAY:
+		return end(i) + 1;
+	case TYPE_TRUE:
+	case TYPE_FALSE:
+	case TYPE_NULL:
+	case TYPE_OBJECT_END:
+	case TYPE_ARRAY_END:
+		return i + 1;
+	default:
+		return i + 2;
+	}
+}
+
+
+inline std::string_view Tape::getString(std::size_t i) const
+{
+	const UInt64 offset = _tape[i] & PAYLOAD_MASK;
+	const UInt64 length = _tape[i + 1];
+	if (length & ESCAPED_FLAG)
+		return std::string_view(_strings.data() + offset, length & ~ESCAPED_FLAG);
+	else
+		return std::string_view(_json + offset, length);
+}
+
+
+inline Int64 Tape::getInt64(std::size_t i) const
+{
+	return static_cast<Int64>(_tape[i + 1]);
+}
+
+
+inline UInt64 Tape::getUInt64(std::size_t i) const
+{
+	return _tape[i + 1];
+}
+
+
+} // namespace Poco::JSON
+
+
+#endif // JSON_Tape_INCLUDED
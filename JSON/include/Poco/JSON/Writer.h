@@ -0,0 +1,184 @@
+//
+// Writer.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Writer
+//
+// Definition of the Writer class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_Writer_INCLUDED
+#define JSON_Writer_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/Dynamic/Var.h"
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace Poco::JSON {
+
+
+class JSON_API Writer
+	/// A push-style writer producing JSON text directly from
+	/// a sequence of calls, without building an Object or Array
+	/// tree first.
+	///
+	/// Output goes either to a std::ostream, through an internal
+	/// buffer that is written to the stream whenever it is full,
+	/// or is appended to a std::string.
+	///
+	/// The writer checks that calls form a valid document and
+	/// throws an IllegalStateException otherwise, e.g. for a value
+	/// in an object without a preceding key().
+	///
+	/// Example:
+	///
+	///    Writer writer(std::cout);
+	///    writer.beginObject()
+	///        .key("name").value("Franky")
+	///        .key("children").beginArray()
+	///            .value("Jonas")
+	///            .value("Ellen")
+	///        .endArray()
+	///    .endObject();
+	///    writer.flush();
+	/// ----
+	///
+	/// Strings are escaped with Poco::toJSON(), so the options
+	/// JSON_ESCAPE_UNICODE and JSON_LOWERCASE_HEX are supported.
+	/// Doubles are written in their shortest form; NaN and
+	/// infinity are written as null, as Stringifier does.
+{
+public:
+	Writer(std::ostream& ostr, int options = 0, unsigned indent = 0);
+		/// Creates a Writer for the given stream.
+		///
+		/// If indent is not 0, the output is pretty-printed,
+		/// with indent spaces per nesting level.
+
+	explicit Writer(std::string& str, int options = 0, unsigned indent = 0);
+		/// Creates a Writer appending to the given string.
+		///
+		/// If indent is not 0, the output is pretty-printed,
+		/// with indent spaces per nesting level.
+
+	~Writer();
+		/// Flushes any buffered output and destroys the Writer.
+
+	Writer& beginObject();
+		/// Starts an object.
+
+	Writer& endObject();
+		/// Ends the current object.
+
+	Writer& beginArray();
+		/// Starts an array.
+
+	Writer& endArray();
+		/// Ends the current array.
+
+	Writer& key(std::string_view name);
+		/// Writes the name of the next member of the current object.
+
+	Writer& value(std::string_view value);
+		/// Writes a string.
+
+	Writer& value(const std::string& value);
+		/// Writes a string.
+
+	Writer& value(const char* value);
+		/// Writes a string.
+
+	Writer& value(int value);
+		/// Writes an integer.
+
+	Writer& value(unsigned value);
+		/// Writes an unsigned integer.
+
+	Writer& value(Int64 value);
+		/// Writes a 64-bit integer.
+
+	Writer& value(UInt64 value);
+		/// Writes an unsigned 64-bit integer.
+
+	Writer& value(double value);
+		/// Writes a number, or null for NaN and infinity.
+
+	Writer& value(bool value);
+		/// Writes true or false.
+
+	Writer& value(const Dynamic::Var& value);
+		/// Writes the given value. Objects and arrays (Object::Ptr,
+		/// Array::Ptr) are written with Stringifier; empty values
+		/// are written as null.
+
+	Writer& null();
+		/// Writes null.
+
+	Writer& rawValue(std::string_view json);
+		/// Writes the given text, which must be a valid
+		/// JSON value, as it is.
+
+	void flush();
+		/// Writes buffered output to the stream.
+
+	bool done() const;
+		/// Returns true if a complete JSON value has been written.
+
+private:
+	struct Level
+	{
+		bool object;
+		bool empty;
+	};
+
+	enum
+	{
+		FLUSH_SIZE = 16384
+	};
+
+	Writer(const Writer&);
+	Writer& operator = (const Writer&);
+
+	void beforeValue();
+	void afterValue();
+	void separate(Level& level);
+	void newLine();
+	void writeString(std::string_view value);
+	void writeDouble(double value);
+
+	std::ostream* _pOstr;
+	std::string   _buffer;
+	std::string&  _out;
+	int           _options;
+	unsigned      _indent;
+	std::vector<Level> _levels;
+	bool          _afterKey;
+	bool          _done;
+};
+
+
+//
+// inlines
+//
+inline bool Writer::done() const
+{
+	return _done;
+}
+
+
+} // namespace Poco::JSON
+
+
+#endif // JSON_Writer_INCLUDED
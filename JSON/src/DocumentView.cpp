@@ -0,0 +1,268 @@
+//
+// DocumentView.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  DocumentView
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/DocumentView.h"
+#include "Poco/JSON/ParseHandler.h"
+#include "Poco/Exception.h"
+
+
+using Poco::Dynamic::Var;
+
+
+namespace Poco::JSON {
+
+
+//
+// DocumentView::ConstIterator
+//
+
+
+DocumentView::ConstIterator::ConstIterator():
+	_index(0),
+	_object(false)
+{
+}
+
+
+DocumentView::ConstIterator::ConstIterator(const SharedPtr<Tape>& pTape, std::size_t index, bool object):
+	_pTape(pTape),
+	_index(index),
+	_object(object)
+{
+}
+
+
+std::string_view DocumentView::ConstIterator::key() const
+{
+	if (_object)
+		return _pTape->getString(_index);
+	else
+		return std::string_view();
+}
+
+
+DocumentView DocumentView::ConstIterator::value() const
+{
+	if (_object)
+		return DocumentView(_pTape, _index + 2);
+	else
+		return DocumentView(_pTape, _index);
+}
+
+
+DocumentView::ConstIterator& DocumentView::ConstIterator::operator ++ ()
+{
+	if (_object)
+		_index = _pTape->next(_index + 2);
+	else
+		_index = _pTape->next(_index);
+	return *this;
+}
+
+
+//
+// DocumentView
+//
+
+
+DocumentView::DocumentView():
+	_index(0)
+{
+}
+
+
+DocumentView::DocumentView(const std::string& json, std::size_t maxDepth):
+	_pTape(new Tape),
+	_index(0)
+{
+	_pTape->parse(json.data(), json.size(), maxDepth);
+}
+
+
+DocumentView::DocumentView(const char* json, std::size_t length, std::size_t maxDepth):
+	_pTape(new Tape),
+	_index(0)
+{
+	_pTape->parse(json, length, maxDepth);
+}
+
+
+DocumentView::DocumentView(const SharedPtr<Tape>& pTape, std::size_t index):
+	_pTape(pTape),
+	_index(index)
+{
+}
+
+
+DocumentView::~DocumentView()
+{
+}
+
+
+std::size_t DocumentView::size() const
+{
+	if (isObject() || isArray())
+		return _pTape->size(_index);
+	else
+		return 0;
+}
+
+
+DocumentView DocumentView::get(std::string_view key) const
+{
+	if (!isObject()) return DocumentView();
+
+	std::size_t found = 0;
+	const std::size_t last = _pTape->end(_index);
+	for (std::size_t i = _index + 1; i < last; i = _pTape->next(i + 2))
+	{
+		if (_pTape->getString(i) == key) found = i + 2;
+	}
+	if (found)
+		return DocumentView(_pTape, found);
+	else
+		return DocumentView();
+}
+
+
+DocumentView DocumentView::get(std::size_t index) const
+{
+	if (!isArray()) return DocumentView();
+
+	const std::size_t last = _pTape->end(_index);
+	std::size_t i = _index + 1;
+	for (; i < last && index > 0; --index)
+	{
+		i = _pTape->next(i);
+	}
+	if (i < last)
+		return DocumentView(_pTape, i);
+	else
+		return DocumentView();
+}
+
+
+DocumentView::ConstIterator DocumentView::begin() const
+{
+	if (isObject() || isArray())
+		return ConstIterator(_pTape, _index + 1, isObject());
+	else
+		return ConstIterator(_pTape, _index, false);
+}
+
+
+DocumentView::ConstIterator DocumentView::end() const
+{
+	if (isObject() || isArray())
+		return ConstIterator(_pTape, _pTape->end(_index), isObject());
+	else
+		return ConstIterator(_pTape, _index, false);
+}
+
+
+std::string_view DocumentView::getStringView() const
+{
+	checkValid();
+	if (type() != Tape::TYPE_STRING) throw BadCastException("JSON value is not a string");
+	return _pTape->getString(_index);
+}
+
+
+Int64 DocumentView::getInt64() const
+{
+	checkValid();
+	if (type() == Tape::TYPE_INT64) return _pTape->getInt64(_index);
+	return asVar().convert<Int64>();
+}
+
+
+UInt64 DocumentView::getUInt64() const
+{
+	checkValid();
+	if (type() == Tape::TYPE_UINT64) return _pTape->getUInt64(_index);
+	if (type() == Tape::TYPE_INT64 && _pTape->getInt64(_index) >= 0) return static_cast<UInt64>(_pTape->getInt64(_index));
+	return asVar().convert<UInt64>();
+}
+
+
+double DocumentView::getDouble() const
+{
+	checkValid();
+	switch (type())
+	{
+	case Tape::TYPE_DOUBLE:
+		return _pTape->getDouble(_index);
+	case Tape::TYPE_INT64:
+		return static_cast<double>(_pTape->getInt64(_index));
+	case Tape::TYPE_UINT64:
+		return static_cast<double>(_pTape->getUInt64(_index));
+	default:
+		return asVar().convert<double>();
+	}
+}
+
+
+bool DocumentView::getBool() const
+{
+	checkValid();
+	switch (type())
+	{
+	case Tape::TYPE_TRUE:
+		return true;
+	case Tape::TYPE_FALSE:
+		return false;
+	default:
+		return asVar().convert<bool>();
+	}
+}
+
+
+Var DocumentView::asVar() const
+{
+	if (!isValid()) return Var();
+
+	switch (type())
+	{
+	case Tape::TYPE_OBJECT:
+	case Tape::TYPE_ARRAY:
+		{
+			ParseHandler handler;
+			_pTape->replay(_index, handler);
+			return handler.asVar();
+		}
+	case Tape::TYPE_STRING:
+		return std::string(_pTape->getString(_index));
+	case Tape::TYPE_INT64:
+		return _pTape->getInt64(_index);
+	case Tape::TYPE_UINT64:
+		return _pTape->getUInt64(_index);
+	case Tape::TYPE_DOUBLE:
+		return _pTape->getDouble(_index);
+	case Tape::TYPE_TRUE:
+		return true;
+	case Tape::TYPE_FALSE:
+		return false;
+	default:
+		return Var();
+	}
+}
+
+
+void DocumentView::checkValid() const
+{
+	if (!isValid()) throw InvalidAccessException("Invalid JSON document view");
+}
+
+
+} // namespace Poco::JSON
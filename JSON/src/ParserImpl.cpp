@@ -13,7 +13,9 @@
 
 #include <Poco/JSON/ParserImpl.h>
 #include <Poco/JSON/JSONException.h>
+#include <Poco/JSON/Tape.h>
 #include <Poco/StreamCopier.h>
+#include <Poco/Arena.h>
 
 #undef min
 #undef max
@@ -21,6 +23,7 @@
 #include <istream>
 #include <streambuf>
 #include <clocale>
+#include <cstddef>
 #include <pdjson.h>
 
 
@@ -43,22 +46,67 @@ extern "C"
 		auto pBuf = reinterpret_cast<std::streambuf*>(ptr);
 		return pBuf->sgetc();
 	}
+
+	// Allocation functions for pdjson's token and stack buffers, used if
+	// the parsing thread has a current Poco::Arena. Every block is preceded
+	// by its size, which Arena::reallocate() needs. Memory is returned
+	// to the Arena when it is reset.
+
+	static const std::size_t ARENA_HEADER_SIZE = alignof(std::max_align_t);
+
+	static void* arena_malloc(std::size_t size)
+	{
+		try
+		{
+			char* p = static_cast<char*>(Poco::Arena::current()->allocate(size + ARENA_HEADER_SIZE));
+			*reinterpret_cast<std::size_t*>(p) = size;
+			return p + ARENA_HEADER_SIZE;
+		}
+		catch (...)
+		{
+			return nullptr;
+		}
+	}
+
+	static void* arena_realloc(void* ptr, std::size_t size)
+	{
+		if (!ptr) return arena_malloc(size);
+		try
+		{
+			char* p = static_cast<char*>(ptr) - ARENA_HEADER_SIZE;
+			std::size_t oldSize = *reinterpret_cast<std::size_t*>(p);
+			p = static_cast<char*>(Poco::Arena::current()->reallocate(p, oldSize + ARENA_HEADER_SIZE, size + ARENA_HEADER_SIZE));
+			*reinterpret_cast<std::size_t*>(p) = size;
+			return p + ARENA_HEADER_SIZE;
+		}
+		catch (...)
+		{
+			return nullptr;
+		}
+	}
+
+	static void arena_free(void*)
+	{
+	}
 }
 
 
 ParserImpl::ParserImpl(const Handler::Ptr& pHandler):
 	_pJSON(new json_stream),
+	_pTape(nullptr),
 	_pHandler(pHandler),
 	_depth(JSON_DEFAULT_DEPTH),
 	_decimalPoint('.'),
 	_allowNullByte(true),
-	_allowComments(false)
+	_allowComments(false),
+	_useTape(false)
 {
 }
 
 
 ParserImpl::~ParserImpl()
 {
+	delete _pTape;
 	delete _pJSON;
 }
 
@@ -68,10 +116,17 @@ void ParserImpl::handle(const std::string& json)
 	if (!_allowNullByte && json.find("\\u0000") != json.npos)
 		throw JSONException("Null bytes in strings not allowed.");
 
+	if (_useTape)
+	{
+		handleTape(json);
+		return;
+	}
+
 	try
 	{
 		json_open_buffer(_pJSON, json.data(), json.size());
 		checkError();
+		setAllocator();
 		//////////////////////////////////
 		// Underlying parser is capable of parsing multiple consecutive JSONs;
 		// we do not currently support this feature; to force error on
@@ -94,12 +149,30 @@ void ParserImpl::handle(const std::string& json)
 }
 
 
+void ParserImpl::handleTape(const std::string& json)
+{
+	if (!_pTape) _pTape = new Tape;
+	try
+	{
+		_pTape->parse(json.data(), json.size(), _depth);
+		if (_pHandler) _pTape->replay(*_pHandler);
+		_pTape->clear();
+	}
+	catch (...)
+	{
+		_pTape->clear();
+		throw;
+	}
+}
+
+
 void ParserImpl::handle(std::istream& json)
 {
 	try
 	{
 		json_open_user(_pJSON, istream_get, istream_peek, json.rdbuf());
 		checkError();
+		setAllocator();
 		json_set_streaming(_pJSON, false);
 		handle();
 		checkError();
@@ -134,7 +207,7 @@ Dynamic::Var ParserImpl::parseImpl(const std::string& json)
 
 Dynamic::Var ParserImpl::parseImpl(std::istream& json)
 {
-	if (_allowComments || !_allowNullByte)
+	if (_allowComments || !_allowNullByte || _useTape)
 	{
 		std::string str;
 		Poco::StreamCopier::copyToString(json, str);
@@ -302,4 +375,17 @@ bool ParserImpl::checkError()
 }
 
 
+void ParserImpl::setAllocator()
+{
+	if (Poco::Arena::current())
+	{
+		json_allocator alloc;
+		alloc.malloc = arena_malloc;
+		alloc.realloc = arena_realloc;
+		alloc.free = arena_free;
+		json_set_allocator(_pJSON, &alloc);
+	}
+}
+
+
 } // namespace Poco::JSON
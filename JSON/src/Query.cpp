@@ -36,6 +36,11 @@ Query::Query(const Var& source): _source(source)
 }
 
 
+Query::Query(const DocumentView& source): _view(source)
+{
+}
+
+
 Query::~Query() = default;
 
 
@@ -97,6 +102,8 @@ Array& Query::findArray(const std::string& path, Array& arr) const
 
 Var Query::find(const std::string& path) const
 {
+	if (_view.isValid()) return findView(path).asVar();
+
 	Var result = _source;
 	if (path.empty()) return result;
 	bool found = false;
@@ -105,27 +112,9 @@ Var Query::find(const std::string& path) const
 	{
 		if (!result.isEmpty())
 		{
+			std::string name;
 			std::vector<int> indexes;
-			RegularExpression::MatchVec matches;
-			int firstOffset = -1;
-			int offset = 0;
-			RegularExpression regex("\\[([0-9]+)\\]");
-			while (regex.match(token, offset, matches) > 0)
-			{
-				if (firstOffset == -1)
-				{
-					firstOffset = static_cast<int>(matches[0].offset);
-				}
-				std::string num(token, matches[1].offset, matches[1].length);
-				indexes.push_back(NumberParser::parse(num));
-				offset = static_cast<int>(matches[0].offset + matches[0].length);
-			}
-
-			std::string name(token);
-			if (firstOffset != -1)
-			{
-				name = name.substr(0, firstOffset);
-			}
+			parseToken(token, name, indexes);
 
 			if (name.length() > 0)
 			{
@@ -170,4 +159,65 @@ Var Query::find(const std::string& path) const
 }
 
 
+DocumentView Query::findView(const std::string& path) const
+{
+	DocumentView result = _view;
+	if (path.empty()) return result;
+	bool found = false;
+	StringTokenizer tokenizer(path, ".");
+	for (const auto& token: tokenizer)
+	{
+		if (result.isValid())
+		{
+			std::string name;
+			std::vector<int> indexes;
+			parseToken(token, name, indexes);
+
+			if (name.length() > 0)
+			{
+				if (result.isObject())
+				{
+					result = result.get(name);
+					found = true;
+				}
+				else result = DocumentView();
+			}
+
+			for (const auto& i: indexes)
+			{
+				if (!result.isArray()) break;
+				result = result.get(static_cast<std::size_t>(i));
+			}
+		}
+	}
+	if (!found) result = DocumentView();
+	return result;
+}
+
+
+void Query::parseToken(const std::string& token, std::string& name, std::vector<int>& indexes)
+{
+	RegularExpression::MatchVec matches;
+	int firstOffset = -1;
+	int offset = 0;
+	RegularExpression regex("\\[([0-9]+)\\]");
+	while (regex.match(token, offset, matches) > 0)
+	{
+		if (firstOffset == -1)
+		{
+			firstOffset = static_cast<int>(matches[0].offset);
+		}
+		std::string num(token, matches[1].offset, matches[1].length);
+		indexes.push_back(NumberParser::parse(num));
+		offset = static_cast<int>(matches[0].offset + matches[0].length);
+	}
+
+	name = token;
+	if (firstOffset != -1)
+	{
+		name = name.substr(0, firstOffset);
+	}
+}
+
+
 } // namespace Poco::JSON
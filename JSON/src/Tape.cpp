@@ -0,0 +1,796 @@
+//
+// Tape.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Tape
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Tape.h"
+#include "Poco/JSON/JSONException.h"
+#include "Poco/UTFTranscoder.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Format.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_JSON_TAPE_SSE2
+	#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_JSON_TAPE_NEON
+	#include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+namespace Poco::JSON {
+
+
+namespace
+{
+	const std::size_t BLOCK_SIZE = 64;
+	const int NO_CHAR = -1;
+
+	struct Block
+		/// Bit masks of the character classes in a 64-byte block,
+		/// one bit per byte.
+	{
+		UInt64 quote;
+		UInt64 backslash;
+		UInt64 op;
+		UInt64 whitespace;
+		UInt64 control;
+	};
+
+	inline int lowestBit(UInt64 mask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		if (_BitScanForward(&index, static_cast<unsigned long>(mask))) return static_cast<int>(index);
+		_BitScanForward(&index, static_cast<unsigned long>(mask >> 32));
+		return static_cast<int>(index) + 32;
+#else
+		return __builtin_ctzll(mask);
+#endif
+	}
+
+#if defined(POCO_JSON_TAPE_SSE2)
+
+	inline UInt64 mask64(__m128i m0, __m128i m1, __m128i m2, __m128i m3)
+	{
+		return UInt64(UInt16(_mm_movemask_epi8(m0))) |
+			(UInt64(UInt16(_mm_movemask_epi8(m1))) << 16) |
+			(UInt64(UInt16(_mm_movemask_epi8(m2))) << 32) |
+			(UInt64(UInt16(_mm_movemask_epi8(m3))) << 48);
+	}
+
+	void classify(const char* p, Block& block)
+	{
+		__m128i in[4];
+		for (int i = 0; i < 4; ++i) in[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i backslash = _mm_set1_epi8('\\');
+		const __m128i lower = _mm_set1_epi8(0x20);
+		const __m128i openBrace = _mm_set1_epi8('{');
+		const __m128i closeBrace = _mm_set1_epi8('}');
+		const __m128i colon = _mm_set1_epi8(':');
+		const __m128i comma = _mm_set1_epi8(',');
+		const __m128i space = _mm_set1_epi8(' ');
+		const __m128i tab = _mm_set1_epi8('\t');
+		const __m128i lf = _mm_set1_epi8('\n');
+		const __m128i cr = _mm_set1_epi8('\r');
+		const __m128i maxControl = _mm_set1_epi8(0x1F);
+
+		__m128i q[4], b[4], o[4], w[4], c[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			q[i] = _mm_cmpeq_epi8(in[i], quote);
+			b[i] = _mm_cmpeq_epi8(in[i], backslash);
+			// '[' and ']' differ from '{' and '}' only in bit 0x20
+			const __m128i folded = _mm_or_si128(in[i], lower);
+			o[i] = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(folded, openBrace), _mm_cmpeq_epi8(folded, closeBrace)),
+				_mm_or_si128(_mm_cmpeq_epi8(in[i], colon), _mm_cmpeq_epi8(in[i], comma)));
+			w[i] = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(in[i], space), _mm_cmpeq_epi8(in[i], tab)),
+				_mm_or_si128(_mm_cmpeq_epi8(in[i], lf), _mm_cmpeq_epi8(in[i], cr)));
+			c[i] = _mm_cmpeq_epi8(_mm_min_epu8(in[i], maxControl), in[i]);
+		}
+		block.quote = mask64(q[0], q[1], q[2], q[3]);
+		block.backslash = mask64(b[0], b[1], b[2], b[3]);
+		block.op = mask64(o[0], o[1], o[2], o[3]);
+		block.whitespace = mask64(w[0], w[1], w[2], w[3]);
+		block.control = mask64(c[0], c[1], c[2], c[3]);
+	}
+
+#elif defined(POCO_JSON_TAPE_NEON)
+
+	inline UInt64 mask64(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3)
+	{
+		const uint8x16_t bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+		uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+		uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+		sum0 = vpaddq_u8(sum0, sum1);
+		sum0 = vpaddq_u8(sum0, sum0);
+		return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+	}
+
+	void classify(const char* p, Block& block)
+	{
+		uint8x16_t in[4];
+		for (int i = 0; i < 4; ++i) in[i] = vld1q_u8(reinterpret_cast<const uint8_t*>(p + 16*i));
+
+		uint8x16_t q[4], b[4], o[4], w[4], c[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			q[i] = vceqq_u8(in[i], vdupq_n_u8('"'));
+			b[i] = vceqq_u8(in[i], vdupq_n_u8('\\'));
+			// '[' and ']' differ from '{' and '}' only in bit 0x20
+			const uint8x16_t folded = vorrq_u8(in[i], vdupq_n_u8(0x20));
+			o[i] = vorrq_u8(
+				vorrq_u8(vceqq_u8(folded, vdupq_n_u8('{')), vceqq_u8(folded, vdupq_n_u8('}'))),
+				vorrq_u8(vceqq_u8(in[i], vdupq_n_u8(':')), vceqq_u8(in[i], vdupq_n_u8(','))));
+			w[i] = vorrq_u8(
+				vorrq_u8(vceqq_u8(in[i], vdupq_n_u8(' ')), vceqq_u8(in[i], vdupq_n_u8('\t'))),
+				vorrq_u8(vceqq_u8(in[i], vdupq_n_u8('\n')), vceqq_u8(in[i], vdupq_n_u8('\r'))));
+			c[i] = vcltq_u8(in[i], vdupq_n_u8(0x20));
+		}
+		block.quote = mask64(q[0], q[1], q[2], q[3]);
+		block.backslash = mask64(b[0], b[1], b[2], b[3]);
+		block.op = mask64(o[0], o[1], o[2], o[3]);
+		block.whitespace = mask64(w[0], w[1], w[2], w[3]);
+		block.control = mask64(c[0], c[1], c[2], c[3]);
+	}
+
+#else
+
+	void classify(const char* p, Block& block)
+	{
+		block = Block();
+		for (std::size_t i = 0; i < BLOCK_SIZE; ++i)
+		{
+			const UInt64 bit = UInt64(1) << i;
+			const unsigned char c = static_cast<unsigned char>(p[i]);
+			switch (c)
+			{
+			case '"':
+				block.quote |= bit;
+				break;
+			case '\\':
+				block.backslash |= bit;
+				break;
+			case '{': case '}': case '[': case ']': case ':': case ',':
+				block.op |= bit;
+				break;
+			case ' ': case '\t': case '\n': case '\r':
+				block.whitespace |= bit;
+				break;
+			}
+			if (c < 0x20) block.control |= bit;
+		}
+	}
+
+#endif
+
+	inline UInt64 prefixXor(UInt64 bits)
+		/// Returns a mask with every bit set to the parity of
+		/// the bits at or below its position.
+	{
+		bits ^= bits << 1;
+		bits ^= bits << 2;
+		bits ^= bits << 4;
+		bits ^= bits << 8;
+		bits ^= bits << 16;
+		bits ^= bits << 32;
+		return bits;
+	}
+
+	inline bool isDelimiter(int c)
+	{
+		switch (c)
+		{
+		case NO_CHAR:
+		case '{': case '}': case '[': case ']': case ':': case ',': case '"':
+		case ' ': case '\t': case '\n': case '\r':
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	inline bool isDigit(int c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+	int hexValue(char c)
+	{
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return -1;
+	}
+
+	void encodeUTF8(UInt32 cp, std::string& out)
+	{
+		if (cp < 0x80)
+		{
+			out += static_cast<char>(cp);
+		}
+		else if (cp < 0x800)
+		{
+			out += static_cast<char>(0xC0 | (cp >> 6));
+			out += static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000)
+		{
+			out += static_cast<char>(0xE0 | (cp >> 12));
+			out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			out += static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			out += static_cast<char>(0xF0 | (cp >> 18));
+			out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+			out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			out += static_cast<char>(0x80 | (cp & 0x3F));
+		}
+	}
+
+	std::string unexpectedByte(int c, const char* where = "")
+	{
+		if (c == NO_CHAR) return Poco::format("unexpected end of text%s", std::string(where));
+		return Poco::format("unexpected byte '%c'%s", static_cast<char>(c), std::string(where));
+	}
+}
+
+
+Tape::Tape():
+	_json(nullptr),
+	_length(0),
+	_indexCount(0)
+{
+}
+
+
+Tape::~Tape()
+{
+}
+
+
+void Tape::clear()
+{
+	_json = nullptr;
+	_length = 0;
+	_indexCount = 0;
+	_tape.clear();
+	_strings.clear();
+}
+
+
+void Tape::parse(const char* json, std::size_t length, std::size_t maxDepth)
+{
+	clear();
+	if (length > std::numeric_limits<UInt32>::max())
+		throw JSONException("JSON text too large");
+
+	_json = json;
+	_length = length;
+	try
+	{
+		if (!UTFTranscoder::isValidUTF8(json, length))
+			throw JSONException("invalid UTF-8 text");
+		index();
+		build(maxDepth);
+	}
+	catch (...)
+	{
+		clear();
+		throw;
+	}
+}
+
+
+void Tape::index()
+{
+	UInt64 prevEscaped = 0;
+	UInt64 prevInString = 0;
+	UInt64 prevScalar = 0;
+	for (std::size_t pos = 0; pos < _length; pos += BLOCK_SIZE)
+	{
+		Block block;
+		if (_length - pos >= BLOCK_SIZE)
+		{
+			classify(_json + pos, block);
+		}
+		else
+		{
+			char buffer[BLOCK_SIZE];
+			std::memset(buffer, ' ', BLOCK_SIZE);
+			std::memcpy(buffer, _json + pos, _length - pos);
+			classify(buffer, block);
+		}
+
+		// characters preceded by an odd number of backslashes
+		UInt64 escaped = prevEscaped;
+		prevEscaped = 0;
+		for (UInt64 bits = block.backslash & ~escaped; bits; bits &= bits - 1)
+		{
+			const int i = lowestBit(bits);
+			const UInt64 bit = UInt64(1) << i;
+			if (escaped & bit) continue;
+			if (i == BLOCK_SIZE - 1)
+				prevEscaped = 1;
+			else
+				escaped |= bit << 1;
+		}
+
+		// string contents including the opening, but not the closing quote
+		const UInt64 quote = block.quote & ~escaped;
+		const UInt64 inString = prefixXor(quote) ^ prevInString;
+		prevInString = static_cast<UInt64>(static_cast<Int64>(inString) >> 63);
+		if (block.control & inString)
+			throw JSONException("unescaped control character in string");
+
+		const UInt64 op = block.op & ~inString;
+		const UInt64 scalar = ~(op | block.whitespace | quote | inString);
+		const UInt64 scalarStart = scalar & ~((scalar << 1) | prevScalar);
+		prevScalar = scalar >> 63;
+
+		UInt64 structural = op | quote | scalarStart;
+		if (_index.size() < _indexCount + BLOCK_SIZE)
+			_index.resize(std::max(2*_index.size(), _indexCount + BLOCK_SIZE));
+		UInt32* pIndex = _index.data() + _indexCount;
+		for (; structural; structural &= structural - 1)
+		{
+			*pIndex++ = static_cast<UInt32>(pos + lowestBit(structural));
+		}
+		_indexCount = pIndex - _index.data();
+	}
+	if (prevInString)
+		throw JSONException("unterminated string literal");
+}
+
+
+void Tape::build(std::size_t maxDepth)
+{
+	enum State
+	{
+		STATE_VALUE,
+		STATE_FIRST_ELEMENT,
+		STATE_FIRST_MEMBER,
+		STATE_MEMBER,
+		STATE_NEXT
+	};
+
+	struct Scope
+	{
+		std::size_t begin;
+		UInt32 count;
+		bool object;
+	};
+
+	std::vector<Scope> stack;
+	std::size_t i = 0;
+	auto peek = [&]() -> int
+	{
+		return i < _indexCount ? static_cast<unsigned char>(_json[_index[i]]) : NO_CHAR;
+	};
+	auto unexpected = [&](int c)
+		/// Throws for a byte that must not follow a value.
+	{
+		if (stack.empty())
+			throw JSONException("Excess characters found after JSON end.");
+		else if (stack.back().object)
+			throw JSONException("expected ',' or '}' after member value");
+		else
+			throw JSONException(unexpectedByte(c));
+	};
+	auto close = [&]()
+	{
+		const Scope& scope = stack.back();
+		const Type type = scope.object ? TYPE_OBJECT : TYPE_ARRAY;
+		const UInt64 count = std::min<UInt64>(scope.count, MAX_COUNT);
+		_tape[scope.begin] = (UInt64(type) << TYPE_SHIFT) | (count << 32) | (_tape.size() + 1);
+		append(scope.object ? TYPE_OBJECT_END : TYPE_ARRAY_END, scope.begin);
+		stack.pop_back();
+		++i;
+	};
+
+	_tape.reserve(_indexCount + 2);
+	State state = STATE_VALUE;
+	for (;;)
+	{
+		switch (state)
+		{
+		case STATE_VALUE:
+			{
+				if (i == _indexCount) throw JSONException("unexpected end of text");
+				const std::size_t pos = _index[i++];
+				const char c = _json[pos];
+				if (c == '{' || c == '[')
+				{
+					if (stack.size() >= maxDepth) throw JSONException("Maximum depth exceeded");
+					stack.push_back({_tape.size(), 0, c == '{'});
+					append(c == '{' ? TYPE_OBJECT : TYPE_ARRAY);
+					state = c == '{' ? STATE_FIRST_MEMBER : STATE_FIRST_ELEMENT;
+					continue;
+				}
+				else if (c == '"')
+				{
+					appendString(pos, _index[i++]);
+				}
+				else
+				{
+					const std::size_t end = appendScalar(pos);
+					if (end != _length && !isDelimiter(static_cast<unsigned char>(_json[end])))
+						unexpected(static_cast<unsigned char>(_json[end]));
+				}
+				state = STATE_NEXT;
+			}
+			break;
+
+		case STATE_FIRST_ELEMENT:
+			if (peek() == ']')
+			{
+				close();
+				state = STATE_NEXT;
+			}
+			else state = STATE_VALUE;
+			break;
+
+		case STATE_FIRST_MEMBER:
+			if (peek() == '}')
+			{
+				close();
+				state = STATE_NEXT;
+				break;
+			}
+			[[fallthrough]];
+
+		case STATE_MEMBER:
+			{
+				const int c = peek();
+				if (c != '"')
+				{
+					if (c == NO_CHAR || !std::strchr("{[tfn-0123456789", c))
+						throw JSONException(unexpectedByte(c, " in value"));
+					throw JSONException(state == STATE_FIRST_MEMBER ? "expected member name or '}'" : "expected member name");
+				}
+				appendString(_index[i], _index[i + 1]);
+				i += 2;
+				if (peek() != ':') throw JSONException("expected ':' after member name");
+				++i;
+				state = STATE_VALUE;
+			}
+			break;
+
+		case STATE_NEXT:
+			{
+				if (stack.empty())
+				{
+					if (i != _indexCount) unexpected(peek());
+					return;
+				}
+				Scope& scope = stack.back();
+				++scope.count;
+				const int c = peek();
+				if (c == ',')
+				{
+					++i;
+					state = scope.object ? STATE_MEMBER : STATE_VALUE;
+				}
+				else if (c == (scope.object ? '}' : ']'))
+				{
+					close();
+				}
+				else unexpected(c);
+			}
+			break;
+		}
+	}
+}
+
+
+void Tape::appendString(std::size_t open, std::size_t close)
+{
+	const char* begin = _json + open + 1;
+	const char* end = _json + close;
+	if (std::memchr(begin, '\\', end - begin))
+	{
+		const std::size_t offset = _strings.size();
+		unescape(begin, end);
+		append(TYPE_STRING, offset);
+		_tape.push_back((_strings.size() - offset) | ESCAPED_FLAG);
+	}
+	else
+	{
+		append(TYPE_STRING, begin - _json);
+		_tape.push_back(end - begin);
+	}
+}
+
+
+std::size_t Tape::appendScalar(std::size_t pos)
+{
+	const char* p = _json + pos;
+	const char* end = _json + _length;
+	const char* literal = nullptr;
+	Type type = TYPE_NULL;
+	switch (*p)
+	{
+	case 't':
+		literal = "true";
+		type = TYPE_TRUE;
+		break;
+	case 'f':
+		literal = "false";
+		type = TYPE_FALSE;
+		break;
+	case 'n':
+		literal = "null";
+		type = TYPE_NULL;
+		break;
+	default:
+		if (*p == '-' || isDigit(*p))
+		{
+			return appendNumber(p, end) - _json;
+		}
+		throw JSONException(unexpectedByte(static_cast<unsigned char>(*p), " in value"));
+	}
+
+	for (const char* q = literal + 1; *q; ++q)
+	{
+		if (++p == end)
+			throw JSONException(Poco::format("expected '%c' instead of end of text", *q));
+		if (*p != *q)
+			throw JSONException(Poco::format("expected '%c' instead of byte '%c'", *q, *p));
+	}
+	append(type);
+	return p + 1 - _json;
+}
+
+
+const char* Tape::appendNumber(const char* begin, const char* end)
+{
+	auto get = [&](const char* p) -> int
+	{
+		return p != end ? static_cast<unsigned char>(*p) : NO_CHAR;
+	};
+	auto digits = [&](const char* p) -> const char*
+	{
+		if (!isDigit(get(p)))
+		{
+			if (p == end) throw JSONException("expected digit instead of end of text");
+			throw JSONException(Poco::format("expected digit instead of byte '%c'", *p));
+		}
+		while (isDigit(get(p))) ++p;
+		return p;
+	};
+
+	// validate against the JSON number grammar
+	const char* p = begin;
+	const bool negative = *p == '-';
+	if (negative)
+	{
+		++p;
+		if (!isDigit(get(p))) throw JSONException(unexpectedByte(get(p), " in number"));
+	}
+	if (*p++ != '0')
+	{
+		while (isDigit(get(p))) ++p;
+	}
+	const char* intEnd = p;
+	if (get(p) == '.') p = digits(p + 1);
+	if (get(p) == 'e' || get(p) == 'E')
+	{
+		++p;
+		if (get(p) == '+' || get(p) == '-')
+			++p;
+		else if (!isDigit(get(p)))
+			throw JSONException(unexpectedByte(get(p), " in number"));
+		p = digits(p);
+	}
+	if (p != intEnd)
+	{
+		const double value = NumberParser::parseFloat(begin, p);
+		UInt64 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		append(TYPE_DOUBLE);
+		_tape.push_back(bits);
+		return p;
+	}
+
+	UInt64 value = 0;
+	for (const char* q = negative ? begin + 1 : begin; q != p; ++q)
+	{
+		const UInt64 digit = *q - '0';
+		if (value > (std::numeric_limits<UInt64>::max() - digit)/10)
+			throw SyntaxException("Not a valid unsigned integer", std::string(begin, p));
+		value = value*10 + digit;
+	}
+	if (negative)
+	{
+		if (value > UInt64(std::numeric_limits<Int64>::max()) + 1)
+			throw SyntaxException("Not a valid unsigned integer", std::string(begin, p));
+		append(TYPE_INT64);
+		_tape.push_back(UInt64(0) - value);
+	}
+	else
+	{
+		append(value > UInt64(std::numeric_limits<Int64>::max()) ? TYPE_UINT64 : TYPE_INT64);
+		_tape.push_back(value);
+	}
+	return p;
+}
+
+
+void Tape::unescape(const char* begin, const char* end)
+{
+	// end points to the closing quote, which terminates
+	// incomplete escape sequences
+	auto codeUnit = [&](const char*& p) -> UInt32
+	{
+		UInt32 cp = 0;
+		for (int n = 0; n < 4; ++n, ++p)
+		{
+			const int v = hexValue(*p);
+			if (v < 0) throw JSONException(Poco::format("invalid escape Unicode byte '%c'", *p));
+			cp = (cp << 4) | v;
+		}
+		return cp;
+	};
+
+	for (const char* p = begin; p != end;)
+	{
+		const char* backslash = static_cast<const char*>(std::memchr(p, '\\', end - p));
+		if (!backslash)
+		{
+			_strings.append(p, end);
+			return;
+		}
+		_strings.append(p, backslash);
+		p = backslash + 1;
+		const char c = *p++;
+		switch (c)
+		{
+		case '"': _strings += '"'; break;
+		case '\\': _strings += '\\'; break;
+		case '/': _strings += '/'; break;
+		case 'b': _strings += '\b'; break;
+		case 'f': _strings += '\f'; break;
+		case 'n': _strings += '\n'; break;
+		case 'r': _strings += '\r'; break;
+		case 't': _strings += '\t'; break;
+		case 'u':
+			{
+				UInt32 cp = codeUnit(p);
+				if (cp >= 0xD800 && cp <= 0xDBFF)
+				{
+					for (const char* expected = "\\u"; *expected; ++expected, ++p)
+					{
+						if (*p != *expected)
+							throw JSONException(Poco::format("invalid continuation for surrogate pair '%c', expected '%c'", *p, *expected));
+					}
+					const UInt32 low = codeUnit(p);
+					if (low < 0xDC00 || low > 0xDFFF)
+						throw JSONException(Poco::format("surrogate pair continuation \\u%04x out of range (dc00-dfff)", low));
+					cp = ((cp - 0xD800) << 10) + (low - 0xDC00) + 0x10000;
+				}
+				else if (cp >= 0xDC00 && cp <= 0xDFFF)
+				{
+					throw JSONException(Poco::format("dangling surrogate \\u%04x", cp));
+				}
+				encodeUTF8(cp, _strings);
+			}
+			break;
+		default:
+			throw JSONException(Poco::format("invalid escaped byte '%c'", c));
+		}
+	}
+}
+
+
+void Tape::append(Type type, UInt64 payload)
+{
+	_tape.push_back((UInt64(type) << TYPE_SHIFT) | payload);
+}
+
+
+void Tape::replay(Handler& handler) const
+{
+	if (!_tape.empty()) replay(0, handler);
+}
+
+
+std::size_t Tape::size(std::size_t i) const
+{
+	const UInt64 count = (_tape[i] >> 32) & MAX_COUNT;
+	if (count < MAX_COUNT) return static_cast<std::size_t>(count);
+
+	// the count is saturated for very large arrays and objects
+	std::size_t n = 0;
+	const std::size_t last = end(i);
+	for (i = i + 1; i < last; i = next(i)) ++n;
+	return type(last) == TYPE_OBJECT_END ? n/2 : n;
+}
+
+
+double Tape::getDouble(std::size_t i) const
+{
+	double value;
+	std::memcpy(&value, &_tape[i + 1], sizeof(value));
+	return value;
+}
+
+
+std::size_t Tape::replay(std::size_t i, Handler& handler) const
+{
+	switch (type(i))
+	{
+	case TYPE_OBJECT:
+		{
+			handler.startObject();
+			const std::size_t last = end(i);
+			i++;
+			while (i < last)
+			{
+				handler.key(std::string(getString(i)));
+				i = replay(i + 2, handler);
+			}
+			handler.endObject();
+			return last + 1;
+		}
+	case TYPE_ARRAY:
+		{
+			handler.startArray();
+			const std::size_t last = end(i);
+			i++;
+			while (i < last)
+			{
+				i = replay(i, handler);
+			}
+			handler.endArray();
+			return last + 1;
+		}
+	case TYPE_STRING:
+		handler.value(std::string(getString(i)));
+		return i + 2;
+	case TYPE_INT64:
+		handler.value(getInt64(i));
+		return i + 2;
+	case TYPE_UINT64:
+		handler.value(getUInt64(i));
+		return i + 2;
+	case TYPE_DOUBLE:
+		handler.value(getDouble(i));
+		return i + 2;
+	case TYPE_TRUE:
+		handler.value(true);
+		return i + 1;
+	case TYPE_FALSE:
+		handler.value(false);
+		return i + 1;
+	case TYPE_NULL:
+		handler.null();
+		return i + 1;
+	default:
+		throw JSONException("invalid tape");
+	}
+}
+
+
+} // namespace Poco::JSON
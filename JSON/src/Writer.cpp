@@ -0,0 +1,331 @@
+//
+// Writer.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Writer
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Writer.h"
+#include "Poco/JSON/Stringifier.h"
+#include "Poco/JSONString.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+#include "Poco/Bugcheck.h"
+#include <sstream>
+#include <cmath>
+
+
+using Poco::Dynamic::Var;
+
+
+namespace Poco::JSON {
+
+
+Writer::Writer(std::ostream& ostr, int options, unsigned indent):
+	_pOstr(&ostr),
+	_out(_buffer),
+	_options(options),
+	_indent(indent),
+	_afterKey(false),
+	_done(false)
+{
+	_buffer.reserve(FLUSH_SIZE + 256);
+}
+
+
+Writer::Writer(std::string& str, int options, unsigned indent):
+	_pOstr(nullptr),
+	_out(str),
+	_options(options),
+	_indent(indent),
+	_afterKey(false),
+	_done(false)
+{
+}
+
+
+Writer::~Writer()
+{
+	try
+	{
+		flush();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+Writer& Writer::beginObject()
+{
+	beforeValue();
+	_out += '{';
+	_levels.push_back(Level{true, true});
+	return *this;
+}
+
+
+Writer& Writer::endObject()
+{
+	if (_levels.empty() || !_levels.back().object || _afterKey)
+		throw IllegalStateException("JSON Writer: endObject() without matching beginObject()");
+
+	const bool empty = _levels.back().empty;
+	_levels.pop_back();
+	if (!empty) newLine();
+	_out += '}';
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::beginArray()
+{
+	beforeValue();
+	_out += '[';
+	_levels.push_back(Level{false, true});
+	return *this;
+}
+
+
+Writer& Writer::endArray()
+{
+	if (_levels.empty() || _levels.back().object)
+		throw IllegalStateException("JSON Writer: endArray() without matching beginArray()");
+
+	const bool empty = _levels.back().empty;
+	_levels.pop_back();
+	if (!empty) newLine();
+	_out += ']';
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::key(std::string_view name)
+{
+	if (_levels.empty() || !_levels.back().object || _afterKey)
+		throw IllegalStateException("JSON Writer: key() outside of an object");
+
+	separate(_levels.back());
+	writeString(name);
+	_out += ':';
+	if (_indent) _out += ' ';
+	_afterKey = true;
+	return *this;
+}
+
+
+Writer& Writer::value(std::string_view value)
+{
+	beforeValue();
+	writeString(value);
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(const std::string& value)
+{
+	return this->value(std::string_view(value));
+}
+
+
+Writer& Writer::value(const char* value)
+{
+	return this->value(std::string_view(value));
+}
+
+
+Writer& Writer::value(int value)
+{
+	beforeValue();
+	NumberFormatter::append(_out, value);
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(unsigned value)
+{
+	beforeValue();
+	NumberFormatter::append(_out, value);
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(Int64 value)
+{
+	beforeValue();
+	NumberFormatter::append(_out, value);
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(UInt64 value)
+{
+	beforeValue();
+	NumberFormatter::append(_out, value);
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(double value)
+{
+	beforeValue();
+	writeDouble(value);
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(bool value)
+{
+	beforeValue();
+	_out += value ? "true" : "false";
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::value(const Var& value)
+{
+	if (value.isEmpty())
+	{
+		return null();
+	}
+	else if (value.isString() || value.isDateTime() || value.isDate() || value.isTime() || value.type() == typeid(char))
+	{
+		return this->value(value.convert<std::string>());
+	}
+	else if (value.isBoolean())
+	{
+		return this->value(value.convert<bool>());
+	}
+	else if (value.isInteger())
+	{
+		if (value.isSigned())
+			return this->value(value.convert<Int64>());
+		else
+			return this->value(value.convert<UInt64>());
+	}
+	else if (value.isNumeric())
+	{
+		return this->value(value.convert<double>());
+	}
+	else
+	{
+		// Object, Array and their Ptr types, and any other
+		// type Stringifier knows how to write.
+		std::ostringstream ostr;
+		Stringifier::stringify(value, ostr, 0, -1, _options);
+		return rawValue(ostr.str());
+	}
+}
+
+
+Writer& Writer::null()
+{
+	beforeValue();
+	_out += "null";
+	afterValue();
+	return *this;
+}
+
+
+Writer& Writer::rawValue(std::string_view json)
+{
+	beforeValue();
+	_out += json;
+	afterValue();
+	return *this;
+}
+
+
+void Writer::flush()
+{
+	if (_pOstr && !_buffer.empty())
+	{
+		_pOstr->write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+		_buffer.clear();
+	}
+}
+
+
+void Writer::beforeValue()
+{
+	if (_levels.empty())
+	{
+		if (_done) throw IllegalStateException("JSON Writer: document already complete");
+	}
+	else if (_levels.back().object)
+	{
+		if (!_afterKey) throw IllegalStateException("JSON Writer: object member without key()");
+		_afterKey = false;
+	}
+	else
+	{
+		separate(_levels.back());
+	}
+}
+
+
+void Writer::afterValue()
+{
+	if (_levels.empty()) _done = true;
+	if (_pOstr && _buffer.size() >= FLUSH_SIZE) flush();
+}
+
+
+void Writer::separate(Level& level)
+{
+	if (!level.empty) _out += ',';
+	level.empty = false;
+	newLine();
+}
+
+
+void Writer::newLine()
+{
+	if (_indent)
+	{
+		_out += '\n';
+		_out.append(_levels.size()*_indent, ' ');
+	}
+}
+
+
+void Writer::writeString(std::string_view value)
+{
+	Poco::toJSON(value, _out, _options | Poco::JSON_WRAP_STRINGS);
+}
+
+
+void Writer::writeDouble(double value)
+{
+	if (std::isfinite(value))
+	{
+		char buffer[POCO_MAX_FLT_STRING_LEN];
+		char* end = NumberFormatter::format(buffer, buffer + sizeof(buffer), value);
+		poco_assert (end != nullptr);
+		_out.append(buffer, end - buffer);
+	}
+	else
+	{
+		_out += "null";
+	}
+}
+
+
+} // namespace Poco::JSON
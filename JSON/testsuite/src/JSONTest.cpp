@@ -23,7 +23,12 @@
 #include "Poco/Dynamic/Struct.h"
 #include "Poco/DateTime.h"
 #include "Poco/DateTimeFormatter.h"
+#include "Poco/Arena.h"
+#include "Poco/StreamCopier.h"
 #include <set>
+#include <limits>
+#include <type_traits>
+#include <sstream>
 #include <iostream>
 
 
@@ -32,6 +37,8 @@ using namespace Poco::Dynamic;
 using Poco::DynamicStruct;
 using Poco::DateTime;
 using Poco::DateTimeFormatter;
+using Poco::Arena;
+using Poco::ArenaScope;
 
 JSONTest::JSONTest(const std::string& name): CppUnit::TestCase("JSON")
 {
@@ -2397,6 +2404,38 @@ void JSONTest::testRemove()
 	assertTrue(nl[1] == "baz");
 
 }
+void JSONTest::testArenaParse()
+{
+	std::string longString(5000, 'x');
+	std::string json = "{ \"name\" : \"" + longString + "\", \"list\" : [ [ [ [ 1, 2, 3 ] ] ] ] }";
+
+	Arena arena;
+	{
+		ArenaScope scope(arena);
+		Parser parser;
+		Var result = parser.parse(json);
+		assertTrue (arena.allocated() > longString.size());
+
+		Object::Ptr object = result.extract<Object::Ptr>();
+		assertTrue (object->getValue<std::string>("name") == longString);
+		Poco::JSON::Array::Ptr list = object->getArray("list");
+		assertTrue (list->getArray(0)->getArray(0)->getArray(0)->get(2) == 3);
+
+		std::istringstream istr(json);
+		parser.reset();
+		result = parser.parse(istr);
+		object = result.extract<Object::Ptr>();
+		assertTrue (object->getValue<std::string>("name") == longString);
+	}
+	arena.reset();
+
+	Parser parser;
+	Var result = parser.parse(json);
+	assertTrue (arena.allocated() == 0);
+	assertTrue (result.extract<Object::Ptr>()->getValue<std::string>("name") == longString);
+}
+
+
 void JSONTest::testEnum()
 {
 	enum SAMPLE_ENUM
@@ -2570,6 +2609,447 @@ void JSONTest::testEnum()
 	}
 }
 
+
+void JSONTest::testSimdBackend()
+{
+	Parser parser;
+	assertTrue (parser.getBackend() == Parser::BACKEND_DEFAULT);
+	parser.setBackend(Parser::BACKEND_SIMD);
+	assertTrue (parser.getBackend() == Parser::BACKEND_SIMD);
+
+	std::string longString(100, 'x');
+	std::string json = "{ \"name\" : \"" + longString + "\", \"escaped\" : \"a\\\"b\\\\c\\/d\\n\\u00e9\\ud83d\\ude00\", "
+		"\"list\" : [ 1, -2, 9223372036854775808, -9223372036854775808, 2.5, -1e-3, 1E+2, true, false, null, {}, [] ],\n"
+		"\t\"nested\" : { \"a\" : { \"b\" : [ [ ] ] } } }";
+	Var result = parser.parse(json);
+	Object::Ptr object = result.extract<Object::Ptr>();
+	assertTrue (object->getValue<std::string>("name") == longString);
+	assertTrue (object->getValue<std::string>("escaped") == "a\"b\\c/d\n\xC3\xA9\xF0\x9F\x98\x80");
+	Poco::JSON::Array::Ptr list = object->getArray("list");
+	assertTrue (list->size() == 12);
+	assertTrue (list->get(0).type() == typeid(Poco::Int64));
+	assertTrue (list->get(1) == -2);
+	assertTrue (list->get(2).type() == typeid(Poco::UInt64));
+	assertTrue (list->get(2) == 9223372036854775808ULL);
+	assertTrue (list->get(3) == std::numeric_limits<Poco::Int64>::min());
+	assertTrue (list->get(4) == 2.5);
+	assertTrue (list->get(5) == -0.001);
+	assertTrue (list->get(6) == 100.0);
+	assertTrue (list->get(7) == true);
+	assertTrue (list->get(8) == false);
+	assertTrue (list->isNull(9));
+	assertTrue (list->getObject(10)->size() == 0);
+	assertTrue (list->getArray(11)->size() == 0);
+	assertTrue (object->getObject("nested")->getObject("a")->getArray("b")->getArray(0)->size() == 0);
+
+	Parser defaultParser;
+	std::ostringstream ostr1;
+	std::ostringstream ostr2;
+	Stringifier::stringify(defaultParser.parse(json), ostr1);
+	Stringifier::stringify(result, ostr2);
+	assertTrue (ostr1.str() == ostr2.str());
+
+	std::istringstream istr(json);
+	parser.reset();
+	result = parser.parse(istr);
+	assertTrue (result.extract<Object::Ptr>()->getValue<std::string>("name") == longString);
+
+	std::ostringstream ostr;
+	parser.setHandler(new PrintHandler(ostr));
+	parser.parse("[1,{\"a\":\"b\"}]");
+	assertTrue (ostr.str() == "[1,{\"a\":\"b\"}]");
+
+	const char* invalid[] =
+	{
+		"", " ", "[1,]", "{\"a\":1,}", "[1 2]", "{\"a\" 1}", "{1:2}", "[01]", "[1.]", "[.5]", "[1.e5]", "[-]",
+		"[tru]", "[truefalse]", "[1true]", "[NaN]", "[\"abc]", "[\"a\tb\"]", "[\"\\x\"]", "[\"\\ud800\"]",
+		"[\"\\udc00\"]", "[\"\xC3\"]", "[1]]", "{\"a\":1}}", "[1] x", "[}", "{]"
+	};
+	for (const auto* pInvalid: invalid)
+	{
+		Parser p;
+		p.setBackend(Parser::BACKEND_SIMD);
+		try
+		{
+			p.parse(pInvalid);
+			fail(std::string("must throw: ") + pInvalid);
+		}
+		catch (JSONException&)
+		{
+		}
+	}
+
+	Parser p;
+	p.setBackend(Parser::BACKEND_SIMD);
+	try
+	{
+		p.parse("[18446744073709551616]");
+		fail("must throw");
+	}
+	catch (Poco::SyntaxException&)
+	{
+	}
+
+	p.setDepth(3);
+	p.parse("[[[1]]]");
+	try
+	{
+		p.parse("[[[[1]]]]");
+		fail("must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	p.setAllowNullByte(false);
+	try
+	{
+		p.parse("[\"\\u0000\"]");
+		fail("must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+
+	p.setAllowComments(true);
+	result = p.parse("[1, /* comment */ 2]");
+	assertTrue (result.extract<Poco::JSON::Array::Ptr>()->size() == 2);
+}
+
+
+void JSONTest::testSimdBackendFiles()
+{
+	const char* dirs[] = {"valid", "invalid", "invalid-unicode"};
+	for (const auto* pDir: dirs)
+	{
+		std::set<std::string> paths;
+		Poco::Glob::glob(Poco::Path(getTestFilesPath(pDir)), paths);
+		for (const auto& path: paths)
+		{
+			Poco::Path filePath(path, "input");
+			if (!filePath.isFile() || !Poco::File(filePath).exists()) continue;
+
+			std::string json;
+			Poco::FileInputStream fis(filePath.toString());
+			Poco::StreamCopier::copyToString(fis, json);
+
+			std::string result[2];
+			for (int i = 0; i < 2; ++i)
+			{
+				Parser parser;
+				parser.setAllowNullByte(false);
+				if (i == 1) parser.setBackend(Parser::BACKEND_SIMD);
+				try
+				{
+					std::ostringstream ostr;
+					Stringifier::stringify(parser.parse(json), ostr, 0, -1, Poco::JSON_PRESERVE_KEY_ORDER);
+					result[i] = ostr.str();
+				}
+				catch (Poco::Exception&)
+				{
+					result[i] = "exception";
+				}
+			}
+			if (result[0] != result[1]) fail(filePath.toString() + ": " + result[1]);
+		}
+	}
+}
+
+
+void JSONTest::testDocumentView()
+{
+	std::string json = "{ \"name\" : \"Franky\", \"id\" : 42, \"big\" : 18446744073709551615, \"price\" : 12.5, "
+		"\"active\" : true, \"spouse\" : null, \"quote\" : \"a\\\"b\", \"name\" : \"Frank\", "
+		"\"children\" : [ { \"name\" : \"Jonas\", \"age\" : 7 }, { \"name\" : \"Ellen\", \"age\" : 5 } ], \"empty\" : {} }";
+	DocumentView doc(json);
+	assertTrue (doc.isValid());
+	assertTrue (doc.isObject());
+	assertTrue (doc.size() == 10);
+
+	assertTrue (doc["name"].getStringView() == std::string_view("Frank"));
+	assertTrue (doc["quote"].getStringView() == std::string_view("a\"b"));
+	assertTrue (doc["id"].isInteger());
+	assertTrue (doc["id"].getInt64() == 42);
+	assertTrue (doc["id"].getDouble() == 42.0);
+	assertTrue (doc["id"].getValue<std::string>() == "42");
+	assertTrue (doc["big"].getUInt64() == 18446744073709551615ULL);
+	assertTrue (doc["price"].isNumeric());
+	assertTrue (!doc["price"].isInteger());
+	assertTrue (doc["price"].getDouble() == 12.5);
+	assertTrue (doc["price"].getInt64() == 12);
+	assertTrue (doc["active"].getBool());
+	assertTrue (doc["spouse"].isNull());
+	assertTrue (doc.has("spouse"));
+	assertTrue (!doc.has("dummy"));
+	assertTrue (!doc["dummy"].isValid());
+	assertTrue (!doc["dummy"]["name"].isValid());
+	assertTrue (!doc["name"][0].isValid());
+	DocumentView empty = doc["empty"];
+	assertTrue (empty.isObject());
+	assertTrue (empty.size() == 0);
+	assertTrue (empty.begin() == empty.end());
+
+	DocumentView children = doc["children"];
+	assertTrue (children.isArray());
+	assertTrue (children.size() == 2);
+	assertTrue (children[1]["name"].getStringView() == std::string_view("Ellen"));
+	assertTrue (children[1]["age"].getInt64() == 5);
+	assertTrue (!children[2].isValid());
+
+	Poco::Int64 ages = 0;
+	for (auto child: children)
+	{
+		ages += child["age"].getInt64();
+	}
+	assertTrue (ages == 12);
+
+	std::vector<std::string> keys;
+	for (auto it = doc.begin(); it != doc.end(); ++it)
+	{
+		keys.emplace_back(it.key());
+	}
+	assertTrue (keys.size() == 10);
+	assertTrue (keys[0] == "name");
+	assertTrue (keys[9] == "empty");
+
+	// iterators share the tape and outlive the (temporary) view
+	DocumentView::ConstIterator it = doc.get("children").begin();
+	DocumentView::ConstIterator end = doc.get("children").end();
+	assertTrue (it != end);
+	assertTrue ((*it)["name"].getStringView() == std::string_view("Jonas"));
+	++it;
+	assertTrue ((*it)["age"].getInt64() == 5);
+	++it;
+	assertTrue (it == end);
+
+	it = doc["children"][0].begin();
+	assertTrue (it.key() == std::string_view("name"));
+	++it;
+	assertTrue (it.key() == std::string_view("age"));
+	assertTrue (it.value().getInt64() == 7);
+
+	static_assert(!std::is_constructible_v<DocumentView, std::string>, "DocumentView must not view a temporary string");
+
+	try
+	{
+		doc["id"].getStringView();
+		fail("must throw");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+
+	try
+	{
+		doc["dummy"].getInt64();
+		fail("must throw");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+
+	Var var = children[0].asVar();
+	assertTrue (var.type() == typeid(Object::Ptr));
+	assertTrue (var.extract<Object::Ptr>()->getValue<std::string>("name") == "Jonas");
+	assertTrue (doc["spouse"].asVar().isEmpty());
+
+	Parser parser;
+	std::ostringstream ostr1;
+	std::ostringstream ostr2;
+	Stringifier::stringify(parser.parse(json), ostr1);
+	Stringifier::stringify(doc.asVar(), ostr2);
+	assertTrue (ostr1.str() == ostr2.str());
+
+	std::string text = "\"abc\"";
+	DocumentView scalar(text);
+	assertTrue (scalar.getStringView() == std::string_view("abc"));
+	assertTrue (scalar.size() == 0);
+	assertTrue (scalar.begin() == scalar.end());
+
+	try
+	{
+		text = "{\"a\":}";
+		DocumentView invalid(text);
+		fail("must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+}
+
+
+void JSONTest::testDocumentViewQuery()
+{
+	std::string json = "{ \"name\" : \"Franky\", \"children\" : [ \"Jonas\", \"Ellen\" ], \"address\": { \"street\": \"A Street\", \"number\": 123, \"city\":\"The City\"} }";
+	DocumentView doc(json);
+	Query query(doc);
+
+	assertTrue (query.findValue("children[0]", "") == "Jonas");
+	assertTrue (query.findValue("children[1]", "") == "Ellen");
+	assertTrue (query.findValue("children[2]", "").empty());
+	assertTrue (query.findValue<int>("address.number", 0) == 123);
+	assertTrue (query.findView("address.city").getStringView() == std::string_view("The City"));
+	assertTrue (!query.findView("address.country").isValid());
+	assertTrue (!query.findView("[0]").isValid());
+
+	std::vector<std::string> names;
+	for (auto it = query.findView("children").begin(); it != query.findView("children").end(); ++it)
+	{
+		names.emplace_back((*it).getStringView());
+	}
+	assertTrue (names.size() == 2);
+	assertTrue (names[1] == "Ellen");
+
+	Object::Ptr pAddress = query.findObject("address");
+	assertTrue (pAddress->getValue<std::string>("street") == "A Street");
+	assertTrue (query.findObject("bad address").isNull());
+
+	Poco::JSON::Array::Ptr pChildren = query.findArray("children");
+	assertTrue (pChildren->size() == 2);
+	assertTrue (query.findArray("name").isNull());
+
+	Query varQuery(Parser().parse(json));
+	assertTrue (!varQuery.findView("name").isValid());
+}
+
+
+void JSONTest::testWriter()
+{
+	std::string json;
+	Poco::JSON::Writer writer(json);
+	writer.beginObject()
+		.key("name").value("Franky")
+		.key("age").value(42)
+		.key("id").value(Poco::UInt64(18446744073709551615ULL))
+		.key("offset").value(Poco::Int64(-9223372036854775807LL - 1))
+		.key("height").value(1.75)
+		.key("nan").value(std::numeric_limits<double>::quiet_NaN())
+		.key("married").value(true)
+		.key("spouse").null()
+		.key("quote \"\n").value(std::string("tab\t\x01"))
+		.key("children").beginArray()
+			.value("Jonas")
+			.value(Poco::Dynamic::Var("Ellen"))
+			.beginObject().endObject()
+			.beginArray().endArray()
+		.endArray()
+		.key("raw").rawValue("[1,2]")
+	.endObject();
+	assertTrue (writer.done());
+	assertEqual (json, "{\"name\":\"Franky\",\"age\":42,\"id\":18446744073709551615,"
+		"\"offset\":-9223372036854775808,\"height\":1.75,\"nan\":null,\"married\":true,"
+		"\"spouse\":null,\"quote \\\"\\n\":\"tab\\t\\u0001\",\"children\":[\"Jonas\",\"Ellen\",{},[]],"
+		"\"raw\":[1,2]}");
+
+	Object::Ptr pObject = Parser().parse(json).extract<Object::Ptr>();
+	assertTrue (pObject->getValue<Poco::UInt64>("id") == 18446744073709551615ULL);
+	assertTrue (pObject->getValue<std::string>("quote \"\n") == "tab\t\x01");
+
+	Object::Ptr pAddress = new Object;
+	pAddress->set("city", "The City");
+	std::string var;
+	Poco::JSON::Writer varWriter(var);
+	varWriter.beginArray()
+		.value(Poco::Dynamic::Var())
+		.value(Poco::Dynamic::Var(3))
+		.value(Poco::Dynamic::Var(2.5))
+		.value(Poco::Dynamic::Var(false))
+		.value(Poco::Dynamic::Var('c'))
+		.value(Poco::Dynamic::Var(pAddress))
+	.endArray();
+	assertEqual (var, "[null,3,2.5,false,\"c\",{\"city\":\"The City\"}]");
+
+	std::string pretty;
+	Poco::JSON::Writer prettyWriter(pretty, 0, 2);
+	prettyWriter.beginObject()
+		.key("a").value(1)
+		.key("b").beginArray().value(2).value(3).endArray()
+		.key("c").beginObject().endObject()
+	.endObject();
+	assertEqual (pretty, "{\n  \"a\": 1,\n  \"b\": [\n    2,\n    3\n  ],\n  \"c\": {}\n}");
+
+	std::string unicode;
+	Poco::JSON::Writer unicodeWriter(unicode, Poco::JSON_ESCAPE_UNICODE | Poco::JSON_LOWERCASE_HEX);
+	unicodeWriter.value("\xC3\xA4\x1F");
+	assertEqual (unicode, "\"\\u00e4\\u001f\"");
+
+	std::string bad;
+	Poco::JSON::Writer badWriter(bad);
+	try
+	{
+		badWriter.endArray();
+		fail ("must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+	badWriter.beginObject();
+	try
+	{
+		badWriter.value(1);
+		fail ("must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+	try
+	{
+		badWriter.endArray();
+		fail ("must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+	badWriter.key("x");
+	try
+	{
+		badWriter.key("y");
+		fail ("must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+	badWriter.value(1).endObject();
+	try
+	{
+		badWriter.value(2);
+		fail ("must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+}
+
+
+void JSONTest::testWriterStream()
+{
+	std::ostringstream ostr;
+	{
+		Poco::JSON::Writer writer(ostr);
+		writer.beginArray();
+		for (int i = 0; i < 10000; ++i)
+		{
+			writer.beginObject().key("index").value(i).key("text").value("some \"text\"").endObject();
+		}
+		writer.endArray();
+	}
+
+	Poco::JSON::Array::Ptr pArray = Parser().parse(ostr.str()).extract<Poco::JSON::Array::Ptr>();
+	assertTrue (pArray->size() == 10000);
+	assertTrue (pArray->getObject(9999)->getValue<int>("index") == 9999);
+	assertTrue (pArray->getObject(0)->getValue<std::string>("text") == "some \"text\"");
+
+	Poco::JSON::Object::Ptr pObj = new Poco::JSON::Object;
+	pObj->set("index", 1);
+	std::ostringstream expected;
+	pObj->stringify(expected);
+	std::ostringstream actual;
+	Poco::JSON::Writer writer(actual);
+	writer.beginObject().key("index").value(1).endObject();
+	writer.flush();
+	assertEqual (actual.str(), expected.str());
+}
+
 CppUnit::Test* JSONTest::suite()
 {
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("JSONTest");
@@ -2623,7 +3103,14 @@ CppUnit::Test* JSONTest::suite()
 	CppUnit_addTest(pSuite, JSONTest, testCopy);
 	CppUnit_addTest(pSuite, JSONTest, testMove);
 	CppUnit_addTest(pSuite, JSONTest, testRemove);
+	CppUnit_addTest(pSuite, JSONTest, testArenaParse);
 	CppUnit_addTest(pSuite, JSONTest, testEnum);
+	CppUnit_addTest(pSuite, JSONTest, testSimdBackend);
+	CppUnit_addTest(pSuite, JSONTest, testSimdBackendFiles);
+	CppUnit_addTest(pSuite, JSONTest, testDocumentView);
+	CppUnit_addTest(pSuite, JSONTest, testDocumentViewQuery);
+	CppUnit_addTest(pSuite, JSONTest, testWriter);
+	CppUnit_addTest(pSuite, JSONTest, testWriterStream);
 
 	return pSuite;
 }
@@ -19,6 +19,8 @@
 #include "Poco/JSON/Object.h"
 #include "Poco/JSON/Parser.h"
 #include "Poco/JSON/Query.h"
+#include "Poco/JSON/DocumentView.h"
+#include "Poco/JSON/Writer.h"
 #include "Poco/JSON/JSONException.h"
 #include "Poco/JSON/Stringifier.h"
 #include "Poco/JSON/ParseHandler.h"
@@ -85,8 +87,15 @@ public:
 	void testCopy();
 	void testMove();
 	void testRemove();
+	void testArenaParse();
 
 	void testEnum();
+	void testSimdBackend();
+	void testSimdBackendFiles();
+	void testDocumentView();
+	void testDocumentViewQuery();
+	void testWriter();
+	void testWriterStream();
 
 	void setUp();
 	void tearDown();
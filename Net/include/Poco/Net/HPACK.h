@@ -0,0 +1,214 @@
+//
+// HPACK.h
+//
+// Library: Net
+// Package: HTTP
+// Module:  HPACK
+//
+// Definition of the HPACKTable, HPACKEncoder and HPACKDecoder classes.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HPACK_INCLUDED
+#define Net_HPACK_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/NameValueCollection.h"
+#include <deque>
+#include <string>
+#include <utility>
+
+
+namespace Poco::Net {
+
+
+class Net_API HPACKTable
+	/// The header table (RFC 7541, section 2.3) shared by
+	/// HPACKEncoder and HPACKDecoder, consisting of the
+	/// static table and a dynamic table of limited size.
+	///
+	/// Indexes are 1-based. Indexes 1 to STATIC_TABLE_SIZE
+	/// refer to the static table, followed by the entries of
+	/// the dynamic table, newest first.
+{
+public:
+	using Field = std::pair<std::string, std::string>;
+
+	enum
+	{
+		STATIC_TABLE_SIZE  = 61,
+		DEFAULT_TABLE_SIZE = 4096,
+		ENTRY_OVERHEAD     = 32
+	};
+
+	explicit HPACKTable(std::size_t maxSize = DEFAULT_TABLE_SIZE);
+		/// Creates the HPACKTable with the given maximum
+		/// size of the dynamic table, in octets.
+
+	~HPACKTable();
+		/// Destroys the HPACKTable.
+
+	const Field& at(std::size_t index) const;
+		/// Returns the entry with the given index.
+		///
+		/// Throws a DataFormatException if the index is invalid.
+
+	void add(const std::string& name, const std::string& value);
+		/// Adds an entry to the dynamic table, evicting older
+		/// entries as necessary. An entry larger than the
+		/// maximum size empties the table.
+
+	std::size_t find(const std::string& name, const std::string& value, bool& valueMatch) const;
+		/// Returns the index of an entry with the given name and value,
+		/// or, if there is no such entry, the index of an entry with the
+		/// given name only. Returns 0 if there is no matching entry.
+		/// valueMatch is set to true if the value matches as well.
+
+	void setMaxSize(std::size_t maxSize);
+		/// Sets the maximum size of the dynamic table, evicting
+		/// entries as necessary.
+
+	std::size_t maxSize() const;
+		/// Returns the maximum size of the dynamic table.
+
+	std::size_t size() const;
+		/// Returns the current size of the dynamic table, in octets.
+
+	std::size_t length() const;
+		/// Returns the number of entries in the dynamic table.
+
+private:
+	void evict(std::size_t maxSize);
+
+	std::deque<Field> _entries;
+	std::size_t       _size;
+	std::size_t       _maxSize;
+};
+
+
+class Net_API HPACKEncoder
+	/// An encoder for HPACK (RFC 7541) header blocks, as used
+	/// by HTTP/2.
+	///
+	/// Fields are added to the dynamic table when possible, and string
+	/// literals are Huffman-coded if this makes them shorter. Values of
+	/// fields that typically contain credentials (Authorization, Cookie,
+	/// Set-Cookie) are never added to the dynamic table.
+	///
+	/// The state of the encoder depends on all header blocks encoded
+	/// before, so header blocks must be sent in the order in which they
+	/// have been encoded.
+{
+public:
+	explicit HPACKEncoder(std::size_t maxTableSize = HPACKTable::DEFAULT_TABLE_SIZE);
+		/// Creates the HPACKEncoder.
+
+	~HPACKEncoder();
+		/// Destroys the HPACKEncoder.
+
+	void encode(const std::string& name, const std::string& value, std::string& block);
+		/// Appends the encoded header field to block.
+		///
+		/// The field name must be in lowercase.
+
+	void setMaxTableSize(std::size_t maxSize);
+		/// Sets the maximum size of the dynamic table, as announced
+		/// by the decoder (e.g., with the SETTINGS_HEADER_TABLE_SIZE
+		/// setting of HTTP/2). The size change is signaled at the
+		/// beginning of the next header block.
+
+	static void encodeInteger(std::size_t value, int prefixBits, unsigned char flags, std::string& block);
+		/// Appends an integer with the given prefix length,
+		/// combining the first octet with flags.
+
+	static void encodeString(const std::string& s, std::string& block);
+		/// Appends a string literal.
+
+private:
+	HPACKTable  _table;
+	std::size_t _pendingSizeUpdate;
+	bool        _sizeUpdatePending;
+};
+
+
+class Net_API HPACKDecoder
+	/// A decoder for HPACK (RFC 7541) header blocks, as used
+	/// by HTTP/2.
+	///
+	/// Every header block received on a connection must be decoded,
+	/// in order, to keep the decoder state consistent with the encoder.
+{
+public:
+	explicit HPACKDecoder(std::size_t maxTableSize = HPACKTable::DEFAULT_TABLE_SIZE);
+		/// Creates the HPACKDecoder. The maximum table size is the
+		/// upper limit for table sizes requested by the encoder.
+
+	~HPACKDecoder();
+		/// Destroys the HPACKDecoder.
+
+	void decode(const char* block, std::size_t length, NameValueCollection& fields);
+		/// Decodes the given header block and adds all fields to the
+		/// given collection, in the order they appear in the block.
+		///
+		/// Throws a DataFormatException if the header block is malformed
+		/// or the decoded header list would exceed the maximum header
+		/// list size.
+
+	void setMaxHeaderListSize(std::size_t size);
+		/// Sets the maximum size of a decoded header list, in octets,
+		/// computed as specified for SETTINGS_MAX_HEADER_LIST_SIZE.
+		/// Zero (the default) means no limit.
+
+	std::size_t tableSize() const;
+		/// Returns the current size of the dynamic table, in octets.
+
+	static std::size_t decodeInteger(const unsigned char*& it, const unsigned char* end, int prefixBits);
+		/// Decodes an integer with the given prefix length.
+
+	static std::string decodeString(const unsigned char*& it, const unsigned char* end);
+		/// Decodes a string literal.
+
+private:
+	HPACKTable  _table;
+	std::size_t _maxTableSize;
+	std::size_t _maxHeaderListSize;
+};
+
+
+//
+// inlines
+//
+inline std::size_t HPACKTable::maxSize() const
+{
+	return _maxSize;
+}
+
+
+inline std::size_t HPACKTable::size() const
+{
+	return _size;
+}
+
+
+inline std::size_t HPACKTable::length() const
+{
+	return _entries.size();
+}
+
+
+inline std::size_t HPACKDecoder::tableSize() const
+{
+	return _table.size();
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HPACK_INCLUDED
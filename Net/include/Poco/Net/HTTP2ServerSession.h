@@ -0,0 +1,195 @@
+//
+// HTTP2ServerSession.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTP2ServerSession
+//
+// Definition of the HTTP2ServerSession class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2ServerSession_INCLUDED
+#define Net_HTTP2ServerSession_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+class Net_API HTTP2ServerSession
+	/// This class implements the server side of a HTTP/2
+	/// (RFC 9113) connection.
+	///
+	/// The session reads frames from the connection in the thread
+	/// calling run(), and dispatches every request stream to a
+	/// HTTPRequestHandler created by the HTTPRequestHandlerFactory,
+	/// just like HTTPServerConnection does for HTTP/1.x requests.
+	/// Handlers run in a thread from the given thread pool, so that
+	/// multiple requests on the same connection are processed
+	/// concurrently. If no thread is available, a request is queued
+	/// until a handler of the same connection completes or a thread
+	/// becomes available. Streams exceeding the limit set with
+	/// HTTPServerParams::setHTTP2MaxConcurrentStreams() are refused
+	/// with REFUSED_STREAM.
+	///
+	/// Header fields are compressed with HPACK (see HPACKEncoder
+	/// and HPACKDecoder). Flow control is applied in both directions:
+	/// the receive window of a stream is only replenished as the
+	/// handler reads the request body, and a handler writing the
+	/// response body blocks while the client's window is exhausted.
+	///
+	/// Server push and stream priorities are not supported.
+	///
+	/// A HTTP2ServerSession is normally created by HTTPServerConnection
+	/// if HTTP/2 has been enabled with HTTPServerParams::setHTTP2Enabled()
+	/// and the client has sent the HTTP/2 connection preface.
+{
+public:
+	enum ErrorCode
+		/// HTTP/2 error codes (RFC 9113, section 7).
+	{
+		H2_NO_ERROR            = 0x0,
+		H2_PROTOCOL_ERROR      = 0x1,
+		H2_INTERNAL_ERROR      = 0x2,
+		H2_FLOW_CONTROL_ERROR  = 0x3,
+		H2_SETTINGS_TIMEOUT    = 0x4,
+		H2_STREAM_CLOSED       = 0x5,
+		H2_FRAME_SIZE_ERROR    = 0x6,
+		H2_REFUSED_STREAM      = 0x7,
+		H2_CANCEL              = 0x8,
+		H2_COMPRESSION_ERROR   = 0x9,
+		H2_CONNECT_ERROR       = 0xa,
+		H2_ENHANCE_YOUR_CALM   = 0xb,
+		H2_INADEQUATE_SECURITY = 0xc,
+		H2_HTTP_1_1_REQUIRED   = 0xd
+	};
+
+	static const std::string CONNECTION_PREFACE;
+		/// The client connection preface ("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n").
+
+	HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool = Poco::ThreadPool::defaultPool());
+		/// Creates the HTTP2ServerSession for the given connected socket.
+
+	~HTTP2ServerSession();
+		/// Destroys the HTTP2ServerSession.
+
+	void run();
+		/// Processes the connection until the client closes it, the
+		/// keep-alive timeout expires with no active streams, or a
+		/// connection error occurs.
+		///
+		/// The client connection preface must not have been consumed
+		/// from the socket yet.
+		///
+		/// Returns after all handlers started for the connection
+		/// have completed.
+
+	static bool isPreface(const char* buffer, std::size_t length);
+		/// Returns true if the given buffer starts with the client
+		/// connection preface. The buffer must contain at least
+		/// CONNECTION_PREFACE.size() bytes.
+
+private:
+	class Stream;
+	class Request;
+	class Response;
+	class RequestStreamBuf;
+	class ResponseStreamBuf;
+
+	using StreamPtr = std::shared_ptr<Stream>;
+
+	bool readFrame();
+	bool fill(std::size_t n, bool frameStart);
+	void processFrame(int type, int flags, Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void onData(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void onHeaders(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void onContinuation(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void onHeaderBlock(Poco::UInt32 streamId, bool endStream);
+	void onSettings(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void onWindowUpdate(Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void onResetStream(Poco::UInt32 streamId, const char* payload, std::size_t length);
+	bool buildRequest(const NameValueCollection& fields, Stream& stream);
+	void startPending();
+	void runStream(Stream& stream);
+	void processRequest(Stream& stream);
+	void sendHeaders(Stream& stream, int status, const NameValueCollection& fields, bool endStream);
+	void sendData(Stream& stream, const char* buffer, std::size_t length, bool endStream);
+	int receiveData(Stream& stream, char* buffer, std::size_t length);
+	void resetStream(Poco::UInt32 streamId, ErrorCode code);
+	void resetStream(Stream& stream, ErrorCode code);
+	void sendWindowUpdate(Poco::UInt32 streamId, Poco::UInt32 increment);
+	void sendGoAway(ErrorCode code);
+	void writeFrame(int type, int flags, Poco::UInt32 streamId, const char* payload, std::size_t length);
+	void sendFrames(const std::string& frames);
+	bool shouldClose();
+	void close();
+
+	HTTP2ServerSession(const HTTP2ServerSession&) = delete;
+	HTTP2ServerSession& operator = (const HTTP2ServerSession&) = delete;
+
+	StreamSocket                   _socket;
+	HTTPServerParams::Ptr          _pParams;
+	HTTPRequestHandlerFactory::Ptr _pFactory;
+	Poco::ThreadPool&              _threadPool;
+	SocketAddress                  _clientAddress;
+	SocketAddress                  _serverAddress;
+
+	// reader thread only
+	std::vector<char>  _inBuffer;
+	std::size_t        _inPos;
+	std::size_t        _inEnd;
+	HPACKDecoder       _decoder;
+	std::string        _headerBlock;
+	Poco::UInt32       _continuationStreamId;
+	bool               _continuationEndStream;
+	Poco::UInt32       _lastStreamId;
+	int                _acceptedStreams;
+	bool               _settingsReceived;
+	std::size_t        _connRecvConsumed;
+	Poco::Int64        _connRecvWindow;
+
+	// guarded by _mutex
+	Poco::FastMutex                 _mutex;
+	Poco::Condition                 _cond;
+	std::map<Poco::UInt32, StreamPtr> _streams;
+	std::deque<StreamPtr>           _pending;
+	Poco::Int64                     _connSendWindow;
+	Poco::Int64                     _peerInitialWindowSize;
+	int                             _activeHandlers;
+	bool                            _closed;
+
+	// guarded by _sendMutex
+	Poco::FastMutex    _sendMutex;
+	HPACKEncoder       _encoder;
+
+	std::atomic<Poco::UInt32> _peerMaxFrameSize;
+	std::atomic<bool>         _goAwaySent;
+	std::atomic<bool>         _goAwayReceived;
+};
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTP2ServerSession_INCLUDED
@@ -0,0 +1,281 @@
+//
+// HTTPClientPool.h
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientPool
+//
+// Definition of the HTTPClientPool class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPClientPool_INCLUDED
+#define Net_HTTPClientPool_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/ProxyConfig.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/URI.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+class HTTPSessionFactory;
+
+
+class Net_API HTTPClientPool
+	/// A thread-safe pool of persistent HTTPClientSession objects.
+	///
+	/// Sessions are pooled per endpoint, identified by the URI scheme,
+	/// host and port, and the proxy configuration. A session obtained
+	/// with get() is returned to the pool when the PooledSession holding
+	/// it is destroyed, so that a later request to the same endpoint can
+	/// reuse the open connection, saving the cost of setting up a new TCP
+	/// connection and, for HTTPS, a new TLS handshake.
+	///
+	/// At most getMaxSessionsPerHost() sessions are handed out or kept
+	/// idle for an endpoint. If the limit has been reached, get() waits
+	/// until another thread returns a session for the same endpoint.
+	///
+	/// Idle sessions are closed once their keep-alive timeout (see
+	/// HTTPClientSession::getKeepAliveTimeout()) has expired. This is
+	/// done whenever a session for the endpoint is requested or returned,
+	/// and for all endpoints by purgeIdle().
+	///
+	/// Sessions for the "http" scheme are created directly; for other
+	/// schemes (e.g., "https"), a HTTPSessionInstantiator must have been
+	/// registered with the HTTPSessionFactory given to the pool.
+	///
+	/// Usage example:
+	///     HTTPClientPool pool;
+	///     Poco::URI uri("http://www.appinf.com/index.html");
+	///     HTTPClientPool::PooledSession pSession = pool.get(uri);
+	///     HTTPRequest request(HTTPRequest::HTTP_GET, uri.getPathAndQuery());
+	///     pSession->sendRequest(request);
+	///     HTTPResponse response;
+	///     std::istream& rs = pSession->receiveResponse(response);
+	///     Poco::StreamCopier::copyStream(rs, std::cout);
+	///
+	/// The response body must be read completely before a session
+	/// is returned to the pool. Otherwise, PooledSession::discard()
+	/// must be called to close the connection.
+	///
+	/// The HTTPClientPool must outlive all PooledSession objects
+	/// obtained from it.
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_SESSIONS_PER_HOST = 8,
+		DEFAULT_WAIT_TIMEOUT          = 30
+	};
+
+	class Net_API PooledSession
+		/// Holds a HTTPClientSession borrowed from a HTTPClientPool
+		/// and returns it to the pool when destroyed.
+	{
+	public:
+		PooledSession();
+			/// Creates an empty PooledSession.
+
+		PooledSession(PooledSession&& other) noexcept;
+			/// Takes over the session held by other.
+
+		~PooledSession();
+			/// Returns the session to the pool.
+
+		PooledSession& operator = (PooledSession&& other) noexcept;
+			/// Returns the currently held session to the pool
+			/// and takes over the session held by other.
+
+		HTTPClientSession& operator * ();
+			/// Returns a reference to the session.
+
+		HTTPClientSession* operator -> ();
+			/// Returns a pointer to the session.
+
+		HTTPClientSession& session();
+			/// Returns a reference to the session.
+
+		void release();
+			/// Returns the session to the pool. Afterwards,
+			/// the PooledSession is empty.
+
+		void discard();
+			/// Closes the session's connection and removes the
+			/// session from the pool, e.g., because the response
+			/// has not been read completely. Afterwards, the
+			/// PooledSession is empty.
+
+		bool isNull() const;
+			/// Returns true if the PooledSession does not hold a session.
+
+	private:
+		PooledSession(HTTPClientPool* pPool, const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession);
+
+		PooledSession(const PooledSession&) = delete;
+		PooledSession& operator = (const PooledSession&) = delete;
+
+		HTTPClientPool* _pPool;
+		std::string _key;
+		std::unique_ptr<HTTPClientSession> _pSession;
+
+		friend class HTTPClientPool;
+	};
+
+	explicit HTTPClientPool(int maxSessionsPerHost = DEFAULT_MAX_SESSIONS_PER_HOST);
+		/// Creates the HTTPClientPool, using the default HTTPSessionFactory
+		/// for schemes other than "http".
+
+	HTTPClientPool(HTTPSessionFactory& factory, int maxSessionsPerHost = DEFAULT_MAX_SESSIONS_PER_HOST);
+		/// Creates the HTTPClientPool, using the given HTTPSessionFactory
+		/// for schemes other than "http".
+
+	~HTTPClientPool();
+		/// Destroys the HTTPClientPool and closes all idle sessions.
+
+	PooledSession get(const Poco::URI& uri);
+		/// Returns a session for the scheme, host and port of the given
+		/// URI, using the global proxy configuration
+		/// (see HTTPClientSession::setGlobalProxyConfig()).
+		///
+		/// An idle session is reused if available. Otherwise, a new
+		/// session is created unless the maximum number of sessions
+		/// for the endpoint has been reached, in which case get() waits
+		/// up to getWaitTimeout() for a session to be returned.
+		///
+		/// Throws a TimeoutException if no session becomes available
+		/// in time, or a UnknownURISchemeException if sessions for the
+		/// URI's scheme cannot be created.
+
+	PooledSession get(const Poco::URI& uri, const ProxyConfig& proxyConfig);
+		/// Returns a session for the scheme, host and port of the given
+		/// URI, connecting via the given proxy. Sessions using different
+		/// proxies are pooled separately.
+		///
+		/// See get(const Poco::URI&) for details.
+
+	void setMaxSessionsPerHost(int maxSessions);
+		/// Sets the maximum number of sessions, in use or idle,
+		/// for a single endpoint.
+
+	int getMaxSessionsPerHost() const;
+		/// Returns the maximum number of sessions for a single endpoint.
+
+	void setWaitTimeout(const Poco::Timespan& timeout);
+		/// Sets the time get() waits for a session to become available
+		/// if the maximum number of sessions for an endpoint has been reached.
+
+	Poco::Timespan getWaitTimeout() const;
+		/// Returns the time get() waits for a session to become available.
+
+	std::size_t purgeIdle();
+		/// Closes all idle sessions whose keep-alive timeout has expired.
+		///
+		/// Returns the number of sessions closed.
+
+	void clear();
+		/// Closes all idle sessions. Sessions currently in use are
+		/// not affected.
+
+	std::size_t idleSessions() const;
+		/// Returns the total number of idle sessions in the pool.
+
+	std::size_t activeSessions() const;
+		/// Returns the total number of sessions currently in use.
+
+protected:
+	virtual HTTPClientSession* createSession(const Poco::URI& uri, const ProxyConfig& proxyConfig);
+		/// Creates a new session for the given URI and proxy configuration,
+		/// with persistent connections enabled.
+		///
+		/// Can be overridden by subclasses to configure new sessions,
+		/// e.g., to set timeouts.
+
+	static std::string endpointKey(const Poco::URI& uri, const ProxyConfig& proxyConfig);
+		/// Returns the key used to pool sessions for the given
+		/// URI and proxy configuration.
+
+private:
+	struct IdleSession
+	{
+		std::unique_ptr<HTTPClientSession> pSession;
+		Poco::Timestamp returned;
+	};
+
+	struct Endpoint
+	{
+		std::vector<IdleSession> idle;
+		int active = 0;
+	};
+
+	using EndpointMap = std::map<std::string, Endpoint>;
+	using SessionList = std::vector<std::unique_ptr<HTTPClientSession>>;
+
+	void returnSession(const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession, bool reuse);
+	static void purgeExpired(Endpoint& endpoint, SessionList& expired);
+	static bool isReusable(HTTPClientSession& session);
+
+	HTTPClientPool(const HTTPClientPool&) = delete;
+	HTTPClientPool& operator = (const HTTPClientPool&) = delete;
+
+	HTTPSessionFactory& _factory;
+	int _maxSessionsPerHost;
+	Poco::Timespan _waitTimeout;
+	EndpointMap _endpoints;
+	mutable Poco::FastMutex _mutex;
+	Poco::Condition _available;
+};
+
+
+//
+// inlines
+//
+inline HTTPClientSession& HTTPClientPool::PooledSession::operator * ()
+{
+	poco_check_ptr (_pSession);
+
+	return *_pSession;
+}
+
+
+inline HTTPClientSession* HTTPClientPool::PooledSession::operator -> ()
+{
+	poco_check_ptr (_pSession);
+
+	return _pSession.get();
+}
+
+
+inline HTTPClientSession& HTTPClientPool::PooledSession::session()
+{
+	poco_check_ptr (_pSession);
+
+	return *_pSession;
+}
+
+
+inline bool HTTPClientPool::PooledSession::isNull() const
+{
+	return !_pSession;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTPClientPool_INCLUDED
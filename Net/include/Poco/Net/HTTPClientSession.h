@@ -398,6 +398,7 @@ private:
 	HTTPClientSession& operator = (const HTTPClientSession&) = delete;
 
 	friend class WebSocket;
+	friend class HTTPClientPool;
 };
 
 
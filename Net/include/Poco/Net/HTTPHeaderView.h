@@ -0,0 +1,186 @@
+//
+// HTTPHeaderView.h
+//
+// Library: Net
+// Package: HTTP
+// Module:  HTTPHeaderView
+//
+// Definition of the HTTPHeaderView class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPHeaderView_INCLUDED
+#define Net_HTTPHeaderView_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco::Net {
+
+
+class Net_API HTTPHeaderView
+	/// An index over the header block (start line and header
+	/// fields) of a HTTP message held in a contiguous buffer.
+	///
+	/// Parsing does not copy the buffer; the start line and all
+	/// field names and values are returned as std::string_view
+	/// referring to the parsed buffer. The views are only valid as
+	/// long as the buffer is neither modified nor destroyed.
+	///
+	/// The first INLINE_FIELDS fields are stored in the object
+	/// itself; further fields are stored in a vector that keeps
+	/// its capacity when the view is cleared, so a view reused for
+	/// a sequence of messages only allocates for the first message
+	/// with an unusually large header. The number of fields is not
+	/// limited here; MessageHeader::read() enforces the field limit
+	/// of the message.
+	///
+	/// Line ends are located using memchr(), which most C runtime
+	/// libraries implement with vector instructions.
+	///
+	/// Field values are returned without leading and trailing
+	/// whitespace. A value folded over multiple lines (obsolete
+	/// line folding) is returned as it appears in the buffer,
+	/// including the CRLF sequences.
+	///
+	/// HTTPHeaderView is used by HTTPReactorServerSession to
+	/// find the end of a request, and to build a HTTPRequest
+	/// without going through a stream.
+{
+public:
+	enum
+	{
+		INLINE_FIELDS = 32
+			/// Number of header fields stored without allocation.
+	};
+
+	HTTPHeaderView();
+		/// Creates an empty HTTPHeaderView.
+
+	~HTTPHeaderView();
+		/// Destroys the HTTPHeaderView.
+
+	std::size_t parse(const char* buffer, std::size_t length);
+		/// Parses the header block at the beginning of the given buffer.
+		///
+		/// Returns the size of the header block, including the
+		/// terminating empty line, or 0 if the buffer does not yet
+		/// contain a complete header block. Empty lines preceding
+		/// the start line are skipped and are included in the
+		/// returned size.
+		///
+		/// Lines without a colon are ignored, like MessageHeader::read()
+		/// does.
+
+	void clear();
+		/// Removes the start line and all fields.
+
+	std::string_view startLine() const;
+		/// Returns the start line, without the line end.
+
+	std::size_t size() const;
+		/// Returns the number of header fields.
+
+	bool empty() const;
+		/// Returns true iff the header contains no fields.
+
+	std::string_view name(std::size_t index) const;
+		/// Returns the name of the field with the given index.
+
+	std::string_view value(std::size_t index) const;
+		/// Returns the value of the field with the given index.
+
+	bool has(std::string_view name) const;
+		/// Returns true if there is at least one field with the
+		/// given name. Field names are compared case-insensitively.
+
+	std::string_view get(std::string_view name) const;
+		/// Returns the value of the first field with the given name.
+		///
+		/// Throws a NotFoundException if the field does not exist.
+
+	std::string_view get(std::string_view name, std::string_view defaultValue) const;
+		/// Returns the value of the first field with the given name,
+		/// or defaultValue if the field does not exist.
+
+	bool hasToken(std::string_view name, std::string_view token) const;
+		/// Returns true iff the value of the first field with the
+		/// given name contains the given token in its comma-separated
+		/// list of elements. Tokens are compared case-insensitively.
+
+	static bool equalsIgnoreCase(std::string_view s1, std::string_view s2);
+		/// Compares the given strings, ignoring the case of ASCII characters.
+
+private:
+	struct Field
+	{
+		std::string_view name;
+		std::string_view value;
+	};
+
+	const Field& field(std::size_t index) const;
+	bool find(std::string_view name, std::string_view& value) const;
+
+	std::string_view   _startLine;
+	std::size_t        _size;
+	Field              _fields[INLINE_FIELDS];
+	std::vector<Field> _moreFields;
+};
+
+
+//
+// inlines
+//
+inline std::string_view HTTPHeaderView::startLine() const
+{
+	return _startLine;
+}
+
+
+inline std::size_t HTTPHeaderView::size() const
+{
+	return _size;
+}
+
+
+inline bool HTTPHeaderView::empty() const
+{
+	return _size == 0;
+}
+
+
+inline const HTTPHeaderView::Field& HTTPHeaderView::field(std::size_t index) const
+{
+	return index < INLINE_FIELDS ? _fields[index] : _moreFields[index - INLINE_FIELDS];
+}
+
+
+inline std::string_view HTTPHeaderView::name(std::size_t index) const
+{
+	poco_assert_dbg (index < _size);
+
+	return field(index).name;
+}
+
+
+inline std::string_view HTTPHeaderView::value(std::size_t index) const
+{
+	poco_assert_dbg (index < _size);
+
+	return field(index).value;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTPHeaderView_INCLUDED
@@ -127,6 +127,7 @@ public:
 
 	static const std::string HTTP_1_0;
 	static const std::string HTTP_1_1;
+	static const std::string HTTP_2_0;
 
 	static const std::string IDENTITY_TRANSFER_ENCODING;
 	static const std::string CHUNKED_TRANSFER_ENCODING;
@@ -0,0 +1,249 @@
+//
+// HTTPReactorClient.h
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPReactorClient
+//
+// Definition of the HTTPReactorClient class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPReactorClient_INCLUDED
+#define Net_HTTPReactorClient_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <set>
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+class Net_API HTTPReactorClient
+	/// An asynchronous HTTP/1.1 client for a single server, driven
+	/// by a SocketReactor.
+	///
+	/// sendRequest() does not block. The request is sent over one of
+	/// up to getMaxConnections() non-blocking, persistent connections
+	/// to the server; if all of them are busy, the request is queued
+	/// until a connection becomes free. Connecting, sending and receiving
+	/// is done by the SocketReactor's thread, so a single thread can drive
+	/// many concurrent requests, to the same or (using multiple
+	/// HTTPReactorClient objects sharing a SocketReactor) to different
+	/// servers.
+	///
+	/// When the response has been received completely, or the request
+	/// has failed, the completion callback is invoked in the reactor
+	/// thread (or, for requests that fail before being sent, in the thread
+	/// calling sendRequest() or close()). A callback must not block. The
+	/// variant of sendRequest() returning a std::future can be used if
+	/// the result is needed in another thread.
+	///
+	/// The response header is parsed with HTTPHeaderView, like
+	/// HTTPReactorServerSession does for requests. The response body
+	/// is collected in memory. Only plain (unencrypted) connections
+	/// are supported.
+	///
+	/// Timeouts are checked whenever the reactor delivers an event
+	/// for one of the client's connections, including timeout events.
+	///
+	/// The server may close a persistent connection while a new request
+	/// is being sent over it. If a request fails on a reused connection
+	/// before any part of the response has been received, it is sent
+	/// again over a new connection, but only if its method is idempotent
+	/// (GET, HEAD, OPTIONS, TRACE, PUT and DELETE, see RFC 9110, section
+	/// 9.2.2). For other methods, e.g. POST, the callback receives the
+	/// exception, as the server may already have processed the request.
+	///
+	/// The HTTPReactorClient must only be destroyed while the reactor
+	/// is not running, or in the reactor thread, e.g., in a completion
+	/// callback.
+	///
+	/// Usage example:
+	///     SocketReactor reactor;
+	///     Thread thread;
+	///     thread.start(reactor);
+	///     HTTPReactorClient client("www.appinf.com", 80, reactor);
+	///     HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+	///     client.sendRequest(request, "", [](const Poco::Exception* pException, HTTPReactorClient::Response& response)
+	///         {
+	///             if (!pException) std::cout << response.body;
+	///         });
+{
+public:
+	struct Response
+		/// The response to a request.
+	{
+		HTTPResponse response;
+			/// The response header.
+
+		std::string body;
+			/// The response body, with any transfer
+			/// encoding removed.
+	};
+
+	using Callback = std::function<void (const Poco::Exception* pException, Response& response)>;
+		/// The completion callback. pException is null if the
+		/// request was successful, otherwise it points to the
+		/// exception describing the failure.
+
+	enum
+	{
+		DEFAULT_MAX_CONNECTIONS    = 8,
+		DEFAULT_TIMEOUT            = 60,
+		DEFAULT_KEEP_ALIVE_TIMEOUT = 8
+	};
+
+	HTTPReactorClient(const std::string& host, Poco::UInt16 port, SocketReactor& reactor);
+		/// Creates a HTTPReactorClient for the server with the given
+		/// host and port. The host name is resolved when the
+		/// HTTPReactorClient is created.
+
+	HTTPReactorClient(const SocketAddress& address, SocketReactor& reactor);
+		/// Creates a HTTPReactorClient for the server with the given address.
+
+	~HTTPReactorClient();
+		/// Destroys the HTTPReactorClient, closing all connections.
+		/// The callbacks of outstanding requests are invoked with
+		/// an IOException.
+
+	void sendRequest(const HTTPRequest& request, const std::string& body, Callback callback);
+		/// Sends the given request, with the given body, to the server.
+		///
+		/// The Host header is set if the request does not have one,
+		/// and the Content-Length header is set unless the request
+		/// uses the chunked transfer encoding, in which case the
+		/// body is sent as a single chunk.
+		///
+		/// The callback is invoked when the request has completed.
+		/// Throws an IllegalStateException if the client has been closed.
+
+	std::future<Response> sendRequest(const HTTPRequest& request, const std::string& body = std::string());
+		/// Sends the given request, with the given body, to the server,
+		/// and returns a future for the response.
+		///
+		/// If the request fails, std::future::get() throws a
+		/// Poco::Exception (or subclass) describing the failure.
+
+	void setMaxConnections(int maxConnections);
+		/// Sets the maximum number of connections to the server.
+
+	int getMaxConnections() const;
+		/// Returns the maximum number of connections to the server.
+
+	void setTimeout(const Poco::Timespan& timeout);
+		/// Sets the timeout for requests. A request that has not
+		/// completed within the given time after sendRequest()
+		/// has been called fails with a TimeoutException.
+		///
+		/// The default is 60 seconds.
+
+	Poco::Timespan getTimeout() const;
+		/// Returns the timeout for requests.
+
+	void setKeepAliveTimeout(const Poco::Timespan& timeout);
+		/// Sets the time after which idle connections are closed.
+		///
+		/// The default is 8 seconds, like for HTTPClientSession.
+
+	Poco::Timespan getKeepAliveTimeout() const;
+		/// Returns the time after which idle connections are closed.
+
+	void close();
+		/// Closes all connections and fails all outstanding requests
+		/// with an IOException. No more requests can be sent.
+		///
+		/// Must be called while the reactor is not running, or in
+		/// the reactor thread.
+
+	std::size_t pendingRequests() const;
+		/// Returns the number of requests that have not completed yet.
+
+	std::size_t connections() const;
+		/// Returns the number of open connections.
+
+	const SocketAddress& address() const;
+		/// Returns the address of the server.
+
+private:
+	class Connection;
+	using ConnectionPtr = std::shared_ptr<Connection>;
+
+	struct PendingRequest
+	{
+		std::string data;
+		bool head = false;
+		bool idempotent = false;
+		Poco::Timestamp deadline;
+		Callback callback;
+	};
+
+	struct Completion
+	{
+		Callback callback;
+		std::unique_ptr<Poco::Exception> pException;
+		Response response;
+	};
+
+	using CompletionList = std::vector<Completion>;
+
+	void dispatch(CompletionList& completions);
+	void checkTimeouts(CompletionList& completions);
+	void release(const ConnectionPtr& pConnection, bool reusable, CompletionList& completions);
+	void remove(const ConnectionPtr& pConnection);
+	void closeImpl(CompletionList& completions);
+	static void fail(PendingRequest& request, const Poco::Exception& exc, CompletionList& completions);
+	static void complete(CompletionList& completions);
+
+	HTTPReactorClient(const HTTPReactorClient&) = delete;
+	HTTPReactorClient& operator = (const HTTPReactorClient&) = delete;
+
+	SocketAddress   _address;
+	std::string     _host;
+	SocketReactor&  _reactor;
+	int             _maxConnections;
+	Poco::Timespan  _timeout;
+	Poco::Timespan  _keepAliveTimeout;
+	bool            _closed;
+	Poco::Timestamp _lastTimeoutCheck;
+	std::deque<PendingRequest> _queue;
+	std::set<ConnectionPtr>    _connections;
+	std::vector<ConnectionPtr> _idle;
+	std::size_t     _active;
+	mutable Poco::FastMutex _mutex;
+
+	friend class Connection;
+};
+
+
+//
+// inlines
+//
+inline const SocketAddress& HTTPReactorClient::address() const
+{
+	return _address;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTPReactorClient_INCLUDED
@@ -9,10 +9,35 @@
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/Net/TCPReactorServer.h"
+#include <functional>
+#include <memory>
 namespace Poco::Net {
 
 
+class HTTPReactorServerSession;
+
+
 class Net_API HTTPReactorServer
+	/// A HTTP server built on TCPReactorServer. Requests are parsed and
+	/// handled inline on the reactor thread owning the connection.
+	///
+	/// For multi-core scalability, the server can be sharded into several
+	/// independent event loops, each with its own SO_REUSEPORT listening
+	/// socket, its own connections (and thus HTTPReactorServerSession
+	/// objects), and optionally its own CPU core:
+	///
+	///     HTTPServerParams::Ptr pParams = new HTTPServerParams;
+	///     pParams->setReactorMode(true);
+	///     pParams->setAcceptorNum(Environment::processorCount());
+	///     pParams->setUseSelfReactor(true);
+	///     pParams->setThreadAffinity(0);
+	///     HTTPReactorServer server(8080, pParams, pFactory);
+	///
+	/// Since handlers run on the reactor thread, a slow (e.g. database-bound)
+	/// handler delays all other connections served by the same reactor.
+	/// Such requests can be offloaded to a bounded worker pool, see
+	/// setOffloadPool(). Requests are still parsed, and responses still
+	/// written, by the reactor thread; only the handler runs in the pool.
 {
 public:
 	HTTPReactorServer(int port, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
@@ -23,7 +48,28 @@ public:
 		/// single interface (e.g. SocketAddress("127.0.0.1", 9800) for a
 		/// localhost-only service).
 
+	using OffloadFilter = std::function<bool(const HTTPServerRequest&)>;
+		/// Decides whether a request is handled in the offload pool (true)
+		/// or inline on the reactor thread (false).
+
 	~HTTPReactorServer();
+
+	void setOffloadPool(int threads, int maxQueued, const OffloadFilter& filter = OffloadFilter());
+		/// Enables handing requests over to a pool of the given number of
+		/// worker threads. At most maxQueued requests wait for a free
+		/// worker; further requests are answered with
+		/// 503 Service Unavailable on the reactor thread.
+		///
+		/// If a filter is given, only requests for which it returns true
+		/// are offloaded, the others are handled inline. Without a filter,
+		/// all requests are offloaded.
+		///
+		/// The response of an offloaded request is buffered in memory and
+		/// sent by the reactor thread once the handler returns. Further
+		/// requests on the same connection are not processed before that.
+		///
+		/// Must be called before start().
+
 	void start();
 	void stop();
 	int port() const { return _tcpReactorServer.port(); }
@@ -36,9 +82,19 @@ public:
 	void sendErrorResponse(HTTPSession& session, HTTPResponse::HTTPStatus status);
 
 private:
+	class OffloadTask;
+	class OffloadPool;
+
+	void prepareResponse(HTTPServerRequest& request, HTTPServerResponse& response);
+	void handleRequest(HTTPReactorServerSession& session, HTTPServerRequest& request, HTTPServerResponse& response);
+	void offload(const TcpReactorConnectionPtr& conn);
+	void runOffloaded(OffloadTask& task);
+
 	TCPReactorServer               _tcpReactorServer;
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	std::unique_ptr<OffloadPool>   _pOffloadPool;
+	OffloadFilter                  _offloadFilter;
 };
 
 } // namespace Poco::Net
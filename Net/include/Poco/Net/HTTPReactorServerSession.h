@@ -1,5 +1,6 @@
 #ifndef Net_HTTPReactorServerSession_INCLUDED
 #define Net_HTTPReactorServerSession_INCLUDED
+#include "Poco/Net/HTTPHeaderView.h"
 #include "Poco/Net/HTTPServerParams.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/SocketAddress.h"
@@ -37,6 +38,21 @@ public:
 
 	void popCompletedRequest();
 
+	const HTTPHeaderView& readHeaders();
+	/// Returns the index of the header block of the current request
+	/// and consumes the header block, so that reading continues
+	/// with the request body. Must only be called after
+	/// checkRequestComplete() has returned true.
+	///
+	/// The index refers to the session buffer and is only valid
+	/// until popCompletedRequest() is called.
+
+	void setOutputBuffer(std::string* pOutput);
+	/// Redirects all output of the session into the given string,
+	/// instead of sending it to the socket. Used when the request
+	/// is handled outside of the reactor thread. Passing nullptr
+	/// restores direct output to the socket.
+
 private:
 	int get() override;
 
@@ -52,11 +68,14 @@ private:
 
 private:
 	std::string&   _buf;
+	HTTPHeaderView _headers;
+	std::size_t    _headerSize{0};
 	char*          _pcur{nullptr};
 	char*          _pend{nullptr};
 	int            _idx{0};
 	int            _complete{0};
 	StreamSocket   _realsocket;
+	std::string*   _pOutput{nullptr};
 };
 
 } // namespace Poco::Net
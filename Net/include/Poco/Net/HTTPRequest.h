@@ -25,6 +25,9 @@
 namespace Poco::Net {
 
 
+class HTTPHeaderView;
+
+
 class Net_API HTTPRequest: public HTTPMessage
 	/// This class encapsulates an HTTP request
 	/// message.
@@ -145,6 +148,10 @@ public:
 		/// Reads the HTTP request from the
 		/// given input stream.
 
+	void read(const HTTPHeaderView& headers);
+		/// Reads the HTTP request from the given,
+		/// already parsed header block.
+
 	static const std::string HTTP_GET;
 	static const std::string HTTP_HEAD;
 	static const std::string HTTP_PUT;
@@ -29,6 +29,7 @@ namespace Poco::Net {
 
 
 class HTTPCookie;
+class HTTPHeaderView;
 
 
 class Net_API HTTPResponse: public HTTPMessage
@@ -203,6 +204,10 @@ public:
 		///
 		/// 100 Continue responses are ignored.
 
+	void read(const HTTPHeaderView& headers);
+		/// Reads the HTTP response from the given,
+		/// already parsed header block.
+
 	static const std::string& getReasonForStatus(HTTPStatus status);
 		/// Returns an appropriate reason phrase
 		/// for the given status code.
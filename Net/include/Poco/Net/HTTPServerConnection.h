@@ -24,6 +24,7 @@
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 #include "Poco/Net/HTTPServerParams.h"
 #include "Poco/Mutex.h"
+#include "Poco/ThreadPool.h"
 #include <atomic>
 
 
@@ -38,8 +39,11 @@ class Net_API HTTPServerConnection: public TCPServerConnection
 	/// connections.
 {
 public:
-	HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
+	HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool = Poco::ThreadPool::defaultPool());
 		/// Creates the HTTPServerConnection.
+		///
+		/// The streams of a HTTP/2 connection are handled
+		/// by threads from the given thread pool.
 
 	virtual ~HTTPServerConnection();
 		/// Destroys the HTTPServerConnection.
@@ -50,10 +54,15 @@ public:
 protected:
 	void sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status);
 	void onServerStopped(const bool& abortCurrent);
+	bool isHTTP2();
+		/// Returns true if the client has started the connection
+		/// with the HTTP/2 connection preface, without consuming
+		/// any data from the socket.
 
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	Poco::ThreadPool&              _threadPool;
 	std::atomic<bool> _stopped;
 	Poco::FastMutex _mutex;
 };
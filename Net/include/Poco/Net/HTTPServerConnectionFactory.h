@@ -22,6 +22,7 @@
 #include "Poco/Net/TCPServerConnectionFactory.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 #include "Poco/Net/HTTPServerParams.h"
+#include "Poco/ThreadPool.h"
 
 
 namespace Poco::Net {
@@ -32,8 +33,12 @@ class Net_API HTTPServerConnectionFactory: public TCPServerConnectionFactory
 	/// is used by HTTPServer to create HTTPServerConnection objects.
 {
 public:
-	HTTPServerConnectionFactory(HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
+	HTTPServerConnectionFactory(HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool = Poco::ThreadPool::defaultPool());
 		/// Creates the HTTPServerConnectionFactory.
+		///
+		/// The thread pool should be the one the server runs its
+		/// connections on. It is passed to the connections, which
+		/// use it to handle the streams of HTTP/2 connections.
 
 	~HTTPServerConnectionFactory();
 		/// Destroys the HTTPServerConnectionFactory.
@@ -45,6 +50,7 @@ public:
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	Poco::ThreadPool&              _threadPool;
 };
 
 
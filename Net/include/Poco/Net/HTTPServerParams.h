@@ -42,6 +42,8 @@ public:
 		///   - keepAlive:            true
 		///   - maxKeepAliveRequests: 0
 		///   - keepAliveTimeout:     10 seconds
+		///   - http2:                false
+		///   - http2MaxConcurrentStreams: 100
 
 	void setServerName(const std::string& serverName);
 		/// Sets the name and port (name:port) that the server uses to identify itself.
@@ -103,6 +105,29 @@ public:
 		/// Returns true if automatic conversion of HTTP header values
 		/// when reading HTTP header.
 
+	void setHTTP2Enabled(bool enabled);
+		/// Enables or disables HTTP/2 support.
+		///
+		/// If enabled, HTTPServerConnection accepts HTTP/2 connections
+		/// in addition to HTTP/1.x connections. A HTTP/2 connection is
+		/// recognized by its connection preface. This covers cleartext
+		/// connections with prior knowledge (h2c), and secure connections
+		/// where "h2" has been negotiated with ALPN (see
+		/// Poco::Net::Context::setALPNProtocols() in NetSSL_OpenSSL).
+		/// The HTTP/1.1 Upgrade mechanism is not supported.
+
+	bool getHTTP2Enabled() const;
+		/// Returns true if HTTP/2 support is enabled.
+
+	void setHTTP2MaxConcurrentStreams(int maxStreams);
+		/// Sets the maximum number of concurrent streams the server
+		/// allows on a HTTP/2 connection, announced to the client with
+		/// the SETTINGS_MAX_CONCURRENT_STREAMS setting.
+
+	int getHTTP2MaxConcurrentStreams() const;
+		/// Returns the maximum number of concurrent streams per
+		/// HTTP/2 connection.
+
 protected:
 	virtual ~HTTPServerParams();
 		/// Destroys the HTTPServerParams.
@@ -115,6 +140,8 @@ private:
 	int            _maxKeepAliveRequests;
 	Poco::Timespan _keepAliveTimeout;
 	bool           _autoDecodeHeaders;
+	bool           _http2Enabled;
+	int            _http2MaxConcurrentStreams;
 };
 
 
@@ -163,6 +190,18 @@ inline bool HTTPServerParams::getAutoDecodeHeaders() const
 }
 
 
+inline bool HTTPServerParams::getHTTP2Enabled() const
+{
+	return _http2Enabled;
+}
+
+
+inline int HTTPServerParams::getHTTP2MaxConcurrentStreams() const
+{
+	return _http2MaxConcurrentStreams;
+}
+
+
 } // namespace Poco::Net
 
 
@@ -21,6 +21,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/HTTPRequest.h"
 #include "Poco/Net/SocketAddress.h"
+#include "Poco/Arena.h"
 #include <istream>
 
 
@@ -70,6 +71,16 @@ public:
 		/// connection. Returns false if no secure connection
 		/// is used, or if it is not known whether a secure
 		/// connection is used.
+
+	virtual Poco::Arena* arena() const;
+		/// Returns the Arena for temporary allocations made while
+		/// handling the request, or nullptr if none is available.
+		///
+		/// HTTPServer and HTTPReactorServer make a per-thread Arena
+		/// current (see Poco::ArenaScope) while the request handler
+		/// runs, and reset it after the handler returns. Memory
+		/// obtained from the Arena must therefore not be used after
+		/// handleRequest() returns.
 };
 
 
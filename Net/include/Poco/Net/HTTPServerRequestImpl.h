@@ -31,6 +31,8 @@ namespace Poco::Net {
 
 
 class HTTPServerSession;
+class HTTPReactorServerSession;
+class HTTPHeaderView;
 class HTTPServerParams;
 class StreamSocket;
 
@@ -47,6 +49,14 @@ public:
 		/// Creates the HTTPServerRequestImpl, using the
 		/// given HTTPServerSession.
 
+	HTTPServerRequestImpl(HTTPServerResponseImpl& response, HTTPReactorServerSession& session, HTTPServerParams* pParams);
+		/// Creates the HTTPServerRequestImpl, using the
+		/// given HTTPReactorServerSession.
+		///
+		/// The request header is taken from the header block
+		/// already parsed by the session, instead of being read
+		/// from the session's input stream.
+
 	~HTTPServerRequestImpl();
 		/// Destroys the HTTPServerRequestImpl.
 
@@ -85,13 +95,26 @@ public:
 	HTTPSession& session();
 		/// Returns the underlying HTTPServerSession.
 
+	const HTTPHeaderView* headerView() const;
+		/// Returns the index over the request header kept by the
+		/// HTTPReactorServerSession, or nullptr if the request has
+		/// been read from a stream.
+		///
+		/// The field names and values are views into the session's
+		/// receive buffer, so a handler can look at the header
+		/// without copying it. The index is valid until the
+		/// request has been handled.
+
 private:
+	void init();
+
 	HTTPServerResponseImpl&         _response;
 	HTTPSession&              _session;
 	std::istream*                   _pStream;
 	Poco::AutoPtr<HTTPServerParams> _pParams;
 	SocketAddress                   _clientAddress;
 	SocketAddress                   _serverAddress;
+	const HTTPHeaderView*           _pHeaderView;
 };
 
 
@@ -136,6 +159,12 @@ inline HTTPSession& HTTPServerRequestImpl::session()
 }
 
 
+inline const HTTPHeaderView* HTTPServerRequestImpl::headerView() const
+{
+	return _pHeaderView;
+}
+
+
 } // namespace Poco::Net
 
 
@@ -24,6 +24,7 @@
 #include "Poco/Net/HTTPServerSession.h"
 #include "Poco/Net/HTTPServerParams.h"
 #include "Poco/Timespan.h"
+#include <string>
 
 
 namespace Poco::Net {
@@ -33,6 +34,16 @@ class Net_API HTTPServerSession: public HTTPSession
 	/// This class handles the server side of a
 	/// HTTP session. It is used internally by
 	/// HTTPServer.
+	///
+	/// Pipelined requests (requests sent by the client before
+	/// it has received the response to a previous request) are
+	/// handled one after the other, in the order they have been
+	/// received. As long as further request data has already been
+	/// received, responses are collected in an output buffer and
+	/// sent together, using a single gathering write if possible.
+	/// The output buffer is sent before the session blocks waiting
+	/// for data from the client, so a client that does not pipeline
+	/// sees no difference.
 {
 public:
 	HTTPServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams);
@@ -53,7 +64,26 @@ public:
 	SocketAddress serverAddress();
 		/// Returns the server's address.
 
+	void flush();
+		/// Sends all buffered response data.
+
+protected:
+	int get();
+	int peek();
+	int read(char* buffer, std::streamsize length);
+	int write(const char* buffer, std::streamsize length);
+
 private:
+	enum
+	{
+		MAX_OUTPUT_BUFFER_SIZE = 65536
+	};
+
+	void send(const char* buffer, std::streamsize length);
+		/// Sends all of the given data. Throws a NetException
+		/// if the socket does not accept any more data.
+
+	std::string    _output;
 	bool           _firstRequest;
 	Poco::Timespan _keepAliveTimeout;
 	int            _maxKeepAliveRequests;
@@ -0,0 +1,181 @@
+//
+// IOUring.h
+//
+// Library: Net
+// Package: Sockets
+// Module:  IOUring
+//
+// Definition of the IOUring class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_IOUring_INCLUDED
+#define Net_IOUring_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+
+
+#if defined(POCO_HAVE_IO_URING)
+
+
+#include "Poco/Timespan.h"
+#include <linux/io_uring.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace Poco::Net {
+
+
+class Net_API IOUring
+	/// A thin wrapper around a Linux io_uring instance, using the raw
+	/// system call interface (no dependency on liburing).
+	///
+	/// IOUring only manages the submission (SQ) and completion (CQ) queues
+	/// shared with the kernel; the meaning of submitted operations is left
+	/// entirely to the user. It is used internally by PollSet and
+	/// SocketProactor.
+	///
+	/// IOUring is not thread-safe. Preparing and flushing submission queue
+	/// entries must be serialized by the caller, and so must be reaping
+	/// completion queue entries. Calling enter() concurrently from
+	/// different threads is safe.
+{
+public:
+	enum
+	{
+		DEFAULT_ENTRIES = 1024
+	};
+
+	explicit IOUring(unsigned entries = DEFAULT_ENTRIES);
+		/// Creates an io_uring instance with (at least) the given
+		/// number of submission queue entries.
+		///
+		/// Throws a Poco::IOException if the ring cannot be created,
+		/// or if the kernel does not support the required features.
+
+	~IOUring();
+		/// Destroys the IOUring and releases all kernel resources.
+
+	io_uring_sqe* getSQE();
+		/// Returns the next free, zero-initialized submission queue entry,
+		/// or nullptr if the submission queue is full.
+		///
+		/// The entry becomes visible to the kernel with the next call
+		/// to flush() or submit().
+
+	unsigned flush();
+		/// Makes all entries obtained through getSQE() visible to the
+		/// kernel and returns the number of entries not yet consumed
+		/// by the kernel.
+
+	int enter(unsigned toSubmit, unsigned waitNr, const Poco::Timespan* pTimeout = nullptr);
+		/// Calls io_uring_enter(), submitting up to toSubmit entries and
+		/// waiting for at least waitNr completions, or until the optional
+		/// timeout expires.
+		///
+		/// Returns the number of submitted entries, or a negative
+		/// error code (-errno) on failure. Timeout expiration is
+		/// reported as -ETIME.
+
+	int submit();
+		/// Flushes and submits all prepared entries without waiting.
+		/// Returns the number of submitted entries, or a negative
+		/// error code (-errno) on failure.
+
+	template <typename F>
+	unsigned reap(F&& func)
+		/// Calls func(const io_uring_cqe&) for every available
+		/// completion queue entry, then releases the entries
+		/// back to the kernel. Returns the number of entries reaped.
+	{
+		unsigned head = _cqHead->load(std::memory_order_relaxed);
+		const unsigned tail = _cqTail->load(std::memory_order_acquire);
+		unsigned count = 0;
+		while (head != tail)
+		{
+			func(_cqes[head & _cqMask]);
+			++head;
+			++count;
+		}
+		if (count) _cqHead->store(head, std::memory_order_release);
+		return count;
+	}
+
+	unsigned ready() const;
+		/// Returns the number of available completion queue entries.
+
+	unsigned entries() const;
+		/// Returns the number of submission queue entries.
+
+	int fd() const;
+		/// Returns the ring file descriptor.
+
+	static bool isAvailable();
+		/// Returns true if io_uring is supported by the running
+		/// kernel (and not disabled by e.g. seccomp policy).
+		/// The result of the first check is cached.
+
+private:
+	IOUring(const IOUring&) = delete;
+	IOUring& operator = (const IOUring&) = delete;
+
+	void unmap();
+
+	int                     _fd;
+	unsigned                _features;
+	void*                   _pSQRing;
+	std::size_t             _sqRingSize;
+	void*                   _pCQRing;
+	std::size_t             _cqRingSize;
+	io_uring_sqe*           _sqes;
+	std::size_t             _sqesSize;
+	std::atomic<unsigned>*  _sqHead;
+	std::atomic<unsigned>*  _sqTail;
+	unsigned*               _sqArray;
+	unsigned                _sqMask;
+	unsigned                _sqEntries;
+	unsigned                _sqeTail;
+	std::atomic<unsigned>*  _cqHead;
+	std::atomic<unsigned>*  _cqTail;
+	io_uring_cqe*           _cqes;
+	unsigned                _cqMask;
+};
+
+
+//
+// inlines
+//
+
+
+inline unsigned IOUring::ready() const
+{
+	return _cqTail->load(std::memory_order_acquire) - _cqHead->load(std::memory_order_relaxed);
+}
+
+
+inline unsigned IOUring::entries() const
+{
+	return _sqEntries;
+}
+
+
+inline int IOUring::fd() const
+{
+	return _fd;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // POCO_HAVE_IO_URING
+
+
+#endif // Net_IOUring_INCLUDED
@@ -28,6 +28,9 @@
 namespace Poco::Net {
 
 
+class HTTPHeaderView;
+
+
 class Net_API MessageHeader: public NameValueCollection
 	/// A collection of name-value pairs that are used in
 	/// various internet protocols like HTTP and SMTP.
@@ -86,6 +89,15 @@ public:
 		/// Throws a MessageException if the input stream is
 		/// malformed.
 
+	void read(const HTTPHeaderView& headers);
+		/// Adds all fields of the given HTTPHeaderView.
+		///
+		/// Applies the same limits and (if enabled) the same
+		/// decoding as read(std::istream&). Folded field values
+		/// are unfolded.
+		///
+		/// Throws a MessageException if a limit is exceeded.
+
 	void setAutoDecode(bool convert);
 		/// Enables or disables automatic conversion of HTTP header values
 		/// when reading HTTP header.
@@ -165,6 +165,20 @@ POCO_NET_FORCE_SYMBOL(pocoNetworkInitializer)
 #endif
 
 
+//
+// Define POCO_HAVE_IO_URING on Linux if the io_uring kernel headers are
+// available. Whether io_uring can actually be used is determined at runtime
+// (see IOUring::isAvailable()). Define POCO_NO_IO_URING to disable it.
+//
+#if (POCO_OS == POCO_OS_LINUX) && !defined(POCO_NO_IO_URING)
+	#if defined(__has_include)
+		#if __has_include(<linux/io_uring.h>)
+			#define POCO_HAVE_IO_URING 1
+		#endif
+	#endif
+#endif
+
+
 #if defined(POCO_OS_FAMILY_BSD)
 	#ifndef POCO_HAVE_FD_POLL
 		#define POCO_HAVE_FD_POLL 1
@@ -52,6 +52,7 @@ POCO_DECLARE_EXCEPTION(Net_API, HTMLFormException, NetException)
 POCO_DECLARE_EXCEPTION(Net_API, WebSocketException, NetException)
 POCO_DECLARE_EXCEPTION(Net_API, UnsupportedFamilyException, NetException)
 POCO_DECLARE_EXCEPTION(Net_API, AddressFamilyMismatchException, NetException)
+POCO_DECLARE_EXCEPTION(Net_API, HTTP2Exception, NetException)
 
 
 } // namespace Poco::Net
@@ -62,6 +62,14 @@ public:
 			_thread.setName(threadName);
 	}
 
+	ParallelSocketReactor(const typename SR::Params& params, const std::string& threadName = ""):
+		SR(params)
+	{
+		_thread.start(*this);
+		if (!threadName.empty())
+			_thread.setName(threadName);
+	}
+
 	~ParallelSocketReactor()
 	{
 		try
@@ -34,6 +34,15 @@ class Net_API PollSet
 	/// If supported, PollSet is implemented using epoll (Linux) or
 	/// poll (BSD) APIs. A fallback implementation using select()
 	/// is also provided.
+	///
+	/// On Linux, an io_uring based implementation can be selected
+	/// at runtime, either for a single PollSet or as the process-wide
+	/// default (see setDefaultBackend()). It batches registration
+	/// changes and re-arming of fired sockets with waiting for events
+	/// into a single system call. If io_uring is not supported by the
+	/// running kernel, the native implementation is used instead.
+	/// With the io_uring implementation, sockets should be removed
+	/// from the PollSet before they are closed.
 {
 public:
 	enum Mode
@@ -43,10 +52,23 @@ public:
 		POLL_ERROR = Socket::SELECT_ERROR
 	};
 
+	enum Backend
+	{
+		BACKEND_DEFAULT,  /// process-wide default backend (see setDefaultBackend())
+		BACKEND_NATIVE,   /// epoll, poll or select, depending on the platform
+		BACKEND_IO_URING  /// io_uring (Linux only)
+	};
+
 	using SocketModeMap = std::map<Poco::Net::Socket, int>;
 
 	PollSet();
-		/// Creates an empty PollSet.
+		/// Creates an empty PollSet, using the default backend.
+
+	explicit PollSet(Backend backend);
+		/// Creates an empty PollSet, using the given backend.
+		///
+		/// If the backend is not available, the native
+		/// implementation is used.
 
 	~PollSet();
 		/// Destroys the PollSet.
@@ -114,7 +136,25 @@ public:
 		/// On platforms/implementations where this functionality
 		/// is not available, it does nothing.
 
+	Backend backend() const;
+		/// Returns the backend actually used by this PollSet,
+		/// which is either BACKEND_NATIVE or BACKEND_IO_URING.
+
+	static bool isAvailable(Backend backend);
+		/// Returns true if the given backend is supported
+		/// on this platform and by the running kernel.
+
+	static void setDefaultBackend(Backend backend);
+		/// Sets the backend used by PollSets created with the default
+		/// constructor (e.g., by SocketReactor). Does not affect
+		/// already existing PollSets. The initial default is BACKEND_NATIVE.
+
+	static Backend getDefaultBackend();
+		/// Returns the backend used by PollSets created with the
+		/// default constructor.
+
 private:
+	Backend      _backend;
 	PollSetImpl* _pImpl;
 
 	PollSet(const PollSet&);
@@ -122,6 +162,15 @@ private:
 };
 
 
+//
+// inlines
+//
+inline PollSet::Backend PollSet::backend() const
+{
+	return _backend;
+}
+
+
 } // namespace Poco::Net
 
 
@@ -50,12 +50,30 @@ namespace Net {
 
 class Socket;
 class Worker;
+class IOUringEngine;
 
 
 class Net_API SocketProactor final: public Poco::Runnable
 	/// This class implements the proactor pattern.
 	/// It may also contain a simple work executor (enabled by default),
 	/// which executes submitted workload.
+	///
+	/// By default, the proactor is emulated on top of a readiness-based
+	/// PollSet: the actual I/O is performed by poll() after the socket
+	/// has been reported ready. On Linux, a native completion-based
+	/// engine built on io_uring can be requested instead (see
+	/// PollSet::BACKEND_IO_URING). In that case, every addReceive(),
+	/// addReceiveFrom(), addSend() and addSendTo() is handed to the
+	/// kernel as an asynchronous operation, and poll() merely collects
+	/// the completed operations and dispatches their completion handlers.
+	/// Sockets do not need to be added to the proactor with addSocket()
+	/// for the io_uring engine.
+	///
+	/// With both engines, the operations pending for the same socket
+	/// are performed in the order they have been added, separately
+	/// for receive and send operations. Buffers (and addresses) passed
+	/// by reference must remain valid until the completion handler
+	/// has been called.
 {
 public:
 	using Buffer = std::vector<std::uint8_t>;
@@ -74,6 +92,18 @@ public:
 	explicit SocketProactor(const Poco::Timespan& timeout, bool worker = true);
 		/// Creates the SocketProactor, using the given timeout.
 
+	explicit SocketProactor(PollSet::Backend backend, bool worker = true);
+		/// Creates the SocketProactor, using the given I/O backend.
+		///
+		/// If BACKEND_IO_URING is requested, but io_uring is not
+		/// available at runtime, the readiness-based emulation
+		/// is used. BACKEND_DEFAULT selects the backend returned
+		/// by PollSet::getDefaultBackend().
+
+	SocketProactor(const Poco::Timespan& timeout, PollSet::Backend backend, bool worker = true);
+		/// Creates the SocketProactor, using the given timeout
+		/// and I/O backend.
+
 	SocketProactor(const SocketProactor&) = delete;
 	SocketProactor(SocketProactor&&) = delete;
 	SocketProactor& operator=(const SocketProactor&) = delete;
@@ -201,10 +231,29 @@ public:
 	bool ioCompletionInProgress() const;
 		/// Returns true if there are not executed handlers from last IO.
 
+	PollSet::Backend backend() const;
+		/// Returns the I/O backend actually in use; either
+		/// BACKEND_NATIVE (readiness-based emulation)
+		/// or BACKEND_IO_URING (native completion engine).
+
 private:
 	void onShutdown();
 		/// Called when the SocketProactor is about to terminate.
 
+	void createEngine();
+		/// Creates the native completion engine, if
+		/// requested and available.
+
+	int pollReadiness();
+		/// Polls the sockets for readiness and performs the
+		/// I/O for the ready ones (readiness-based emulation).
+		/// Returns the number of I/O handlers completed.
+
+	int pollCompletions();
+		/// Submits the pending I/O operations to the native
+		/// completion engine and collects the completed ones.
+		/// Returns the number of I/O handlers completed.
+
 	int doWork(bool handleOne = false, bool expiredOnly = false);
 		/// Runs the scheduled work.
 		/// If handleOne is true, only the next scheduled function
@@ -453,9 +502,14 @@ private:
 	IOCompletion  _ioCompletion;
 	Poco::Mutex   _writeMutex;
 	Poco::Mutex   _readMutex;
+	Poco::Mutex   _runMutex;
 
 	std::unique_ptr<Worker> _pWorker;
+	PollSet::Backend        _backend;
+	std::unique_ptr<IOUringEngine> _pEngine;
+
 	friend class Worker;
+	friend class IOUringEngine;
 };
 
 //
@@ -497,6 +551,12 @@ inline bool SocketProactor::isRunning() const
 }
 
 
+inline PollSet::Backend SocketProactor::backend() const
+{
+	return _backend;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -29,7 +29,10 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/Event.h"
 #include "Poco/Thread.h"
+#include "Poco/Clock.h"
+#include "Poco/TimingWheel.h"
 #include <map>
+#include <vector>
 #include <atomic>
 
 
@@ -84,11 +87,12 @@ class Net_API SocketReactor: public Poco::Runnable
 	///
 	/// Timeout/sleep strategy operates as follows:
 	///
-	/// If the poll timeout expires and no event has occurred, a
+	/// If no socket event has occurred for the poll timeout, a
 	/// TimeoutNotification will be dispatched to all event handlers
 	/// registered for it. This is done in the onTimeout() method
 	/// which can be overridden by subclasses to perform custom
-	/// timeout processing.
+	/// timeout processing. Socket timeouts set with scheduleTimeout()
+	/// do not count as events.
 	///
 	/// By default, the SocketReactor is configured to start sleeping
 	/// when the poll timeout is zero and there are no socket events for
@@ -123,8 +127,15 @@ class Net_API SocketReactor: public Poco::Runnable
 	/// This sequence of events is obviously not desirable and it is highly
 	/// recommended that handlers wrap the code in try/catch and deal with all
 	/// the exceptions internally, lest they disrupt the notification of the peers.
+	///
+	/// In addition to the reactor-wide poll timeout, a timeout can be scheduled
+	/// for an individual socket with scheduleTimeout(). This is useful for
+	/// per-connection idle or request timeouts.
 {
 public:
+	using TimerId = Poco::TimingWheel<Socket>::TimerId;
+		/// Identifies a socket timeout scheduled with scheduleTimeout().
+
 	struct Params
 		/// Reactor parameters.
 		/// Default values should work well for most scenarios.
@@ -159,6 +170,11 @@ public:
 		bool throttle = true;
 			/// Indicates whether to start sleeping when poll timeout is zero and
 			/// there's no socket events for a period longer than `idleThreshold`
+
+		PollSet::Backend pollBackend = PollSet::BACKEND_DEFAULT;
+			/// PollSet backend; BACKEND_IO_URING batches socket registration
+			/// changes with waiting for events (Linux only, falls back to
+			/// the native implementation if not supported)
 	};
 
 	SocketReactor();
@@ -210,6 +226,35 @@ public:
 	const Poco::Timespan& getTimeout() const;
 		/// Returns the timeout.
 
+	TimerId scheduleTimeout(const Socket& socket, const Poco::Timespan& timeout);
+		/// Schedules a timeout for the given socket.
+		///
+		/// Once the given timeout has elapsed, a TimeoutNotification is
+		/// dispatched to the event handlers registered for the socket,
+		/// but not to other handlers. Use rescheduleTimeout() to restart
+		/// the timeout, e.g. after data has been received, and
+		/// cancelTimeout() if the timeout is no longer needed.
+		///
+		/// Socket timeouts are kept in a TimingWheel with a resolution of
+		/// one millisecond, so scheduling, rescheduling and cancelling
+		/// take constant time, regardless of the number of timeouts.
+		///
+		/// Can be called from any thread, including event handlers.
+		/// Returns the id of the timeout.
+
+	bool rescheduleTimeout(TimerId id, const Poco::Timespan& timeout);
+		/// Restarts the socket timeout with the given id, using
+		/// the given timeout, counted from now.
+		///
+		/// Returns false if the timeout has already expired
+		/// or has been cancelled.
+
+	bool cancelTimeout(TimerId id);
+		/// Cancels the socket timeout with the given id.
+		///
+		/// Returns false if the timeout has already expired
+		/// or has been cancelled.
+
 	void addEventHandler(const Socket& socket, const Poco::AbstractObserver& observer);
 		/// Registers an event handler with the SocketReactor.
 		///
@@ -301,6 +346,16 @@ private:
 
 	void sleep();
 
+	Poco::Timespan nextPollTimeout();
+		/// Returns the time left until the poll timeout expires,
+		/// counted from the last socket event or onTimeout() call,
+		/// shortened to the expiration of the next socket timeout,
+		/// if necessary.
+
+	void dispatchTimeouts();
+		/// Dispatches a TimeoutNotification for every expired
+		/// socket timeout.
+
 	enum
 	{
 		DEFAULT_TIMEOUT = 250000,
@@ -321,6 +376,11 @@ private:
 	NotificationPtr   _pShutdownNotification;
 	MutexType         _mutex;
 	Poco::Event       _event;
+	Poco::TimingWheel<Socket> _timeouts;
+	std::vector<Socket> _expiredTimeouts;
+	Poco::Clock       _pollDeadline{0};
+	Poco::Clock       _idleSince;
+	MutexType         _timeoutMutex;
 
 	friend class SocketNotifier;
 };
@@ -8,6 +8,7 @@
 #include "Poco/Net/TCPServerParams.h"
 #include "Poco/ThreadPool.h"
 #include <atomic>
+#include <memory>
 #include <vector>
 
 namespace Poco::Net {
@@ -21,6 +22,15 @@ class Net_API TCPReactorServer
 	/// and a TCPReactorAcceptor. The SocketReactor handles the event
 	/// loop, while the TCPReactorAcceptor accepts incoming connections
 	/// and creates TCPReactorServerConnection objects to handle them.
+	///
+	/// The server creates TCPServerParams::getAcceptorNum() acceptors, each
+	/// with its own reactor thread and its own listening socket. All
+	/// listening sockets are bound to the same address with SO_REUSEPORT,
+	/// so that (on platforms supporting it, e.g. Linux) the kernel spreads
+	/// incoming connections across the acceptors. If the acceptors also
+	/// handle their connections themselves (TCPServerParams::setUseSelfReactor()),
+	/// every acceptor is a fully independent event loop, which can be pinned
+	/// to a CPU core with TCPServerParams::setThreadAffinity().
 {
 public:
 	TCPReactorServer(int port, TCPServerParams::Ptr pParams);
@@ -48,7 +58,7 @@ public:
 
 private:
 	ThreadPool                                       _threadPool;
-	std::vector<SocketReactor>                       _reactors;
+	std::vector<std::unique_ptr<SocketReactor>>      _reactors;
 	std::vector<std::shared_ptr<TCPReactorAcceptor>> _acceptors;
 	std::vector<ServerSocket>                        _sockets;
 	TCPServerParams::Ptr                             _pParams;
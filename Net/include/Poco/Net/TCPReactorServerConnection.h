@@ -4,6 +4,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/SocketReactor.h"
 #include "Poco/Net/StreamSocket.h"
+#include "Poco/Mutex.h"
 #include <string>
 #include <functional>
 
@@ -24,9 +25,24 @@ public:
 	void initialize();
 
 	void onRead(const AutoPtr<ReadableNotification>& pNf);
+	void onWritable(const AutoPtr<WritableNotification>& pNf);
 	void onError(const AutoPtr<ErrorNotification>& pNf);
 	void onShutdown(const AutoPtr<ShutdownNotification>& pNf);
 
+	void suspend();
+		/// Stops passing received data to the message callback, e.g. while
+		/// a request is being processed outside of the reactor thread.
+		/// Received data is still appended to the buffer.
+		/// Must be called from the reactor thread.
+
+	void resume(std::string&& output, std::string&& pending, bool close);
+		/// Hands the output (e.g. a response produced by another thread)
+		/// over to the reactor thread, which sends it. Afterwards, the
+		/// connection is either closed (if close is true), or pending
+		/// (unconsumed input taken from the buffer before suspend()) is
+		/// put back in front of the buffer and the message callback
+		/// is resumed. Can be called from any thread.
+
 	void handleClose();
 	const StreamSocket& socket();
 	std::string& buffer();
@@ -38,6 +54,11 @@ private:
 	Poco::Net::StreamSocket   _socket;
 	RecvMessageCallback       _rcvCallback;
 	std::string               _buf;
+	bool                      _suspended{false};
+	Poco::FastMutex           _outputMutex;
+	std::string               _output;
+	std::string               _pending;
+	bool                      _closeAfterOutput{false};
 };
 
 } // namespace Poco::Net
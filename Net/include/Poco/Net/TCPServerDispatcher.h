@@ -25,6 +25,7 @@
 #include "Poco/Runnable.h"
 #include "Poco/NotificationQueue.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/WorkStealingThreadPool.h"
 #include "Poco/Mutex.h"
 #include <atomic>
 
@@ -44,6 +45,21 @@ public:
 		/// If no TCPServerParams object is supplied, the TCPServerDispatcher
 		/// creates one.
 
+	TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::WorkStealingThreadPool& threadPool, TCPServerParams::Ptr pParams);
+		/// Creates the TCPServerDispatcher, running connections
+		/// as tasks of the given WorkStealingThreadPool.
+		///
+		/// Connections are handed to the pool directly, without
+		/// going through the dispatcher's NotificationQueue. The
+		/// maximum number of queued connections is still limited
+		/// by TCPServerParams::getMaxQueued(). Since every connection
+		/// occupies a worker thread until it is closed, this is best
+		/// suited for many short-lived connections.
+		///
+		/// The dispatcher takes ownership of the TCPServerParams object.
+		/// If no TCPServerParams object is supplied, the TCPServerDispatcher
+		/// creates one.
+
 	void duplicate();
 		/// Increments the object's reference count.
 
@@ -96,6 +112,9 @@ protected:
 		/// Updates the performance counters.
 
 private:
+	void serve(const StreamSocket& socket);
+	void runConnection(const StreamSocket& socket);
+
 	TCPServerDispatcher();
 	TCPServerDispatcher(const TCPServerDispatcher&);
 	TCPServerDispatcher& operator = (const TCPServerDispatcher&);
@@ -110,7 +129,9 @@ private:
 	std::atomic<bool>  _stopped;
 	Poco::NotificationQueue         _queue;
 	TCPServerConnectionFactory::Ptr _pConnectionFactory;
-	Poco::ThreadPool&               _threadPool;
+	Poco::ThreadPool*               _pThreadPool;
+	Poco::WorkStealingThreadPool*   _pWorkStealingPool;
+	std::atomic<int>                _queuedConnections;
 	mutable Poco::FastMutex         _mutex;
 };
 
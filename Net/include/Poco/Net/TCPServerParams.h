@@ -116,6 +116,20 @@ public:
 		///
 		/// If true, use acceptor's self reactor, else create {_maxThreads} threads to use
 
+	int getThreadAffinity() const;
+		/// Returns the CPU core the first acceptor reactor thread
+		/// is pinned to, or -1 if the threads are not pinned.
+
+	void setThreadAffinity(int firstCore);
+		/// Pins the acceptor reactor threads to CPU cores (reactor mode only).
+		///
+		/// If firstCore is non-negative, the reactor thread of the n-th
+		/// acceptor is pinned to CPU core (firstCore + n), modulo the number
+		/// of available processors. Together with setUseSelfReactor(true),
+		/// this gives one independent, pinned event loop per acceptor.
+		///
+		/// The default is -1 (threads are not pinned).
+
 	const Poco::Timespan& getSendTimeout() const;
 		/// Returns the send timeout applied to accepted connections in reactor
 		/// mode. Zero (the default) means no timeout.
@@ -145,6 +159,7 @@ private:
 	bool _reactorMode;
 	int _acceptorNum;
 	bool _useSelfReactor;
+	int _threadAffinity;
 	Poco::Timespan _sendTimeout;
 };
 
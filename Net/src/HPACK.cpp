@@ -0,0 +1,604 @@
+//
+// HPACK.cpp
+//
+// Library: Net
+// Package: HTTP
+// Module:  HPACK
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HPACK.h"
+#include "Poco/Exception.h"
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	struct StaticEntry
+	{
+		const char* name;
+		const char* value;
+	};
+
+	const StaticEntry STATIC_TABLE[HPACKTable::STATIC_TABLE_SIZE] =
+	{
+		{":authority", ""},
+		{":method", "GET"},
+		{":method", "POST"},
+		{":path", "/"},
+		{":path", "/index.html"},
+		{":scheme", "http"},
+		{":scheme", "https"},
+		{":status", "200"},
+		{":status", "204"},
+		{":status", "206"},
+		{":status", "304"},
+		{":status", "400"},
+		{":status", "404"},
+		{":status", "500"},
+		{"accept-charset", ""},
+		{"accept-encoding", "gzip, deflate"},
+		{"accept-language", ""},
+		{"accept-ranges", ""},
+		{"accept", ""},
+		{"access-control-allow-origin", ""},
+		{"age", ""},
+		{"allow", ""},
+		{"authorization", ""},
+		{"cache-control", ""},
+		{"content-disposition", ""},
+		{"content-encoding", ""},
+		{"content-language", ""},
+		{"content-length", ""},
+		{"content-location", ""},
+		{"content-range", ""},
+		{"content-type", ""},
+		{"cookie", ""},
+		{"date", ""},
+		{"etag", ""},
+		{"expect", ""},
+		{"expires", ""},
+		{"from", ""},
+		{"host", ""},
+		{"if-match", ""},
+		{"if-modified-since", ""},
+		{"if-none-match", ""},
+		{"if-range", ""},
+		{"if-unmodified-since", ""},
+		{"last-modified", ""},
+		{"link", ""},
+		{"location", ""},
+		{"max-forwards", ""},
+		{"proxy-authenticate", ""},
+		{"proxy-authorization", ""},
+		{"range", ""},
+		{"referer", ""},
+		{"refresh", ""},
+		{"retry-after", ""},
+		{"server", ""},
+		{"set-cookie", ""},
+		{"strict-transport-security", ""},
+		{"transfer-encoding", ""},
+		{"user-agent", ""},
+		{"vary", ""},
+		{"via", ""},
+		{"www-authenticate", ""},
+	};
+
+	struct HuffmanCode
+	{
+		Poco::UInt32 code;
+		int bits;
+	};
+
+	const HuffmanCode HUFFMAN_CODES[257] =
+		// RFC 7541, Appendix B; the last entry is EOS.
+	{
+		{0x00001ff8, 13}, {0x007fffd8, 23}, {0x0fffffe2, 28}, {0x0fffffe3, 28},
+		{0x0fffffe4, 28}, {0x0fffffe5, 28}, {0x0fffffe6, 28}, {0x0fffffe7, 28},
+		{0x0fffffe8, 28}, {0x00ffffea, 24}, {0x3ffffffc, 30}, {0x0fffffe9, 28},
+		{0x0fffffea, 28}, {0x3ffffffd, 30}, {0x0fffffeb, 28}, {0x0fffffec, 28},
+		{0x0fffffed, 28}, {0x0fffffee, 28}, {0x0fffffef, 28}, {0x0ffffff0, 28},
+		{0x0ffffff1, 28}, {0x0ffffff2, 28}, {0x3ffffffe, 30}, {0x0ffffff3, 28},
+		{0x0ffffff4, 28}, {0x0ffffff5, 28}, {0x0ffffff6, 28}, {0x0ffffff7, 28},
+		{0x0ffffff8, 28}, {0x0ffffff9, 28}, {0x0ffffffa, 28}, {0x0ffffffb, 28},
+		{0x00000014,  6}, {0x000003f8, 10}, {0x000003f9, 10}, {0x00000ffa, 12},
+		{0x00001ff9, 13}, {0x00000015,  6}, {0x000000f8,  8}, {0x000007fa, 11},
+		{0x000003fa, 10}, {0x000003fb, 10}, {0x000000f9,  8}, {0x000007fb, 11},
+		{0x000000fa,  8}, {0x00000016,  6}, {0x00000017,  6}, {0x00000018,  6},
+		{0x00000000,  5}, {0x00000001,  5}, {0x00000002,  5}, {0x00000019,  6},
+		{0x0000001a,  6}, {0x0000001b,  6}, {0x0000001c,  6}, {0x0000001d,  6},
+		{0x0000001e,  6}, {0x0000001f,  6}, {0x0000005c,  7}, {0x000000fb,  8},
+		{0x00007ffc, 15}, {0x00000020,  6}, {0x00000ffb, 12}, {0x000003fc, 10},
+		{0x00001ffa, 13}, {0x00000021,  6}, {0x0000005d,  7}, {0x0000005e,  7},
+		{0x0000005f,  7}, {0x00000060,  7}, {0x00000061,  7}, {0x00000062,  7},
+		{0x00000063,  7}, {0x00000064,  7}, {0x00000065,  7}, {0x00000066,  7},
+		{0x00000067,  7}, {0x00000068,  7}, {0x00000069,  7}, {0x0000006a,  7},
+		{0x0000006b,  7}, {0x0000006c,  7}, {0x0000006d,  7}, {0x0000006e,  7},
+		{0x0000006f,  7}, {0x00000070,  7}, {0x00000071,  7}, {0x00000072,  7},
+		{0x000000fc,  8}, {0x00000073,  7}, {0x000000fd,  8}, {0x00001ffb, 13},
+		{0x0007fff0, 19}, {0x00001ffc, 13}, {0x00003ffc, 14}, {0x00000022,  6},
+		{0x00007ffd, 15}, {0x00000003,  5}, {0x00000023,  6}, {0x00000004,  5},
+		{0x00000024,  6}, {0x00000005,  5}, {0x00000025,  6}, {0x00000026,  6},
+		{0x00000027,  6}, {0x00000006,  5}, {0x00000074,  7}, {0x00000075,  7},
+		{0x00000028,  6}, {0x00000029,  6}, {0x0000002a,  6}, {0x00000007,  5},
+		{0x0000002b,  6}, {0x00000076,  7}, {0x0000002c,  6}, {0x00000008,  5},
+		{0x00000009,  5}, {0x0000002d,  6}, {0x00000077,  7}, {0x00000078,  7},
+		{0x00000079,  7}, {0x0000007a,  7}, {0x0000007b,  7}, {0x00007ffe, 15},
+		{0x000007fc, 11}, {0x00003ffd, 14}, {0x00001ffd, 13}, {0x0ffffffc, 28},
+		{0x000fffe6, 20}, {0x003fffd2, 22}, {0x000fffe7, 20}, {0x000fffe8, 20},
+		{0x003fffd3, 22}, {0x003fffd4, 22}, {0x003fffd5, 22}, {0x007fffd9, 23},
+		{0x003fffd6, 22}, {0x007fffda, 23}, {0x007fffdb, 23}, {0x007fffdc, 23},
+		{0x007fffdd, 23}, {0x007fffde, 23}, {0x00ffffeb, 24}, {0x007fffdf, 23},
+		{0x00ffffec, 24}, {0x00ffffed, 24}, {0x003fffd7, 22}, {0x007fffe0, 23},
+		{0x00ffffee, 24}, {0x007fffe1, 23}, {0x007fffe2, 23}, {0x007fffe3, 23},
+		{0x007fffe4, 23}, {0x001fffdc, 21}, {0x003fffd8, 22}, {0x007fffe5, 23},
+		{0x003fffd9, 22}, {0x007fffe6, 23}, {0x007fffe7, 23}, {0x00ffffef, 24},
+		{0x003fffda, 22}, {0x001fffdd, 21}, {0x000fffe9, 20}, {0x003fffdb, 22},
+		{0x003fffdc, 22}, {0x007fffe8, 23}, {0x007fffe9, 23}, {0x001fffde, 21},
+		{0x007fffea, 23}, {0x003fffdd, 22}, {0x003fffde, 22}, {0x00fffff0, 24},
+		{0x001fffdf, 21}, {0x003fffdf, 22}, {0x007fffeb, 23}, {0x007fffec, 23},
+		{0x001fffe0, 21}, {0x001fffe1, 21}, {0x003fffe0, 22}, {0x001fffe2, 21},
+		{0x007fffed, 23}, {0x003fffe1, 22}, {0x007fffee, 23}, {0x007fffef, 23},
+		{0x000fffea, 20}, {0x003fffe2, 22}, {0x003fffe3, 22}, {0x003fffe4, 22},
+		{0x007ffff0, 23}, {0x003fffe5, 22}, {0x003fffe6, 22}, {0x007ffff1, 23},
+		{0x03ffffe0, 26}, {0x03ffffe1, 26}, {0x000fffeb, 20}, {0x0007fff1, 19},
+		{0x003fffe7, 22}, {0x007ffff2, 23}, {0x003fffe8, 22}, {0x01ffffec, 25},
+		{0x03ffffe2, 26}, {0x03ffffe3, 26}, {0x03ffffe4, 26}, {0x07ffffde, 27},
+		{0x07ffffdf, 27}, {0x03ffffe5, 26}, {0x00fffff1, 24}, {0x01ffffed, 25},
+		{0x0007fff2, 19}, {0x001fffe3, 21}, {0x03ffffe6, 26}, {0x07ffffe0, 27},
+		{0x07ffffe1, 27}, {0x03ffffe7, 26}, {0x07ffffe2, 27}, {0x00fffff2, 24},
+		{0x001fffe4, 21}, {0x001fffe5, 21}, {0x03ffffe8, 26}, {0x03ffffe9, 26},
+		{0x0ffffffd, 28}, {0x07ffffe3, 27}, {0x07ffffe4, 27}, {0x07ffffe5, 27},
+		{0x000fffec, 20}, {0x00fffff3, 24}, {0x000fffed, 20}, {0x001fffe6, 21},
+		{0x003fffe9, 22}, {0x001fffe7, 21}, {0x001fffe8, 21}, {0x007ffff3, 23},
+		{0x003fffea, 22}, {0x003fffeb, 22}, {0x01ffffee, 25}, {0x01ffffef, 25},
+		{0x00fffff4, 24}, {0x00fffff5, 24}, {0x03ffffea, 26}, {0x007ffff4, 23},
+		{0x03ffffeb, 26}, {0x07ffffe6, 27}, {0x03ffffec, 26}, {0x03ffffed, 26},
+		{0x07ffffe7, 27}, {0x07ffffe8, 27}, {0x07ffffe9, 27}, {0x07ffffea, 27},
+		{0x07ffffeb, 27}, {0x0ffffffe, 28}, {0x07ffffec, 27}, {0x07ffffed, 27},
+		{0x07ffffee, 27}, {0x07ffffef, 27}, {0x07fffff0, 27}, {0x03ffffee, 26},
+		{0x3fffffff, 30},
+	};
+
+	const int EOS = 256;
+
+	class HuffmanTree
+		/// Binary decoding tree for the Huffman code, built once.
+	{
+	public:
+		struct Node
+		{
+			int child[2] = {0, 0};
+			int symbol = -1;
+		};
+
+		HuffmanTree():
+			_nodes(1)
+		{
+			for (int sym = 0; sym < 257; ++sym)
+			{
+				int node = 0;
+				for (int i = HUFFMAN_CODES[sym].bits - 1; i >= 0; --i)
+				{
+					int bit = (HUFFMAN_CODES[sym].code >> i) & 1;
+					if (_nodes[node].child[bit] == 0)
+					{
+						_nodes[node].child[bit] = static_cast<int>(_nodes.size());
+						_nodes.emplace_back();
+					}
+					node = _nodes[node].child[bit];
+				}
+				_nodes[node].symbol = sym;
+			}
+		}
+
+		const Node& operator [] (int index) const
+		{
+			return _nodes[index];
+		}
+
+	private:
+		std::vector<Node> _nodes;
+	};
+
+	const HuffmanTree& huffmanTree()
+	{
+		static const HuffmanTree tree;
+		return tree;
+	}
+
+	std::size_t huffmanLength(const std::string& s)
+	{
+		std::size_t bits = 0;
+		for (unsigned char c: s) bits += HUFFMAN_CODES[c].bits;
+		return (bits + 7)/8;
+	}
+
+	void huffmanEncode(const std::string& s, std::string& out)
+	{
+		Poco::UInt64 acc = 0;
+		int n = 0;
+		for (unsigned char c: s)
+		{
+			acc = (acc << HUFFMAN_CODES[c].bits) | HUFFMAN_CODES[c].code;
+			n += HUFFMAN_CODES[c].bits;
+			while (n >= 8)
+			{
+				n -= 8;
+				out += static_cast<char>(acc >> n);
+			}
+			acc &= (Poco::UInt64(1) << n) - 1;
+		}
+		if (n > 0)
+		{
+			// pad with the most significant bits of EOS
+			out += static_cast<char>((acc << (8 - n)) | (0xFF >> n));
+		}
+	}
+
+	void huffmanDecode(const unsigned char* it, const unsigned char* end, std::string& out)
+	{
+		const HuffmanTree& tree = huffmanTree();
+		int node = 0;
+		int depth = 0;
+		bool allOnes = true;
+		for (; it != end; ++it)
+		{
+			for (int i = 7; i >= 0; --i)
+			{
+				int bit = (*it >> i) & 1;
+				node = tree[node].child[bit];
+				if (node == 0) throw DataFormatException("Invalid Huffman code");
+				++depth;
+				allOnes = allOnes && bit;
+				int sym = tree[node].symbol;
+				if (sym >= 0)
+				{
+					if (sym == EOS) throw DataFormatException("EOS in Huffman-coded string");
+					out += static_cast<char>(sym);
+					node = 0;
+					depth = 0;
+					allOnes = true;
+				}
+			}
+		}
+		// padding must be shorter than 8 bits and consist of
+		// the most significant bits of EOS (all ones)
+		if (depth > 7 || !allOnes) throw DataFormatException("Invalid Huffman padding");
+	}
+
+	bool isSensitive(const std::string& name)
+	{
+		return name == "authorization" || name == "proxy-authorization" || name == "cookie" || name == "set-cookie";
+	}
+}
+
+
+//
+// HPACKTable
+//
+
+
+HPACKTable::HPACKTable(std::size_t maxSize):
+	_size(0),
+	_maxSize(maxSize)
+{
+}
+
+
+HPACKTable::~HPACKTable()
+{
+}
+
+
+const HPACKTable::Field& HPACKTable::at(std::size_t index) const
+{
+	if (index == 0) throw DataFormatException("Invalid header table index");
+	if (index <= STATIC_TABLE_SIZE)
+	{
+		static const std::vector<Field> staticFields = []()
+		{
+			std::vector<Field> fields;
+			fields.reserve(STATIC_TABLE_SIZE);
+			for (const auto& e: STATIC_TABLE) fields.emplace_back(e.name, e.value);
+			return fields;
+		}();
+		return staticFields[index - 1];
+	}
+	index -= STATIC_TABLE_SIZE + 1;
+	if (index >= _entries.size()) throw DataFormatException("Invalid header table index");
+	return _entries[index];
+}
+
+
+void HPACKTable::add(const std::string& name, const std::string& value)
+{
+	std::size_t entrySize = name.size() + value.size() + ENTRY_OVERHEAD;
+	if (entrySize > _maxSize)
+	{
+		evict(0);
+	}
+	else
+	{
+		evict(_maxSize - entrySize);
+		_entries.emplace_front(name, value);
+		_size += entrySize;
+	}
+}
+
+
+std::size_t HPACKTable::find(const std::string& name, const std::string& value, bool& valueMatch) const
+{
+	std::size_t nameIndex = 0;
+	valueMatch = false;
+	for (std::size_t i = 0; i < STATIC_TABLE_SIZE; ++i)
+	{
+		if (name == STATIC_TABLE[i].name)
+		{
+			if (value == STATIC_TABLE[i].value)
+			{
+				valueMatch = true;
+				return i + 1;
+			}
+			if (nameIndex == 0) nameIndex = i + 1;
+		}
+	}
+	for (std::size_t i = 0; i < _entries.size(); ++i)
+	{
+		if (_entries[i].first == name)
+		{
+			if (_entries[i].second == value)
+			{
+				valueMatch = true;
+				return i + STATIC_TABLE_SIZE + 1;
+			}
+			if (nameIndex == 0) nameIndex = i + STATIC_TABLE_SIZE + 1;
+		}
+	}
+	return nameIndex;
+}
+
+
+void HPACKTable::setMaxSize(std::size_t maxSize)
+{
+	_maxSize = maxSize;
+	evict(maxSize);
+}
+
+
+void HPACKTable::evict(std::size_t maxSize)
+{
+	while (_size > maxSize && !_entries.empty())
+	{
+		const Field& f = _entries.back();
+		_size -= f.first.size() + f.second.size() + ENTRY_OVERHEAD;
+		_entries.pop_back();
+	}
+}
+
+
+//
+// HPACKEncoder
+//
+
+
+HPACKEncoder::HPACKEncoder(std::size_t maxTableSize):
+	_table(maxTableSize),
+	_pendingSizeUpdate(0),
+	_sizeUpdatePending(false)
+{
+}
+
+
+HPACKEncoder::~HPACKEncoder()
+{
+}
+
+
+void HPACKEncoder::encode(const std::string& name, const std::string& value, std::string& block)
+{
+	if (_sizeUpdatePending)
+	{
+		encodeInteger(_pendingSizeUpdate, 5, 0x20, block);
+		_sizeUpdatePending = false;
+	}
+
+	bool valueMatch;
+	std::size_t index = _table.find(name, value, valueMatch);
+	if (valueMatch)
+	{
+		// indexed header field
+		encodeInteger(index, 7, 0x80, block);
+	}
+	else if (isSensitive(name))
+	{
+		// literal header field never indexed
+		encodeInteger(index, 4, 0x10, block);
+		if (index == 0) encodeString(name, block);
+		encodeString(value, block);
+	}
+	else
+	{
+		// literal header field with incremental indexing
+		encodeInteger(index, 6, 0x40, block);
+		if (index == 0) encodeString(name, block);
+		encodeString(value, block);
+		_table.add(name, value);
+	}
+}
+
+
+void HPACKEncoder::setMaxTableSize(std::size_t maxSize)
+{
+	if (maxSize != _table.maxSize())
+	{
+		_table.setMaxSize(maxSize);
+		_pendingSizeUpdate = maxSize;
+		_sizeUpdatePending = true;
+	}
+}
+
+
+void HPACKEncoder::encodeInteger(std::size_t value, int prefixBits, unsigned char flags, std::string& block)
+{
+	std::size_t maxPrefix = (std::size_t(1) << prefixBits) - 1;
+	if (value < maxPrefix)
+	{
+		block += static_cast<char>(flags | value);
+	}
+	else
+	{
+		block += static_cast<char>(flags | maxPrefix);
+		value -= maxPrefix;
+		while (value >= 128)
+		{
+			block += static_cast<char>((value & 0x7F) | 0x80);
+			value >>= 7;
+		}
+		block += static_cast<char>(value);
+	}
+}
+
+
+void HPACKEncoder::encodeString(const std::string& s, std::string& block)
+{
+	std::size_t huffLen = huffmanLength(s);
+	if (huffLen < s.size())
+	{
+		encodeInteger(huffLen, 7, 0x80, block);
+		huffmanEncode(s, block);
+	}
+	else
+	{
+		encodeInteger(s.size(), 7, 0, block);
+		block += s;
+	}
+}
+
+
+//
+// HPACKDecoder
+//
+
+
+HPACKDecoder::HPACKDecoder(std::size_t maxTableSize):
+	_table(maxTableSize),
+	_maxTableSize(maxTableSize),
+	_maxHeaderListSize(0)
+{
+}
+
+
+HPACKDecoder::~HPACKDecoder()
+{
+}
+
+
+void HPACKDecoder::decode(const char* block, std::size_t length, NameValueCollection& fields)
+{
+	const unsigned char* it  = reinterpret_cast<const unsigned char*>(block);
+	const unsigned char* end = it + length;
+	std::size_t listSize = 0;
+	bool fieldSeen = false;
+	while (it != end)
+	{
+		unsigned char c = *it;
+		std::string name;
+		std::string value;
+		if (c & 0x80)
+		{
+			// indexed header field
+			std::size_t index = decodeInteger(it, end, 7);
+			const HPACKTable::Field& f = _table.at(index);
+			name  = f.first;
+			value = f.second;
+		}
+		else if ((c & 0xE0) == 0x20)
+		{
+			// dynamic table size update, only allowed at the beginning of a block
+			if (fieldSeen) throw DataFormatException("Misplaced dynamic table size update");
+			std::size_t size = decodeInteger(it, end, 5);
+			if (size > _maxTableSize) throw DataFormatException("Dynamic table size update exceeds limit");
+			_table.setMaxSize(size);
+			continue;
+		}
+		else
+		{
+			// literal header field: with incremental indexing (01xxxxxx),
+			// without indexing (0000xxxx) or never indexed (0001xxxx)
+			bool indexing = (c & 0xC0) == 0x40;
+			std::size_t index = decodeInteger(it, end, indexing ? 6 : 4);
+			if (index == 0)
+				name = decodeString(it, end);
+			else
+				name = _table.at(index).first;
+			value = decodeString(it, end);
+			if (indexing) _table.add(name, value);
+		}
+		fieldSeen = true;
+		listSize += name.size() + value.size() + HPACKTable::ENTRY_OVERHEAD;
+		if (_maxHeaderListSize > 0 && listSize > _maxHeaderListSize)
+			throw DataFormatException("Header list too large");
+		fields.add(name, value);
+	}
+}
+
+
+void HPACKDecoder::setMaxHeaderListSize(std::size_t size)
+{
+	_maxHeaderListSize = size;
+}
+
+
+std::size_t HPACKDecoder::decodeInteger(const unsigned char*& it, const unsigned char* end, int prefixBits)
+{
+	if (it == end) throw DataFormatException("Truncated integer");
+	std::size_t maxPrefix = (std::size_t(1) << prefixBits) - 1;
+	std::size_t value = *it++ & maxPrefix;
+	if (value < maxPrefix) return value;
+
+	int shift = 0;
+	while (true)
+	{
+		if (it == end) throw DataFormatException("Truncated integer");
+		if (shift > 28) throw DataFormatException("Integer overflow");
+		unsigned char c = *it++;
+		value += std::size_t(c & 0x7F) << shift;
+		shift += 7;
+		if ((c & 0x80) == 0) break;
+	}
+	return value;
+}
+
+
+std::string HPACKDecoder::decodeString(const unsigned char*& it, const unsigned char* end)
+{
+	if (it == end) throw DataFormatException("Truncated string literal");
+	bool huffman = (*it & 0x80) != 0;
+	std::size_t length = decodeInteger(it, end, 7);
+	if (length > static_cast<std::size_t>(end - it)) throw DataFormatException("Truncated string literal");
+	std::string s;
+	if (huffman)
+	{
+		s.reserve(length + length/2);
+		huffmanDecode(it, it + length, s);
+	}
+	else
+	{
+		s.assign(reinterpret_cast<const char*>(it), length);
+	}
+	it += length;
+	return s;
+}
+
+
+} // namespace Poco::Net
@@ -0,0 +1,1353 @@
+//
+// HTTP2ServerSession.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTP2ServerSession
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/BufferedStreamBuf.h"
+#include "Poco/NullStream.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Timestamp.h"
+#include "Poco/String.h"
+#include "Poco/Ascii.h"
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	enum FrameType
+	{
+		FRAME_DATA          = 0x0,
+		FRAME_HEADERS       = 0x1,
+		FRAME_PRIORITY      = 0x2,
+		FRAME_RST_STREAM    = 0x3,
+		FRAME_SETTINGS      = 0x4,
+		FRAME_PUSH_PROMISE  = 0x5,
+		FRAME_PING          = 0x6,
+		FRAME_GOAWAY        = 0x7,
+		FRAME_WINDOW_UPDATE = 0x8,
+		FRAME_CONTINUATION  = 0x9
+	};
+
+	enum FrameFlags
+	{
+		FLAG_ACK         = 0x01,
+		FLAG_END_STREAM  = 0x01,
+		FLAG_END_HEADERS = 0x04,
+		FLAG_PADDED      = 0x08,
+		FLAG_PRIORITY    = 0x20
+	};
+
+	enum Setting
+	{
+		SETTINGS_HEADER_TABLE_SIZE      = 0x1,
+		SETTINGS_ENABLE_PUSH            = 0x2,
+		SETTINGS_MAX_CONCURRENT_STREAMS = 0x3,
+		SETTINGS_INITIAL_WINDOW_SIZE    = 0x4,
+		SETTINGS_MAX_FRAME_SIZE         = 0x5,
+		SETTINGS_MAX_HEADER_LIST_SIZE   = 0x6
+	};
+
+	const std::size_t  FRAME_HEADER_SIZE      = 9;
+	const std::size_t  DEFAULT_MAX_FRAME_SIZE = 16384;
+	const std::size_t  MAX_HEADER_LIST_SIZE   = 65536;
+	const Poco::Int64  DEFAULT_WINDOW_SIZE    = 65535;
+	const Poco::Int64  CONNECTION_WINDOW_SIZE = 1048576;
+	const Poco::Int64  MAX_WINDOW_SIZE        = 0x7FFFFFFF;
+	const long         POLL_INTERVAL          = 200000;
+
+	inline Poco::UInt32 read32(const char* p)
+	{
+		const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+		return (Poco::UInt32(u[0]) << 24) | (Poco::UInt32(u[1]) << 16) | (Poco::UInt32(u[2]) << 8) | u[3];
+	}
+
+	inline void append32(std::string& out, Poco::UInt32 value)
+	{
+		out += static_cast<char>(value >> 24);
+		out += static_cast<char>(value >> 16);
+		out += static_cast<char>(value >> 8);
+		out += static_cast<char>(value);
+	}
+
+	inline void appendSetting(std::string& out, int id, Poco::UInt32 value)
+	{
+		out += static_cast<char>(id >> 8);
+		out += static_cast<char>(id);
+		append32(out, value);
+	}
+
+	void appendFrame(std::string& out, int type, int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+	{
+		out += static_cast<char>(length >> 16);
+		out += static_cast<char>(length >> 8);
+		out += static_cast<char>(length);
+		out += static_cast<char>(type);
+		out += static_cast<char>(flags);
+		append32(out, streamId & 0x7FFFFFFF);
+		if (length > 0) out.append(payload, length);
+	}
+
+	bool isConnectionSpecific(const std::string& name)
+		/// Connection-specific header fields (RFC 9113, section 8.2.2).
+	{
+		return name == "connection" || name == "keep-alive" || name == "proxy-connection" || name == "transfer-encoding" || name == "upgrade";
+	}
+}
+
+
+//
+// HTTP2ServerSession::Stream
+//
+
+
+class HTTP2ServerSession::Stream: public Poco::Runnable
+{
+public:
+	Stream(HTTP2ServerSession& session, Poco::UInt32 id, Poco::Int64 sendWindow):
+		session(session),
+		id(id),
+		contentLength(-1),
+		received(0),
+		dataPos(0),
+		endStream(false),
+		reset(false),
+		sendWindow(sendWindow),
+		recvWindow(DEFAULT_WINDOW_SIZE),
+		consumed(0)
+	{
+	}
+
+	void run()
+	{
+		session.runStream(*this);
+	}
+
+	HTTP2ServerSession& session;
+	Poco::UInt32        id;
+
+	// set up by the reader thread before the handler is started
+	std::string         method;
+	std::string         uri;
+	NameValueCollection fields;
+	Poco::Int64         contentLength;
+	Poco::Int64         received;
+
+	// guarded by the session mutex
+	std::string         data;
+	std::size_t         dataPos;
+	bool                endStream;
+	bool                reset;
+	Poco::Int64         sendWindow;
+	Poco::Int64         recvWindow;
+	Poco::Int64         consumed;
+};
+
+
+//
+// HTTP2ServerSession::RequestStreamBuf
+//
+
+
+class HTTP2ServerSession::RequestStreamBuf: public Poco::BufferedStreamBuf
+{
+public:
+	RequestStreamBuf(Stream& stream):
+		Poco::BufferedStreamBuf(DEFAULT_MAX_FRAME_SIZE, std::ios::in),
+		_stream(stream)
+	{
+	}
+
+private:
+	std::streamsize readFromDevice(char* buffer, std::streamsize length) override
+	{
+		return _stream.session.receiveData(_stream, buffer, static_cast<std::size_t>(length));
+	}
+
+	Stream& _stream;
+};
+
+
+//
+// HTTP2ServerSession::ResponseStreamBuf
+//
+
+
+class HTTP2ServerSession::ResponseStreamBuf: public Poco::BufferedStreamBuf
+{
+public:
+	ResponseStreamBuf(Stream& stream):
+		Poco::BufferedStreamBuf(DEFAULT_MAX_FRAME_SIZE, std::ios::out),
+		_stream(stream),
+		_last(false)
+	{
+	}
+
+	void close()
+		/// Sends all buffered data, together with the END_STREAM flag.
+	{
+		_last = true;
+		if (pptr() > pbase())
+		{
+			if (sync() == 0) return;
+		}
+		_stream.session.sendData(_stream, nullptr, 0, true);
+	}
+
+private:
+	std::streamsize writeToDevice(const char* buffer, std::streamsize length) override
+	{
+		_stream.session.sendData(_stream, buffer, static_cast<std::size_t>(length), _last);
+		return length;
+	}
+
+	Stream& _stream;
+	bool    _last;
+};
+
+
+//
+// HTTP2ServerSession::Response
+//
+
+
+class HTTP2ServerSession::Response: public HTTPServerResponse
+{
+public:
+	Response(Stream& stream):
+		_stream(stream),
+		_buf(stream),
+		_ostr(&_buf),
+		_pStream(nullptr),
+		_pRequest(nullptr),
+		_hasBody(false)
+	{
+		setVersion(HTTPMessage::HTTP_2_0);
+	}
+
+	~Response()
+	{
+		if (_pStream != &_ostr) delete _pStream;
+	}
+
+	void sendContinue() override
+	{
+		NameValueCollection none;
+		_stream.session.sendHeaders(_stream, HTTP_CONTINUE, none, false);
+	}
+
+	std::ostream& send() override
+	{
+		poco_assert (!_pStream);
+
+		bool noBody =
+			(_pRequest && _pRequest->getMethod() == HTTPRequest::HTTP_HEAD) ||
+			getStatus() < 200 ||
+			getStatus() == HTTPResponse::HTTP_NO_CONTENT ||
+			getStatus() == HTTPResponse::HTTP_NOT_MODIFIED;
+		bool emptyBody = noBody || (hasContentLength() && getContentLength64() == 0);
+		_stream.session.sendHeaders(_stream, getStatus(), *this, emptyBody);
+		if (emptyBody)
+		{
+			_pStream = new Poco::NullOutputStream;
+		}
+		else
+		{
+			_pStream = &_ostr;
+			_hasBody = true;
+		}
+		return *_pStream;
+	}
+
+	void sendFile(const std::string& path, const std::string& mediaType) override
+	{
+		poco_assert (!_pStream);
+
+		Poco::File f(path);
+		Poco::Timestamp dateTime = f.getLastModified();
+		Poco::File::FileSize length = f.getSize();
+		set("Last-Modified"s, Poco::DateTimeFormatter::format(dateTime, Poco::DateTimeFormat::HTTP_FORMAT));
+		setContentLength64(length);
+		setContentType(mediaType);
+		setChunkedTransferEncoding(false);
+
+		Poco::FileInputStream istr(path);
+		if (istr.good())
+		{
+			std::ostream& ostr = send();
+			if (_hasBody) Poco::StreamCopier::copyStream(istr, ostr);
+		}
+		else throw OpenFileException(path);
+	}
+
+	void sendBuffer(const void* pBuffer, std::size_t length) override
+	{
+		poco_assert (!_pStream);
+
+		setContentLength64(length);
+		setChunkedTransferEncoding(false);
+
+		std::ostream& ostr = send();
+		if (_hasBody) ostr.write(static_cast<const char*>(pBuffer), static_cast<std::streamsize>(length));
+	}
+
+	void redirect(const std::string& uri, HTTPStatus status) override
+	{
+		poco_assert (!_pStream);
+
+		setContentLength(0);
+		setChunkedTransferEncoding(false);
+
+		setStatusAndReason(status);
+		set("Location"s, uri);
+		send();
+	}
+
+	void requireAuthentication(const std::string& realm) override
+	{
+		poco_assert (!_pStream);
+
+		setStatusAndReason(HTTPResponse::HTTP_UNAUTHORIZED);
+		std::string auth("Basic realm=\"");
+		auth.append(realm);
+		auth.append("\"");
+		set("WWW-Authenticate"s, auth);
+	}
+
+	bool sent() const override
+	{
+		return _pStream != nullptr;
+	}
+
+	void attachRequest(const HTTPRequest* pRequest)
+	{
+		_pRequest = pRequest;
+	}
+
+	void finish()
+		/// Completes the response after the handler has returned,
+		/// sending the response header if the handler has not done
+		/// so, and the END_STREAM flag.
+	{
+		if (!_pStream)
+		{
+			if (!hasContentLength() && !getChunkedTransferEncoding()) setContentLength(0);
+			send();
+		}
+		if (_hasBody) _buf.close();
+	}
+
+private:
+	Stream&            _stream;
+	ResponseStreamBuf  _buf;
+	std::ostream       _ostr;
+	std::ostream*      _pStream;
+	const HTTPRequest* _pRequest;
+	bool               _hasBody;
+};
+
+
+//
+// HTTP2ServerSession::Request
+//
+
+
+class HTTP2ServerSession::Request: public HTTPServerRequest
+{
+public:
+	Request(Stream& stream, Response& response):
+		_stream(stream),
+		_response(response),
+		_buf(stream),
+		_istr(&_buf)
+	{
+		response.attachRequest(this);
+
+		setMethod(stream.method);
+		setURI(stream.uri);
+		setVersion(HTTPMessage::HTTP_2_0);
+		for (const auto& f: stream.fields)
+		{
+			add(f.first, f.second);
+		}
+	}
+
+	std::istream& stream() override
+	{
+		return _istr;
+	}
+
+	const SocketAddress& clientAddress() const override
+	{
+		return _stream.session._clientAddress;
+	}
+
+	const SocketAddress& serverAddress() const override
+	{
+		return _stream.session._serverAddress;
+	}
+
+	const HTTPServerParams& serverParams() const override
+	{
+		return *_stream.session._pParams;
+	}
+
+	HTTPServerResponse& response() const override
+	{
+		return _response;
+	}
+
+	bool secure() const override
+	{
+		return _stream.session._socket.secure();
+	}
+
+private:
+	Stream&          _stream;
+	Response&        _response;
+	RequestStreamBuf _buf;
+	std::istream     _istr;
+};
+
+
+//
+// HTTP2ServerSession
+//
+
+
+const std::string HTTP2ServerSession::CONNECTION_PREFACE("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n");
+
+
+HTTP2ServerSession::HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool):
+	_socket(socket),
+	_pParams(pParams),
+	_pFactory(pFactory),
+	_threadPool(threadPool),
+	_clientAddress(socket.peerAddress()),
+	_serverAddress(socket.address()),
+	_inBuffer(2*(FRAME_HEADER_SIZE + DEFAULT_MAX_FRAME_SIZE)),
+	_inPos(0),
+	_inEnd(0),
+	_continuationStreamId(0),
+	_continuationEndStream(false),
+	_lastStreamId(0),
+	_acceptedStreams(0),
+	_settingsReceived(false),
+	_connRecvConsumed(0),
+	_connRecvWindow(CONNECTION_WINDOW_SIZE),
+	_connSendWindow(DEFAULT_WINDOW_SIZE),
+	_peerInitialWindowSize(DEFAULT_WINDOW_SIZE),
+	_activeHandlers(0),
+	_closed(false),
+	_peerMaxFrameSize(DEFAULT_MAX_FRAME_SIZE),
+	_goAwaySent(false),
+	_goAwayReceived(false)
+{
+	poco_check_ptr (pParams);
+	poco_check_ptr (pFactory);
+
+	_decoder.setMaxHeaderListSize(MAX_HEADER_LIST_SIZE);
+}
+
+
+HTTP2ServerSession::~HTTP2ServerSession()
+{
+}
+
+
+bool HTTP2ServerSession::isPreface(const char* buffer, std::size_t length)
+{
+	return length >= CONNECTION_PREFACE.size() && std::memcmp(buffer, CONNECTION_PREFACE.data(), CONNECTION_PREFACE.size()) == 0;
+}
+
+
+void HTTP2ServerSession::run()
+{
+	try
+	{
+		_socket.setSendTimeout(_pParams->getTimeout());
+		// frames are small and latency-sensitive (SETTINGS, WINDOW_UPDATE, PING)
+		_socket.setNoDelay(true);
+
+		std::string settings;
+		appendSetting(settings, SETTINGS_MAX_CONCURRENT_STREAMS, _pParams->getHTTP2MaxConcurrentStreams());
+		appendSetting(settings, SETTINGS_MAX_HEADER_LIST_SIZE, MAX_HEADER_LIST_SIZE);
+		std::string increment;
+		append32(increment, static_cast<Poco::UInt32>(CONNECTION_WINDOW_SIZE - DEFAULT_WINDOW_SIZE));
+		std::string frames;
+		appendFrame(frames, FRAME_SETTINGS, 0, 0, settings.data(), settings.size());
+		appendFrame(frames, FRAME_WINDOW_UPDATE, 0, 0, increment.data(), increment.size());
+		{
+			Poco::FastMutex::ScopedLock lock(_sendMutex);
+			sendFrames(frames);
+		}
+
+		if (!fill(CONNECTION_PREFACE.size(), true) || !isPreface(_inBuffer.data() + _inPos, _inEnd - _inPos))
+			throw HTTP2Exception("Invalid connection preface", H2_PROTOCOL_ERROR);
+		_inPos += CONNECTION_PREFACE.size();
+
+		while (readFrame())
+		{
+		}
+	}
+	catch (HTTP2Exception& exc)
+	{
+		try
+		{
+			sendGoAway(static_cast<ErrorCode>(exc.code()));
+		}
+		catch (...)
+		{
+		}
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	close();
+}
+
+
+bool HTTP2ServerSession::readFrame()
+{
+	if (!fill(FRAME_HEADER_SIZE, true)) return false;
+
+	const char* header = _inBuffer.data() + _inPos;
+	std::size_t length = (std::size_t(static_cast<unsigned char>(header[0])) << 16) | (std::size_t(static_cast<unsigned char>(header[1])) << 8) | static_cast<unsigned char>(header[2]);
+	int type  = static_cast<unsigned char>(header[3]);
+	int flags = static_cast<unsigned char>(header[4]);
+	Poco::UInt32 streamId = read32(header + 5) & 0x7FFFFFFF;
+	if (length > DEFAULT_MAX_FRAME_SIZE) throw HTTP2Exception("Frame too large", H2_FRAME_SIZE_ERROR);
+
+	fill(FRAME_HEADER_SIZE + length, false);
+	processFrame(type, flags, streamId, _inBuffer.data() + _inPos + FRAME_HEADER_SIZE, length);
+	_inPos += FRAME_HEADER_SIZE + length;
+	return true;
+}
+
+
+bool HTTP2ServerSession::fill(std::size_t n, bool frameStart)
+{
+	Poco::Timestamp idleSince;
+	while (_inEnd - _inPos < n)
+	{
+		if (_inPos > 0)
+		{
+			std::memmove(_inBuffer.data(), _inBuffer.data() + _inPos, _inEnd - _inPos);
+			_inEnd -= _inPos;
+			_inPos = 0;
+		}
+		if (_socket.available() == 0 && !_socket.poll(Poco::Timespan(POLL_INTERVAL), Socket::SELECT_READ | Socket::SELECT_ERROR))
+		{
+			startPending();
+			if (frameStart && _inEnd == 0)
+			{
+				if (shouldClose()) return false;
+
+				bool idle;
+				{
+					Poco::FastMutex::ScopedLock lock(_mutex);
+					idle = _streams.empty();
+				}
+				if (!idle)
+				{
+					idleSince.update();
+				}
+				else if (idleSince.isElapsed(_pParams->getKeepAliveTimeout().totalMicroseconds()))
+				{
+					sendGoAway(H2_NO_ERROR);
+					return false;
+				}
+			}
+			else if (idleSince.isElapsed(_pParams->getTimeout().totalMicroseconds()))
+			{
+				throw TimeoutException("Timeout waiting for HTTP/2 frame");
+			}
+			continue;
+		}
+		int rc = _socket.receiveBytes(_inBuffer.data() + _inEnd, static_cast<int>(_inBuffer.size() - _inEnd));
+		if (rc <= 0)
+		{
+			if (frameStart && _inEnd == 0) return false;
+			throw ConnectionResetException("Connection closed within HTTP/2 frame");
+		}
+		_inEnd += rc;
+	}
+	return true;
+}
+
+
+void HTTP2ServerSession::processFrame(int type, int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (_continuationStreamId != 0 && type != FRAME_CONTINUATION)
+		throw HTTP2Exception("CONTINUATION frame expected", H2_PROTOCOL_ERROR);
+	if (!_settingsReceived && type != FRAME_SETTINGS)
+		throw HTTP2Exception("SETTINGS frame expected", H2_PROTOCOL_ERROR);
+
+	switch (type)
+	{
+	case FRAME_DATA:
+		onData(flags, streamId, payload, length);
+		break;
+	case FRAME_HEADERS:
+		onHeaders(flags, streamId, payload, length);
+		break;
+	case FRAME_PRIORITY:
+		if (streamId == 0) throw HTTP2Exception("PRIORITY frame on stream 0", H2_PROTOCOL_ERROR);
+		if (length != 5) resetStream(streamId, H2_FRAME_SIZE_ERROR);
+		break;
+	case FRAME_RST_STREAM:
+		onResetStream(streamId, payload, length);
+		break;
+	case FRAME_SETTINGS:
+		onSettings(flags, streamId, payload, length);
+		break;
+	case FRAME_PUSH_PROMISE:
+		throw HTTP2Exception("PUSH_PROMISE frame from client", H2_PROTOCOL_ERROR);
+	case FRAME_PING:
+		if (streamId != 0) throw HTTP2Exception("PING frame on stream", H2_PROTOCOL_ERROR);
+		if (length != 8) throw HTTP2Exception("Invalid PING frame", H2_FRAME_SIZE_ERROR);
+		if ((flags & FLAG_ACK) == 0) writeFrame(FRAME_PING, FLAG_ACK, 0, payload, length);
+		break;
+	case FRAME_GOAWAY:
+		if (streamId != 0) throw HTTP2Exception("GOAWAY frame on stream", H2_PROTOCOL_ERROR);
+		if (length < 8) throw HTTP2Exception("Invalid GOAWAY frame", H2_FRAME_SIZE_ERROR);
+		_goAwayReceived = true;
+		break;
+	case FRAME_WINDOW_UPDATE:
+		onWindowUpdate(streamId, payload, length);
+		break;
+	case FRAME_CONTINUATION:
+		onContinuation(flags, streamId, payload, length);
+		break;
+	default:
+		// unknown frame types must be ignored
+		break;
+	}
+}
+
+
+void HTTP2ServerSession::onData(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (streamId == 0) throw HTTP2Exception("DATA frame on stream 0", H2_PROTOCOL_ERROR);
+	if (streamId > _lastStreamId) throw HTTP2Exception("DATA frame on idle stream", H2_PROTOCOL_ERROR);
+
+	std::size_t padding = 0;
+	std::size_t offset = 0;
+	if (flags & FLAG_PADDED)
+	{
+		if (length < 1) throw HTTP2Exception("Invalid DATA frame", H2_FRAME_SIZE_ERROR);
+		padding = static_cast<unsigned char>(payload[0]);
+		offset = 1;
+		if (padding >= length) throw HTTP2Exception("Invalid padding", H2_PROTOCOL_ERROR);
+	}
+
+	// the entire frame payload counts against the flow control windows
+	_connRecvWindow -= length;
+	if (_connRecvWindow < 0) throw HTTP2Exception("Connection flow control window exceeded", H2_FLOW_CONTROL_ERROR);
+	_connRecvConsumed += length;
+	if (_connRecvConsumed >= CONNECTION_WINDOW_SIZE/2)
+	{
+		sendWindowUpdate(0, static_cast<Poco::UInt32>(_connRecvConsumed));
+		_connRecvWindow += _connRecvConsumed;
+		_connRecvConsumed = 0;
+	}
+
+	ErrorCode error = H2_NO_ERROR;
+	Poco::UInt32 windowUpdate = 0;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		auto it = _streams.find(streamId);
+		if (it == _streams.end()) return; // stream has been closed or reset by us
+		Stream& stream = *it->second;
+		if (stream.reset) return;
+		if (stream.endStream)
+		{
+			error = H2_STREAM_CLOSED;
+		}
+		else if (static_cast<Poco::Int64>(length) > stream.recvWindow)
+		{
+			error = H2_FLOW_CONTROL_ERROR;
+		}
+		else
+		{
+			std::size_t dataLength = length - offset - padding;
+			stream.recvWindow -= length;
+			stream.received += dataLength;
+			if (stream.contentLength >= 0 && (stream.received > stream.contentLength || ((flags & FLAG_END_STREAM) && stream.received != stream.contentLength)))
+			{
+				error = H2_PROTOCOL_ERROR;
+			}
+			else
+			{
+				stream.data.append(payload + offset, dataLength);
+				stream.consumed += offset + padding;
+				if (flags & FLAG_END_STREAM) stream.endStream = true;
+				if (stream.consumed >= DEFAULT_WINDOW_SIZE/2 && !stream.endStream)
+				{
+					windowUpdate = static_cast<Poco::UInt32>(stream.consumed);
+					stream.recvWindow += stream.consumed;
+					stream.consumed = 0;
+				}
+				_cond.broadcast();
+			}
+		}
+	}
+	if (error != H2_NO_ERROR)
+		resetStream(streamId, error);
+	else if (windowUpdate > 0)
+		sendWindowUpdate(streamId, windowUpdate);
+}
+
+
+void HTTP2ServerSession::onHeaders(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (streamId == 0) throw HTTP2Exception("HEADERS frame on stream 0", H2_PROTOCOL_ERROR);
+
+	std::size_t padding = 0;
+	std::size_t offset = 0;
+	if (flags & FLAG_PADDED)
+	{
+		if (length < 1) throw HTTP2Exception("Invalid HEADERS frame", H2_FRAME_SIZE_ERROR);
+		padding = static_cast<unsigned char>(payload[0]);
+		offset = 1;
+	}
+	if (flags & FLAG_PRIORITY)
+	{
+		offset += 5;
+	}
+	if (offset + padding > length) throw HTTP2Exception("Invalid HEADERS frame", H2_PROTOCOL_ERROR);
+
+	_headerBlock.assign(payload + offset, length - offset - padding);
+	if (flags & FLAG_END_HEADERS)
+	{
+		onHeaderBlock(streamId, (flags & FLAG_END_STREAM) != 0);
+	}
+	else
+	{
+		_continuationStreamId  = streamId;
+		_continuationEndStream = (flags & FLAG_END_STREAM) != 0;
+	}
+}
+
+
+void HTTP2ServerSession::onContinuation(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (_continuationStreamId == 0 || streamId != _continuationStreamId)
+		throw HTTP2Exception("Unexpected CONTINUATION frame", H2_PROTOCOL_ERROR);
+	if (_headerBlock.size() + length > MAX_HEADER_LIST_SIZE)
+		throw HTTP2Exception("Header block too large", H2_ENHANCE_YOUR_CALM);
+
+	_headerBlock.append(payload, length);
+	if (flags & FLAG_END_HEADERS)
+	{
+		_continuationStreamId = 0;
+		onHeaderBlock(streamId, _continuationEndStream);
+	}
+}
+
+
+void HTTP2ServerSession::onHeaderBlock(Poco::UInt32 streamId, bool endStream)
+{
+	// the header block must be decoded even if the stream is refused,
+	// to keep the decoder state in sync with the client's encoder
+	NameValueCollection fields;
+	try
+	{
+		_decoder.decode(_headerBlock.data(), _headerBlock.size(), fields);
+	}
+	catch (Poco::DataFormatException& exc)
+	{
+		throw HTTP2Exception("HPACK", exc.message(), H2_COMPRESSION_ERROR);
+	}
+
+	if (streamId <= _lastStreamId)
+	{
+		// trailer section, which is discarded
+		ErrorCode error = H2_NO_ERROR;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			auto it = _streams.find(streamId);
+			if (it == _streams.end() || it->second->reset) return;
+			Stream& stream = *it->second;
+			if (stream.endStream)
+			{
+				error = H2_STREAM_CLOSED;
+			}
+			else if (!endStream || (stream.contentLength >= 0 && stream.received != stream.contentLength))
+			{
+				error = H2_PROTOCOL_ERROR;
+			}
+			else
+			{
+				stream.endStream = true;
+				_cond.broadcast();
+			}
+		}
+		if (error != H2_NO_ERROR) resetStream(streamId, error);
+		return;
+	}
+
+	if ((streamId & 1) == 0) throw HTTP2Exception("Invalid stream identifier", H2_PROTOCOL_ERROR);
+	_lastStreamId = streamId;
+
+	StreamPtr pStream;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (!_goAwaySent && !_goAwayReceived && _streams.size() < static_cast<std::size_t>(_pParams->getHTTP2MaxConcurrentStreams()))
+			pStream = std::make_shared<Stream>(*this, streamId, _peerInitialWindowSize);
+	}
+	if (!pStream)
+	{
+		resetStream(streamId, H2_REFUSED_STREAM);
+		return;
+	}
+
+	if (!buildRequest(fields, *pStream) || (endStream && pStream->contentLength > 0))
+	{
+		resetStream(streamId, H2_PROTOCOL_ERROR);
+		return;
+	}
+	pStream->endStream = endStream;
+
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_streams[streamId] = pStream;
+		++_activeHandlers;
+		_pending.push_back(pStream);
+	}
+	startPending();
+
+	++_acceptedStreams;
+	if (_pParams->getMaxKeepAliveRequests() > 0 && _acceptedStreams >= _pParams->getMaxKeepAliveRequests())
+	{
+		sendGoAway(H2_NO_ERROR);
+	}
+}
+
+
+bool HTTP2ServerSession::buildRequest(const NameValueCollection& fields, Stream& stream)
+{
+	std::string scheme;
+	std::string path;
+	std::string authority;
+	std::string cookie;
+	bool regularSeen = false;
+	for (const auto& f: fields)
+	{
+		const std::string& name = f.first;
+		if (name.empty()) return false;
+		for (char c: name)
+		{
+			if (Poco::Ascii::isUpper(c)) return false;
+		}
+		if (name[0] == ':')
+		{
+			if (regularSeen) return false;
+			std::string* pValue;
+			if (name == ":method")
+				pValue = &stream.method;
+			else if (name == ":path")
+				pValue = &path;
+			else if (name == ":scheme")
+				pValue = &scheme;
+			else if (name == ":authority")
+				pValue = &authority;
+			else
+				return false;
+			if (!pValue->empty()) return false;
+			*pValue = f.second;
+		}
+		else
+		{
+			regularSeen = true;
+			if (isConnectionSpecific(name)) return false;
+			if (name == "te" && f.second != "trailers") return false;
+			if (name == "cookie")
+			{
+				// multiple cookie fields are concatenated for HTTP/1.x-style handlers
+				if (!cookie.empty()) cookie += "; ";
+				cookie += f.second;
+			}
+			else
+			{
+				if (name == "content-length")
+				{
+					Poco::UInt64 contentLength;
+					if (!Poco::NumberParser::tryParseUnsigned64(f.second, contentLength)) return false;
+					if (stream.contentLength >= 0 && stream.contentLength != static_cast<Poco::Int64>(contentLength)) return false;
+					stream.contentLength = static_cast<Poco::Int64>(contentLength);
+				}
+				stream.fields.add(name, f.second);
+			}
+		}
+	}
+	if (stream.method.empty()) return false;
+	if (stream.method == HTTPRequest::HTTP_CONNECT)
+	{
+		if (authority.empty() || !path.empty() || !scheme.empty()) return false;
+		stream.uri = authority;
+	}
+	else
+	{
+		if (path.empty() || scheme.empty()) return false;
+		stream.uri = path;
+	}
+	if (!cookie.empty()) stream.fields.add("cookie"s, cookie);
+	if (!authority.empty() && !stream.fields.has("host"s)) stream.fields.add("host"s, authority);
+	return true;
+}
+
+
+void HTTP2ServerSession::startPending()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	while (!_pending.empty())
+	{
+		try
+		{
+			_threadPool.start(*_pending.front(), "HTTP2ServerSession"s);
+		}
+		catch (Poco::NoThreadAvailableException&)
+		{
+			// the stream stays queued until a handler of this connection
+			// completes, or the reader thread finds a free thread
+			break;
+		}
+		_pending.pop_front();
+	}
+}
+
+
+void HTTP2ServerSession::runStream(Stream& stream)
+{
+	StreamPtr pStream;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		auto it = _streams.find(stream.id);
+		if (it == _streams.end()) return;
+		pStream = it->second;
+	}
+	while (pStream)
+	{
+		processRequest(*pStream);
+
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_streams.erase(pStream->id);
+		--_activeHandlers;
+		_cond.broadcast();
+		if (!_pending.empty() && !_closed)
+		{
+			pStream = _pending.front();
+			_pending.pop_front();
+		}
+		else pStream.reset();
+	}
+}
+
+
+void HTTP2ServerSession::processRequest(Stream& stream)
+{
+	try
+	{
+		Response response(stream);
+		Request request(stream, response);
+
+		Poco::Timestamp now;
+		response.setDate(now);
+		const std::string& server = _pParams->getSoftwareVersion();
+		if (!server.empty())
+			response.set("Server"s, server);
+		try
+		{
+			std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
+			if (pHandler.get())
+			{
+				if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
+					response.sendContinue();
+
+				pHandler->handleRequest(request, response);
+			}
+			else
+			{
+				response.setStatusAndReason(HTTPResponse::HTTP_NOT_IMPLEMENTED);
+				response.setContentLength(0);
+			}
+		}
+		catch (Poco::Exception&)
+		{
+			if (response.sent()) throw;
+			response.setStatusAndReason(HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+			response.setContentLength(0);
+		}
+		response.finish();
+
+		bool requestComplete;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			requestComplete = stream.endStream || stream.reset;
+		}
+		// the response is complete, so the client can stop sending the request body
+		if (!requestComplete) resetStream(stream, H2_NO_ERROR);
+	}
+	catch (Poco::Exception& exc)
+	{
+		try
+		{
+			resetStream(stream, H2_INTERNAL_ERROR);
+		}
+		catch (...)
+		{
+		}
+		Poco::ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		try
+		{
+			resetStream(stream, H2_INTERNAL_ERROR);
+		}
+		catch (...)
+		{
+		}
+		Poco::ErrorHandler::handle(exc);
+	}
+}
+
+
+void HTTP2ServerSession::onSettings(int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (streamId != 0) throw HTTP2Exception("SETTINGS frame on stream", H2_PROTOCOL_ERROR);
+	if (flags & FLAG_ACK)
+	{
+		if (length != 0) throw HTTP2Exception("Invalid SETTINGS frame", H2_FRAME_SIZE_ERROR);
+		return;
+	}
+	if (length % 6 != 0) throw HTTP2Exception("Invalid SETTINGS frame", H2_FRAME_SIZE_ERROR);
+
+	for (std::size_t i = 0; i < length; i += 6)
+	{
+		int id = (static_cast<unsigned char>(payload[i]) << 8) | static_cast<unsigned char>(payload[i + 1]);
+		Poco::UInt32 value = read32(payload + i + 2);
+		switch (id)
+		{
+		case SETTINGS_HEADER_TABLE_SIZE:
+			{
+				Poco::FastMutex::ScopedLock lock(_sendMutex);
+				_encoder.setMaxTableSize(std::min<std::size_t>(value, HPACKTable::DEFAULT_TABLE_SIZE));
+			}
+			break;
+		case SETTINGS_ENABLE_PUSH:
+			if (value > 1) throw HTTP2Exception("Invalid SETTINGS_ENABLE_PUSH", H2_PROTOCOL_ERROR);
+			break;
+		case SETTINGS_INITIAL_WINDOW_SIZE:
+			{
+				if (value > MAX_WINDOW_SIZE) throw HTTP2Exception("Invalid SETTINGS_INITIAL_WINDOW_SIZE", H2_FLOW_CONTROL_ERROR);
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				Poco::Int64 delta = static_cast<Poco::Int64>(value) - _peerInitialWindowSize;
+				for (auto& p: _streams)
+				{
+					p.second->sendWindow += delta;
+					if (p.second->sendWindow > MAX_WINDOW_SIZE) throw HTTP2Exception("Stream flow control window overflow", H2_FLOW_CONTROL_ERROR);
+				}
+				_peerInitialWindowSize = value;
+				_cond.broadcast();
+			}
+			break;
+		case SETTINGS_MAX_FRAME_SIZE:
+			if (value < DEFAULT_MAX_FRAME_SIZE || value > 0xFFFFFF) throw HTTP2Exception("Invalid SETTINGS_MAX_FRAME_SIZE", H2_PROTOCOL_ERROR);
+			_peerMaxFrameSize = value;
+			break;
+		default:
+			// SETTINGS_MAX_CONCURRENT_STREAMS only limits server push,
+			// SETTINGS_MAX_HEADER_LIST_SIZE is advisory, and
+			// unknown settings must be ignored
+			break;
+		}
+	}
+	_settingsReceived = true;
+	writeFrame(FRAME_SETTINGS, FLAG_ACK, 0, nullptr, 0);
+}
+
+
+void HTTP2ServerSession::onWindowUpdate(Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (length != 4) throw HTTP2Exception("Invalid WINDOW_UPDATE frame", H2_FRAME_SIZE_ERROR);
+	Poco::UInt32 increment = read32(payload) & 0x7FFFFFFF;
+	if (streamId == 0)
+	{
+		if (increment == 0) throw HTTP2Exception("Invalid window size increment", H2_PROTOCOL_ERROR);
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_connSendWindow += increment;
+		if (_connSendWindow > MAX_WINDOW_SIZE) throw HTTP2Exception("Connection flow control window overflow", H2_FLOW_CONTROL_ERROR);
+		_cond.broadcast();
+	}
+	else
+	{
+		if (streamId > _lastStreamId) throw HTTP2Exception("WINDOW_UPDATE frame on idle stream", H2_PROTOCOL_ERROR);
+		ErrorCode error = H2_NO_ERROR;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			auto it = _streams.find(streamId);
+			if (it == _streams.end() || it->second->reset) return;
+			Stream& stream = *it->second;
+			if (increment == 0)
+			{
+				error = H2_PROTOCOL_ERROR;
+			}
+			else
+			{
+				stream.sendWindow += increment;
+				if (stream.sendWindow > MAX_WINDOW_SIZE) error = H2_FLOW_CONTROL_ERROR;
+				_cond.broadcast();
+			}
+		}
+		if (error != H2_NO_ERROR) resetStream(streamId, error);
+	}
+}
+
+
+void HTTP2ServerSession::onResetStream(Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	if (streamId == 0 || streamId > _lastStreamId) throw HTTP2Exception("RST_STREAM frame on idle stream", H2_PROTOCOL_ERROR);
+	if (length != 4) throw HTTP2Exception("Invalid RST_STREAM frame", H2_FRAME_SIZE_ERROR);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	auto it = _streams.find(streamId);
+	if (it != _streams.end())
+	{
+		it->second->reset = true;
+		_cond.broadcast();
+	}
+}
+
+
+void HTTP2ServerSession::sendHeaders(Stream& stream, int status, const NameValueCollection& fields, bool endStream)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (stream.reset || _closed) throw HTTP2Exception("Stream has been reset", H2_CANCEL);
+	}
+
+	Poco::FastMutex::ScopedLock lock(_sendMutex);
+	std::string block;
+	_encoder.encode(":status"s, Poco::NumberFormatter::format(status), block);
+	for (const auto& f: fields)
+	{
+		std::string name = Poco::toLower(f.first);
+		if (!isConnectionSpecific(name))
+			_encoder.encode(name, f.second, block);
+	}
+
+	std::size_t maxFrameSize = _peerMaxFrameSize;
+	std::string frames;
+	std::size_t pos = 0;
+	int type = FRAME_HEADERS;
+	int flags = endStream ? FLAG_END_STREAM : 0;
+	do
+	{
+		std::size_t n = std::min(block.size() - pos, maxFrameSize);
+		if (pos + n == block.size()) flags |= FLAG_END_HEADERS;
+		appendFrame(frames, type, flags, stream.id, block.data() + pos, n);
+		pos += n;
+		type = FRAME_CONTINUATION;
+		flags = 0;
+	}
+	while (pos < block.size());
+	sendFrames(frames);
+}
+
+
+void HTTP2ServerSession::sendData(Stream& stream, const char* buffer, std::size_t length, bool endStream)
+{
+	do
+	{
+		std::size_t n = 0;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			while (length > 0 && !stream.reset && !_closed && (stream.sendWindow <= 0 || _connSendWindow <= 0))
+			{
+				if (!_cond.tryWait(_mutex, static_cast<long>(_pParams->getTimeout().totalMilliseconds())))
+					throw TimeoutException("Timeout waiting for HTTP/2 flow control window");
+			}
+			if (stream.reset || _closed) throw HTTP2Exception("Stream has been reset", H2_CANCEL);
+
+			n = std::min<std::size_t>(length, _peerMaxFrameSize);
+			n = static_cast<std::size_t>(std::min<Poco::Int64>(n, std::min(stream.sendWindow, _connSendWindow)));
+			stream.sendWindow -= n;
+			_connSendWindow -= n;
+		}
+		writeFrame(FRAME_DATA, endStream && n == length ? FLAG_END_STREAM : 0, stream.id, buffer, n);
+		buffer += n;
+		length -= n;
+	}
+	while (length > 0);
+}
+
+
+int HTTP2ServerSession::receiveData(Stream& stream, char* buffer, std::size_t length)
+{
+	Poco::UInt32 windowUpdate = 0;
+	std::size_t n = 0;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		while (stream.dataPos == stream.data.size())
+		{
+			if (stream.endStream) return 0;
+			if (stream.reset || _closed) throw HTTP2Exception("Stream has been reset", H2_CANCEL);
+			if (!_cond.tryWait(_mutex, static_cast<long>(_pParams->getTimeout().totalMilliseconds())))
+				throw TimeoutException("Timeout waiting for HTTP/2 request body");
+		}
+		n = std::min(length, stream.data.size() - stream.dataPos);
+		std::memcpy(buffer, stream.data.data() + stream.dataPos, n);
+		stream.dataPos += n;
+		if (stream.dataPos == stream.data.size())
+		{
+			stream.data.clear();
+			stream.dataPos = 0;
+		}
+		stream.consumed += n;
+		if (stream.consumed >= DEFAULT_WINDOW_SIZE/2 && !stream.endStream)
+		{
+			windowUpdate = static_cast<Poco::UInt32>(stream.consumed);
+			stream.recvWindow += stream.consumed;
+			stream.consumed = 0;
+		}
+	}
+	if (windowUpdate > 0) sendWindowUpdate(stream.id, windowUpdate);
+	return static_cast<int>(n);
+}
+
+
+void HTTP2ServerSession::resetStream(Poco::UInt32 streamId, ErrorCode code)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		auto it = _streams.find(streamId);
+		if (it != _streams.end())
+		{
+			if (it->second->reset) return;
+			it->second->reset = true;
+			_cond.broadcast();
+		}
+	}
+	std::string payload;
+	append32(payload, code);
+	writeFrame(FRAME_RST_STREAM, 0, streamId, payload.data(), payload.size());
+}
+
+
+void HTTP2ServerSession::resetStream(Stream& stream, ErrorCode code)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (stream.reset || _closed) return;
+		stream.reset = true;
+		_cond.broadcast();
+	}
+	std::string payload;
+	append32(payload, code);
+	writeFrame(FRAME_RST_STREAM, 0, stream.id, payload.data(), payload.size());
+}
+
+
+void HTTP2ServerSession::sendWindowUpdate(Poco::UInt32 streamId, Poco::UInt32 increment)
+{
+	std::string payload;
+	append32(payload, increment);
+	writeFrame(FRAME_WINDOW_UPDATE, 0, streamId, payload.data(), payload.size());
+}
+
+
+void HTTP2ServerSession::sendGoAway(ErrorCode code)
+{
+	if (_goAwaySent.exchange(true)) return;
+
+	std::string payload;
+	append32(payload, _lastStreamId);
+	append32(payload, code);
+	writeFrame(FRAME_GOAWAY, 0, 0, payload.data(), payload.size());
+}
+
+
+void HTTP2ServerSession::writeFrame(int type, int flags, Poco::UInt32 streamId, const char* payload, std::size_t length)
+{
+	std::string frame;
+	frame.reserve(FRAME_HEADER_SIZE + length);
+	appendFrame(frame, type, flags, streamId, payload, length);
+
+	Poco::FastMutex::ScopedLock lock(_sendMutex);
+	sendFrames(frame);
+}
+
+
+void HTTP2ServerSession::sendFrames(const std::string& frames)
+{
+	const char* p = frames.data();
+	std::size_t remaining = frames.size();
+	while (remaining > 0)
+	{
+		int n = _socket.sendBytes(p, static_cast<int>(remaining));
+		if (n <= 0) throw ConnectionResetException("Cannot send HTTP/2 frame");
+		p += n;
+		remaining -= n;
+	}
+}
+
+
+bool HTTP2ServerSession::shouldClose()
+{
+	if (!_goAwaySent && !_goAwayReceived) return false;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _streams.empty();
+}
+
+
+void HTTP2ServerSession::close()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_closed = true;
+	for (const auto& pStream: _pending)
+	{
+		_streams.erase(pStream->id);
+		--_activeHandlers;
+	}
+	_pending.clear();
+	_cond.broadcast();
+	while (_activeHandlers > 0)
+	{
+		_cond.wait(_mutex);
+	}
+}
+
+
+} // namespace Poco::Net
@@ -0,0 +1,411 @@
+//
+// HTTPClientPool.cpp
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientPool
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPClientPool.h"
+#include "Poco/Net/HTTPSessionFactory.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+
+
+using Poco::FastMutex;
+using Poco::Timespan;
+using Poco::Timestamp;
+
+
+namespace Poco::Net {
+
+
+//
+// HTTPClientPool::PooledSession
+//
+
+
+HTTPClientPool::PooledSession::PooledSession():
+	_pPool(nullptr)
+{
+}
+
+
+HTTPClientPool::PooledSession::PooledSession(HTTPClientPool* pPool, const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession):
+	_pPool(pPool),
+	_key(key),
+	_pSession(std::move(pSession))
+{
+}
+
+
+HTTPClientPool::PooledSession::PooledSession(PooledSession&& other) noexcept:
+	_pPool(other._pPool),
+	_key(std::move(other._key)),
+	_pSession(std::move(other._pSession))
+{
+	other._pPool = nullptr;
+}
+
+
+HTTPClientPool::PooledSession::~PooledSession()
+{
+	try
+	{
+		release();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+HTTPClientPool::PooledSession& HTTPClientPool::PooledSession::operator = (PooledSession&& other) noexcept
+{
+	if (&other != this)
+	{
+		try
+		{
+			release();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+		_pPool = other._pPool;
+		_key = std::move(other._key);
+		_pSession = std::move(other._pSession);
+		other._pPool = nullptr;
+	}
+	return *this;
+}
+
+
+void HTTPClientPool::PooledSession::release()
+{
+	if (_pSession)
+	{
+		_pPool->returnSession(_key, std::move(_pSession), true);
+		_pPool = nullptr;
+	}
+}
+
+
+void HTTPClientPool::PooledSession::discard()
+{
+	if (_pSession)
+	{
+		_pPool->returnSession(_key, std::move(_pSession), false);
+		_pPool = nullptr;
+	}
+}
+
+
+//
+// HTTPClientPool
+//
+
+
+HTTPClientPool::HTTPClientPool(int maxSessionsPerHost):
+	_factory(HTTPSessionFactory::defaultFactory()),
+	_maxSessionsPerHost(maxSessionsPerHost),
+	_waitTimeout(DEFAULT_WAIT_TIMEOUT, 0)
+{
+	poco_assert (maxSessionsPerHost > 0);
+}
+
+
+HTTPClientPool::HTTPClientPool(HTTPSessionFactory& factory, int maxSessionsPerHost):
+	_factory(factory),
+	_maxSessionsPerHost(maxSessionsPerHost),
+	_waitTimeout(DEFAULT_WAIT_TIMEOUT, 0)
+{
+	poco_assert (maxSessionsPerHost > 0);
+}
+
+
+HTTPClientPool::~HTTPClientPool()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+HTTPClientPool::PooledSession HTTPClientPool::get(const Poco::URI& uri)
+{
+	return get(uri, HTTPClientSession::getGlobalProxyConfig());
+}
+
+
+HTTPClientPool::PooledSession HTTPClientPool::get(const Poco::URI& uri, const ProxyConfig& proxyConfig)
+{
+	const std::string key = endpointKey(uri, proxyConfig);
+	SessionList expired;
+	std::unique_ptr<HTTPClientSession> pSession;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		Timestamp start;
+		for (;;)
+		{
+			// the endpoint may have been removed while waiting
+			Endpoint& endpoint = _endpoints[key];
+			purgeExpired(endpoint, expired);
+			if (!endpoint.idle.empty())
+			{
+				// reuse the most recently returned session, as its
+				// connection is the least likely to have been closed
+				pSession = std::move(endpoint.idle.back().pSession);
+				endpoint.idle.pop_back();
+				++endpoint.active;
+				break;
+			}
+			else if (endpoint.active < _maxSessionsPerHost)
+			{
+				++endpoint.active;
+				break;
+			}
+			Timespan remaining = _waitTimeout - Timespan(start.elapsed());
+			if (remaining <= 0 || !_available.tryWait(_mutex, static_cast<long>(remaining.totalMilliseconds())))
+			{
+				if (endpoint.active == 0 && endpoint.idle.empty()) _endpoints.erase(key);
+				throw Poco::TimeoutException("No HTTP session available for", key);
+			}
+		}
+	}
+	if (!pSession)
+	{
+		try
+		{
+			pSession.reset(createSession(uri, proxyConfig));
+		}
+		catch (...)
+		{
+			returnSession(key, nullptr, false);
+			throw;
+		}
+	}
+	return PooledSession(this, key, std::move(pSession));
+}
+
+
+void HTTPClientPool::setMaxSessionsPerHost(int maxSessions)
+{
+	poco_assert (maxSessions > 0);
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	_maxSessionsPerHost = maxSessions;
+	_available.broadcast();
+}
+
+
+int HTTPClientPool::getMaxSessionsPerHost() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _maxSessionsPerHost;
+}
+
+
+void HTTPClientPool::setWaitTimeout(const Poco::Timespan& timeout)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_waitTimeout = timeout;
+}
+
+
+Poco::Timespan HTTPClientPool::getWaitTimeout() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _waitTimeout;
+}
+
+
+std::size_t HTTPClientPool::purgeIdle()
+{
+	SessionList expired;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		for (auto it = _endpoints.begin(); it != _endpoints.end();)
+		{
+			purgeExpired(it->second, expired);
+			if (it->second.active == 0 && it->second.idle.empty())
+				it = _endpoints.erase(it);
+			else
+				++it;
+		}
+		if (!expired.empty()) _available.broadcast();
+	}
+	return expired.size();
+}
+
+
+void HTTPClientPool::clear()
+{
+	SessionList closed;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		for (auto it = _endpoints.begin(); it != _endpoints.end();)
+		{
+			for (auto& idle: it->second.idle)
+			{
+				closed.push_back(std::move(idle.pSession));
+			}
+			it->second.idle.clear();
+			if (it->second.active == 0)
+				it = _endpoints.erase(it);
+			else
+				++it;
+		}
+		if (!closed.empty()) _available.broadcast();
+	}
+}
+
+
+std::size_t HTTPClientPool::idleSessions() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	std::size_t n = 0;
+	for (const auto& p: _endpoints)
+	{
+		n += p.second.idle.size();
+	}
+	return n;
+}
+
+
+std::size_t HTTPClientPool::activeSessions() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	std::size_t n = 0;
+	for (const auto& p: _endpoints)
+	{
+		n += p.second.active;
+	}
+	return n;
+}
+
+
+HTTPClientSession* HTTPClientPool::createSession(const Poco::URI& uri, const ProxyConfig& proxyConfig)
+{
+	std::unique_ptr<HTTPClientSession> pSession;
+	if (uri.getScheme() == "http")
+	{
+		pSession.reset(new HTTPClientSession(uri.getHost(), uri.getPort(), proxyConfig));
+	}
+	else
+	{
+		pSession.reset(_factory.createClientSession(uri));
+		pSession->setProxyConfig(proxyConfig);
+	}
+	pSession->setKeepAlive(true);
+	return pSession.release();
+}
+
+
+std::string HTTPClientPool::endpointKey(const Poco::URI& uri, const ProxyConfig& proxyConfig)
+{
+	if (uri.isRelative()) throw Poco::UnknownURISchemeException("Relative URIs are not supported by HTTPClientPool");
+
+	std::string key(uri.getScheme());
+	key += "://";
+	key += uri.getHost();
+	key += ':';
+	Poco::NumberFormatter::append(key, uri.getPort());
+	if (!proxyConfig.host.empty())
+	{
+		key += " via ";
+		key += proxyConfig.protocol;
+		key += "://";
+		if (!proxyConfig.username.empty())
+		{
+			key += proxyConfig.username;
+			key += '@';
+		}
+		key += proxyConfig.host;
+		key += ':';
+		Poco::NumberFormatter::append(key, proxyConfig.port);
+	}
+	return key;
+}
+
+
+void HTTPClientPool::returnSession(const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession, bool reuse)
+{
+	SessionList closed;
+	if (pSession && !(reuse && isReusable(*pSession)))
+	{
+		closed.push_back(std::move(pSession));
+	}
+	FastMutex::ScopedLock lock(_mutex);
+
+	auto it = _endpoints.find(key);
+	poco_assert (it != _endpoints.end() && it->second.active > 0);
+
+	Endpoint& endpoint = it->second;
+	--endpoint.active;
+	if (pSession)
+	{
+		endpoint.idle.push_back(IdleSession{std::move(pSession), Timestamp()});
+	}
+	purgeExpired(endpoint, closed);
+	if (endpoint.active == 0 && endpoint.idle.empty())
+	{
+		_endpoints.erase(it);
+	}
+	_available.broadcast();
+}
+
+
+void HTTPClientPool::purgeExpired(Endpoint& endpoint, SessionList& expired)
+{
+	// idle sessions are ordered by the time they have been returned
+	std::size_t n = 0;
+	while (n < endpoint.idle.size() && endpoint.idle[n].returned.isElapsed(endpoint.idle[n].pSession->getKeepAliveTimeout().totalMicroseconds()))
+	{
+		expired.push_back(std::move(endpoint.idle[n].pSession));
+		++n;
+	}
+	if (n > 0) endpoint.idle.erase(endpoint.idle.begin(), endpoint.idle.begin() + n);
+}
+
+
+bool HTTPClientPool::isReusable(HTTPClientSession& session)
+{
+	try
+	{
+		// unread data means the response has not been consumed completely
+		return session.connected()
+			&& session.getKeepAlive()
+			&& !session.mustReconnect()
+			&& session.buffered() == 0
+			&& session.socket().available() == 0;
+	}
+	catch (Poco::Exception&)
+	{
+		return false;
+	}
+}
+
+
+} // namespace Poco::Net
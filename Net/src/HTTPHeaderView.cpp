@@ -0,0 +1,188 @@
+//
+// HTTPHeaderView.cpp
+//
+// Library: Net
+// Package: HTTP
+// Module:  HTTPHeaderView
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPHeaderView.h"
+#include "Poco/Exception.h"
+#include "Poco/Ascii.h"
+#include <cstring>
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	inline bool isBlank(char c)
+	{
+		return c == ' ' || c == '\t';
+	}
+
+	std::string_view trim(const char* begin, const char* end)
+	{
+		while (begin < end && isBlank(*begin)) ++begin;
+		while (end > begin && (isBlank(end[-1]) || end[-1] == '\r' || end[-1] == '\n')) --end;
+		return std::string_view(begin, end - begin);
+	}
+}
+
+
+HTTPHeaderView::HTTPHeaderView():
+	_size(0)
+{
+}
+
+
+HTTPHeaderView::~HTTPHeaderView()
+{
+}
+
+
+std::size_t HTTPHeaderView::parse(const char* buffer, std::size_t length)
+{
+	clear();
+
+	const char* it  = buffer;
+	const char* end = buffer + length;
+	while (it != end && (*it == '\r' || *it == '\n')) ++it;
+
+	const char* eol = static_cast<const char*>(std::memchr(it, '\n', end - it));
+	if (!eol) return 0;
+	const char* lineEnd = eol > it && eol[-1] == '\r' ? eol - 1 : eol;
+	std::string_view startLine(it, lineEnd - it);
+	it = eol + 1;
+
+	std::size_t size = 0;
+	while (true)
+	{
+		if (it == end) return 0;
+		if (*it == '\n')
+		{
+			++it;
+			break;
+		}
+		if (*it == '\r')
+		{
+			if (it + 1 == end) return 0;
+			if (it[1] == '\n')
+			{
+				it += 2;
+				break;
+			}
+		}
+
+		eol = static_cast<const char*>(std::memchr(it, '\n', end - it));
+		if (!eol) return 0;
+		// obsolete line folding: the value continues on lines
+		// starting with a space or horizontal tab
+		while (eol + 1 != end && isBlank(eol[1]))
+		{
+			eol = static_cast<const char*>(std::memchr(eol + 1, '\n', end - eol - 1));
+			if (!eol) return 0;
+		}
+		if (eol + 1 == end) return 0;
+
+		const char* colon = static_cast<const char*>(std::memchr(it, ':', eol - it));
+		if (colon)
+		{
+			Field field{std::string_view(it, colon - it), trim(colon + 1, eol)};
+			if (size < INLINE_FIELDS)
+				_fields[size] = field;
+			else
+				_moreFields.push_back(field);
+			++size;
+		}
+		it = eol + 1;
+	}
+	_startLine = startLine;
+	_size = size;
+	return it - buffer;
+}
+
+
+void HTTPHeaderView::clear()
+{
+	_startLine = std::string_view();
+	_size = 0;
+	_moreFields.clear();
+}
+
+
+bool HTTPHeaderView::has(std::string_view name) const
+{
+	std::string_view value;
+	return find(name, value);
+}
+
+
+std::string_view HTTPHeaderView::get(std::string_view name) const
+{
+	std::string_view value;
+	if (!find(name, value)) throw NotFoundException(std::string(name));
+	return value;
+}
+
+
+std::string_view HTTPHeaderView::get(std::string_view name, std::string_view defaultValue) const
+{
+	std::string_view value;
+	if (!find(name, value)) return defaultValue;
+	return value;
+}
+
+
+bool HTTPHeaderView::hasToken(std::string_view name, std::string_view token) const
+{
+	std::string_view value;
+	if (!find(name, value)) return false;
+
+	const char* it  = value.data();
+	const char* end = it + value.size();
+	while (it != end)
+	{
+		const char* comma = static_cast<const char*>(std::memchr(it, ',', end - it));
+		const char* elemEnd = comma ? comma : end;
+		if (equalsIgnoreCase(trim(it, elemEnd), token)) return true;
+		it = comma ? comma + 1 : end;
+	}
+	return false;
+}
+
+
+bool HTTPHeaderView::equalsIgnoreCase(std::string_view s1, std::string_view s2)
+{
+	if (s1.size() != s2.size()) return false;
+	for (std::size_t i = 0; i < s1.size(); ++i)
+	{
+		if (Poco::Ascii::toLower(s1[i]) != Poco::Ascii::toLower(s2[i])) return false;
+	}
+	return true;
+}
+
+
+bool HTTPHeaderView::find(std::string_view name, std::string_view& value) const
+{
+	for (std::size_t i = 0; i < _size; ++i)
+	{
+		const Field& f = field(i);
+		if (equalsIgnoreCase(f.name, name))
+		{
+			value = f.value;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+} // namespace Poco::Net
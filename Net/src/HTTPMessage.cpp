@@ -29,6 +29,7 @@ namespace Poco::Net {
 
 const std::string HTTPMessage::HTTP_1_0                   = "HTTP/1.0";
 const std::string HTTPMessage::HTTP_1_1                   = "HTTP/1.1";
+const std::string HTTPMessage::HTTP_2_0                   = "HTTP/2.0";
 const std::string HTTPMessage::IDENTITY_TRANSFER_ENCODING = "identity";
 const std::string HTTPMessage::CHUNKED_TRANSFER_ENCODING  = "chunked";
 const int         HTTPMessage::UNKNOWN_CONTENT_LENGTH     = -1;
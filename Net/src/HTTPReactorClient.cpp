@@ -0,0 +1,867 @@
+//
+// HTTPReactorClient.cpp
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPReactorClient
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPReactorClient.h"
+#include "Poco/Net/HTTPHeaderView.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NObserver.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+#include "Poco/Error.h"
+#include <algorithm>
+#include <charconv>
+#include <sstream>
+
+
+using Poco::FastMutex;
+using Poco::NObserver;
+using Poco::Timespan;
+using Poco::Timestamp;
+using Poco::AutoPtr;
+
+
+namespace Poco::Net {
+
+
+class HTTPReactorClient::Connection: public std::enable_shared_from_this<HTTPReactorClient::Connection>
+	/// A non-blocking connection to the server, processing
+	/// one request at a time.
+{
+public:
+	enum State
+	{
+		CONNECTING,
+		IDLE,
+		SENDING,
+		RECEIVING,
+		CLOSED
+	};
+
+	enum
+	{
+		RECEIVE_BUFFER_SIZE = 16384,
+		MAX_HEADER_SIZE     = 65536,
+		MAX_LINE_SIZE       = 4096
+	};
+
+	Connection(HTTPReactorClient& client):
+		_client(client),
+		_state(CONNECTING),
+		_writable(false),
+		_reused(false),
+		_received(false)
+	{
+	}
+
+	~Connection()
+	{
+	}
+
+	void connect()
+	{
+		_socket.connectNB(_client._address);
+		_client._reactor.addEventHandler(_socket, NObserver<Connection, ReadableNotification>(*this, &Connection::onReadable));
+		_client._reactor.addEventHandler(_socket, NObserver<Connection, ErrorNotification>(*this, &Connection::onError));
+		_client._reactor.addEventHandler(_socket, NObserver<Connection, TimeoutNotification>(*this, &Connection::onTimeout));
+		setWritable(true);
+	}
+
+	void close()
+	{
+		if (_state != CLOSED)
+		{
+			_state = CLOSED;
+			_client._reactor.remove(_socket);
+			try
+			{
+				_socket.close();
+			}
+			catch (Poco::Exception&)
+			{
+			}
+		}
+	}
+
+	void start(PendingRequest&& request, CompletionList& completions)
+		/// Starts processing the given request.
+		/// The connection must be connecting or idle.
+	{
+		poco_assert (_state == CONNECTING || _state == IDLE);
+
+		_request = std::move(request);
+		_outPos = 0;
+		_received = false;
+		_in.clear();
+		_headerParsed = false;
+		_response = Response();
+		if (_state == IDLE)
+		{
+			_reused = true;
+			_state = SENDING;
+			send(completions);
+		}
+	}
+
+	PendingRequest& request()
+	{
+		return _request;
+	}
+
+	bool busy() const
+	{
+		return _state == SENDING || _state == RECEIVING || (_state == CONNECTING && _request.callback);
+	}
+
+	State state() const
+	{
+		return _state;
+	}
+
+	const Timestamp& idleSince() const
+	{
+		return _idleSince;
+	}
+
+	void onReadable(const AutoPtr<ReadableNotification>& pNf)
+	{
+		ConnectionPtr pGuard(shared_from_this());
+		CompletionList completions;
+		{
+			FastMutex::ScopedLock lock(_client._mutex);
+
+			if (_state != CLOSED)
+			{
+				try
+				{
+					if (_state == CONNECTING)
+					{
+						checkError();
+						connected(completions);
+					}
+					receive(completions);
+				}
+				catch (Poco::Exception& exc)
+				{
+					fail(exc, completions);
+				}
+				_client.checkTimeouts(completions);
+			}
+		}
+		complete(completions);
+	}
+
+	void onWritable(const AutoPtr<WritableNotification>& pNf)
+	{
+		ConnectionPtr pGuard(shared_from_this());
+		CompletionList completions;
+		{
+			FastMutex::ScopedLock lock(_client._mutex);
+
+			if (_state != CLOSED)
+			{
+				try
+				{
+					if (_state == CONNECTING)
+					{
+						checkError();
+						connected(completions);
+					}
+					else if (_state == SENDING)
+					{
+						send(completions);
+					}
+					else setWritable(false);
+				}
+				catch (Poco::Exception& exc)
+				{
+					fail(exc, completions);
+				}
+				_client.checkTimeouts(completions);
+			}
+		}
+		complete(completions);
+	}
+
+	void onError(const AutoPtr<ErrorNotification>& pNf)
+	{
+		ConnectionPtr pGuard(shared_from_this());
+		CompletionList completions;
+		{
+			FastMutex::ScopedLock lock(_client._mutex);
+
+			if (_state != CLOSED)
+			{
+				try
+				{
+					checkError();
+					throw NetException("Socket error");
+				}
+				catch (Poco::Exception& exc)
+				{
+					fail(exc, completions);
+				}
+			}
+		}
+		complete(completions);
+	}
+
+	void onTimeout(const AutoPtr<TimeoutNotification>& pNf)
+	{
+		ConnectionPtr pGuard(shared_from_this());
+		CompletionList completions;
+		{
+			FastMutex::ScopedLock lock(_client._mutex);
+
+			if (_state != CLOSED)
+			{
+				_client.checkTimeouts(completions);
+			}
+		}
+		complete(completions);
+	}
+
+	void fail(const Poco::Exception& exc, CompletionList& completions, bool mayRetry = true)
+		/// Closes the connection and fails the current request.
+	{
+		ConnectionPtr pThis(shared_from_this());
+		bool busy = this->busy();
+		close();
+		if (busy)
+		{
+			--_client._active;
+			if (mayRetry && _reused && !_received && _request.idempotent)
+			{
+				// The server may have closed the idle connection just
+				// before the request was sent. Send it again over a
+				// new connection, which is safe for idempotent methods.
+				_reused = false;
+				_client._queue.push_front(std::move(_request));
+			}
+			else HTTPReactorClient::fail(_request, exc, completions);
+			_request = PendingRequest();
+		}
+		_client.remove(pThis);
+		_client.dispatch(completions);
+	}
+
+private:
+	enum BodyMode
+	{
+		BODY_NONE,
+		BODY_LENGTH,
+		BODY_CHUNKED,
+		BODY_EOF
+	};
+
+	enum ChunkState
+	{
+		CHUNK_SIZE,
+		CHUNK_DATA,
+		CHUNK_DATA_END,
+		CHUNK_TRAILER
+	};
+
+	void checkError()
+	{
+		int err = _socket.impl()->socketError();
+		if (err) throw NetException(Poco::Error::getMessage(err), err);
+	}
+
+	void connected(CompletionList& completions)
+	{
+		if (_request.callback)
+		{
+			_state = SENDING;
+			send(completions);
+		}
+		else
+		{
+			_state = IDLE;
+			_idleSince.update();
+			setWritable(false);
+		}
+	}
+
+	void setWritable(bool writable)
+	{
+		if (writable != _writable)
+		{
+			if (writable)
+				_client._reactor.addEventHandler(_socket, NObserver<Connection, WritableNotification>(*this, &Connection::onWritable));
+			else
+				_client._reactor.removeEventHandler(_socket, NObserver<Connection, WritableNotification>(*this, &Connection::onWritable));
+			_writable = writable;
+		}
+	}
+
+	void send(CompletionList& completions)
+	{
+		const std::string& data = _request.data;
+		while (_outPos < data.size())
+		{
+			int n = _socket.sendBytes(data.data() + _outPos, static_cast<int>(data.size() - _outPos));
+			if (n < 0)
+			{
+				setWritable(true);
+				return;
+			}
+			_outPos += n;
+		}
+		setWritable(false);
+		_state = RECEIVING;
+		// the server may have responded before the request was sent completely
+		if (!_in.empty() && parse()) finish(isReusable(), completions);
+	}
+
+	void receive(CompletionList& completions)
+	{
+		std::size_t size = _in.size();
+		_in.resize(size + RECEIVE_BUFFER_SIZE);
+		int n = _socket.receiveBytes(_in.data() + size, RECEIVE_BUFFER_SIZE);
+		_in.resize(size + (n > 0 ? n : 0));
+		if (n < 0) return;
+
+		if (n == 0)
+		{
+			if (_state == RECEIVING && _headerParsed && _bodyMode == BODY_EOF)
+			{
+				finish(false, completions);
+			}
+			else if (_state == RECEIVING)
+			{
+				throw NetException("Connection closed by server");
+			}
+			else
+			{
+				// idle connection closed by server
+				close();
+				_client.remove(shared_from_this());
+			}
+			return;
+		}
+		if (_state != RECEIVING && _state != SENDING)
+		{
+			throw NetException("Unexpected data received from server");
+		}
+		_received = true;
+		if (_state == RECEIVING && parse())
+		{
+			finish(isReusable(), completions);
+		}
+	}
+
+	bool isReusable() const
+	{
+		return _bodyMode != BODY_EOF && _in.empty() && _response.response.getKeepAlive();
+	}
+
+	bool parse()
+		/// Consumes the received data, returns true if the
+		/// response is complete.
+	{
+		while (!_headerParsed)
+		{
+			std::size_t headerSize = _headers.parse(_in.data(), _in.size());
+			if (headerSize == 0)
+			{
+				if (_in.size() > MAX_HEADER_SIZE) throw MessageException("HTTP response header too long");
+				return false;
+			}
+			_response.response.clear();
+			_response.response.read(_headers);
+			_headers.clear();
+			_in.erase(0, headerSize);
+			int status = _response.response.getStatus();
+			if (status >= 100 && status < 200 && status != HTTPResponse::HTTP_SWITCHING_PROTOCOLS)
+			{
+				// interim response, e.g. 100 Continue
+				continue;
+			}
+			_headerParsed = true;
+			if (_request.head || status < 200 || status == HTTPResponse::HTTP_NO_CONTENT || status == HTTPResponse::HTTP_NOT_MODIFIED)
+			{
+				_bodyMode = BODY_NONE;
+			}
+			else if (_response.response.getChunkedTransferEncoding())
+			{
+				_bodyMode = BODY_CHUNKED;
+				_chunkState = CHUNK_SIZE;
+			}
+			else if (_response.response.hasContentLength())
+			{
+				_bodyMode = BODY_LENGTH;
+				_remaining = static_cast<std::size_t>(_response.response.getContentLength64());
+			}
+			else
+			{
+				_bodyMode = BODY_EOF;
+			}
+		}
+
+		switch (_bodyMode)
+		{
+		case BODY_NONE:
+			return true;
+		case BODY_LENGTH:
+			{
+				std::size_t n = std::min(_remaining, _in.size());
+				_response.body.append(_in, 0, n);
+				_in.erase(0, n);
+				_remaining -= n;
+				return _remaining == 0;
+			}
+		case BODY_CHUNKED:
+			return parseChunks();
+		case BODY_EOF:
+			_response.body.append(_in);
+			_in.clear();
+			return false;
+		}
+		return false;
+	}
+
+	bool parseChunks()
+	{
+		std::size_t pos = 0;
+		bool done = false;
+		while (!done)
+		{
+			if (_chunkState == CHUNK_DATA)
+			{
+				std::size_t n = std::min(_remaining, _in.size() - pos);
+				if (n == 0) break;
+				_response.body.append(_in, pos, n);
+				pos += n;
+				_remaining -= n;
+				if (_remaining == 0) _chunkState = CHUNK_DATA_END;
+				continue;
+			}
+
+			std::size_t eol = _in.find('\n', pos);
+			if (eol == std::string::npos)
+			{
+				if (_in.size() - pos > MAX_LINE_SIZE) throw MessageException("Invalid chunked transfer encoding");
+				break;
+			}
+			std::string_view line(_in.data() + pos, eol - pos);
+			if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+			pos = eol + 1;
+
+			switch (_chunkState)
+			{
+			case CHUNK_SIZE:
+				{
+					std::size_t end = line.find_first_of("; \t");
+					if (end != std::string_view::npos) line = line.substr(0, end);
+					const char* last = line.data() + line.size();
+					auto [ptr, ec] = std::from_chars(line.data(), last, _remaining, 16);
+					if (line.empty() || ec != std::errc() || ptr != last) throw MessageException("Invalid chunk size");
+					_chunkState = _remaining == 0 ? CHUNK_TRAILER : CHUNK_DATA;
+				}
+				break;
+			case CHUNK_DATA_END:
+				if (!line.empty()) throw MessageException("Invalid chunked transfer encoding");
+				_chunkState = CHUNK_SIZE;
+				break;
+			case CHUNK_TRAILER:
+				// trailer fields are ignored
+				done = line.empty();
+				break;
+			case CHUNK_DATA:
+				break;
+			}
+		}
+		_in.erase(0, pos);
+		return done;
+	}
+
+	void finish(bool reusable, CompletionList& completions)
+	{
+		Completion completion;
+		completion.callback = std::move(_request.callback);
+		completion.response = std::move(_response);
+		completions.push_back(std::move(completion));
+		_request = PendingRequest();
+		_response = Response();
+		--_client._active;
+
+		if (reusable)
+		{
+			_state = IDLE;
+			_idleSince.update();
+		}
+		else close();
+		_client.release(shared_from_this(), reusable, completions);
+	}
+
+	HTTPReactorClient& _client;
+	StreamSocket       _socket;
+	State              _state;
+	bool               _writable;
+	bool               _reused;
+	bool               _received;
+	Timestamp          _idleSince;
+	PendingRequest     _request;
+	std::size_t        _outPos = 0;
+	std::string        _in;
+	HTTPHeaderView     _headers;
+	bool               _headerParsed = false;
+	Response           _response;
+	BodyMode           _bodyMode = BODY_NONE;
+	ChunkState         _chunkState = CHUNK_SIZE;
+	std::size_t        _remaining = 0;
+};
+
+
+HTTPReactorClient::HTTPReactorClient(const std::string& host, Poco::UInt16 port, SocketReactor& reactor):
+	_address(host, port),
+	_host(host),
+	_reactor(reactor),
+	_maxConnections(DEFAULT_MAX_CONNECTIONS),
+	_timeout(DEFAULT_TIMEOUT, 0),
+	_keepAliveTimeout(DEFAULT_KEEP_ALIVE_TIMEOUT, 0),
+	_closed(false),
+	_active(0)
+{
+}
+
+
+HTTPReactorClient::HTTPReactorClient(const SocketAddress& address, SocketReactor& reactor):
+	_address(address),
+	_host(address.host().toString()),
+	_reactor(reactor),
+	_maxConnections(DEFAULT_MAX_CONNECTIONS),
+	_timeout(DEFAULT_TIMEOUT, 0),
+	_keepAliveTimeout(DEFAULT_KEEP_ALIVE_TIMEOUT, 0),
+	_closed(false),
+	_active(0)
+{
+}
+
+
+HTTPReactorClient::~HTTPReactorClient()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void HTTPReactorClient::sendRequest(const HTTPRequest& request, const std::string& body, Callback callback)
+{
+	poco_assert (callback);
+
+	HTTPRequest req(request);
+	if (!req.has(HTTPRequest::HOST)) req.setHost(_host, _address.port());
+	bool chunked = req.getChunkedTransferEncoding();
+	if (!chunked && (!body.empty() || req.hasContentLength()))
+		req.setContentLength64(body.size());
+
+	std::ostringstream ostr;
+	req.write(ostr);
+	PendingRequest pending;
+	pending.data = ostr.str();
+	if (chunked)
+	{
+		if (!body.empty())
+		{
+			Poco::NumberFormatter::appendHex(pending.data, body.size());
+			pending.data += "\r\n";
+			pending.data += body;
+			pending.data += "\r\n";
+		}
+		pending.data += "0\r\n\r\n";
+	}
+	else pending.data += body;
+	const std::string& method = req.getMethod();
+	pending.head = method == HTTPRequest::HTTP_HEAD;
+	pending.idempotent = method == HTTPRequest::HTTP_GET
+		|| method == HTTPRequest::HTTP_HEAD
+		|| method == HTTPRequest::HTTP_OPTIONS
+		|| method == HTTPRequest::HTTP_TRACE
+		|| method == HTTPRequest::HTTP_PUT
+		|| method == HTTPRequest::HTTP_DELETE;
+	pending.callback = std::move(callback);
+
+	CompletionList completions;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (_closed) throw Poco::IllegalStateException("HTTPReactorClient has been closed");
+
+		pending.deadline += _timeout.totalMicroseconds();
+		_queue.push_back(std::move(pending));
+		dispatch(completions);
+	}
+	complete(completions);
+}
+
+
+std::future<HTTPReactorClient::Response> HTTPReactorClient::sendRequest(const HTTPRequest& request, const std::string& body)
+{
+	auto pPromise = std::make_shared<std::promise<Response>>();
+	std::future<Response> future = pPromise->get_future();
+	sendRequest(request, body, [pPromise](const Poco::Exception* pException, Response& response)
+		{
+			if (pException)
+			{
+				try
+				{
+					pException->rethrow();
+				}
+				catch (...)
+				{
+					pPromise->set_exception(std::current_exception());
+				}
+			}
+			else pPromise->set_value(std::move(response));
+		});
+	return future;
+}
+
+
+void HTTPReactorClient::setMaxConnections(int maxConnections)
+{
+	poco_assert (maxConnections > 0);
+
+	CompletionList completions;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		_maxConnections = maxConnections;
+		if (!_closed) dispatch(completions);
+	}
+	complete(completions);
+}
+
+
+int HTTPReactorClient::getMaxConnections() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _maxConnections;
+}
+
+
+void HTTPReactorClient::setTimeout(const Poco::Timespan& timeout)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_timeout = timeout;
+}
+
+
+Poco::Timespan HTTPReactorClient::getTimeout() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _timeout;
+}
+
+
+void HTTPReactorClient::setKeepAliveTimeout(const Poco::Timespan& timeout)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_keepAliveTimeout = timeout;
+}
+
+
+Poco::Timespan HTTPReactorClient::getKeepAliveTimeout() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _keepAliveTimeout;
+}
+
+
+void HTTPReactorClient::close()
+{
+	CompletionList completions;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		closeImpl(completions);
+	}
+	complete(completions);
+}
+
+
+std::size_t HTTPReactorClient::pendingRequests() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _queue.size() + _active;
+}
+
+
+std::size_t HTTPReactorClient::connections() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _connections.size();
+}
+
+
+void HTTPReactorClient::dispatch(CompletionList& completions)
+{
+	while (!_queue.empty())
+	{
+		ConnectionPtr pConnection;
+		if (!_idle.empty())
+		{
+			pConnection = _idle.back();
+			_idle.pop_back();
+		}
+		else if (_connections.size() < static_cast<std::size_t>(_maxConnections))
+		{
+			pConnection = std::make_shared<Connection>(*this);
+			try
+			{
+				pConnection->connect();
+			}
+			catch (Poco::Exception& exc)
+			{
+				pConnection->close();
+				fail(_queue.front(), exc, completions);
+				_queue.pop_front();
+				continue;
+			}
+			_connections.insert(pConnection);
+		}
+		else break;
+
+		PendingRequest request(std::move(_queue.front()));
+		_queue.pop_front();
+		++_active;
+		try
+		{
+			pConnection->start(std::move(request), completions);
+		}
+		catch (Poco::Exception& exc)
+		{
+			pConnection->fail(exc, completions);
+		}
+	}
+}
+
+
+void HTTPReactorClient::checkTimeouts(CompletionList& completions)
+{
+	static const Timespan CHECK_INTERVAL(0, 100000);
+
+	Timestamp now;
+	if (now - _lastTimeoutCheck < CHECK_INTERVAL.totalMicroseconds()) return;
+	_lastTimeoutCheck = now;
+
+	while (!_queue.empty() && _queue.front().deadline <= now)
+	{
+		fail(_queue.front(), Poco::TimeoutException("HTTP request timed out"), completions);
+		_queue.pop_front();
+	}
+
+	std::vector<ConnectionPtr> connections(_connections.begin(), _connections.end());
+	for (auto& pConnection: connections)
+	{
+		if (pConnection->state() == Connection::CLOSED) continue;
+		if (pConnection->busy())
+		{
+			if (pConnection->request().deadline <= now)
+			{
+				pConnection->fail(Poco::TimeoutException("HTTP request timed out"), completions, false);
+			}
+		}
+		else if (pConnection->state() == Connection::IDLE && pConnection->idleSince().isElapsed(_keepAliveTimeout.totalMicroseconds()))
+		{
+			pConnection->close();
+			remove(pConnection);
+		}
+	}
+}
+
+
+void HTTPReactorClient::release(const ConnectionPtr& pConnection, bool reusable, CompletionList& completions)
+{
+	if (reusable && !_closed)
+		_idle.push_back(pConnection);
+	else
+		remove(pConnection);
+	dispatch(completions);
+}
+
+
+void HTTPReactorClient::remove(const ConnectionPtr& pConnection)
+{
+	_connections.erase(pConnection);
+	auto it = std::find(_idle.begin(), _idle.end(), pConnection);
+	if (it != _idle.end()) _idle.erase(it);
+}
+
+
+void HTTPReactorClient::closeImpl(CompletionList& completions)
+{
+	_closed = true;
+	Poco::IOException exc("HTTPReactorClient has been closed");
+	for (auto& pending: _queue)
+	{
+		fail(pending, exc, completions);
+	}
+	_queue.clear();
+	for (auto& pConnection: _connections)
+	{
+		if (pConnection->busy())
+		{
+			fail(pConnection->request(), exc, completions);
+			--_active;
+		}
+		pConnection->close();
+	}
+	_connections.clear();
+	_idle.clear();
+}
+
+
+void HTTPReactorClient::fail(PendingRequest& request, const Poco::Exception& exc, CompletionList& completions)
+{
+	Completion completion;
+	completion.callback = std::move(request.callback);
+	completion.pException.reset(exc.clone());
+	completions.push_back(std::move(completion));
+}
+
+
+void HTTPReactorClient::complete(CompletionList& completions)
+{
+	for (auto& completion: completions)
+	{
+		try
+		{
+			completion.callback(completion.pException.get(), completion.response);
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+	}
+}
+
+
+} // namespace Poco::Net
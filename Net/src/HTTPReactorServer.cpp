@@ -2,10 +2,192 @@
 #include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPRequestHandler.h"
 #include "Poco/Net/HTTPSession.h"
+#include "Poco/Notification.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Logger.h"
+#include "Poco/ErrorHandler.h"
+#include <atomic>
 #include <cstring>
 
 namespace Poco::Net {
 
+
+namespace
+{
+	Poco::Arena& reactorArena()
+		/// Returns the Arena used for requests handled
+		/// in the calling reactor thread.
+	{
+		thread_local Poco::Arena arena;
+		return arena;
+	}
+}
+
+
+class HTTPReactorServer::OffloadTask: public Poco::Notification
+	/// A parsed request waiting for, or being handled by, an offload
+	/// worker. Owns the request input, from which the request has been
+	/// parsed, and collects the response output.
+{
+public:
+	using Ptr = Poco::AutoPtr<OffloadTask>;
+
+	explicit OffloadTask(const TcpReactorConnectionPtr& conn):
+		pConnection(conn)
+	{
+	}
+
+	std::string finish()
+		/// Destroys the request, response and session, and returns
+		/// the remaining (not yet consumed) input.
+	{
+		pRequest.reset();
+		pResponse.reset();
+		pSession.reset();
+		return std::move(input);
+	}
+
+	void resume(bool close)
+		/// Hands the output and the remaining input back to the
+		/// connection, which is closed if close is true.
+	{
+		std::string pending = finish();
+		pConnection->resume(std::move(output), std::move(pending), close);
+	}
+
+	TcpReactorConnectionPtr                   pConnection;
+	std::string                               input;
+	std::string                               output;
+	std::unique_ptr<HTTPReactorServerSession> pSession;
+	std::unique_ptr<HTTPServerResponseImpl>   pResponse;
+	std::unique_ptr<HTTPServerRequestImpl>    pRequest;
+};
+
+
+class HTTPReactorServer::OffloadPool: public Poco::Runnable
+	/// A fixed number of worker threads handling OffloadTasks
+	/// from a queue of limited depth.
+{
+public:
+	OffloadPool(HTTPReactorServer& server, int threads, int maxQueued):
+		_server(server),
+		_threads(threads),
+		_maxPending(threads + maxQueued),
+		_pending(0),
+		_stopped(false),
+		_pool("HTTPRO", threads, threads)
+	{
+	}
+
+	~OffloadPool() override
+	{
+		try
+		{
+			stop();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+	}
+
+	void start()
+	{
+		for (int i = 0; i < _threads; ++i) _pool.start(*this);
+	}
+
+	void stop()
+	{
+		if (_stopped.exchange(true)) return;
+		_queue.wakeUpAll();
+		_pool.joinAll();
+
+		// Connections of tasks that have not been handled
+		// would stay suspended forever, so they are closed.
+		// The socket is shut down here, as the reactor may
+		// be stopped before it gets to close the connection.
+		Poco::AutoPtr<Poco::Notification> pNf(_queue.dequeueNotification());
+		while (pNf)
+		{
+			auto* pTask = dynamic_cast<OffloadTask*>(pNf.get());
+			if (pTask)
+			{
+				try
+				{
+					StreamSocket socket(pTask->pConnection->socket());
+					socket.shutdown();
+					pTask->resume(true);
+				}
+				catch (...)
+				{
+					poco_unexpected();
+				}
+			}
+			--_pending;
+			pNf = _queue.dequeueNotification();
+		}
+	}
+
+	bool reserve()
+		/// Reserves a place for a task. Returns false
+		/// if the queue depth limit has been reached.
+	{
+		if (_pending.fetch_add(1) >= _maxPending)
+		{
+			--_pending;
+			return false;
+		}
+		return true;
+	}
+
+	void enqueue(const OffloadTask::Ptr& pTask)
+		/// Enqueues a task for which a place has been reserved.
+	{
+		_queue.enqueueNotification(pTask);
+	}
+
+	void run() override
+	{
+		Poco::Arena arena;
+		while (!_stopped)
+		{
+			Poco::AutoPtr<Poco::Notification> pNf(_queue.waitDequeueNotification());
+			auto* pTask = dynamic_cast<OffloadTask*>(pNf.get());
+			if (!pTask) continue;
+			try
+			{
+				Poco::ArenaScope arenaScope(arena, true);
+				_server.runOffloaded(*pTask);
+			}
+			catch (Poco::Exception& exc)
+			{
+				Poco::ErrorHandler::handle(exc);
+			}
+			catch (std::exception& exc)
+			{
+				Poco::ErrorHandler::handle(exc);
+			}
+			catch (...)
+			{
+				Poco::ErrorHandler::handle();
+			}
+			--_pending;
+		}
+	}
+
+private:
+	HTTPReactorServer&    _server;
+	int                   _threads;
+	int                   _maxPending;
+	std::atomic<int>      _pending;
+	std::atomic<bool>     _stopped;
+	Poco::NotificationQueue _queue;
+	Poco::ThreadPool      _pool;
+};
+
+
 HTTPReactorServer::HTTPReactorServer(int port, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory)
 	: _tcpReactorServer(port, pParams)
 {
@@ -32,22 +214,40 @@ HTTPReactorServer::HTTPReactorServer(const SocketAddress& address, HTTPServerPar
 
 HTTPReactorServer::~HTTPReactorServer()
 {
+	_pOffloadPool.reset();
+}
+
+void HTTPReactorServer::setOffloadPool(int threads, int maxQueued, const OffloadFilter& filter)
+{
+	poco_assert (threads > 0 && maxQueued >= 0);
+
+	_pOffloadPool = std::make_unique<OffloadPool>(*this, threads, maxQueued);
+	_offloadFilter = filter;
 }
 
 void HTTPReactorServer::start()
 {
+	if (_pOffloadPool) _pOffloadPool->start();
 	_tcpReactorServer.start();
 }
 
 void HTTPReactorServer::stop()
 {
+	if (_pOffloadPool) _pOffloadPool->stop();
 	_tcpReactorServer.stop();
 }
 
 void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn)
 {
+	if (_pOffloadPool)
+	{
+		offload(conn);
+		return;
+	}
 	try
 	{
+		// session, request and response are destroyed before the arena is reset
+		Poco::ArenaScope arenaScope(reactorArena(), true);
 		HTTPReactorServerSession session(conn->socket(), conn->buffer(), _pParams);
 		if (!session.checkRequestComplete())
 		{
@@ -56,60 +256,138 @@ void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn)
 
 		HTTPServerResponseImpl response(session);
 		HTTPServerRequestImpl request(response, session, _pParams);
+		prepareResponse(request, response);
+		handleRequest(session, request, response);
+	}
+	catch (const Poco::Exception& ex)
+	{
+		onError(ex);
+	}
+}
+
+void HTTPReactorServer::prepareResponse(HTTPServerRequest& request, HTTPServerResponse& response)
+{
+	Poco::Timestamp now;
+	response.setDate(now);
+	response.setVersion(request.getVersion());
+	response.setKeepAlive(request.getKeepAlive());
+	std::string server = _pParams->getSoftwareVersion();
+	if (!server.empty())
+	{
+		response.set("Server", server);
+	}
+}
 
-		Poco::Timestamp now;
-		response.setDate(now);
-		response.setVersion(request.getVersion());
-		response.setKeepAlive(request.getKeepAlive());
-		std::string server = _pParams->getSoftwareVersion();
-		if (!server.empty())
+void HTTPReactorServer::handleRequest(HTTPReactorServerSession& session, HTTPServerRequest& request, HTTPServerResponse& response)
+{
+	try
+	{
+		session.requestTrailer().clear();
+		session.responseTrailer().clear();
+		std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
+		if (pHandler.get())
 		{
-			response.set("Server", server);
-		}
+			if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
+				response.sendContinue();
 
-		try
+			pHandler->handleRequest(request, response);
+			session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive());
+			session.popCompletedRequest();
+		}
+		else
+		{
+			sendErrorResponse(session, HTTPResponse::HTTP_NOT_IMPLEMENTED);
+			session.popCompletedRequest();
+		}
+	}
+	catch (Poco::Exception& e)
+	{
+		if (!response.sent())
 		{
-			session.requestTrailer().clear();
-			session.responseTrailer().clear();
-			std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
-			if (pHandler.get())
+			try
 			{
-				if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
-					response.sendContinue();
-
-				pHandler->handleRequest(request, response);
-				session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive());
+				sendErrorResponse(session, e.code() == 0 ? HTTPResponse::HTTP_INTERNAL_SERVER_ERROR
+														 : HTTPResponse::HTTPStatus(e.code()));
 				session.popCompletedRequest();
 			}
-			else
+			catch (...)
 			{
-				sendErrorResponse(session, HTTPResponse::HTTP_NOT_IMPLEMENTED);
-				session.popCompletedRequest();
 			}
 		}
-		catch (Poco::Exception& e)
+		throw;
+	}
+}
+
+void HTTPReactorServer::offload(const TcpReactorConnectionPtr& conn)
+{
+	// The request is parsed from a buffer owned by the task, so that the
+	// reactor can keep receiving into the connection buffer while the
+	// request is being handled by a worker thread.
+	OffloadTask::Ptr pTask = new OffloadTask(conn);
+	pTask->input.swap(conn->buffer());
+	try
+	{
+		pTask->pSession = std::make_unique<HTTPReactorServerSession>(conn->socket(), pTask->input, _pParams);
+		if (!pTask->pSession->checkRequestComplete())
+		{
+			conn->buffer() = pTask->finish();
+			return;
+		}
+		pTask->pResponse = std::make_unique<HTTPServerResponseImpl>(*pTask->pSession);
+		pTask->pRequest = std::make_unique<HTTPServerRequestImpl>(*pTask->pResponse, *pTask->pSession, _pParams);
+		prepareResponse(*pTask->pRequest, *pTask->pResponse);
+
+		if (_offloadFilter && !_offloadFilter(*pTask->pRequest))
 		{
-			if (!response.sent())
-			{
-				try
-				{
-					sendErrorResponse(session, e.code() == 0 ? HTTPResponse::HTTP_INTERNAL_SERVER_ERROR
-															 : HTTPResponse::HTTPStatus(e.code()));
-					session.popCompletedRequest();
-				}
-				catch (...)
-				{
-				}
-			}
-			throw;
+			handleRequest(*pTask->pSession, *pTask->pRequest, *pTask->pResponse);
 		}
+		else if (!_pOffloadPool->reserve())
+		{
+			sendErrorResponse(*pTask->pSession, HTTPResponse::HTTP_SERVICE_UNAVAILABLE);
+			pTask->pSession->popCompletedRequest();
+		}
+		else
+		{
+			conn->suspend();
+			pTask->pSession->setOutputBuffer(&pTask->output);
+			_pOffloadPool->enqueue(pTask);
+			return;
+		}
+		conn->buffer() = pTask->finish();
 	}
 	catch (const Poco::Exception& ex)
 	{
+		conn->buffer() = pTask->finish();
 		onError(ex);
 	}
 }
 
+void HTTPReactorServer::runOffloaded(OffloadTask& task)
+{
+	bool close = false;
+	try
+	{
+		handleRequest(*task.pSession, *task.pRequest, *task.pResponse);
+	}
+	catch (const Poco::Exception& exc)
+	{
+		// an error response (if any) has been buffered by handleRequest()
+		close = true;
+		Poco::Logger::get("Poco.Net.HTTPReactorServer").error("offloaded request failed: %s", exc.displayText());
+	}
+	catch (const std::exception& exc)
+	{
+		close = true;
+		Poco::Logger::get("Poco.Net.HTTPReactorServer").error("offloaded request failed: %s", std::string(exc.what()));
+	}
+	catch (...)
+	{
+		close = true;
+		Poco::Logger::get("Poco.Net.HTTPReactorServer").error("offloaded request failed");
+	}
+	task.resume(close);
+}
+
 void HTTPReactorServer::sendErrorResponse(HTTPSession& session, HTTPResponse::HTTPStatus status)
 {
 	HTTPServerResponseImpl response(session);
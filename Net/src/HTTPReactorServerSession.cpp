@@ -1,6 +1,7 @@
 #include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPMessage.h"
-#include "Poco/String.h"
+#include "Poco/Net/NetException.h"
+#include <charconv>
 #include <cstddef>
 
 namespace Poco::Net {
@@ -108,50 +109,37 @@ bool HTTPReactorServerSession::checkRequestComplete()
 bool HTTPReactorServerSession::parseHeaders(
 	std::size_t pos, std::size_t& bodyStart, std::size_t& contentLength, bool& isChunked)
 {
-	std::size_t headerEnd = _buf.find("\r\n\r\n", pos);
-	if (headerEnd == std::string::npos)
+	_headerSize = _headers.parse(_buf.data() + pos, _buf.size() - pos);
+	if (_headerSize == 0)
 	{
 		return false; // Incomplete headers
 	}
 
-	bodyStart = headerEnd + 4; // "\r\n\r\n" is 4 characters
-	std::size_t chunkedPos = _buf.find(HTTPMessage::TRANSFER_ENCODING, pos);
-	if (chunkedPos == std::string::npos)
-	{
-		chunkedPos = _buf.find(toLower(HTTPMessage::TRANSFER_ENCODING), pos);
-	}
-	std::size_t chunkedVal = _buf.find(HTTPMessage::CHUNKED_TRANSFER_ENCODING, chunkedPos);
-	std::size_t chunkedLineEnd = _buf.find("\r\n", chunkedPos);
-	if (chunkedPos != std::string::npos && chunkedVal != std::string::npos &&
-		chunkedLineEnd != std::string::npos && chunkedVal < chunkedLineEnd)
-	{
-		isChunked = true;
-		return true;
-	}
-	std::size_t contentLengthPos = _buf.find(HTTPMessage::CONTENT_LENGTH, pos);
-	if(contentLengthPos == std::string::npos)
-	{
-		contentLengthPos = _buf.find(toLower(HTTPMessage::CONTENT_LENGTH), pos);
-	}
-	if (contentLengthPos != std::string::npos)
+	bodyStart = pos + _headerSize;
+	isChunked = _headers.hasToken(HTTPMessage::TRANSFER_ENCODING, HTTPMessage::CHUNKED_TRANSFER_ENCODING);
+	contentLength = 0;
+	if (!isChunked)
 	{
-		std::size_t valueStart = contentLengthPos + 15; // "Content-Length:" is 15 characters
-		std::size_t valueEnd = _buf.find("\r\n", valueStart);
-		if (valueEnd != std::string::npos)
-		{
-			contentLength = std::stoi(_buf.substr(valueStart, valueEnd - valueStart));
-			isChunked = false;
-			return true;
-		} else
+		std::string_view value = _headers.get(HTTPMessage::CONTENT_LENGTH, std::string_view());
+		if (!value.empty())
 		{
-			return false; // Incomplete Content-Length header
+			const char* end = value.data() + value.size();
+			auto [ptr, ec] = std::from_chars(value.data(), end, contentLength);
+			if (ec != std::errc() || ptr != end)
+				throw MessageException("Invalid Content-Length header");
 		}
 	}
-	contentLength = 0;
-	isChunked = false;
 	return true;
 }
 
+const HTTPHeaderView& HTTPReactorServerSession::readHeaders()
+{
+	poco_assert (_complete > 0 && _idx == 0);
+
+	_idx = static_cast<int>(_headerSize);
+	return _headers;
+}
+
 bool HTTPReactorServerSession::parseChunkSize(std::size_t& pos, std::size_t& chunkSize, int& complete)
 {
 
@@ -190,6 +178,8 @@ void HTTPReactorServerSession::popCompletedRequest()
 	}
 	_complete = 0;
 	_idx = 0;
+	_headerSize = 0;
+	_headers.clear();
 	_pcur = const_cast<char*>(_buf.c_str());
 	_pend = _pcur + _buf.length();
 }
@@ -231,8 +221,18 @@ int HTTPReactorServerSession::read(char* buffer, std::streamsize length)
 	return 0;
 }
 
+void HTTPReactorServerSession::setOutputBuffer(std::string* pOutput)
+{
+	_pOutput = pOutput;
+}
+
 int HTTPReactorServerSession::write(const char* buffer, std::streamsize length)
 {
+	if (_pOutput)
+	{
+		_pOutput->append(buffer, static_cast<std::size_t>(length));
+		return static_cast<int>(length);
+	}
 	try
 	{
 		return _realsocket.sendBytes(buffer, (int)length);
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPHeaderView.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/NameValueCollection.h"
 #include "Poco/NumberFormatter.h"
@@ -264,6 +265,31 @@ void HTTPRequest::read(std::istream& istr)
 }
 
 
+void HTTPRequest::read(const HTTPHeaderView& headers)
+{
+	std::string_view line = headers.startLine();
+	std::size_t pos = 0;
+	auto nextToken = [&line, &pos]()
+	{
+		while (pos < line.size() && Poco::Ascii::isSpace(line[pos])) ++pos;
+		std::size_t start = pos;
+		while (pos < line.size() && !Poco::Ascii::isSpace(line[pos])) ++pos;
+		return line.substr(start, pos - start);
+	};
+	std::string_view method = nextToken();
+	if (method.empty()) throw MessageException("No HTTP request header");
+	if (method.size() > MAX_METHOD_LENGTH) throw MessageException("HTTP request method invalid or too long");
+	std::string_view uri = nextToken();
+	if (uri.size() > MAX_URI_LENGTH) throw MessageException("HTTP request URI invalid or too long");
+	std::string_view version = nextToken();
+	if (version.size() > MAX_VERSION_LENGTH) throw MessageException("Invalid HTTP version string");
+	HTTPMessage::read(headers);
+	setMethod(std::string(method));
+	setURI(std::string(uri));
+	setVersion(std::string(version));
+}
+
+
 void HTTPRequest::getCredentials(const std::string& header, std::string& scheme, std::string& authInfo) const
 {
 	scheme.clear();
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTPHeaderView.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/NumberParser.h"
@@ -305,6 +306,32 @@ void HTTPResponse::read(std::istream& istr)
 }
 
 
+void HTTPResponse::read(const HTTPHeaderView& headers)
+{
+	std::string_view line = headers.startLine();
+	std::size_t pos = 0;
+	auto nextToken = [&line, &pos]()
+	{
+		while (pos < line.size() && Poco::Ascii::isSpace(line[pos])) ++pos;
+		std::size_t start = pos;
+		while (pos < line.size() && !Poco::Ascii::isSpace(line[pos])) ++pos;
+		return line.substr(start, pos - start);
+	};
+	std::string_view version = nextToken();
+	if (version.empty()) throw MessageException("No HTTP response header");
+	if (version.size() > MAX_VERSION_LENGTH) throw MessageException("Invalid HTTP version string");
+	std::string_view status = nextToken();
+	if (status.empty() || status.size() > MAX_STATUS_LENGTH) throw MessageException("Invalid HTTP status code");
+	while (pos < line.size() && Poco::Ascii::isSpace(line[pos])) ++pos;
+	std::string_view reason = line.substr(pos);
+	if (reason.size() > MAX_REASON_LENGTH) throw MessageException("HTTP reason string too long");
+	HTTPMessage::read(headers);
+	setVersion(std::string(version));
+	setStatus(std::string(status));
+	setReason(std::string(reason));
+}
+
+
 const std::string& HTTPResponse::getReasonForStatus(HTTPStatus status)
 {
 	switch (status)
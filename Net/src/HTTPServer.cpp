@@ -34,7 +34,7 @@ HTTPServer::HTTPServer(HTTPRequestHandlerFactory::Ptr pFactory, const ServerSock
 
 
 HTTPServer::HTTPServer(HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool, const ServerSocket& socket, HTTPServerParams::Ptr pParams):
-	TCPServer(new HTTPServerConnectionFactory(pParams, pFactory), threadPool, socket, pParams),
+	TCPServer(new HTTPServerConnectionFactory(pParams, pFactory, threadPool), threadPool, socket, pParams),
 	_pFactory(pFactory)
 {
 }
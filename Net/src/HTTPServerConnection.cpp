@@ -14,6 +14,7 @@
 
 #include "Poco/Net/HTTPServerConnection.h"
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTP2ServerSession.h"
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPRequestHandler.h"
@@ -21,8 +22,10 @@
 #include "Poco/Net/NetException.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Timestamp.h"
+#include "Poco/Thread.h"
 #include "Poco/Delegate.h"
 #include <memory>
+#include <cstring>
 
 
 using namespace std::string_literals;
@@ -31,10 +34,11 @@ using namespace std::string_literals;
 namespace Poco::Net {
 
 
-HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory):
+HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool):
 	TCPServerConnection(socket),
 	_pParams(pParams),
 	_pFactory(pFactory),
+	_threadPool(threadPool),
 	_stopped(false)
 {
 	poco_check_ptr (pFactory);
@@ -58,8 +62,16 @@ HTTPServerConnection::~HTTPServerConnection()
 
 void HTTPServerConnection::run()
 {
+	if (_pParams->getHTTP2Enabled() && isHTTP2())
+	{
+		HTTP2ServerSession session(socket(), _pParams, _pFactory, _threadPool);
+		session.run();
+		return;
+	}
+
 	std::string server = _pParams->getSoftwareVersion();
 	HTTPServerSession session(socket(), _pParams);
+	Poco::Arena arena;
 	while (!_stopped && session.hasMoreRequests())
 	{
 		try
@@ -67,6 +79,8 @@ void HTTPServerConnection::run()
 			Poco::FastMutex::ScopedLock lock(_mutex);
 			if (!_stopped)
 			{
+				// request and response are destroyed before the arena is reset
+				Poco::ArenaScope arenaScope(arena, true);
 				HTTPServerResponseImpl response(session);
 				HTTPServerRequestImpl request(response, session, _pParams);
 
@@ -127,6 +141,25 @@ void HTTPServerConnection::run()
 }
 
 
+bool HTTPServerConnection::isHTTP2()
+{
+	const std::string& preface = HTTP2ServerSession::CONNECTION_PREFACE;
+	char buffer[64];
+	Poco::Timestamp start;
+	while (socket().poll(_pParams->getTimeout(), Socket::SELECT_READ))
+	{
+		int n = socket().receiveBytes(buffer, static_cast<int>(preface.size()), MSG_PEEK);
+		if (n <= 0 || std::memcmp(buffer, preface.data(), n) != 0) return false;
+		if (n == static_cast<int>(preface.size())) return true;
+
+		// only part of the preface has arrived yet
+		if (start.isElapsed(_pParams->getTimeout().totalMicroseconds())) return false;
+		Poco::Thread::sleep(10);
+	}
+	return false;
+}
+
+
 void HTTPServerConnection::sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status)
 {
 	HTTPServerResponseImpl response(session);
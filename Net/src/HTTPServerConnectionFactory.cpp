@@ -20,9 +20,10 @@
 namespace Poco::Net {
 
 
-HTTPServerConnectionFactory::HTTPServerConnectionFactory(HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory):
+HTTPServerConnectionFactory::HTTPServerConnectionFactory(HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool):
 	_pParams(pParams),
-	_pFactory(pFactory)
+	_pFactory(pFactory),
+	_threadPool(threadPool)
 {
 	poco_check_ptr (pFactory);
 }
@@ -35,7 +36,7 @@ HTTPServerConnectionFactory::~HTTPServerConnectionFactory()
 
 TCPServerConnection* HTTPServerConnectionFactory::createConnection(const StreamSocket& socket)
 {
-	return new HTTPServerConnection(socket, _pParams, _pFactory);
+	return new HTTPServerConnection(socket, _pParams, _pFactory, _threadPool);
 }
 
 
@@ -28,4 +28,10 @@ HTTPServerRequest::~HTTPServerRequest()
 }
 
 
+Poco::Arena* HTTPServerRequest::arena() const
+{
+	return Poco::Arena::current();
+}
+
+
 } // namespace Poco::Net
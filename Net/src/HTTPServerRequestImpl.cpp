@@ -15,6 +15,7 @@
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/HTTPStream.h"
@@ -35,7 +36,8 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 	_response(response),
 	_session(session),
 	_pStream(nullptr),
-	_pParams(pParams, true)
+	_pParams(pParams, true),
+	_pHeaderView(nullptr)
 {
 	response.attachRequest(this);
 
@@ -43,20 +45,42 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 	setAutoDecode(_pParams->getAutoDecodeHeaders());
 	read(hs);
 
+	init();
+}
+
+
+HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, HTTPReactorServerSession& session, HTTPServerParams* pParams):
+	_response(response),
+	_session(session),
+	_pStream(nullptr),
+	_pParams(pParams, true),
+	_pHeaderView(&session.readHeaders())
+{
+	response.attachRequest(this);
+
+	setAutoDecode(_pParams->getAutoDecodeHeaders());
+	read(*_pHeaderView);
+
+	init();
+}
+
+
+void HTTPServerRequestImpl::init()
+{
 	// Now that we know socket is still connected, obtain addresses
-	_clientAddress = session.clientAddress();
-	_serverAddress = session.serverAddress();
+	_clientAddress = _session.clientAddress();
+	_serverAddress = _session.serverAddress();
 
 	if (getChunkedTransferEncoding())
-		_pStream = new HTTPChunkedInputStream(session, &session.requestTrailer());
+		_pStream = new HTTPChunkedInputStream(_session, &_session.requestTrailer());
 	else if (hasContentLength())
 #if defined(POCO_HAVE_INT64)
-		_pStream = new HTTPFixedLengthInputStream(session, getContentLength64());
+		_pStream = new HTTPFixedLengthInputStream(_session, getContentLength64());
 #else
-		_pStream = new HTTPFixedLengthInputStream(session, getContentLength());
+		_pStream = new HTTPFixedLengthInputStream(_session, getContentLength());
 #endif
-	else 
-		_pStream = new HTTPFixedLengthInputStream(session, 0);
+	else
+		_pStream = new HTTPFixedLengthInputStream(_session, 0);
 }
 
 
@@ -80,6 +104,11 @@ StreamSocket& HTTPServerRequestImpl::socket()
 
 StreamSocket HTTPServerRequestImpl::detachSocket()
 {
+	// send any response data held back for pipelined requests
+	// before the socket is taken over (e.g., by a WebSocket)
+	HTTPServerSession* pServerSession = dynamic_cast<HTTPServerSession*>(&_session);
+	if (pServerSession) pServerSession->flush();
+
 	return _session.detachSocket();
 }
 
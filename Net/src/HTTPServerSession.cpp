@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/NetException.h"
 
 
 namespace Poco::Net {
@@ -31,6 +32,13 @@ HTTPServerSession::HTTPServerSession(const StreamSocket& socket, HTTPServerParam
 
 HTTPServerSession::~HTTPServerSession()
 {
+	try
+	{
+		flush();
+	}
+	catch (...)
+	{
+	}
 }
 
 
@@ -42,15 +50,25 @@ bool HTTPServerSession::hasMoreRequests()
 	{
 		_firstRequest = false;
 		--_maxKeepAliveRequests;
+		// Request data may already have been read into a buffer
+		// of the socket implementation (e.g., by SSL_peek() when
+		// checking for the HTTP/2 connection preface).
+		if (socket().available() > 0) return true;
 		return socket().poll(getTimeout(), Socket::SELECT_READ);
 	}
 	else if (_maxKeepAliveRequests != 0 && getKeepAlive())
 	{
 		if (_maxKeepAliveRequests > 0)
 			--_maxKeepAliveRequests;
-		return buffered() > 0 || socket().poll(_keepAliveTimeout, Socket::SELECT_READ);
+		if (buffered() > 0) return true;
+		flush();
+		return socket().poll(_keepAliveTimeout, Socket::SELECT_READ);
+	}
+	else
+	{
+		flush();
+		return false;
 	}
-	else return false;
 }
 
 
@@ -66,4 +84,100 @@ SocketAddress HTTPServerSession::serverAddress()
 }
 
 
+void HTTPServerSession::flush()
+{
+	if (!_output.empty())
+	{
+		std::string output;
+		output.swap(_output);
+		send(output.data(), static_cast<std::streamsize>(output.size()));
+	}
+}
+
+
+int HTTPServerSession::get()
+{
+	if (buffered() == 0) flush();
+	return HTTPSession::get();
+}
+
+
+int HTTPServerSession::peek()
+{
+	if (buffered() == 0) flush();
+	return HTTPSession::peek();
+}
+
+
+int HTTPServerSession::read(char* buffer, std::streamsize length)
+{
+	if (buffered() == 0) flush();
+	return HTTPSession::read(buffer, length);
+}
+
+
+int HTTPServerSession::write(const char* buffer, std::streamsize length)
+{
+	if (_output.empty() && buffered() == 0)
+		return HTTPSession::write(buffer, length);
+
+	// more request data has already been received, so
+	// hold back the response until it can be sent together
+	// with the responses to the following requests
+	if (_output.size() + length <= MAX_OUTPUT_BUFFER_SIZE)
+	{
+		_output.append(buffer, static_cast<std::size_t>(length));
+	}
+	else
+	{
+		std::string output;
+		output.swap(_output);
+		SocketBufVec buffers;
+		buffers.push_back(Socket::makeBuffer(const_cast<char*>(output.data()), output.size()));
+		buffers.push_back(Socket::makeBuffer(const_cast<char*>(buffer), static_cast<std::size_t>(length)));
+		int sent = 0;
+		try
+		{
+			sent = socket().sendBytes(buffers);
+		}
+		catch (Poco::Exception& exc)
+		{
+			setException(exc);
+			throw;
+		}
+		if (sent < 0) sent = 0;
+		if (static_cast<std::size_t>(sent) < output.size())
+		{
+			send(output.data() + sent, static_cast<std::streamsize>(output.size() - sent));
+			sent = 0;
+		}
+		else sent -= static_cast<int>(output.size());
+		if (sent < length)
+		{
+			send(buffer + sent, length - sent);
+		}
+	}
+	return static_cast<int>(length);
+}
+
+
+void HTTPServerSession::send(const char* buffer, std::streamsize length)
+{
+	while (length > 0)
+	{
+		int n = HTTPSession::write(buffer, length);
+		if (n <= 0)
+		{
+			// the response would be truncated, so the connection
+			// must not be kept alive
+			NetException exc("Failed to send response data");
+			setException(exc);
+			throw exc;
+		}
+		buffer += n;
+		length -= n;
+	}
+}
+
+
 } // namespace Poco::Net
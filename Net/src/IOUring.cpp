@@ -0,0 +1,225 @@
+//
+// IOUring.cpp
+//
+// Library: Net
+// Package: Sockets
+// Module:  IOUring
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/IOUring.h"
+
+
+#if defined(POCO_HAVE_IO_URING)
+
+
+#include "Poco/Exception.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <signal.h>
+#include <cerrno>
+#include <cstring>
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	int sysSetup(unsigned entries, io_uring_params* p)
+	{
+		return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+	}
+
+	int sysEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, const void* arg, std::size_t argSize)
+	{
+		return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+	}
+
+	const unsigned REQUIRED_FEATURES =
+#if defined(IORING_FEAT_EXT_ARG)
+		IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+#else
+		0;
+#endif
+}
+
+
+IOUring::IOUring(unsigned entries):
+	_fd(-1),
+	_features(0),
+	_pSQRing(MAP_FAILED),
+	_sqRingSize(0),
+	_pCQRing(MAP_FAILED),
+	_cqRingSize(0),
+	_sqes(static_cast<io_uring_sqe*>(MAP_FAILED)),
+	_sqesSize(0),
+	_sqHead(nullptr),
+	_sqTail(nullptr),
+	_sqArray(nullptr),
+	_sqMask(0),
+	_sqEntries(0),
+	_sqeTail(0),
+	_cqHead(nullptr),
+	_cqTail(nullptr),
+	_cqes(nullptr),
+	_cqMask(0)
+{
+#if !defined(IORING_FEAT_EXT_ARG)
+	throw Poco::IOException("io_uring kernel headers too old");
+#endif
+	io_uring_params params;
+	std::memset(&params, 0, sizeof(params));
+	_fd = sysSetup(entries, &params);
+	if (_fd < 0) throw Poco::IOException("io_uring_setup() failed", std::strerror(errno), errno);
+
+	_features = params.features;
+	if ((_features & REQUIRED_FEATURES) != REQUIRED_FEATURES)
+	{
+		::close(_fd);
+		throw Poco::IOException("io_uring kernel support insufficient");
+	}
+
+	_sqRingSize = params.sq_off.array + params.sq_entries*sizeof(unsigned);
+	_cqRingSize = params.cq_off.cqes + params.cq_entries*sizeof(io_uring_cqe);
+	if (_features & IORING_FEAT_SINGLE_MMAP)
+	{
+		if (_cqRingSize > _sqRingSize) _sqRingSize = _cqRingSize;
+		_cqRingSize = _sqRingSize;
+	}
+	_pSQRing = ::mmap(nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+	if (_pSQRing != MAP_FAILED)
+	{
+		if (_features & IORING_FEAT_SINGLE_MMAP)
+			_pCQRing = _pSQRing;
+		else
+			_pCQRing = ::mmap(nullptr, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_CQ_RING);
+	}
+	if (_pCQRing != MAP_FAILED)
+	{
+		_sqesSize = params.sq_entries*sizeof(io_uring_sqe);
+		_sqes = static_cast<io_uring_sqe*>(::mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQES));
+	}
+	if (_sqes == MAP_FAILED)
+	{
+		int err = errno;
+		unmap();
+		::close(_fd);
+		throw Poco::IOException("io_uring mmap() failed", std::strerror(err), err);
+	}
+
+	char* pSQ = static_cast<char*>(_pSQRing);
+	_sqHead    = reinterpret_cast<std::atomic<unsigned>*>(pSQ + params.sq_off.head);
+	_sqTail    = reinterpret_cast<std::atomic<unsigned>*>(pSQ + params.sq_off.tail);
+	_sqArray   = reinterpret_cast<unsigned*>(pSQ + params.sq_off.array);
+	_sqMask    = *reinterpret_cast<unsigned*>(pSQ + params.sq_off.ring_mask);
+	_sqEntries = *reinterpret_cast<unsigned*>(pSQ + params.sq_off.ring_entries);
+	_sqeTail   = _sqTail->load(std::memory_order_relaxed);
+
+	char* pCQ = static_cast<char*>(_pCQRing);
+	_cqHead = reinterpret_cast<std::atomic<unsigned>*>(pCQ + params.cq_off.head);
+	_cqTail = reinterpret_cast<std::atomic<unsigned>*>(pCQ + params.cq_off.tail);
+	_cqes   = reinterpret_cast<io_uring_cqe*>(pCQ + params.cq_off.cqes);
+	_cqMask = *reinterpret_cast<unsigned*>(pCQ + params.cq_off.ring_mask);
+}
+
+
+IOUring::~IOUring()
+{
+	unmap();
+	if (_fd >= 0) ::close(_fd);
+}
+
+
+void IOUring::unmap()
+{
+	if (_sqes != MAP_FAILED) ::munmap(_sqes, _sqesSize);
+	if (_pCQRing != MAP_FAILED && _pCQRing != _pSQRing) ::munmap(_pCQRing, _cqRingSize);
+	if (_pSQRing != MAP_FAILED) ::munmap(_pSQRing, _sqRingSize);
+	_sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+	_pCQRing = _pSQRing = MAP_FAILED;
+}
+
+
+io_uring_sqe* IOUring::getSQE()
+{
+	const unsigned head = _sqHead->load(std::memory_order_acquire);
+	if (_sqeTail - head >= _sqEntries) return nullptr;
+
+	const unsigned index = _sqeTail & _sqMask;
+	io_uring_sqe* pSQE = &_sqes[index];
+	std::memset(pSQE, 0, sizeof(io_uring_sqe));
+	_sqArray[index] = index;
+	++_sqeTail;
+	return pSQE;
+}
+
+
+unsigned IOUring::flush()
+{
+	_sqTail->store(_sqeTail, std::memory_order_release);
+	return _sqeTail - _sqHead->load(std::memory_order_acquire);
+}
+
+
+int IOUring::enter(unsigned toSubmit, unsigned waitNr, const Poco::Timespan* pTimeout)
+{
+	unsigned flags = waitNr ? IORING_ENTER_GETEVENTS : 0;
+	int rc;
+#if defined(IORING_FEAT_EXT_ARG)
+	if (pTimeout)
+	{
+		__kernel_timespec ts;
+		ts.tv_sec  = pTimeout->totalSeconds();
+		ts.tv_nsec = static_cast<long long>(pTimeout->useconds())*1000;
+		io_uring_getevents_arg arg;
+		std::memset(&arg, 0, sizeof(arg));
+		arg.sigmask_sz = _NSIG/8;
+		arg.ts = reinterpret_cast<std::uint64_t>(&ts);
+		rc = sysEnter(_fd, toSubmit, waitNr, flags | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+	}
+	else
+#endif
+	{
+		rc = sysEnter(_fd, toSubmit, waitNr, flags, nullptr, _NSIG/8);
+	}
+	return rc < 0 ? -errno : rc;
+}
+
+
+int IOUring::submit()
+{
+	unsigned toSubmit = flush();
+	if (toSubmit == 0) return 0;
+	return enter(toSubmit, 0);
+}
+
+
+bool IOUring::isAvailable()
+{
+	static const bool available = []()
+	{
+		try
+		{
+			IOUring ring(2);
+			return true;
+		}
+		catch (Poco::Exception&)
+		{
+			return false;
+		}
+	}();
+	return available;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // POCO_HAVE_IO_URING
@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/MessageHeader.h"
+#include "Poco/Net/HTTPHeaderView.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/String.h"
 #include "Poco/Ascii.h"
@@ -135,6 +136,45 @@ void MessageHeader::read(std::istream& istr)
 }
 
 
+void MessageHeader::read(const HTTPHeaderView& headers)
+{
+	const std::size_t size = headers.size();
+	if (_fieldLimit > 0 && size > static_cast<std::size_t>(_fieldLimit))
+		throw MessageException("Too many header fields");
+
+	std::string name;
+	std::string value;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		std::string_view n = headers.name(i);
+		std::string_view v = headers.value(i);
+		if (n.size() > static_cast<std::size_t>(_nameLengthLimit))
+			throw MessageException("Field name too long/no colon found");
+		if (v.size() > static_cast<std::size_t>(_valueLengthLimit))
+			throw MessageException("Field value too long/no CRLF found");
+
+		name.assign(n);
+		if (v.find('\n') == std::string_view::npos)
+		{
+			value.assign(v);
+		}
+		else
+		{
+			value.clear();
+			for (char c: v)
+			{
+				if (c != '\r' && c != '\n') value += c;
+			}
+		}
+		if (_autoDecode)
+			add(name, decodeWord(value));
+		else
+			add(name, value);
+	}
+	_decodedOnRead = _autoDecode;
+}
+
+
 void MessageHeader::setAutoDecode(bool decode)
 {
 	_autoDecode = decode;
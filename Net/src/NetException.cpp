@@ -49,6 +49,7 @@ POCO_IMPLEMENT_EXCEPTION(HTMLFormException, NetException, "HTML Form Exception")
 POCO_IMPLEMENT_EXCEPTION(WebSocketException, NetException, "WebSocket Exception")
 POCO_IMPLEMENT_EXCEPTION(UnsupportedFamilyException, NetException, "Unknown or unsupported socket family")
 POCO_IMPLEMENT_EXCEPTION(AddressFamilyMismatchException, NetException, "Address family mismatch")
+POCO_IMPLEMENT_EXCEPTION(HTTP2Exception, NetException, "HTTP/2 Exception")
 
 
 } // namespace Poco::Net
@@ -35,11 +35,52 @@
 		#include "Poco/Pipe.h"
 	#endif
 #endif
+#if defined(POCO_HAVE_IO_URING)
+	#include "Poco/Net/IOUring.h"
+	#include <sys/eventfd.h>
+	#include <poll.h>
+	#include <unistd.h>
+	#include <unordered_map>
+#endif
 
 
 namespace Poco::Net {
 
 
+class PollSetImpl
+	/// Interface for PollSet implementations.
+{
+public:
+	virtual ~PollSetImpl() = default;
+
+	virtual void add(const Socket& socket, int mode) = 0;
+	virtual void remove(const Socket& socket) = 0;
+	virtual void update(const Socket& socket, int mode) = 0;
+	virtual bool has(const Socket& socket) const = 0;
+	virtual bool empty() const = 0;
+	virtual void clear() = 0;
+	virtual PollSet::SocketModeMap poll(const Poco::Timespan& timeout) = 0;
+	virtual void wakeUp() = 0;
+	virtual std::size_t size() const = 0;
+
+protected:
+	static void error()
+	{
+		SocketImpl::error();
+	}
+
+	static void error(int code)
+	{
+		SocketImpl::error(code);
+	}
+
+	static int lastError()
+	{
+		return SocketImpl::lastError();
+	}
+};
+
+
 #if defined(POCO_HAVE_FD_EPOLL)
 
 //
@@ -58,7 +99,7 @@ namespace
 #endif // WEPOLL_H_
 
 
-class PollSetImpl
+class EPollImpl: public PollSetImpl
 {
 public:
 	using Mutex = Poco::FastMutex;
@@ -68,7 +109,7 @@ public:
 
 	static const epoll_event EPOLL_NULL_EVENT;
 
-	PollSetImpl(): _events(FD_SETSIZE, EPOLL_NULL_EVENT),
+	EPollImpl(): _events(FD_SETSIZE, EPOLL_NULL_EVENT),
 		_eventfd(eventfd(0, 0)),
 		_epollfd(epoll_create(1))
 	{
@@ -79,11 +120,11 @@ public:
 		if ((err) || (_epollfd < 0))
 #endif
 		{
-			SocketImpl::error();
+			error();
 		}
 	}
 
-	~PollSetImpl()
+	~EPollImpl() override
 	{
 		// Signal shutdown, close fds to wake up epoll_wait(), then wait
 		// for poll() to exit before freeing memory (since epoll_wait()
@@ -98,24 +139,24 @@ public:
 		_pollLock.wait();
 	}
 
-	void add(const Socket& socket, int mode)
+	void add(const Socket& socket, int mode) override
 	{
 		int newMode = getNewMode(socket.impl(), mode);
 		int err = addImpl(socket, newMode);
 		if (err)
 		{
 			if (errno == EEXIST) update(socket, newMode);
-			else SocketImpl::error();
+			else error();
 		}
 	}
 
-	void update(const Socket& socket, int mode)
+	void update(const Socket& socket, int mode) override
 	{
 		int err = updateImpl(socket, mode);
-		if (err) SocketImpl::error();
+		if (err) error();
 	}
 
-	void remove(const Socket& socket)
+	void remove(const Socket& socket) override
 	{
 		poco_socket_t fd = socket.impl()->sockfd();
 		struct epoll_event ev;
@@ -123,12 +164,12 @@ public:
 		ev.data.ptr = nullptr;
 
 		int err = epoll_ctl(_epollfd, EPOLL_CTL_DEL, fd, &ev);
-		if (err) SocketImpl::error();
+		if (err) error();
 		ScopedLock lock(_mutex);
 		_socketMap.erase(socket.impl());
 	}
 
-	bool has(const Socket& socket) const
+	bool has(const Socket& socket) const override
 	{
 		SocketImpl* sockImpl = socket.impl();
 		ScopedLock lock(_mutex);
@@ -136,13 +177,13 @@ public:
 			(_socketMap.find(sockImpl) != _socketMap.end());
 	}
 
-	bool empty() const
+	bool empty() const override
 	{
 		ScopedLock lock(_mutex);
 		return _socketMap.empty();
 	}
 
-	void clear()
+	void clear() override
 	{
 		{
 			ScopedLock lock(_mutex);
@@ -151,9 +192,9 @@ public:
 			_socketMap.clear();
 			_epollfd = epoll_create(1);
 #ifdef WEPOLL_H_
-			if (!_epollfd) SocketImpl::error();
+			if (!_epollfd) error();
 #else
-			if (_epollfd < 0) SocketImpl::error();
+			if (_epollfd < 0) error();
 #endif
 		}
 #ifndef WEPOLL_H_
@@ -163,7 +204,7 @@ public:
 		addFD(_eventfd, PollSet::POLL_READ, EPOLL_CTL_ADD);
 	}
 
-	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout) override
 	{
 		PollSet::SocketModeMap result;
 		Poco::Timespan remainingTime(timeout);
@@ -193,7 +234,7 @@ public:
 			else if (rc < 0)
 			{
 				// if interrupted and there's still time left, keep waiting
-				if (SocketImpl::lastError() == POCO_EINTR)
+				if (lastError() == POCO_EINTR)
 				{
 					if (!pollLock.isClosed() && keepWaiting(start, remainingTime)) continue;
 				}
@@ -201,7 +242,7 @@ public:
 				{
 					return result;
 				}
-				else SocketImpl::error();
+				else error();
 			}
 			break;
 		}
@@ -242,7 +283,7 @@ public:
 		return result;
 	}
 
-	void wakeUp()
+	void wakeUp() override
 	{
 		if (_pollLock.isClosed())
 			return;
@@ -258,7 +299,7 @@ public:
 #endif
 	}
 
-	std::size_t size() const
+	std::size_t size() const override
 	{
 		ScopedLock lock(_mutex);
 		return _socketMap.size();
@@ -354,7 +395,10 @@ private:
 };
 
 
-const epoll_event PollSetImpl::EPOLL_NULL_EVENT = {0, {nullptr}};
+const epoll_event EPollImpl::EPOLL_NULL_EVENT = {0, {nullptr}};
+
+
+using NativePollSetImpl = EPollImpl;
 
 
 #elif defined(POCO_HAVE_FD_POLL)
@@ -363,16 +407,16 @@ const epoll_event PollSetImpl::EPOLL_NULL_EVENT = {0, {nullptr}};
 //
 // BSD/Windows implementation using poll/WSAPoll
 //
-class PollSetImpl
+class PollImpl: public PollSetImpl
 {
 public:
-	PollSetImpl()
+	PollImpl()
 	{
 		pollfd fd{_pipe.readHandle(), POLLIN, 0};
 		_pollfds.push_back(fd);
 	}
 
-	~PollSetImpl()
+	~PollImpl() override
 	{
 		// Signal shutdown, close pipe to wake up poll(), then wait
 		// for poll() to exit before freeing memory (since ::poll()
@@ -382,7 +426,7 @@ public:
 		_pollLock.wait();
 	}
 
-	void add(const Socket& socket, int mode)
+	void add(const Socket& socket, int mode) override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		poco_socket_t fd = socket.impl()->sockfd();
@@ -391,7 +435,7 @@ public:
 		_socketMap[fd] = socket;
 	}
 
-	void remove(const Socket& socket)
+	void remove(const Socket& socket) override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		poco_socket_t fd = socket.impl()->sockfd();
@@ -400,7 +444,7 @@ public:
 		_socketMap.erase(fd);
 	}
 
-	bool has(const Socket& socket) const
+	bool has(const Socket& socket) const override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		SocketImpl* sockImpl = socket.impl();
@@ -408,13 +452,13 @@ public:
 			(_socketMap.find(sockImpl->sockfd()) != _socketMap.end());
 	}
 
-	bool empty() const
+	bool empty() const override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		return _socketMap.empty();
 	}
 
-	void update(const Socket& socket, int mode)
+	void update(const Socket& socket, int mode) override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		poco_socket_t fd = socket.impl()->sockfd();
@@ -429,7 +473,7 @@ public:
 		}
 	}
 
-	void clear()
+	void clear() override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 
@@ -439,7 +483,7 @@ public:
 		_pollfds.reserve(1);
 	}
 
-	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout) override
 	{
 		PollSet::SocketModeMap result;
 
@@ -485,7 +529,7 @@ public:
 		{
 			Poco::Timestamp start;
 			rc = ::poll(_pollfds.data(), _pollfds.size(), remainingTime.totalMilliseconds());
-			if (rc < 0 && SocketImpl::lastError() == POCO_EINTR)
+			if (rc < 0 && lastError() == POCO_EINTR)
 			{
 				Poco::Timestamp end;
 				Poco::Timespan waited = end - start;
@@ -495,12 +539,12 @@ public:
 					remainingTime = 0;
 			}
 		}
-		while (rc < 0 && SocketImpl::lastError() == POCO_EINTR && !pollLock.isClosed());
+		while (rc < 0 && lastError() == POCO_EINTR && !pollLock.isClosed());
 
 		if (pollLock.isClosed())
 			return result;
 
-		if (rc < 0) SocketImpl::error();
+		if (rc < 0) error();
 
 		if (_pollfds[0].revents & POLLIN)
 		{
@@ -531,7 +575,7 @@ public:
 		return result;
 	}
 
-	void wakeUp()
+	void wakeUp() override
 	{
 		static const char c = 1;
 		if (_pollLock.isClosed())
@@ -539,7 +583,7 @@ public:
 		_pipe.writeBytes(&c, 1);
 	}
 
-	std::size_t size() const
+	std::size_t size() const override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		return _socketMap.size();
@@ -565,59 +609,62 @@ private:
 };
 
 
+using NativePollSetImpl = PollImpl;
+
+
 #else
 
 
 //
 // Fallback implementation using select()
 //
-class PollSetImpl
+class SelectImpl: public PollSetImpl
 {
 public:
-	~PollSetImpl()
+	~SelectImpl() override
 	{
 		// Wait for poll() to exit before freeing memory.
 		// Note: select() cannot be woken up, so we just wait for timeout.
 		_pollLock.close();
 	}
 
-	void add(const Socket& socket, int mode)
+	void add(const Socket& socket, int mode) override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		_map[socket] = mode;
 	}
 
-	void remove(const Socket& socket)
+	void remove(const Socket& socket) override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		_map.erase(socket);
 	}
 
-	bool has(const Socket& socket) const
+	bool has(const Socket& socket) const override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		return _map.find(socket) != _map.end();
 	}
 
-	bool empty() const
+	bool empty() const override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		return _map.empty();
 	}
 
-	void update(const Socket& socket, int mode)
+	void update(const Socket& socket, int mode) override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		_map[socket] = mode;
 	}
 
-	void clear()
+	void clear() override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		_map.clear();
 	}
 
-	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout) override
 	{
 		PollSet::SocketModeMap result;
 		fd_set fdRead;
@@ -671,7 +718,7 @@ public:
 			tv.tv_usec = (long) remainingTime.useconds();
 			Poco::Timestamp start;
 			rc = ::select(nfd + 1, &fdRead, &fdWrite, &fdExcept, &tv);
-			if (rc < 0 && SocketImpl::lastError() == POCO_EINTR)
+			if (rc < 0 && lastError() == POCO_EINTR)
 			{
 				Poco::Timestamp end;
 				Poco::Timespan waited = end - start;
@@ -681,12 +728,12 @@ public:
 					remainingTime = 0;
 			}
 		}
-		while (rc < 0 && SocketImpl::lastError() == POCO_EINTR && !pollLock.isClosed());
+		while (rc < 0 && lastError() == POCO_EINTR && !pollLock.isClosed());
 
 		if (pollLock.isClosed())
 			return result;
 
-		if (rc < 0) SocketImpl::error();
+		if (rc < 0) error();
 
 		Poco::FastMutex::ScopedLock lock(_mutex);
 
@@ -713,12 +760,12 @@ public:
 		return result;
 	}
 
-	void wakeUp()
+	void wakeUp() override
 	{
 		// TODO
 	}
 
-	std::size_t size() const
+	std::size_t size() const override
 	{
 		Poco::FastMutex::ScopedLock lock(_mutex);
 		return _map.size();
@@ -731,11 +778,397 @@ private:
 };
 
 
+using NativePollSetImpl = SelectImpl;
+
+
+#endif
+
+
+#if defined(POCO_HAVE_IO_URING)
+
+
+//
+// Linux implementation using io_uring
+//
+class IOUringImpl: public PollSetImpl
+	/// Readiness polling on top of io_uring one-shot IORING_OP_POLL_ADD
+	/// requests.
+	///
+	/// Registration changes made while no poll() is in progress are only
+	/// queued in the submission ring and handed to the kernel, together
+	/// with the re-arming requests for sockets that fired during the
+	/// previous poll(), by the single io_uring_enter() call that also waits
+	/// for completions. Level-triggered semantics are preserved, since a
+	/// re-armed request for a socket that is still ready completes
+	/// immediately.
+	///
+	/// As a pending poll request holds a reference to the socket, sockets
+	/// should be removed from the PollSet before they are closed.
+{
+public:
+	using Mutex = Poco::FastMutex;
+	using ScopedLock = Mutex::ScopedLock;
+
+	IOUringImpl():
+		_ring(RING_ENTRIES),
+		_eventfd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+	{
+		if (_eventfd < 0) error();
+		ScopedLock lock(_mutex);
+		armWakeUp();
+		submit();
+	}
+
+	~IOUringImpl() override
+	{
+		// Signal shutdown and wake up a waiting poll(), which then
+		// must exit before the ring can be destroyed.
+		_pollLock.markClosed();
+		std::uint64_t val = 1;
+		[[maybe_unused]] auto n = write(_eventfd, &val, sizeof(val));
+		_pollLock.wait();
+		close(_eventfd);
+	}
+
+	void add(const Socket& socket, int mode) override
+	{
+		SocketImpl* sockImpl = socket.impl();
+		poco_check_ptr(sockImpl);
+		if (sockImpl->sockfd() == POCO_INVALID_SOCKET) error(EBADF);
+
+		ScopedLock lock(_mutex);
+		auto it = _socketMap.find(sockImpl);
+		if (it == _socketMap.end()) it = _socketMap.emplace(sockImpl, Entry{socket}).first;
+		Entry& entry = it->second;
+		int newMode = entry.mode | mode;
+		if (entry.token && newMode == entry.mode) return;
+		entry.mode = newMode;
+		disarm(entry);
+		arm(sockImpl, entry);
+		submitIfWaiting();
+	}
+
+	void update(const Socket& socket, int mode) override
+	{
+		SocketImpl* sockImpl = socket.impl();
+		poco_check_ptr(sockImpl);
+		if (sockImpl->sockfd() == POCO_INVALID_SOCKET) error(EBADF);
+
+		ScopedLock lock(_mutex);
+		auto it = _socketMap.find(sockImpl);
+		if (it == _socketMap.end()) it = _socketMap.emplace(sockImpl, Entry{socket}).first;
+		Entry& entry = it->second;
+		entry.mode = mode;
+		disarm(entry);
+		arm(sockImpl, entry);
+		submitIfWaiting();
+	}
+
+	void remove(const Socket& socket) override
+	{
+		ScopedLock lock(_mutex);
+		auto it = _socketMap.find(socket.impl());
+		if (it != _socketMap.end())
+		{
+			disarm(it->second);
+			_socketMap.erase(it);
+			submitIfWaiting();
+		}
+	}
+
+	bool has(const Socket& socket) const override
+	{
+		SocketImpl* sockImpl = socket.impl();
+		ScopedLock lock(_mutex);
+		return sockImpl &&
+			(_socketMap.find(sockImpl) != _socketMap.end());
+	}
+
+	bool empty() const override
+	{
+		ScopedLock lock(_mutex);
+		return _socketMap.empty();
+	}
+
+	void clear() override
+	{
+		ScopedLock lock(_mutex);
+		for (auto& s: _socketMap) disarm(s.second);
+		_socketMap.clear();
+		submitIfWaiting();
+	}
+
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout) override
+	{
+		PollSet::SocketModeMap result;
+		Poco::Timespan remainingTime(timeout);
+
+		ScopedIOLock pollLock(_pollLock);
+		if (!pollLock)
+			return result;
+
+		while (true)
+		{
+			unsigned toSubmit;
+			{
+				ScopedLock lock(_mutex);
+				toSubmit = _ring.flush();
+				_waiting = true;
+			}
+			Poco::Timestamp start;
+			int rc = _ring.enter(toSubmit, 1, &remainingTime);
+			bool wokenUp = false;
+			{
+				ScopedLock lock(_mutex);
+				_waiting = false;
+				_ring.reap([&](const io_uring_cqe& cqe)
+				{
+					onCompletion(cqe, result, wokenUp);
+				});
+			}
+			if (pollLock.isClosed())
+				return PollSet::SocketModeMap();
+
+			// -ETIME: timeout expired, -EINTR: interrupted,
+			// -EBUSY/-EAGAIN: completion backlog, reaped above
+			if (rc < 0 && rc != -ETIME && rc != -EINTR && rc != -EBUSY && rc != -EAGAIN)
+				error(-rc);
+
+			if (!result.empty() || wokenUp || !keepWaiting(start, remainingTime))
+				break;
+		}
+		return result;
+	}
+
+	void wakeUp() override
+	{
+		if (_pollLock.isClosed())
+			return;
+		// Errors are ignored.
+		std::uint64_t val = 1;
+		[[maybe_unused]] auto n = write(_eventfd, &val, sizeof(val));
+	}
+
+	std::size_t size() const override
+	{
+		ScopedLock lock(_mutex);
+		return _socketMap.size();
+	}
+
+private:
+	struct Entry
+	{
+		Socket        socket;
+		int           mode = 0;
+		std::uint64_t token = 0;
+			/// user_data of the pending poll request, 0 if not armed
+	};
+
+	using SocketMap = std::unordered_map<void*, Entry>;
+	using TokenMap = std::unordered_map<std::uint64_t, void*>;
+
+	enum : std::uint64_t
+	{
+		INTERNAL_TOKEN = 0, /// poll removal requests; completions are ignored
+		WAKEUP_TOKEN   = 1, /// eventfd poll request
+		FIRST_TOKEN    = 2
+	};
+
+	enum
+	{
+		RING_ENTRIES = 4096
+	};
+
+	void onCompletion(const io_uring_cqe& cqe, PollSet::SocketModeMap& result, bool& wokenUp)
+	{
+		if (cqe.user_data == INTERNAL_TOKEN) return;
+		if (cqe.user_data == WAKEUP_TOKEN)
+		{
+			std::uint64_t val;
+			if (read(_eventfd, &val, sizeof(val)) < 0 && errno != EAGAIN)
+				poco_debugger_msg("eventfd read failed");
+			wokenUp = true;
+			armWakeUp();
+			return;
+		}
+
+		// completions for requests that have been cancelled
+		// through update()/remove()/clear() are not in the token map
+		auto itt = _tokenMap.find(cqe.user_data);
+		if (itt == _tokenMap.end()) return;
+		void* key = itt->second;
+		_tokenMap.erase(itt);
+
+		auto it = _socketMap.find(key);
+		if (it == _socketMap.end()) return;
+		Entry& entry = it->second;
+		entry.token = 0;
+
+		if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+		{
+			arm(key, entry);
+			return;
+		}
+		if (cqe.res < 0)
+		{
+			// The request failed, e.g. with EBADF for a socket that has been
+			// closed without being removed. Re-arming would fail again at once,
+			// so the error is reported once and the socket stays unarmed
+			// until update() or remove() is called.
+			result[entry.socket] |= PollSet::POLL_ERROR;
+			return;
+		}
+
+		int mode = 0;
+		if (cqe.res & (POLLIN | POLLRDNORM | POLLHUP))
+			mode |= PollSet::POLL_READ;
+		if (cqe.res & (POLLOUT | POLLWRNORM))
+			mode |= PollSet::POLL_WRITE;
+		if (cqe.res & POLLERR)
+			mode |= PollSet::POLL_ERROR;
+		if (mode) result[entry.socket] |= mode;
+		arm(key, entry);
+	}
+
+	io_uring_sqe* getSQE()
+	{
+		io_uring_sqe* pSQE = _ring.getSQE();
+		if (!pSQE)
+		{
+			// submission ring is full, hand it over to the kernel
+			int rc = _ring.submit();
+			if (rc < 0) error(-rc);
+			pSQE = _ring.getSQE();
+			if (!pSQE) error(EBUSY);
+		}
+		return pSQE;
+	}
+
+	static std::uint32_t pollEvents(int mode)
+	{
+		std::uint32_t events = 0;
+		if (mode & PollSet::POLL_READ)
+			events |= POLLIN;
+		if (mode & PollSet::POLL_WRITE)
+			events |= POLLOUT;
+		if (mode & PollSet::POLL_ERROR)
+			events |= POLLERR;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		events = (events << 16) | (events >> 16);
+#endif
+		return events;
+	}
+
+	void arm(void* key, Entry& entry)
+	{
+		io_uring_sqe* pSQE = getSQE();
+		pSQE->opcode = IORING_OP_POLL_ADD;
+		pSQE->fd = static_cast<int>(entry.socket.impl()->sockfd());
+		pSQE->poll32_events = pollEvents(entry.mode);
+		entry.token = _nextToken++;
+		pSQE->user_data = entry.token;
+		_tokenMap[entry.token] = key;
+	}
+
+	void disarm(Entry& entry)
+	{
+		if (!entry.token) return;
+		io_uring_sqe* pSQE = getSQE();
+		pSQE->opcode = IORING_OP_POLL_REMOVE;
+		pSQE->fd = -1;
+		pSQE->addr = entry.token;
+		pSQE->user_data = INTERNAL_TOKEN;
+		_tokenMap.erase(entry.token);
+		entry.token = 0;
+	}
+
+	void armWakeUp()
+	{
+		io_uring_sqe* pSQE = getSQE();
+		pSQE->opcode = IORING_OP_POLL_ADD;
+		pSQE->fd = _eventfd;
+		pSQE->poll32_events = pollEvents(PollSet::POLL_READ);
+		pSQE->user_data = WAKEUP_TOKEN;
+	}
+
+	void submit()
+	{
+		int rc = _ring.submit();
+		if (rc < 0) error(-rc);
+	}
+
+	void submitIfWaiting()
+		/// Changes made while poll() is blocked must be submitted
+		/// right away; otherwise, they are submitted by the next poll().
+	{
+		if (_waiting) submit();
+	}
+
+	static bool keepWaiting(const Poco::Timestamp& start, Poco::Timespan& remainingTime)
+	{
+		Poco::Timestamp end;
+		Poco::Timespan waited = end - start;
+		if (waited < remainingTime)
+		{
+			remainingTime -= waited;
+			return true;
+		}
+		return false;
+	}
+
+	mutable Mutex _mutex;
+	IOUring       _ring;
+	int           _eventfd;
+	SocketMap     _socketMap;
+	TokenMap      _tokenMap;
+	std::uint64_t _nextToken = FIRST_TOKEN;
+	bool          _waiting = false;
+	IOLock        _pollLock;
+};
+
+
+#endif // POCO_HAVE_IO_URING
+
+
+namespace
+{
+	std::atomic<int> defaultBackend(PollSet::BACKEND_NATIVE);
+
+	PollSetImpl* createImpl(PollSet::Backend& backend)
+		/// Creates the implementation for the requested backend and
+		/// updates backend to reflect the one actually used.
+	{
+		if (backend == PollSet::BACKEND_DEFAULT)
+			backend = static_cast<PollSet::Backend>(defaultBackend.load());
+#if defined(POCO_HAVE_IO_URING)
+		if (backend == PollSet::BACKEND_IO_URING && IOUring::isAvailable())
+		{
+			try
+			{
+				return new IOUringImpl;
+			}
+			catch (Poco::Exception&)
+			{
+				// fall back to the native implementation
+			}
+		}
 #endif
+		backend = PollSet::BACKEND_NATIVE;
+		return new NativePollSetImpl;
+	}
+}
 
 
 PollSet::PollSet():
-	_pImpl(new PollSetImpl)
+	_backend(BACKEND_DEFAULT),
+	_pImpl(createImpl(_backend))
+{
+}
+
+
+PollSet::PollSet(Backend backend):
+	_backend(backend),
+	_pImpl(createImpl(_backend))
 {
 }
 
@@ -806,4 +1239,36 @@ void PollSet::wakeUp()
 }
 
 
+bool PollSet::isAvailable(Backend backend)
+{
+	switch (backend)
+	{
+	case BACKEND_DEFAULT:
+	case BACKEND_NATIVE:
+		return true;
+	case BACKEND_IO_URING:
+#if defined(POCO_HAVE_IO_URING)
+		return IOUring::isAvailable();
+#else
+		return false;
+#endif
+	}
+	return false;
+}
+
+
+void PollSet::setDefaultBackend(Backend backend)
+{
+	poco_assert (backend != BACKEND_DEFAULT);
+
+	defaultBackend = backend;
+}
+
+
+PollSet::Backend PollSet::getDefaultBackend()
+{
+	return static_cast<Backend>(defaultBackend.load());
+}
+
+
 } // namespace Poco::Net
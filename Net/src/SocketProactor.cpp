@@ -17,6 +17,13 @@
 #include "Poco/Net/DatagramSocketImpl.h"
 #include "Poco/Thread.h"
 #include "Poco/Exception.h"
+#if defined(POCO_HAVE_IO_URING)
+#include "Poco/Net/IOUring.h"
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <cstring>
+#include <set>
+#endif
 #ifdef POCO_OS_FAMILY_WINDOWS
 #ifdef max
 #undef max
@@ -220,6 +227,391 @@ private:
 };
 
 
+#if defined(POCO_HAVE_IO_URING)
+
+
+//
+// IOUringEngine
+//
+
+class IOUringEngine
+	/// IOUringEngine is the native completion engine of the
+	/// SocketProactor, built on io_uring.
+	///
+	/// Receive and send operations are prepared as submission queue
+	/// entries operating directly on the user-supplied buffers, and
+	/// handed to the kernel by poll(), which also waits for, and
+	/// dispatches, the completions. Operations added while poll() is
+	/// blocked are submitted immediately.
+	///
+	/// Only one receive and one send operation per socket is in flight
+	/// at any time; the following ones are queued and submitted when
+	/// the preceding one completes. This keeps the per-socket ordering
+	/// guarantees of the readiness-based emulation.
+{
+public:
+	using Handler = SocketProactor::Handler;
+	using Buffer = SocketProactor::Buffer;
+	using MutexType = Poco::FastMutex;
+	using ScopedLock = MutexType::ScopedLock;
+
+	explicit IOUringEngine(SocketProactor& proactor):
+		_proactor(proactor),
+		_ring(RING_ENTRIES)
+	{
+	}
+
+	~IOUringEngine()
+	{
+		try
+		{
+			cancelAll();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+	}
+
+	void addReceive(const Socket& sock, std::unique_ptr<Handler>&& pHandler)
+	{
+		add(sock, std::move(pHandler), true);
+	}
+
+	void addSend(const Socket& sock, std::unique_ptr<Handler>&& pHandler)
+	{
+		add(sock, std::move(pHandler), false);
+	}
+
+	int poll(const Poco::Timespan& timeout)
+		/// Submits the pending operations and waits up to timeout for
+		/// the first completion. Dispatches all available completions
+		/// and returns their number.
+	{
+		const bool wait = timeout.totalMicroseconds() > 0;
+		unsigned toSubmit;
+		{
+			ScopedLock lock(_mutex);
+			toSubmit = _ring.flush();
+			_waiting = wait;
+		}
+		int rc = _ring.enter(toSubmit, wait ? 1 : 0, wait ? &timeout : nullptr);
+
+		int handled = 0;
+		{
+			ScopedLock lock(_mutex);
+			_waiting = false;
+			_ring.reap([&](const io_uring_cqe& cqe)
+			{
+				if (onCompletion(cqe)) ++handled;
+			});
+		}
+		if (handled) _proactor._ioCompletion.wakeUp();
+
+		// -ETIME: timeout expired, -EINTR: interrupted,
+		// -EBUSY/-EAGAIN: completion backlog, reaped above
+		if (rc < 0 && rc != -ETIME && rc != -EINTR && rc != -EBUSY && rc != -EAGAIN)
+			throw Poco::IOException("io_uring_enter() failed", std::strerror(-rc), -rc);
+		return handled;
+	}
+
+	void wakeUp()
+		/// Wakes up a blocked poll() by submitting a no-op.
+	{
+		ScopedLock lock(_mutex);
+		io_uring_sqe* pSQE = getSQE();
+		pSQE->opcode = IORING_OP_NOP;
+		pSQE->user_data = INTERNAL_TOKEN;
+		submit();
+	}
+
+	bool has(const Socket& sock) const
+	{
+		ScopedLock lock(_mutex);
+		poco_socket_t fd = sock.impl()->sockfd();
+		return _receiveQueues.find(fd) != _receiveQueues.end() ||
+			_sendQueues.find(fd) != _sendQueues.end();
+	}
+
+	bool hasPending() const
+	{
+		ScopedLock lock(_mutex);
+		return !_receiveQueues.empty() || !_sendQueues.empty();
+	}
+
+private:
+	enum : std::uint64_t
+	{
+		INTERNAL_TOKEN = 0 /// no-op and cancel requests; completions are ignored
+	};
+
+	enum
+	{
+		RING_ENTRIES = 1024,
+		STREAM_RECEIVE_SIZE = 8192,
+		DATAGRAM_RECEIVE_SIZE = 65536,
+		CANCEL_WAIT_MS = 100,
+		CANCEL_ATTEMPTS = 10
+	};
+
+	struct Operation
+		/// A receive or send operation. The address of the Operation
+		/// is passed to the kernel as user_data, so the object must
+		/// not move while the operation is in flight.
+	{
+		Socket socket;
+		std::unique_ptr<Handler> pHandler;
+		bool receive = false;
+		bool resized = false;
+		msghdr msg;
+		iovec iov;
+		char address[SocketAddress::MAX_ADDRESS_LENGTH];
+	};
+
+	using OperationQueue = std::deque<std::unique_ptr<Operation>>;
+	using QueueMap = std::unordered_map<poco_socket_t, OperationQueue>;
+
+	void add(const Socket& sock, std::unique_ptr<Handler>&& pHandler, bool receive)
+	{
+		poco_check_ptr(pHandler->_pBuf);
+		std::unique_ptr<Operation> pOp(new Operation);
+		pOp->socket = sock;
+		pOp->pHandler = std::move(pHandler);
+		pOp->receive = receive;
+
+		ScopedLock lock(_mutex);
+		OperationQueue& queue = queues(receive)[sock.impl()->sockfd()];
+		queue.push_back(std::move(pOp));
+		if (queue.size() == 1)
+		{
+			prepare(*queue.front());
+			if (_waiting) submit();
+		}
+	}
+
+	void prepare(Operation& op)
+		/// Prepares the submission queue entry for the operation.
+	{
+		Buffer& buf = *op.pHandler->_pBuf;
+		const bool datagram = op.socket.isDatagram();
+		if (op.receive && buf.empty())
+		{
+			buf.resize(datagram ? DATAGRAM_RECEIVE_SIZE : STREAM_RECEIVE_SIZE);
+			op.resized = true;
+		}
+
+		io_uring_sqe* pSQE = getSQE();
+		pSQE->fd = static_cast<int>(op.socket.impl()->sockfd());
+		pSQE->user_data = reinterpret_cast<std::uint64_t>(&op);
+		if (datagram)
+		{
+			std::memset(&op.msg, 0, sizeof(op.msg));
+			op.iov.iov_base = buf.data();
+			op.iov.iov_len = buf.size();
+			op.msg.msg_iov = &op.iov;
+			op.msg.msg_iovlen = 1;
+			if (op.receive)
+			{
+				op.msg.msg_name = op.address;
+				op.msg.msg_namelen = sizeof(op.address);
+			}
+			else if (op.pHandler->_pAddr)
+			{
+				op.msg.msg_name = const_cast<sockaddr*>(op.pHandler->_pAddr->addr());
+				op.msg.msg_namelen = op.pHandler->_pAddr->length();
+			}
+			pSQE->opcode = op.receive ? IORING_OP_RECVMSG : IORING_OP_SENDMSG;
+			pSQE->addr = reinterpret_cast<std::uint64_t>(&op.msg);
+			pSQE->len = 1;
+		}
+		else
+		{
+			pSQE->opcode = op.receive ? IORING_OP_RECV : IORING_OP_SEND;
+			pSQE->addr = reinterpret_cast<std::uint64_t>(buf.data());
+			pSQE->len = static_cast<std::uint32_t>(buf.size());
+		}
+		if (!op.receive) pSQE->msg_flags = MSG_NOSIGNAL;
+	}
+
+	bool onCompletion(const io_uring_cqe& cqe)
+		/// Dispatches the completion handler and submits the next
+		/// operation queued for the socket, if any.
+	{
+		if (cqe.user_data == INTERNAL_TOKEN) return false;
+
+		auto* pOp = reinterpret_cast<Operation*>(cqe.user_data);
+		QueueMap& queueMap = queues(pOp->receive);
+		auto it = queueMap.find(pOp->socket.impl()->sockfd());
+		poco_assert_dbg (it != queueMap.end() && it->second.front().get() == pOp);
+		std::unique_ptr<Operation> pDone = std::move(it->second.front());
+		it->second.pop_front();
+		if (it->second.empty())
+			queueMap.erase(it);
+		else
+			prepare(*it->second.front());
+
+		Handler& handler = *pDone->pHandler;
+		int n = cqe.res < 0 ? 0 : cqe.res;
+		int err = cqe.res < 0 ? -cqe.res : 0;
+		if (pDone->receive)
+		{
+			if (pDone->resized) handler._pBuf->resize(n);
+			if (n > 0 && handler._pAddr && pDone->msg.msg_namelen)
+			{
+				*handler._pAddr = SocketAddress(reinterpret_cast<const sockaddr*>(pDone->address),
+					static_cast<poco_socklen_t>(pDone->msg.msg_namelen));
+			}
+		}
+		_proactor.enqueueIONotification(std::move(handler._onCompletion), n, err);
+		release(handler);
+		return true;
+	}
+
+	void cancelAll()
+		/// Cancels all operations in flight and waits for their
+		/// (discarded) completions, so that the kernel no longer
+		/// accesses the buffers once the engine is gone.
+		///
+		/// Operations whose completion does not arrive in time are
+		/// leaked, together with their buffers, as the kernel may
+		/// still write into them.
+	{
+		ScopedLock lock(_mutex);
+		std::set<const Operation*> inFlight;
+		for (auto* pQueueMap: {&_receiveQueues, &_sendQueues})
+		{
+			for (auto& q: *pQueueMap)
+			{
+				io_uring_sqe* pSQE = getSQE();
+				pSQE->opcode = IORING_OP_ASYNC_CANCEL;
+				pSQE->fd = -1;
+				pSQE->addr = reinterpret_cast<std::uint64_t>(q.second.front().get());
+				pSQE->user_data = INTERNAL_TOKEN;
+				inFlight.insert(q.second.front().get());
+			}
+		}
+
+		unsigned toSubmit = inFlight.empty() ? 0 : _ring.flush();
+		Poco::Timespan timeout(0, CANCEL_WAIT_MS*1000);
+		for (int attempt = 0; !inFlight.empty() && attempt < CANCEL_ATTEMPTS; ++attempt)
+		{
+			_ring.enter(toSubmit, 1, &timeout);
+			toSubmit = 0;
+			_ring.reap([&](const io_uring_cqe& cqe)
+			{
+				if (cqe.user_data != INTERNAL_TOKEN)
+					inFlight.erase(reinterpret_cast<const Operation*>(cqe.user_data));
+			});
+		}
+		for (auto* pQueueMap: {&_receiveQueues, &_sendQueues})
+		{
+			for (auto& q: *pQueueMap)
+			{
+				for (auto& pOp: q.second)
+				{
+					if (inFlight.count(pOp.get()))
+						(void) pOp.release();
+					else
+						release(*pOp->pHandler);
+				}
+			}
+			pQueueMap->clear();
+		}
+	}
+
+	static void release(Handler& handler)
+		/// Deletes the buffer and address, if owned by the handler.
+	{
+		if (handler._owner)
+		{
+			delete handler._pBuf;
+			handler._pBuf = nullptr;
+			delete handler._pAddr;
+			handler._pAddr = nullptr;
+		}
+	}
+
+	io_uring_sqe* getSQE()
+	{
+		io_uring_sqe* pSQE = _ring.getSQE();
+		if (!pSQE)
+		{
+			// submission ring is full, hand it over to the kernel
+			submit();
+			pSQE = _ring.getSQE();
+			if (!pSQE) throw Poco::IOException("io_uring submission queue full");
+		}
+		return pSQE;
+	}
+
+	void submit()
+	{
+		int rc = _ring.submit();
+		if (rc < 0 && rc != -EBUSY && rc != -EAGAIN)
+			throw Poco::IOException("io_uring_enter() failed", std::strerror(-rc), -rc);
+	}
+
+	QueueMap& queues(bool receive)
+	{
+		return receive ? _receiveQueues : _sendQueues;
+	}
+
+	SocketProactor&   _proactor;
+	mutable MutexType _mutex;
+	IOUring           _ring;
+	QueueMap          _receiveQueues;
+	QueueMap          _sendQueues;
+	bool              _waiting = false;
+};
+
+
+#else
+
+
+class IOUringEngine
+	/// Placeholder; the native completion engine
+	/// is only available on platforms with io_uring,
+	/// and is never created elsewhere.
+{
+public:
+	using Handler = SocketProactor::Handler;
+
+	void addReceive(const Socket&, std::unique_ptr<Handler>&&)
+	{
+		poco_bugcheck();
+	}
+
+	void addSend(const Socket&, std::unique_ptr<Handler>&&)
+	{
+		poco_bugcheck();
+	}
+
+	int poll(const Poco::Timespan&)
+	{
+		poco_bugcheck();
+		return 0;
+	}
+
+	void wakeUp()
+	{
+	}
+
+	bool has(const Socket&) const
+	{
+		return false;
+	}
+
+	bool hasPending() const
+	{
+		return false;
+	}
+};
+
+
+#endif // POCO_HAVE_IO_URING
+
+
+
 //
 // SocketProactor
 //
@@ -236,8 +628,10 @@ SocketProactor::SocketProactor(bool worker):
 	_maxTimeout(DEFAULT_MAX_TIMEOUT_MS),
 	_pThread(nullptr),
 	_ioCompletion(_maxTimeout),
-	_pWorker(worker ? new Worker : nullptr)
+	_pWorker(worker ? new Worker : nullptr),
+	_backend(PollSet::BACKEND_DEFAULT)
 {
+	createEngine();
 }
 
 
@@ -249,15 +643,57 @@ SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker):
 	_maxTimeout(static_cast<long>(timeout.totalMilliseconds())),
 	_pThread(nullptr),
 	_ioCompletion(_maxTimeout),
-	_pWorker(worker ? new Worker : nullptr)
+	_pWorker(worker ? new Worker : nullptr),
+	_backend(PollSet::BACKEND_DEFAULT)
+{
+	createEngine();
+}
+
+
+SocketProactor::SocketProactor(PollSet::Backend backend, bool worker):
+	_isRunning(false),
+	_isStopped(false),
+	_stop(false),
+	_timeout(0),
+	_maxTimeout(DEFAULT_MAX_TIMEOUT_MS),
+	_pThread(nullptr),
+	_ioCompletion(_maxTimeout),
+	_pWorker(worker ? new Worker : nullptr),
+	_backend(backend)
 {
+	createEngine();
+}
+
+
+SocketProactor::SocketProactor(const Poco::Timespan& timeout, PollSet::Backend backend, bool worker):
+	_isRunning(false),
+	_isStopped(false),
+	_stop(false),
+	_timeout(0),
+	_maxTimeout(static_cast<long>(timeout.totalMilliseconds())),
+	_pThread(nullptr),
+	_ioCompletion(_maxTimeout),
+	_pWorker(worker ? new Worker : nullptr),
+	_backend(backend)
+{
+	createEngine();
 }
 
 
 SocketProactor::~SocketProactor()
 {
+	// a thread still in run() and the completion handler
+	// thread may use the engine, so both must be done first
+	stop();
+	if (_pEngine) _pEngine->wakeUp();
+	{
+		Poco::Mutex::ScopedLock lock(_runMutex);
+	}
 	_ioCompletion.stop();
 	wait();
+	// in-flight operations must be cancelled
+	// before any of the buffers is released
+	_pEngine.reset();
 	for (auto& pS : _writeHandlers)
 	{
 		for (auto& pH : pS.second)
@@ -269,6 +705,28 @@ SocketProactor::~SocketProactor()
 }
 
 
+void SocketProactor::createEngine()
+{
+	if (_backend == PollSet::BACKEND_DEFAULT)
+		_backend = PollSet::getDefaultBackend();
+#if defined(POCO_HAVE_IO_URING)
+	if (_backend == PollSet::BACKEND_IO_URING && IOUring::isAvailable())
+	{
+		try
+		{
+			_pEngine.reset(new IOUringEngine(*this));
+			return;
+		}
+		catch (Poco::Exception&)
+		{
+			// fall back to the readiness-based emulation
+		}
+	}
+#endif
+	_backend = PollSet::BACKEND_NATIVE;
+}
+
+
 void SocketProactor::wait()
 {
 	_ioCompletion.wakeUp();
@@ -287,8 +745,23 @@ bool SocketProactor::hasHandlers(SubscriberMap& handlers, int sockfd)
 
 int SocketProactor::poll(int* pHandled)
 {
-	int handled = 0;
+	int handled = _pEngine ? pollCompletions() : pollReadiness();
 	int worked = 0;
+
+	if (_pWorker)
+	{
+		if (hasSocketHandlers() && handled) worked = doWork();
+		else worked = doWork(false, true);
+	}
+
+	if (pHandled) *pHandled = handled;
+	return worked;
+}
+
+
+int SocketProactor::pollReadiness()
+{
+	int handled = 0;
 	PollSet::SocketModeMap sm = _pollSet.poll(_timeout);
 	if (sm.size() > 0)
 	{
@@ -315,15 +788,13 @@ int SocketProactor::poll(int* pHandled)
 			}
 		}
 	}
+	return handled;
+}
 
-	if (_pWorker)
-	{
-		if (hasSocketHandlers() && handled) worked = doWork();
-		else worked = doWork(false, true);
-	}
 
-	if (pHandled) *pHandled = handled;
-	return worked;
+int SocketProactor::pollCompletions()
+{
+	return _pEngine->poll(Poco::Timespan(0, _timeout*1000));
 }
 
 
@@ -336,6 +807,12 @@ void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketA
 	pHandler->_pBuf = std::addressof(buf);
 	pHandler->_onCompletion = std::move(onCompletion);
 
+	if (_pEngine)
+	{
+		_pEngine->addReceive(sock, std::move(pHandler));
+		return;
+	}
+
 	Poco::Mutex::ScopedLock l(_readMutex);
 	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
 	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
@@ -393,6 +870,12 @@ void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletio
 	pHandler->_pBuf = std::addressof(buf);
 	pHandler->_onCompletion = std::move(onCompletion);
 
+	if (_pEngine)
+	{
+		_pEngine->addReceive(sock, std::move(pHandler));
+		return;
+	}
+
 	Poco::Mutex::ScopedLock l(_readMutex);
 	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
 	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
@@ -443,6 +926,12 @@ void SocketProactor::addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr
 	pHandler->_onCompletion = std::move(onCompletion);
 	pHandler->_owner = own;
 
+	if (_pEngine)
+	{
+		_pEngine->addSend(sock, std::move(pHandler));
+		return;
+	}
+
 	Poco::Mutex::ScopedLock l(_writeMutex);
 	_writeHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
 	if (!has(sock)) addSocket(sock, PollSet::POLL_WRITE);
@@ -654,6 +1143,8 @@ void SocketProactor::sleep(bool isAtWork)
 		{
 			if (_timeout < _maxTimeout) ++_timeout;
 		}
+		// the completion engine waits in poll()
+		if (_pEngine) return;
 		if (_pThread) _pThread->trySleep(_timeout);
 		else Thread::sleep(_timeout);
 	}
@@ -674,6 +1165,7 @@ void SocketProactor::sleep(bool isAtWork)
 
 void SocketProactor::run()
 {
+	Poco::Mutex::ScopedLock lock(_runMutex);
 	_pThread = Thread::current();
 	_ioCompletion.start();
 	int handled = 0;
@@ -693,6 +1185,8 @@ bool SocketProactor::hasSocketHandlers() const
 {
 	if (_readHandlers.size() || _writeHandlers.size())
 		return true;
+	if (_pEngine && _pEngine->hasPending())
+		return true;
 	return false;
 }
 
@@ -710,6 +1204,7 @@ void SocketProactor::stop()
 
 void SocketProactor::wakeUp()
 {
+	if (_pEngine) _pEngine->wakeUp();
 	if (_pThread) _pThread->wakeUp();
 }
 
@@ -777,7 +1272,7 @@ int SocketProactor::removePermanentWork(int count)
 
 bool SocketProactor::has(const Socket& sock) const
 {
-	return _pollSet.has(sock);
+	return _pollSet.has(sock) || (_pEngine && _pEngine->has(sock));
 }
 
 
@@ -790,6 +1285,7 @@ bool SocketProactor::ioCompletionInProgress() const
 void SocketProactor::onShutdown()
 {
 	_pollSet.wakeUp();
+	if (_pEngine) _pEngine->wakeUp();
 	_ioCompletion.stop();
 	_ioCompletion.wait();
 }
@@ -16,6 +16,7 @@
 #include "Poco/ErrorHandler.h"
 #include "Poco/Thread.h"
 #include "Poco/Stopwatch.h"
+#include "Poco/Clock.h"
 #include "Poco/Exception.h"
 
 
@@ -57,6 +58,7 @@ SocketReactor::SocketReactor(const Params& params, int threadAffinity):
 	_params(params),
 	_threadAffinity(threadAffinity),
 	_stop(false),
+	_pollSet(params.pollBackend),
 	_pReadableNotification(new ReadableNotification(this)),
 	_pWritableNotification(new WritableNotification(this)),
 	_pErrorNotification(new ErrorNotification(this)),
@@ -83,13 +85,15 @@ void SocketReactor::run()
 	Poco::Stopwatch sw;
 	if (_params.throttle) sw.start();
 	PollSet::SocketModeMap sm;
+	_idleSince.update();
 	while (!_stop)
 	{
 		try
 		{
 			if (hasSocketHandlers())
 			{
-				sm = _pollSet.poll(_params.pollTimeout);
+				const Poco::Timespan timeout = nextPollTimeout();
+				sm = _pollSet.poll(timeout);
 				if (_stop) break;
 				for (const auto& s : sm)
 				{
@@ -124,17 +128,30 @@ void SocketReactor::run()
 						ErrorHandler::handle();
 					}
 				}
-				if (0 == sm.size())
+				dispatchTimeouts();
+				// poll() also returns for socket timeouts and wake-ups, so
+				// onTimeout() is called once no socket event has occurred
+				// for pollTimeout, not whenever poll() returns empty
+				if (!sm.empty())
 				{
+					_idleSince.update();
+					if (_params.throttle) sw.restart();
+				}
+				else if (_idleSince.isElapsed(_params.pollTimeout.totalMicroseconds()))
+				{
+					_idleSince.update();
 					onTimeout();
 					if (_params.throttle && _params.pollTimeout == 0)
 					{
 						if ((sw.elapsed()/1000) > _params.sleepLimit) sleep();
 					}
 				}
-				else if (_params.throttle) sw.restart();
 			}
-			else sleep();
+			else
+			{
+				_idleSince.update();
+				sleep();
+			}
 		}
 		catch (Exception& exc)
 		{
@@ -163,6 +180,97 @@ void SocketReactor::sleep()
 }
 
 
+Poco::Timespan SocketReactor::nextPollTimeout()
+{
+	Poco::Clock now;
+	const Poco::Clock::ClockDiff idle = now - _idleSince;
+	Poco::Timespan timeout = idle < _params.pollTimeout.totalMicroseconds() ? _params.pollTimeout.totalMicroseconds() - idle : 0;
+	ScopedLock lock(_timeoutMutex);
+	Poco::Clock next;
+	if (_timeouts.nextExpiry(next))
+	{
+		const Poco::Clock::ClockDiff diff = next - now;
+		if (diff < timeout.totalMicroseconds()) timeout = diff > 0 ? diff : 0;
+	}
+	_pollDeadline = now + timeout.totalMicroseconds();
+	return timeout;
+}
+
+
+void SocketReactor::dispatchTimeouts()
+{
+	{
+		ScopedLock lock(_timeoutMutex);
+		if (_timeouts.empty()) return;
+		_timeouts.advance(Poco::Clock(), _expiredTimeouts);
+	}
+	for (const auto& socket: _expiredTimeouts)
+	{
+		try
+		{
+			dispatch(socket, _pTimeoutNotification);
+		}
+		catch (Exception& exc)
+		{
+			onError(socket, exc.code(), exc.displayText());
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			onError(socket, 0, exc.what());
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			onError(socket, 0, "unknown exception");
+			ErrorHandler::handle();
+		}
+	}
+	_expiredTimeouts.clear();
+}
+
+
+SocketReactor::TimerId SocketReactor::scheduleTimeout(const Socket& socket, const Poco::Timespan& timeout)
+{
+	Poco::Clock expiry;
+	expiry += timeout.totalMicroseconds();
+	TimerId id;
+	bool wake;
+	{
+		ScopedLock lock(_timeoutMutex);
+		id = _timeouts.schedule(expiry, socket);
+		wake = expiry < _pollDeadline;
+	}
+	// the reactor may be waiting in poll() for longer
+	// than the new timeout, so make it recompute the timeout
+	if (wake) wakeUp();
+	return id;
+}
+
+
+bool SocketReactor::rescheduleTimeout(TimerId id, const Poco::Timespan& timeout)
+{
+	Poco::Clock expiry;
+	expiry += timeout.totalMicroseconds();
+	bool rescheduled;
+	bool wake;
+	{
+		ScopedLock lock(_timeoutMutex);
+		rescheduled = _timeouts.reschedule(id, expiry);
+		wake = rescheduled && expiry < _pollDeadline;
+	}
+	if (wake) wakeUp();
+	return rescheduled;
+}
+
+
+bool SocketReactor::cancelTimeout(TimerId id)
+{
+	ScopedLock lock(_timeoutMutex);
+	return _timeouts.cancel(id);
+}
+
+
 void SocketReactor::start()
 {
 	_stop.exchange(false);
@@ -2,6 +2,7 @@
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Net/TCPServerParams.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/Environment.h"
 
 namespace Poco::Net {
 
@@ -15,20 +16,31 @@ TCPReactorServer::TCPReactorServer(int port, TCPServerParams::Ptr pParams)
 
 TCPReactorServer::TCPReactorServer(const SocketAddress& address, TCPServerParams::Ptr pParams)
 	: _threadPool("TCPRA", pParams->getAcceptorNum()),
-	  _reactors(pParams->getAcceptorNum()),
 	  _pParams(pParams),
 	  _port(address.port()),
 	  _stopped(false)
 {
-	for (auto& reactor : _reactors)
+	const int acceptorNum = _pParams->getAcceptorNum();
+	const int firstCore = _pParams->getThreadAffinity();
+	const int cores = static_cast<int>(Environment::processorCount());
+	SocketAddress bindAddress(address);
+	for (int i = 0; i < acceptorNum; ++i)
 	{
-		ServerSocket socket(address);
+		const int affinity = firstCore >= 0 ? (firstCore + i) % cores : -1;
+		_reactors.push_back(std::make_unique<SocketReactor>(SocketReactor::Params(), affinity));
+
+		ServerSocket socket;
+		socket.bind(bindAddress, true, true);
+		socket.listen();
 		_sockets.push_back(socket);
-		if (_sockets.size() == 1)
+		if (i == 0)
 		{
+			// with an ephemeral port, the remaining acceptors
+			// must share the port assigned to the first one
 			_port = socket.address().port();
+			bindAddress = SocketAddress(address.host(), static_cast<Poco::UInt16>(_port));
 		}
-		auto acceptor = std::make_shared<TCPReactorAcceptor>(socket, reactor, _pParams);
+		auto acceptor = std::make_shared<TCPReactorAcceptor>(socket, *_reactors.back(), _pParams);
 		_acceptors.push_back(acceptor);
 	}
 }
@@ -40,9 +52,9 @@ TCPReactorServer::~TCPReactorServer()
 
 void TCPReactorServer::start()
 {
-	for (auto& reactor : _reactors)
+	for (auto& pReactor : _reactors)
 	{
-		_threadPool.start(reactor);
+		_threadPool.start(*pReactor);
 	}
 }
 
@@ -64,9 +76,9 @@ void TCPReactorServer::stop()
 	{
 		acceptor->stop();
 	}
-	for (auto& reactor : _reactors)
+	for (auto& pReactor : _reactors)
 	{
-		reactor.stop();
+		pReactor->stop();
 	}
 	_threadPool.joinAll();
 }
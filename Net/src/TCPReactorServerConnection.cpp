@@ -51,7 +51,7 @@ void TCPReactorServerConnection::onRead(const AutoPtr<ReadableNotification>& pNf
 		else
 		{
 			_buf.append(tmp, n);
-			_rcvCallback(shared_from_this());
+			if (!_suspended) _rcvCallback(shared_from_this());
 		}
 	}
 	catch (const Poco::Exception& exc)
@@ -102,6 +102,81 @@ void TCPReactorServerConnection::onRead(const AutoPtr<ReadableNotification>& pNf
 	}
 }
 
+void TCPReactorServerConnection::onWritable(const AutoPtr<WritableNotification>& pNf)
+{
+	_reactor.removeEventHandler(
+		_socket,
+		HTTPObserver<TCPReactorServerConnection, WritableNotification>(
+			shared_from_this(), &TCPReactorServerConnection::onWritable));
+
+	std::string output;
+	std::string pending;
+	bool close;
+	{
+		Poco::FastMutex::ScopedLock lock(_outputMutex);
+		output.swap(_output);
+		pending.swap(_pending);
+		close = _closeAfterOutput;
+	}
+	try
+	{
+		std::size_t sent = 0;
+		while (sent < output.size())
+		{
+			int n = _socket.sendBytes(output.data() + sent, static_cast<int>(output.size() - sent));
+			if (n <= 0)
+			{
+				handleClose();
+				return;
+			}
+			sent += n;
+		}
+		if (close)
+		{
+			handleClose();
+			return;
+		}
+		pending.append(_buf);
+		_buf.swap(pending);
+		_suspended = false;
+		if (!_buf.empty()) _rcvCallback(shared_from_this());
+	}
+	catch (const Poco::Exception& exc)
+	{
+		handleClose();
+		try
+		{
+			Poco::Logger& log = Poco::Logger::get("Poco.Net.TCPReactorServer");
+			if (log.debug()) log.debug("connection closed: %s", exc.displayText());
+		}
+		catch (...) {}
+	}
+	catch (...)
+	{
+		handleClose();
+	}
+}
+
+void TCPReactorServerConnection::suspend()
+{
+	_suspended = true;
+}
+
+void TCPReactorServerConnection::resume(std::string&& output, std::string&& pending, bool close)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_outputMutex);
+		_output = std::move(output);
+		_pending = std::move(pending);
+		_closeAfterOutput = close;
+	}
+	_reactor.addEventHandler(
+		_socket,
+		HTTPObserver<TCPReactorServerConnection, WritableNotification>(
+			shared_from_this(), &TCPReactorServerConnection::onWritable));
+	_reactor.wakeUp();
+}
+
 void TCPReactorServerConnection::onError(const AutoPtr<ErrorNotification>& pNf)
 {
 	handleClose();
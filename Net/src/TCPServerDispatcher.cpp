@@ -18,6 +18,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/ErrorHandler.h"
 #include <memory>
+#include <vector>
 
 
 using Poco::Notification;
@@ -65,7 +66,33 @@ TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactor
 	_refusedConnections(0),
 	_stopped(false),
 	_pConnectionFactory(pFactory),
-	_threadPool(threadPool)
+	_pThreadPool(&threadPool),
+	_pWorkStealingPool(nullptr),
+	_queuedConnections(0)
+{
+	poco_check_ptr (pFactory);
+
+	if (!_pParams)
+		_pParams = new TCPServerParams;
+
+	if (_pParams->getMaxThreads() == 0)
+		_pParams->setMaxThreads(threadPool.capacity());
+}
+
+
+TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::WorkStealingThreadPool& threadPool, TCPServerParams::Ptr pParams):
+	_rc(1),
+	_pParams(pParams),
+	_currentThreads(0),
+	_totalConnections(0),
+	_currentConnections(0),
+	_maxConcurrentConnections(0),
+	_refusedConnections(0),
+	_stopped(false),
+	_pConnectionFactory(pFactory),
+	_pThreadPool(nullptr),
+	_pWorkStealingPool(&threadPool),
+	_queuedConnections(0)
 {
 	poco_check_ptr (pFactory);
 
@@ -110,13 +137,7 @@ void TCPServerDispatcher::run()
 				TCPConnectionNotification* pCNf = dynamic_cast<TCPConnectionNotification*>(pNf.get());
 				if (pCNf)
 				{
-					std::unique_ptr<TCPServerConnection> pConnection(_pConnectionFactory->createConnection(pCNf->socket()));
-					if (pConnection)
-					{
-						beginConnection();
-						pConnection->start();
-						endConnection();
-					}
+					serve(pCNf->socket());
 				}
 			}
 		}
@@ -139,8 +160,57 @@ namespace
 }
 
 
+void TCPServerDispatcher::serve(const StreamSocket& socket)
+{
+	std::unique_ptr<TCPServerConnection> pConnection(_pConnectionFactory->createConnection(socket));
+	if (pConnection)
+	{
+		beginConnection();
+		pConnection->start();
+		endConnection();
+	}
+}
+
+
+void TCPServerDispatcher::runConnection(const StreamSocket& socket)
+{
+	--_queuedConnections;
+	if (_stopped) return;
+
+	++_currentThreads;
+	try
+	{
+		serve(socket);
+	}
+	catch (Poco::Exception &exc) { ErrorHandler::handle(exc); }
+	catch (std::exception &exc)  { ErrorHandler::handle(exc); }
+	catch (...)                  { ErrorHandler::handle();    }
+	--_currentThreads;
+}
+
+
 void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 {
+	if (_pWorkStealingPool)
+	{
+		// no dispatcher lock: the pool queues the connection, and
+		// the place is reserved before the limit is checked
+		if (_queuedConnections.fetch_add(1) < _pParams->getMaxQueued())
+		{
+			AutoPtr<TCPServerDispatcher> pThis(this, true);
+			_pWorkStealingPool->startFunc([pThis, socket]() mutable
+				{
+					pThis->runConnection(socket);
+				});
+		}
+		else
+		{
+			--_queuedConnections;
+			++_refusedConnections;
+		}
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	if (_queue.size() < _pParams->getMaxQueued())
@@ -150,7 +220,7 @@ void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 		{
 			try
 			{
-				_threadPool.startWithPriority(_pParams->getThreadPriority(), *this, threadName);
+				_pThreadPool->startWithPriority(_pParams->getThreadPriority(), *this, threadName);
 				++_currentThreads;
 				// Ensure this object lives at least until run() starts
 				// Small chance of leaking if threadpool is stopped before this
@@ -177,9 +247,14 @@ void TCPServerDispatcher::stop()
 	_pConnectionFactory->stop();
 	_stopped = true;
 	_queue.clear();
-	for (int i = 0; i < _threadPool.allocated(); i++)
+	if (_pThreadPool)
 	{
-		_queue.enqueueNotification(new StopNotification);
+		std::vector<Notification::Ptr> stopNotifications;
+		for (int i = 0; i < _pThreadPool->allocated(); i++)
+		{
+			stopNotifications.push_back(new StopNotification);
+		}
+		_queue.enqueueBatch(stopNotifications);
 	}
 }
 
@@ -193,7 +268,7 @@ int TCPServerDispatcher::maxThreads() const
 {
 	FastMutex::ScopedLock lock(_mutex);
 
-	return _threadPool.capacity();
+	return _pWorkStealingPool ? _pWorkStealingPool->capacity() : _pThreadPool->capacity();
 }
 
 
@@ -217,7 +292,10 @@ int TCPServerDispatcher::maxConcurrentConnections() const
 
 int TCPServerDispatcher::queuedConnections() const
 {
-	return _queue.size();
+	if (_pWorkStealingPool)
+		return _queuedConnections;
+	else
+		return _queue.size();
 }
 
 
@@ -229,12 +307,12 @@ int TCPServerDispatcher::refusedConnections() const
 
 void TCPServerDispatcher::beginConnection()
 {
-	FastMutex::ScopedLock lock(_mutex);
-
 	++_totalConnections;
-	++_currentConnections;
-	if (_currentConnections > _maxConcurrentConnections)
-		_maxConcurrentConnections.store(_currentConnections);
+	int current = ++_currentConnections;
+	int max = _maxConcurrentConnections.load();
+	while (current > max && !_maxConcurrentConnections.compare_exchange_weak(max, current))
+	{
+	}
 }
 
 
@@ -27,6 +27,7 @@ TCPServerParams::TCPServerParams():
 	_reactorMode(false),
 	_acceptorNum(1),
 	_useSelfReactor(false),
+	_threadAffinity(-1),
 	_sendTimeout(0)
 {
 }
@@ -93,6 +94,16 @@ void TCPServerParams::setUseSelfReactor(bool useSelfReactor)
 	poco_assert(_reactorMode);
 	_useSelfReactor = useSelfReactor;
 }
+int TCPServerParams::getThreadAffinity() const
+{
+	poco_assert(_reactorMode);
+	return _threadAffinity;
+}
+void TCPServerParams::setThreadAffinity(int firstCore)
+{
+	poco_assert(_reactorMode);
+	_threadAffinity = firstCore;
+}
 
 
 } // namespace Poco::Net
@@ -0,0 +1,638 @@
+//
+// HTTP2ServerTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTP2ServerTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Event.h"
+#include "Poco/Thread.h"
+#include "Poco/ThreadPool.h"
+#include <atomic>
+#include <map>
+#include <sstream>
+
+
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTP2ServerSession;
+using Poco::Net::HPACKEncoder;
+using Poco::Net::HPACKDecoder;
+using Poco::Net::NameValueCollection;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::StreamCopier;
+using Poco::UInt32;
+
+
+namespace
+{
+	std::atomic<int> barrierCount(0);
+	Poco::Event waitEvent;
+
+	class HelloRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.setContentType("text/plain");
+			response.sendBuffer("Hello, world!", 13);
+		}
+	};
+
+	class EchoRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			if (request.hasContentLength())
+				response.setContentLength64(request.getContentLength64());
+			response.setContentType(request.getContentType());
+			StreamCopier::copyStream(request.stream(), response.send());
+		}
+	};
+
+	class LargeRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::ostream& ostr = response.send();
+			for (int i = 0; i < 5000; ++i)
+			{
+				ostr << std::string(99, 'x') << '\n';
+			}
+		}
+	};
+
+	class BarrierRequestHandler: public HTTPRequestHandler
+		/// Responds only after three requests have arrived,
+		/// which requires them to be processed concurrently.
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			++barrierCount;
+			int n = 0;
+			while (barrierCount < 3 && n++ < 500) Poco::Thread::sleep(10);
+			if (barrierCount < 3) response.setStatusAndReason(HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+			response.sendBuffer("ok", 2);
+		}
+	};
+
+	class WaitRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			waitEvent.tryWait(5000);
+			response.sendBuffer("done", 4);
+		}
+	};
+
+	class RequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			if (request.getURI() == "/hello")
+				return new HelloRequestHandler;
+			else if (request.getURI() == "/echo")
+				return new EchoRequestHandler;
+			else if (request.getURI() == "/large")
+				return new LargeRequestHandler;
+			else if (request.getURI() == "/barrier")
+				return new BarrierRequestHandler;
+			else if (request.getURI() == "/wait")
+				return new WaitRequestHandler;
+			else
+				return nullptr;
+		}
+	};
+
+	class HTTP2TestClient
+		/// A minimal HTTP/2 client for testing.
+	{
+	public:
+		enum
+		{
+			DATA = 0, HEADERS = 1, RST_STREAM = 3, SETTINGS = 4, PING = 6, GOAWAY = 7, WINDOW_UPDATE = 8, CONTINUATION = 9
+		};
+
+		struct Frame
+		{
+			int type = 0;
+			int flags = 0;
+			UInt32 streamId = 0;
+			std::string payload;
+		};
+
+		struct Response
+		{
+			NameValueCollection headers;
+			std::string body;
+			int resetCode = -1;
+			bool complete = false;
+		};
+
+		HTTP2TestClient(const SocketAddress& address, UInt32 initialWindowSize = 65535):
+			_socket(address),
+			_nextStreamId(1),
+			_connSendWindow(65535),
+			_peerInitialWindowSize(65535),
+			_peerMaxStreams(-1),
+			_goAwayCode(-1)
+		{
+			_socket.setReceiveTimeout(Poco::Timespan(10, 0));
+			_socket.setNoDelay(true);
+			_socket.sendBytes(HTTP2ServerSession::CONNECTION_PREFACE.data(), static_cast<int>(HTTP2ServerSession::CONNECTION_PREFACE.size()));
+			std::string settings;
+			appendSetting(settings, 4, initialWindowSize);
+			sendFrame(SETTINGS, 0, 0, settings);
+		}
+
+		void sendFrame(int type, int flags, UInt32 streamId, const std::string& payload)
+		{
+			std::string frame;
+			frame += static_cast<char>(payload.size() >> 16);
+			frame += static_cast<char>(payload.size() >> 8);
+			frame += static_cast<char>(payload.size());
+			frame += static_cast<char>(type);
+			frame += static_cast<char>(flags);
+			append32(frame, streamId);
+			frame += payload;
+			_socket.sendBytes(frame.data(), static_cast<int>(frame.size()));
+		}
+
+		bool readFrame(Frame& frame)
+		{
+			std::string header;
+			if (!receive(9, header)) return false;
+			std::size_t length = (std::size_t(static_cast<unsigned char>(header[0])) << 16) | (std::size_t(static_cast<unsigned char>(header[1])) << 8) | static_cast<unsigned char>(header[2]);
+			frame.type = static_cast<unsigned char>(header[3]);
+			frame.flags = static_cast<unsigned char>(header[4]);
+			frame.streamId = read32(header.data() + 5) & 0x7FFFFFFF;
+			frame.payload.clear();
+			return receive(length, frame.payload);
+		}
+
+		UInt32 sendRequest(const std::string& method, const std::string& path, bool endStream, const NameValueCollection& fields = NameValueCollection())
+		{
+			UInt32 id = _nextStreamId;
+			_nextStreamId += 2;
+			std::string block;
+			_encoder.encode(":method", method, block);
+			_encoder.encode(":scheme", "http", block);
+			_encoder.encode(":path", path, block);
+			_encoder.encode(":authority", "localhost", block);
+			for (const auto& f: fields) _encoder.encode(f.first, f.second, block);
+			sendFrame(HEADERS, 0x04 | (endStream ? 0x01 : 0), id, block);
+			_sendWindows[id] = _peerInitialWindowSize;
+			_responses[id];
+			return id;
+		}
+
+		void sendBody(UInt32 id, const std::string& body)
+		{
+			std::size_t pos = 0;
+			do
+			{
+				while (_sendWindows[id] <= 0 || _connSendWindow <= 0)
+				{
+					Frame frame;
+					if (!readFrame(frame)) throw Poco::IOException("connection closed");
+					process(frame);
+				}
+				std::size_t n = std::min<std::size_t>(body.size() - pos, 16384);
+				n = std::min<std::size_t>(n, std::min(_sendWindows[id], _connSendWindow));
+				_sendWindows[id] -= n;
+				_connSendWindow -= n;
+				sendFrame(DATA, pos + n == body.size() ? 0x01 : 0, id, body.substr(pos, n));
+				pos += n;
+			}
+			while (pos < body.size());
+		}
+
+		Response& waitFor(UInt32 id)
+		{
+			while (!_responses[id].complete)
+			{
+				Frame frame;
+				if (!readFrame(frame)) throw Poco::IOException("connection closed");
+				process(frame);
+			}
+			return _responses[id];
+		}
+
+		void process(const Frame& frame)
+		{
+			switch (frame.type)
+			{
+			case DATA:
+				_responses[frame.streamId].body += frame.payload;
+				if (frame.flags & 0x01) _responses[frame.streamId].complete = true;
+				if (!frame.payload.empty())
+				{
+					std::string increment;
+					append32(increment, static_cast<UInt32>(frame.payload.size()));
+					sendFrame(WINDOW_UPDATE, 0, 0, increment);
+					if (!_responses[frame.streamId].complete) sendFrame(WINDOW_UPDATE, 0, frame.streamId, increment);
+				}
+				break;
+			case HEADERS:
+			case CONTINUATION:
+				_block += frame.payload;
+				if (frame.flags & 0x04)
+				{
+					NameValueCollection headers;
+					_decoder.decode(_block.data(), _block.size(), headers);
+					_block.clear();
+					if (headers.get(":status", "")[0] != '1')
+						_responses[frame.streamId].headers = headers;
+				}
+				if (frame.flags & 0x01) _responses[frame.streamId].complete = true;
+				break;
+			case RST_STREAM:
+				_responses[frame.streamId].resetCode = static_cast<int>(read32(frame.payload.data()));
+				_responses[frame.streamId].complete = true;
+				break;
+			case SETTINGS:
+				if ((frame.flags & 0x01) == 0)
+				{
+					for (std::size_t i = 0; i + 6 <= frame.payload.size(); i += 6)
+					{
+						int id = (static_cast<unsigned char>(frame.payload[i]) << 8) | static_cast<unsigned char>(frame.payload[i + 1]);
+						UInt32 value = read32(frame.payload.data() + i + 2);
+						if (id == 3) _peerMaxStreams = static_cast<int>(value);
+						if (id == 4) _peerInitialWindowSize = value;
+					}
+					sendFrame(SETTINGS, 0x01, 0, "");
+				}
+				break;
+			case GOAWAY:
+				_goAwayCode = static_cast<int>(read32(frame.payload.data() + 4));
+				break;
+			case WINDOW_UPDATE:
+				if (frame.streamId == 0)
+					_connSendWindow += read32(frame.payload.data());
+				else
+					_sendWindows[frame.streamId] += read32(frame.payload.data());
+				break;
+			default:
+				break;
+			}
+		}
+
+		int waitForGoAway()
+		{
+			Frame frame;
+			while (_goAwayCode < 0 && readFrame(frame)) process(frame);
+			return _goAwayCode;
+		}
+
+		bool closed()
+		{
+			Frame frame;
+			while (readFrame(frame)) process(frame);
+			return true;
+		}
+
+		int peerMaxStreams() const
+		{
+			return _peerMaxStreams;
+		}
+
+		static void append32(std::string& out, UInt32 value)
+		{
+			out += static_cast<char>(value >> 24);
+			out += static_cast<char>(value >> 16);
+			out += static_cast<char>(value >> 8);
+			out += static_cast<char>(value);
+		}
+
+		static void appendSetting(std::string& out, int id, UInt32 value)
+		{
+			out += static_cast<char>(id >> 8);
+			out += static_cast<char>(id);
+			append32(out, value);
+		}
+
+		static UInt32 read32(const char* p)
+		{
+			const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+			return (UInt32(u[0]) << 24) | (UInt32(u[1]) << 16) | (UInt32(u[2]) << 8) | u[3];
+		}
+
+	private:
+		bool receive(std::size_t n, std::string& out)
+		{
+			char buffer[16384];
+			while (out.size() < n)
+			{
+				int rc = _socket.receiveBytes(buffer, static_cast<int>(std::min(sizeof(buffer), n - out.size())));
+				if (rc <= 0) return false;
+				out.append(buffer, rc);
+			}
+			return true;
+		}
+
+		StreamSocket _socket;
+		HPACKEncoder _encoder;
+		HPACKDecoder _decoder;
+		std::string  _block;
+		UInt32       _nextStreamId;
+		Poco::Int64  _connSendWindow;
+		Poco::Int64  _peerInitialWindowSize;
+		int          _peerMaxStreams;
+		int          _goAwayCode;
+		std::map<UInt32, Poco::Int64> _sendWindows;
+		std::map<UInt32, Response>    _responses;
+	};
+
+	HTTPServerParams::Ptr http2Params()
+	{
+		HTTPServerParams::Ptr pParams = new HTTPServerParams;
+		pParams->setHTTP2Enabled(true);
+		pParams->setSoftwareVersion("H2Test/1.0");
+		return pParams;
+	}
+}
+
+
+HTTP2ServerTest::HTTP2ServerTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTP2ServerTest::~HTTP2ServerTest()
+{
+}
+
+
+void HTTP2ServerTest::testGet()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	for (int i = 0; i < 3; ++i)
+	{
+		UInt32 id = client.sendRequest("GET", "/hello", true);
+		HTTP2TestClient::Response& response = client.waitFor(id);
+		assertTrue (response.headers.get(":status") == "200");
+		assertTrue (response.headers.get("content-type") == "text/plain");
+		assertTrue (response.headers.get("content-length") == "13");
+		assertTrue (response.headers.get("server") == "H2Test/1.0");
+		assertTrue (response.headers.has("date"));
+		assertTrue (!response.headers.has("connection"));
+		assertTrue (response.body == "Hello, world!");
+	}
+
+	UInt32 id = client.sendRequest("GET", "/notfound", true);
+	HTTP2TestClient::Response& response = client.waitFor(id);
+	assertTrue (response.headers.get(":status") == "501");
+	assertTrue (response.body.empty());
+}
+
+
+void HTTP2ServerTest::testHead()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	UInt32 id = client.sendRequest("HEAD", "/hello", true);
+	HTTP2TestClient::Response& response = client.waitFor(id);
+	assertTrue (response.headers.get(":status") == "200");
+	assertTrue (response.headers.get("content-length") == "13");
+	assertTrue (response.body.empty());
+}
+
+
+void HTTP2ServerTest::testPost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string body;
+	for (int i = 0; i < 200000; ++i) body += static_cast<char>('a' + i % 26);
+	NameValueCollection fields;
+	fields.add("content-type", "text/plain");
+	fields.add("content-length", std::to_string(body.size()));
+	UInt32 id = client.sendRequest("POST", "/echo", false, fields);
+	client.sendBody(id, body);
+	HTTP2TestClient::Response& response = client.waitFor(id);
+	assertTrue (response.headers.get(":status") == "200");
+	assertTrue (response.headers.get("content-type") == "text/plain");
+	assertTrue (response.body == body);
+}
+
+
+void HTTP2ServerTest::testLargeResponse()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	// small stream window, so the server has to wait for WINDOW_UPDATE frames
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()), 4096);
+	UInt32 id = client.sendRequest("GET", "/large", true);
+	HTTP2TestClient::Response& response = client.waitFor(id);
+	assertTrue (response.headers.get(":status") == "200");
+	assertTrue (response.body.size() == 500000);
+	assertTrue (response.body.substr(0, 100) == std::string(99, 'x') + '\n');
+}
+
+
+void HTTP2ServerTest::testConcurrentStreams()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	barrierCount = 0;
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	UInt32 id1 = client.sendRequest("GET", "/barrier", true);
+	UInt32 id2 = client.sendRequest("GET", "/barrier", true);
+	UInt32 id3 = client.sendRequest("GET", "/barrier", true);
+	assertTrue (client.waitFor(id1).headers.get(":status") == "200");
+	assertTrue (client.waitFor(id2).headers.get(":status") == "200");
+	assertTrue (client.waitFor(id3).headers.get(":status") == "200");
+	assertTrue (client.waitFor(id3).body == "ok");
+}
+
+
+void HTTP2ServerTest::testRefusedStream()
+{
+	ServerSocket svs(0);
+	HTTPServerParams::Ptr pParams = http2Params();
+	pParams->setHTTP2MaxConcurrentStreams(1);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	waitEvent.reset();
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	UInt32 id1 = client.sendRequest("GET", "/wait", true);
+	UInt32 id2 = client.sendRequest("GET", "/hello", true);
+	HTTP2TestClient::Response& response2 = client.waitFor(id2);
+	assertTrue (response2.resetCode == HTTP2ServerSession::H2_REFUSED_STREAM);
+	assertTrue (client.peerMaxStreams() == 1);
+
+	waitEvent.set();
+	HTTP2TestClient::Response& response1 = client.waitFor(id1);
+	assertTrue (response1.headers.get(":status") == "200");
+	assertTrue (response1.body == "done");
+}
+
+
+void HTTP2ServerTest::testPing()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendFrame(HTTP2TestClient::PING, 0, 0, "12345678");
+	HTTP2TestClient::Frame frame;
+	while (client.readFrame(frame) && frame.type != HTTP2TestClient::PING)
+	{
+		client.process(frame);
+	}
+	assertTrue (frame.type == HTTP2TestClient::PING);
+	assertTrue (frame.flags == 0x01);
+	assertTrue (frame.payload == "12345678");
+}
+
+
+void HTTP2ServerTest::testProtocolError()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	{
+		HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+		client.sendFrame(HTTP2TestClient::DATA, 0, 0, "data");
+		assertTrue (client.waitForGoAway() == HTTP2ServerSession::H2_PROTOCOL_ERROR);
+		assertTrue (client.closed());
+	}
+	{
+		HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+		client.sendFrame(HTTP2TestClient::HEADERS, 0x05, 1, std::string("\x80", 1));
+		assertTrue (client.waitForGoAway() == HTTP2ServerSession::H2_COMPRESSION_ERROR);
+	}
+	{
+		// missing :path pseudo-header field is a stream error
+		HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+		HPACKEncoder encoder;
+		std::string block;
+		encoder.encode(":method", "GET", block);
+		encoder.encode(":scheme", "http", block);
+		client.sendFrame(HTTP2TestClient::HEADERS, 0x05, 1, block);
+		HTTP2TestClient::Response& response = client.waitFor(1);
+		assertTrue (response.resetCode == HTTP2ServerSession::H2_PROTOCOL_ERROR);
+	}
+}
+
+
+void HTTP2ServerTest::testHTTP1Fallback()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	HTTPRequest request("GET", "/hello", HTTPRequest::HTTP_1_1);
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::string body;
+	cs.receiveResponse(response) >> body;
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.getVersion() == HTTPRequest::HTTP_1_1);
+	assertTrue (body == "Hello,");
+}
+
+
+void HTTP2ServerTest::testThreadPool()
+{
+	Poco::ThreadPool pool(2, 4);
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, pool, svs, http2Params());
+	srv.start();
+
+	// the connection and the handler of the stream both
+	// run on the server's thread pool
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	UInt32 id = client.sendRequest("GET", "/wait", true);
+	int n = 0;
+	while (pool.used() < 2 && n++ < 200) Poco::Thread::sleep(10);
+	assertTrue (pool.used() == 2);
+	waitEvent.set();
+	HTTP2TestClient::Response& response = client.waitFor(id);
+	assertTrue (response.headers.get(":status") == "200");
+	assertTrue (response.body == "done");
+
+	srv.stop();
+	pool.joinAll();
+}
+
+
+void HTTP2ServerTest::setUp()
+{
+}
+
+
+void HTTP2ServerTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTP2ServerTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTP2ServerTest");
+
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testGet);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testHead);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPost);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testLargeResponse);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testConcurrentStreams);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testRefusedStream);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPing);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testProtocolError);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testHTTP1Fallback);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testThreadPool);
+
+	return pSuite;
+}
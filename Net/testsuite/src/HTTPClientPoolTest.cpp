@@ -0,0 +1,332 @@
+//
+// HTTPClientPoolTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPClientPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPClientPool.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Exception.h"
+#include <sstream>
+
+
+using Poco::Net::HTTPClientPool;
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::ServerSocket;
+using Poco::Net::ProxyConfig;
+using Poco::StreamCopier;
+using Poco::Thread;
+using Poco::URI;
+
+
+namespace
+{
+	class BodyRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string body(request.getURI() == "/large" ? 100000 : 5, 'x');
+			response.setContentType("text/plain");
+			response.setContentLength(body.size());
+			response.send() << body;
+		}
+	};
+
+	class RequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new BodyRequestHandler;
+		}
+	};
+
+	std::string get(HTTPClientPool::PooledSession& pSession, const std::string& path)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, path, HTTPRequest::HTTP_1_1);
+		pSession->sendRequest(request);
+		HTTPResponse response;
+		std::istream& rs = pSession->receiveResponse(response);
+		std::ostringstream ostr;
+		StreamCopier::copyStream(rs, ostr);
+		return ostr.str();
+	}
+
+	Poco::UInt16 localPort(HTTPClientPool::PooledSession& pSession)
+	{
+		return pSession->socket().address().port();
+	}
+
+	class Releaser: public Poco::Runnable
+	{
+	public:
+		Releaser(HTTPClientPool::PooledSession& pSession):
+			_pSession(pSession)
+		{
+		}
+
+		void run()
+		{
+			Thread::sleep(200);
+			_pSession.release();
+		}
+
+	private:
+		HTTPClientPool::PooledSession& _pSession;
+	};
+}
+
+
+HTTPClientPoolTest::HTTPClientPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPClientPoolTest::~HTTPClientPoolTest()
+{
+}
+
+
+void HTTPClientPoolTest::testReuse()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1/");
+	uri.setPort(svs.address().port());
+
+	HTTPClientPool pool;
+	Poco::UInt16 port = 0;
+	{
+		HTTPClientPool::PooledSession pSession = pool.get(uri);
+		assertTrue (pool.activeSessions() == 1);
+		assertTrue (get(pSession, "/") == "xxxxx");
+		port = localPort(pSession);
+	}
+	assertTrue (pool.activeSessions() == 0);
+	assertTrue (pool.idleSessions() == 1);
+
+	for (int i = 0; i < 3; i++)
+	{
+		HTTPClientPool::PooledSession pSession = pool.get(uri);
+		assertTrue (pool.idleSessions() == 0);
+		assertTrue (get(pSession, "/") == "xxxxx");
+		assertTrue (localPort(pSession) == port);
+	}
+	assertTrue (pool.idleSessions() == 1);
+	assertTrue (srv.totalConnections() == 1);
+
+	pool.clear();
+	assertTrue (pool.idleSessions() == 0);
+}
+
+
+void HTTPClientPoolTest::testMaxSessionsPerHost()
+{
+	URI uri("http://127.0.0.1:8080/");
+
+	HTTPClientPool pool(2);
+	pool.setWaitTimeout(Poco::Timespan(0, 100000));
+	HTTPClientPool::PooledSession pSession1 = pool.get(uri);
+	HTTPClientPool::PooledSession pSession2 = pool.get(uri);
+	assertTrue (pool.activeSessions() == 2);
+	try
+	{
+		HTTPClientPool::PooledSession pSession3 = pool.get(uri);
+		fail("maximum number of sessions exceeded - must throw");
+	}
+	catch (Poco::TimeoutException&)
+	{
+	}
+
+	HTTPClientPool::PooledSession pSession4 = pool.get(URI("http://127.0.0.1:8081/"));
+	assertTrue (pool.activeSessions() == 3);
+
+	pSession1.release();
+	assertTrue (pSession1.isNull());
+	HTTPClientPool::PooledSession pSession3 = pool.get(uri);
+	assertTrue (!pSession3.isNull());
+	assertTrue (pool.activeSessions() == 3);
+}
+
+
+void HTTPClientPoolTest::testWaitForSession()
+{
+	URI uri("http://127.0.0.1:8080/");
+
+	HTTPClientPool pool(1);
+	HTTPClientPool::PooledSession pSession1 = pool.get(uri);
+	Releaser releaser(pSession1);
+	Thread thread;
+	thread.start(releaser);
+	HTTPClientPool::PooledSession pSession2 = pool.get(uri);
+	thread.join();
+	assertTrue (pSession1.isNull());
+	assertTrue (!pSession2.isNull());
+	assertTrue (pool.activeSessions() == 1);
+}
+
+
+void HTTPClientPoolTest::testIdleTimeout()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1/");
+	uri.setPort(svs.address().port());
+
+	HTTPClientPool pool;
+	{
+		HTTPClientPool::PooledSession pSession = pool.get(uri);
+		pSession->setKeepAliveTimeout(Poco::Timespan(0, 200000));
+		assertTrue (get(pSession, "/") == "xxxxx");
+	}
+	assertTrue (pool.idleSessions() == 1);
+	assertTrue (pool.purgeIdle() == 0);
+	Thread::sleep(300);
+	assertTrue (pool.purgeIdle() == 1);
+	assertTrue (pool.idleSessions() == 0);
+
+	{
+		HTTPClientPool::PooledSession pSession = pool.get(uri);
+		pSession->setKeepAliveTimeout(Poco::Timespan(0, 200000));
+		assertTrue (get(pSession, "/") == "xxxxx");
+	}
+	Thread::sleep(300);
+	HTTPClientPool::PooledSession pSession = pool.get(uri);
+	assertTrue (!pSession->connected());
+	assertTrue (pool.idleSessions() == 0);
+}
+
+
+void HTTPClientPoolTest::testUnreadResponse()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1/");
+	uri.setPort(svs.address().port());
+
+	HTTPClientPool pool;
+	{
+		HTTPClientPool::PooledSession pSession = pool.get(uri);
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/large", HTTPRequest::HTTP_1_1);
+		pSession->sendRequest(request);
+		HTTPResponse response;
+		pSession->receiveResponse(response);
+	}
+	assertTrue (pool.idleSessions() == 0);
+
+	HTTPClientPool::PooledSession pSession = pool.get(uri);
+	assertTrue (get(pSession, "/") == "xxxxx");
+}
+
+
+void HTTPClientPoolTest::testDiscard()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("http://127.0.0.1/");
+	uri.setPort(svs.address().port());
+
+	HTTPClientPool pool;
+	HTTPClientPool::PooledSession pSession = pool.get(uri);
+	assertTrue (get(pSession, "/") == "xxxxx");
+	pSession.discard();
+	assertTrue (pSession.isNull());
+	assertTrue (pool.activeSessions() == 0);
+	assertTrue (pool.idleSessions() == 0);
+}
+
+
+void HTTPClientPoolTest::testEndpoints()
+{
+	HTTPClientPool pool(1);
+	pool.setWaitTimeout(0);
+
+	URI uri("http://127.0.0.1:8080/");
+	ProxyConfig proxy;
+	proxy.host = "proxy.example.com";
+	proxy.port = 3128;
+
+	HTTPClientPool::PooledSession pSession1 = pool.get(uri);
+	HTTPClientPool::PooledSession pSession2 = pool.get(uri, proxy);
+	assertTrue (pSession2->getProxyHost() == "proxy.example.com");
+	HTTPClientPool::PooledSession pSession3 = pool.get(URI("http://localhost:8080/"));
+	assertTrue (pool.activeSessions() == 3);
+	try
+	{
+		HTTPClientPool::PooledSession pSession4 = pool.get(URI("http://127.0.0.1:8080/index.html"));
+		fail("same endpoint - must throw");
+	}
+	catch (Poco::TimeoutException&)
+	{
+	}
+
+	try
+	{
+		pool.get(URI("ftp://127.0.0.1/"));
+		fail("unsupported scheme - must throw");
+	}
+	catch (Poco::UnknownURISchemeException&)
+	{
+	}
+	assertTrue (pool.activeSessions() == 3);
+}
+
+
+void HTTPClientPoolTest::setUp()
+{
+}
+
+
+void HTTPClientPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPClientPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPClientPoolTest");
+
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testReuse);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testMaxSessionsPerHost);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testWaitForSession);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testIdleTimeout);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testUnreadResponse);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testDiscard);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testEndpoints);
+
+	return pSuite;
+}
@@ -0,0 +1,44 @@
+//
+// HTTPClientPoolTest.h
+//
+// Definition of the HTTPClientPoolTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPClientPoolTest_INCLUDED
+#define HTTPClientPoolTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTPClientPoolTest: public CppUnit::TestCase
+{
+public:
+	HTTPClientPoolTest(const std::string& name);
+	~HTTPClientPoolTest();
+
+	void testReuse();
+	void testMaxSessionsPerHost();
+	void testWaitForSession();
+	void testIdleTimeout();
+	void testUnreadResponse();
+	void testDiscard();
+	void testEndpoints();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTPClientPoolTest_INCLUDED
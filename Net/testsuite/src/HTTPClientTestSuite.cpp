@@ -11,6 +11,8 @@
 #include "HTTPClientTestSuite.h"
 #include "HTTPClientSessionTest.h"
 #include "HTTPStreamFactoryTest.h"
+#include "HTTPClientPoolTest.h"
+#include "HTTPReactorClientTest.h"
 
 
 CppUnit::Test* HTTPClientTestSuite::suite()
@@ -19,6 +21,8 @@ CppUnit::Test* HTTPClientTestSuite::suite()
 
 	pSuite->addTest(HTTPClientSessionTest::suite());
 	pSuite->addTest(HTTPStreamFactoryTest::suite());
+	pSuite->addTest(HTTPClientPoolTest::suite());
+	pSuite->addTest(HTTPReactorClientTest::suite());
 
 	return pSuite;
 }
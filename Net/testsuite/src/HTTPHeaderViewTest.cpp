@@ -0,0 +1,306 @@
+//
+// HTTPHeaderViewTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPHeaderViewTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPHeaderView.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Exception.h"
+#include <sstream>
+
+
+using Poco::Net::HTTPHeaderView;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::MessageException;
+using Poco::NotFoundException;
+
+
+HTTPHeaderViewTest::HTTPHeaderViewTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPHeaderViewTest::~HTTPHeaderViewTest()
+{
+}
+
+
+void HTTPHeaderViewTest::testParse()
+{
+	std::string s("GET /index.html HTTP/1.1\r\nHost: localhost\r\nContent-Length: 4\r\nX-Empty:\r\n\r\nbody");
+	HTTPHeaderView view;
+	std::size_t n = view.parse(s.data(), s.size());
+	assertTrue (n == s.size() - 4);
+	assertTrue (view.startLine() == "GET /index.html HTTP/1.1");
+	assertTrue (view.size() == 3);
+	assertTrue (view.name(0) == "Host");
+	assertTrue (view.value(0) == "localhost");
+	assertTrue (view.name(1) == "Content-Length");
+	assertTrue (view.value(1) == "4");
+	assertTrue (view.name(2) == "X-Empty");
+	assertTrue (view.value(2).empty());
+
+	assertTrue (view.has("content-length"));
+	assertTrue (view.get("CONTENT-LENGTH") == "4");
+	assertTrue (!view.has("Content-Type"));
+	assertTrue (view.get("Content-Type", "text/plain") == "text/plain");
+	try
+	{
+		view.get("Content-Type");
+		fail("nonexistent field - must throw");
+	}
+	catch (NotFoundException&)
+	{
+	}
+
+	// the values refer to the parsed buffer
+	assertTrue (view.value(0).data() == s.data() + s.find("localhost"));
+
+	view.clear();
+	assertTrue (view.empty());
+	assertTrue (view.startLine().empty());
+}
+
+
+void HTTPHeaderViewTest::testIncomplete()
+{
+	std::string s("\r\nPOST / HTTP/1.1\r\nHost: localhost\r\nX-Folded: a\r\n b\r\n\r\n");
+	HTTPHeaderView view;
+	for (std::size_t i = 0; i < s.size(); ++i)
+	{
+		assertTrue (view.parse(s.data(), i) == 0);
+	}
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+	assertTrue (view.startLine() == "POST / HTTP/1.1");
+	assertTrue (view.size() == 2);
+
+	std::string lf("GET / HTTP/1.0\nHost: localhost\n\n");
+	assertTrue (view.parse(lf.data(), lf.size()) == lf.size());
+	assertTrue (view.startLine() == "GET / HTTP/1.0");
+	assertTrue (view.get("Host") == "localhost");
+}
+
+
+void HTTPHeaderViewTest::testWhitespace()
+{
+	std::string s("GET / HTTP/1.1\r\nName1: \t value1 \t\r\nName2:value2\r\ninvalid line\r\nName3 :  value 3  \r\n\r\n");
+	HTTPHeaderView view;
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+	assertTrue (view.size() == 3);
+	assertTrue (view.get("Name1") == "value1");
+	assertTrue (view.get("Name2") == "value2");
+	assertTrue (view.name(2) == "Name3 ");
+	assertTrue (view.value(2) == "value 3");
+}
+
+
+void HTTPHeaderViewTest::testFolding()
+{
+	std::string s("GET / HTTP/1.1\r\nName1: value1\r\n continued\r\n\tand more\r\nName2: value2\r\n\r\n");
+	HTTPHeaderView view;
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+	assertTrue (view.size() == 2);
+	assertTrue (view.get("Name1") == "value1\r\n continued\r\n\tand more");
+	assertTrue (view.get("Name2") == "value2");
+
+	HTTPRequest request;
+	request.read(view);
+	assertTrue (request.get("Name1") == "value1 continued\tand more");
+}
+
+
+void HTTPHeaderViewTest::testToken()
+{
+	std::string s("POST / HTTP/1.1\r\nTransfer-Encoding: gzip , Chunked\r\nConnection: close\r\n\r\n");
+	HTTPHeaderView view;
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+	assertTrue (view.hasToken("Transfer-Encoding", "chunked"));
+	assertTrue (view.hasToken("transfer-encoding", "GZIP"));
+	assertTrue (!view.hasToken("Transfer-Encoding", "deflate"));
+	assertTrue (!view.hasToken("Connection", "chunked"));
+	assertTrue (!view.hasToken("Content-Encoding", "gzip"));
+}
+
+
+void HTTPHeaderViewTest::testManyFields()
+{
+	std::string s("GET / HTTP/1.1\r\n");
+	for (int i = 0; i < 200; ++i)
+	{
+		s += "Name";
+		s += std::to_string(i);
+		s += ": value\r\n";
+	}
+	s += "\r\n";
+	HTTPHeaderView view;
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+	assertTrue (view.size() == 200);
+	assertTrue (view.name(0) == "Name0");
+	assertTrue (view.name(HTTPHeaderView::INLINE_FIELDS) == "Name32");
+	assertTrue (view.name(199) == "Name199");
+	assertTrue (view.get("name150") == "value");
+
+	HTTPRequest request;
+	try
+	{
+		request.read(view);
+		fail("too many fields - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	HTTPRequest unlimited;
+	unlimited.setFieldLimit(0);
+	unlimited.read(view);
+	assertTrue (unlimited.size() == 200);
+
+	std::string small("GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+	assertTrue (view.parse(small.data(), small.size()) == small.size());
+	assertTrue (view.size() == 1);
+	assertTrue (!view.has("Name199"));
+}
+
+
+void HTTPHeaderViewTest::testReadRequest()
+{
+	std::string s("POST /test.cgi?a=b HTTP/1.1\r\nHost: localhost:8000\r\nConnection: Keep-Alive\r\nContent-Length: 100\r\nContent-Type: text/plain\r\n\r\n");
+	HTTPHeaderView view;
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+
+	HTTPRequest request;
+	request.read(view);
+	assertTrue (request.getMethod() == HTTPRequest::HTTP_POST);
+	assertTrue (request.getURI() == "/test.cgi?a=b");
+	assertTrue (request.getVersion() == HTTPRequest::HTTP_1_1);
+	assertTrue (request.size() == 4);
+	assertTrue (request.getHost() == "localhost:8000");
+	assertTrue (request.getKeepAlive());
+	assertTrue (request.getContentLength() == 100);
+	assertTrue (request.getContentType() == "text/plain");
+
+	std::istringstream istr(s);
+	HTTPRequest streamRequest;
+	streamRequest.read(istr);
+	assertTrue (streamRequest.getMethod() == request.getMethod());
+	assertTrue (streamRequest.getURI() == request.getURI());
+	assertTrue (streamRequest.getVersion() == request.getVersion());
+	assertTrue (streamRequest.size() == request.size());
+}
+
+
+void HTTPHeaderViewTest::testReadRequestInvalid()
+{
+	HTTPHeaderView view;
+	std::string s("GET / HTTP/1.1\r\n");
+	s += std::string(300, 'x');
+	s += ": value\r\n\r\n";
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+	try
+	{
+		HTTPRequest request;
+		request.read(view);
+		fail("field name too long - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	std::string method("VERYVERYVERYVERYVERYVERYLONGMETHOD / HTTP/1.1\r\n\r\n");
+	assertTrue (view.parse(method.data(), method.size()) == method.size());
+	try
+	{
+		HTTPRequest request;
+		request.read(view);
+		fail("method too long - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	std::string version("GET / HTTP/1.1.1.1\r\n\r\n");
+	assertTrue (view.parse(version.data(), version.size()) == version.size());
+	try
+	{
+		HTTPRequest request;
+		request.read(view);
+		fail("invalid version - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+}
+
+
+void HTTPHeaderViewTest::testReadResponse()
+{
+	std::string s("HTTP/1.1 404 Not Found\r\nContent-Length: 10\r\nConnection: close\r\n\r\n");
+	HTTPHeaderView view;
+	assertTrue (view.parse(s.data(), s.size()) == s.size());
+
+	HTTPResponse response;
+	response.read(view);
+	assertTrue (response.getVersion() == HTTPResponse::HTTP_1_1);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_NOT_FOUND);
+	assertTrue (response.getReason() == "Not Found");
+	assertTrue (response.size() == 2);
+	assertTrue (response.getContentLength() == 10);
+	assertTrue (!response.getKeepAlive());
+
+	std::string noReason("HTTP/1.1 200\r\n\r\n");
+	assertTrue (view.parse(noReason.data(), noReason.size()) == noReason.size());
+	response.clear();
+	response.read(view);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.getReason().empty());
+
+	std::string noStatus("HTTP/1.1\r\n\r\n");
+	assertTrue (view.parse(noStatus.data(), noStatus.size()) == noStatus.size());
+	try
+	{
+		response.read(view);
+		fail("no status - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+}
+
+
+void HTTPHeaderViewTest::setUp()
+{
+}
+
+
+void HTTPHeaderViewTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPHeaderViewTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPHeaderViewTest");
+
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testParse);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testIncomplete);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testWhitespace);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testFolding);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testToken);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testManyFields);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testReadRequest);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testReadRequestInvalid);
+	CppUnit_addTest(pSuite, HTTPHeaderViewTest, testReadResponse);
+
+	return pSuite;
+}
@@ -0,0 +1,46 @@
+//
+// HTTPHeaderViewTest.h
+//
+// Definition of the HTTPHeaderViewTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPHeaderViewTest_INCLUDED
+#define HTTPHeaderViewTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTPHeaderViewTest: public CppUnit::TestCase
+{
+public:
+	HTTPHeaderViewTest(const std::string& name);
+	~HTTPHeaderViewTest();
+
+	void testParse();
+	void testIncomplete();
+	void testWhitespace();
+	void testFolding();
+	void testToken();
+	void testManyFields();
+	void testReadRequest();
+	void testReadRequestInvalid();
+	void testReadResponse();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTPHeaderViewTest_INCLUDED
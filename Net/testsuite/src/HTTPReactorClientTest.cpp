@@ -0,0 +1,539 @@
+//
+// HTTPReactorClientTest.cpp
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPReactorClientTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPReactorClient.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include "Poco/Event.h"
+#include "Poco/Exception.h"
+#include "Poco/Runnable.h"
+#include "Poco/NumberParser.h"
+#include "Poco/String.h"
+#include <atomic>
+#include <future>
+#include <map>
+#include <sstream>
+
+
+using Poco::Net::HTTPReactorClient;
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::Net::SocketReactor;
+using Poco::StreamCopier;
+using Poco::Thread;
+
+
+namespace
+{
+	class TestRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			const std::string& uri = request.getURI();
+			response.setContentType("text/plain");
+			if (uri == "/echo")
+			{
+				std::string body;
+				StreamCopier::copyToString(request.stream(), body);
+				response.setContentLength(body.size());
+				response.send() << body;
+			}
+			else if (uri == "/chunked")
+			{
+				response.setChunkedTransferEncoding(true);
+				std::ostream& ostr = response.send();
+				for (int i = 0; i < 100; i++)
+				{
+					ostr << std::string(1000, static_cast<char>('a' + i % 26));
+					ostr.flush();
+				}
+			}
+			else if (uri == "/close")
+			{
+				response.setKeepAlive(false);
+				response.send() << "closed";
+			}
+			else if (uri == "/slow")
+			{
+				Thread::sleep(1000);
+				response.setContentLength(4);
+				response.send() << "slow";
+			}
+			else
+			{
+				std::string body("Hello, world!");
+				response.setContentLength(body.size());
+				response.send() << body;
+			}
+		}
+	};
+
+	class TestRequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new TestRequestHandler;
+		}
+	};
+
+	class ReactorRunner
+		/// Runs the reactor until destroyed. Must be destroyed
+		/// before the HTTPReactorClient using the reactor.
+	{
+	public:
+		ReactorRunner(SocketReactor& reactor):
+			_reactor(reactor)
+		{
+			_reactor.setTimeout(Poco::Timespan(0, 50000));
+			_thread.start(_reactor);
+		}
+
+		~ReactorRunner()
+		{
+			_reactor.stop();
+			_thread.join();
+		}
+
+	private:
+		SocketReactor& _reactor;
+		Thread _thread;
+	};
+
+	class StaleConnectionServer: public Poco::Runnable
+		/// Answers the first request on every connection and
+		/// closes the connection when the next request arrives,
+		/// like a server closing an idle connection while the
+		/// client sends a new request over it.
+	{
+	public:
+		StaleConnectionServer():
+			_socket(SocketAddress("127.0.0.1", 0)),
+			_stop(false)
+		{
+			_thread.start(*this);
+		}
+
+		~StaleConnectionServer()
+		{
+			_stop = true;
+			_thread.join();
+		}
+
+		Poco::UInt16 port() const
+		{
+			return _socket.address().port();
+		}
+
+		int requests(const std::string& method)
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			return _requests[method];
+		}
+
+		void run()
+		{
+			while (!_stop)
+			{
+				if (!_socket.poll(Poco::Timespan(0, 50000), Poco::Net::Socket::SELECT_READ)) continue;
+				StreamSocket socket = _socket.acceptConnection();
+				socket.setReceiveTimeout(Poco::Timespan(2, 0));
+				try
+				{
+					bool first = true;
+					std::string method;
+					while (readRequest(socket, method))
+					{
+						{
+							Poco::FastMutex::ScopedLock lock(_mutex);
+							++_requests[method];
+						}
+						if (!first) break;
+						first = false;
+						std::string response("HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok");
+						socket.sendBytes(response.data(), static_cast<int>(response.size()));
+					}
+				}
+				catch (Poco::Exception&)
+				{
+				}
+				socket.close();
+			}
+		}
+
+	private:
+		bool readRequest(StreamSocket& socket, std::string& method)
+		{
+			std::string data;
+			std::string::size_type end;
+			char buffer[1024];
+			while ((end = data.find("\r\n\r\n")) == std::string::npos)
+			{
+				int n = socket.receiveBytes(buffer, sizeof(buffer));
+				if (n <= 0) return false;
+				data.append(buffer, n);
+			}
+			method = data.substr(0, data.find(' '));
+			std::size_t length = 0;
+			std::string::size_type pos = Poco::toLower(data).find("content-length:");
+			if (pos != std::string::npos && pos < end)
+				length = Poco::NumberParser::parseUnsigned(Poco::trim(data.substr(pos + 15, data.find("\r\n", pos) - pos - 15)));
+			std::size_t received = data.size() - end - 4;
+			while (received < length)
+			{
+				int n = socket.receiveBytes(buffer, sizeof(buffer));
+				if (n <= 0) return false;
+				received += n;
+			}
+			return true;
+		}
+
+		ServerSocket _socket;
+		std::atomic<bool> _stop;
+		Thread _thread;
+		Poco::FastMutex _mutex;
+		std::map<std::string, int> _requests;
+	};
+
+	HTTPServerParams* createParams()
+	{
+		HTTPServerParams* pParams = new HTTPServerParams;
+		pParams->setMaxThreads(16);
+		pParams->setKeepAliveTimeout(Poco::Timespan(5, 0));
+		return pParams;
+	}
+}
+
+
+HTTPReactorClientTest::HTTPReactorClientTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPReactorClientTest::~HTTPReactorClientTest()
+{
+}
+
+
+void HTTPReactorClientTest::testGet()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+	std::future<HTTPReactorClient::Response> future = client.sendRequest(request);
+	HTTPReactorClient::Response response = future.get();
+	assertTrue (response.response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.response.getContentType() == "text/plain");
+	assertTrue (response.body == "Hello, world!");
+	assertTrue (client.pendingRequests() == 0);
+	assertTrue (client.connections() == 1);
+}
+
+
+void HTTPReactorClientTest::testPost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	std::string body(200000, 'x');
+	HTTPRequest request(HTTPRequest::HTTP_POST, "/echo", HTTPMessage::HTTP_1_1);
+	HTTPReactorClient::Response response = client.sendRequest(request, body).get();
+	assertTrue (response.response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.body == body);
+
+	HTTPRequest chunkedRequest(HTTPRequest::HTTP_POST, "/echo", HTTPMessage::HTTP_1_1);
+	chunkedRequest.setChunkedTransferEncoding(true);
+	response = client.sendRequest(chunkedRequest, "chunked body").get();
+	assertTrue (response.body == "chunked body");
+}
+
+
+void HTTPReactorClientTest::testChunked()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/chunked", HTTPMessage::HTTP_1_1);
+	HTTPReactorClient::Response response = client.sendRequest(request).get();
+	assertTrue (response.response.getChunkedTransferEncoding());
+	assertTrue (response.body.size() == 100000);
+	assertTrue (response.body.substr(0, 1000) == std::string(1000, 'a'));
+	assertTrue (response.body.substr(99000) == std::string(1000, 'v'));
+
+	response = client.sendRequest(request).get();
+	assertTrue (response.body.size() == 100000);
+	assertTrue (client.connections() == 1);
+}
+
+
+void HTTPReactorClientTest::testHead()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	HTTPRequest request(HTTPRequest::HTTP_HEAD, "/", HTTPMessage::HTTP_1_1);
+	HTTPReactorClient::Response response = client.sendRequest(request).get();
+	assertTrue (response.response.getContentLength() == 13);
+	assertTrue (response.body.empty());
+
+	HTTPRequest getRequest(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+	response = client.sendRequest(getRequest).get();
+	assertTrue (response.body == "Hello, world!");
+}
+
+
+void HTTPReactorClientTest::testReadUntilClose()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/close", HTTPMessage::HTTP_1_1);
+	HTTPReactorClient::Response response = client.sendRequest(request).get();
+	assertTrue (!response.response.getKeepAlive());
+	assertTrue (response.body == "closed");
+	assertTrue (client.connections() == 0);
+
+	response = client.sendRequest(request).get();
+	assertTrue (response.body == "closed");
+}
+
+
+void HTTPReactorClientTest::testConcurrentRequests()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	client.setMaxConnections(4);
+
+	const int REQUESTS = 200;
+	std::atomic<int> succeeded(0);
+	std::atomic<int> completed(0);
+	Poco::Event done;
+	for (int i = 0; i < REQUESTS; i++)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+		client.sendRequest(request, "", [&](const Poco::Exception* pException, HTTPReactorClient::Response& response)
+			{
+				if (!pException && response.body == "Hello, world!") ++succeeded;
+				if (++completed == REQUESTS) done.set();
+			});
+		assertTrue (client.connections() <= 4);
+	}
+	done.wait(20000);
+	assertTrue (succeeded == REQUESTS);
+	assertTrue (client.pendingRequests() == 0);
+	assertTrue (client.connections() <= 4);
+	assertTrue (srv.totalConnections() <= 4);
+}
+
+
+void HTTPReactorClientTest::testKeepAlive()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	client.setKeepAliveTimeout(Poco::Timespan(0, 200000));
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+	assertTrue (client.sendRequest(request).get().body == "Hello, world!");
+	assertTrue (client.sendRequest(request).get().body == "Hello, world!");
+	assertTrue (srv.totalConnections() == 1);
+	assertTrue (client.connections() == 1);
+
+	Thread::sleep(500);
+	assertTrue (client.connections() == 0);
+	assertTrue (client.sendRequest(request).get().body == "Hello, world!");
+	assertTrue (srv.totalConnections() == 2);
+}
+
+
+void HTTPReactorClientTest::testTimeout()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+	ReactorRunner runner(reactor);
+	client.setTimeout(Poco::Timespan(0, 300000));
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/slow", HTTPMessage::HTTP_1_1);
+	std::future<HTTPReactorClient::Response> future = client.sendRequest(request);
+	try
+	{
+		future.get();
+		fail("request must time out");
+	}
+	catch (Poco::TimeoutException&)
+	{
+	}
+	assertTrue (client.pendingRequests() == 0);
+	assertTrue (client.connections() == 0);
+}
+
+
+void HTTPReactorClientTest::testConnectionRefused()
+{
+	SocketAddress address;
+	{
+		ServerSocket svs(0);
+		address = SocketAddress("127.0.0.1", svs.address().port());
+	}
+
+	SocketReactor reactor;
+	HTTPReactorClient client(address, reactor);
+	ReactorRunner runner(reactor);
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+	std::future<HTTPReactorClient::Response> future = client.sendRequest(request);
+	try
+	{
+		future.get();
+		fail("connection refused - must throw");
+	}
+	catch (Poco::Net::NetException&)
+	{
+	}
+	assertTrue (client.pendingRequests() == 0);
+}
+
+
+void HTTPReactorClientTest::testClose()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new TestRequestHandlerFactory, svs, createParams());
+	srv.start();
+
+	std::future<HTTPReactorClient::Response> future;
+	SocketReactor reactor;
+	{
+		HTTPReactorClient client("127.0.0.1", svs.address().port(), reactor);
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+		future = client.sendRequest(request);
+		assertTrue (client.pendingRequests() == 1);
+	}
+	try
+	{
+		future.get();
+		fail("client destroyed - must throw");
+	}
+	catch (Poco::IOException&)
+	{
+	}
+}
+
+
+void HTTPReactorClientTest::testRetry()
+{
+	StaleConnectionServer srv;
+
+	SocketReactor reactor;
+	HTTPReactorClient client("127.0.0.1", srv.port(), reactor);
+	ReactorRunner runner(reactor);
+
+	// a GET failing on a reused connection is sent again
+	HTTPRequest get(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+	assertTrue (client.sendRequest(get).get().body == "ok");
+	assertTrue (client.sendRequest(get).get().body == "ok");
+	assertTrue (srv.requests(HTTPRequest::HTTP_GET) == 3);
+
+	// a POST is not, as the server may have processed it
+	HTTPRequest post(HTTPRequest::HTTP_POST, "/", HTTPMessage::HTTP_1_1);
+	try
+	{
+		client.sendRequest(post, "data").get();
+		fail("stale connection - must throw");
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	assertTrue (srv.requests(HTTPRequest::HTTP_POST) == 1);
+}
+
+
+void HTTPReactorClientTest::setUp()
+{
+}
+
+
+void HTTPReactorClientTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPReactorClientTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPReactorClientTest");
+
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testGet);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testPost);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testChunked);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testHead);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testReadUntilClose);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testConcurrentRequests);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testKeepAlive);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testTimeout);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testConnectionRefused);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testClose);
+	CppUnit_addTest(pSuite, HTTPReactorClientTest, testRetry);
+
+	return pSuite;
+}
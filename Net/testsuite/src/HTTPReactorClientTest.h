@@ -0,0 +1,48 @@
+//
+// HTTPReactorClientTest.h
+//
+// Definition of the HTTPReactorClientTest class.
+//
+// Copyright (c) 2026, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPReactorClientTest_INCLUDED
+#define HTTPReactorClientTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTPReactorClientTest: public CppUnit::TestCase
+{
+public:
+	HTTPReactorClientTest(const std::string& name);
+	~HTTPReactorClientTest();
+
+	void testGet();
+	void testPost();
+	void testChunked();
+	void testHead();
+	void testReadUntilClose();
+	void testConcurrentRequests();
+	void testKeepAlive();
+	void testTimeout();
+	void testConnectionRefused();
+	void testClose();
+	void testRetry();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTPReactorClientTest_INCLUDED
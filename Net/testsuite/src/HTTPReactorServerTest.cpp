@@ -8,6 +8,8 @@
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPServerRequestImpl.h"
+#include "Poco/Net/HTTPHeaderView.h"
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/Net/NetException.h"
@@ -101,6 +103,33 @@ namespace
 		}
 	};
 
+	// Simulates a handler blocked on e.g. a database query.
+	class SlowRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest&, HTTPServerResponse& response)
+		{
+			Poco::Thread::sleep(500);
+			response.setContentLength(4);
+			response.send() << "slow";
+		}
+	};
+
+	// Answers with the value of the X-Token header, taken
+	// from the session's header index.
+	class HeaderViewRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			auto* pRequestImpl = dynamic_cast<Poco::Net::HTTPServerRequestImpl*>(&request);
+			const Poco::Net::HTTPHeaderView* pView = pRequestImpl ? pRequestImpl->headerView() : nullptr;
+			std::string body = pView ? std::string(pView->get("X-Token", "missing")) : std::string("no view");
+			response.setContentLength(static_cast<int>(body.size()));
+			response.send() << body;
+		}
+	};
+
 	class RequestHandlerFactory: public HTTPRequestHandlerFactory
 	{
 	public:
@@ -113,6 +142,8 @@ namespace
 			if (request.getURI() == "/throw-poco") return new ThrowPocoRequestHandler;
 			if (request.getURI() == "/throw-std")  return new ThrowStdRequestHandler;
 			if (request.getURI() == "/big")        return new BigBodyRequestHandler;
+			if (request.getURI() == "/slow")       return new SlowRequestHandler;
+			if (request.getURI() == "/view")       return new HeaderViewRequestHandler;
 			return new EchoBodyRequestHandler;
 		}
 	};
@@ -529,6 +560,205 @@ void HTTPReactorServerTest::testUseSelfReactor()
 	srv.stop();
 }
 
+void HTTPReactorServerTest::testShardedReactors()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	pParams->setReactorMode(true);
+	pParams->setAcceptorNum(4);
+	pParams->setUseSelfReactor(true);
+	assertTrue(pParams->getThreadAffinity() == -1);
+	pParams->setThreadAffinity(0);
+	assertTrue(pParams->getThreadAffinity() == 0);
+
+	// all acceptors must share the same (ephemeral) port
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	int port = srv.port();
+	assertTrue(port != 0);
+
+	for (int i = 0; i < 20; ++i)
+	{
+		HTTPClientSession cs("127.0.0.1", port);
+		std::string body("Sharded " + std::to_string(i));
+		HTTPRequest request("POST", "/", HTTPMessage::HTTP_1_1);
+		request.setContentLength((int) body.length());
+		cs.sendRequest(request) << body;
+		HTTPResponse response;
+		std::string rbody;
+		std::istream& rs = cs.receiveResponse(response);
+		rbody.assign((std::istreambuf_iterator<char>(rs)), std::istreambuf_iterator<char>());
+		assertTrue(rbody == body);
+	}
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testOffloadPool()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setReactorMode(true);
+	pParams->setUseSelfReactor(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.setOffloadPool(2, 4, [](const HTTPServerRequest& request)
+		{
+			return request.getURI() == "/slow";
+		});
+	srv.start();
+
+	int port = srv.port();
+
+	// a slow, offloaded request must not delay a fast one on the same reactor
+	HTTPClientSession slow("127.0.0.1", port);
+	slow.setKeepAlive(true);
+	HTTPRequest slowRequest("GET", "/slow", HTTPMessage::HTTP_1_1);
+	slow.sendRequest(slowRequest);
+	slow.flushRequest();
+
+	Poco::Timestamp start;
+	HTTPClientSession fast("127.0.0.1", port);
+	std::string body("fast");
+	HTTPRequest fastRequest("POST", "/", HTTPMessage::HTTP_1_1);
+	fastRequest.setContentLength((int) body.length());
+	fast.sendRequest(fastRequest) << body;
+	HTTPResponse fastResponse;
+	std::string rbody;
+	std::istream& frs = fast.receiveResponse(fastResponse);
+	rbody.assign((std::istreambuf_iterator<char>(frs)), std::istreambuf_iterator<char>());
+	assertTrue(rbody == body);
+	assertTrue(start.elapsed() < 400000);
+
+	HTTPResponse slowResponse;
+	std::istream& srs = slow.receiveResponse(slowResponse);
+	rbody.assign((std::istreambuf_iterator<char>(srs)), std::istreambuf_iterator<char>());
+	assertTrue(slowResponse.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue(rbody == "slow");
+
+	// the connection is kept alive across offloaded requests
+	for (int i = 0; i < 2; ++i)
+	{
+		HTTPRequest request("GET", "/slow", HTTPMessage::HTTP_1_1);
+		slow.sendRequest(request);
+		HTTPResponse response;
+		std::istream& rs = slow.receiveResponse(response);
+		rbody.assign((std::istreambuf_iterator<char>(rs)), std::istreambuf_iterator<char>());
+		assertTrue(response.getStatus() == HTTPResponse::HTTP_OK);
+		assertTrue(response.getKeepAlive());
+		assertTrue(rbody == "slow");
+	}
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testOffloadPoolOverflow()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	pParams->setReactorMode(true);
+	pParams->setUseSelfReactor(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.setOffloadPool(1, 0);
+	srv.start();
+
+	int port = srv.port();
+
+	// with one worker and no queue, one of two concurrent slow
+	// requests is handled, while the other one is rejected
+	HTTPClientSession cs1("127.0.0.1", port);
+	HTTPRequest request1("GET", "/slow", HTTPMessage::HTTP_1_1);
+	cs1.sendRequest(request1);
+	cs1.flushRequest();
+	HTTPClientSession cs2("127.0.0.1", port);
+	HTTPRequest request2("GET", "/slow", HTTPMessage::HTTP_1_1);
+	cs2.sendRequest(request2);
+	cs2.flushRequest();
+
+	HTTPResponse response1;
+	cs1.receiveResponse(response1);
+	HTTPResponse response2;
+	cs2.receiveResponse(response2);
+	if (response1.getStatus() == HTTPResponse::HTTP_OK)
+		assertTrue(response2.getStatus() == HTTPResponse::HTTP_SERVICE_UNAVAILABLE);
+	else
+	{
+		assertTrue(response1.getStatus() == HTTPResponse::HTTP_SERVICE_UNAVAILABLE);
+		assertTrue(response2.getStatus() == HTTPResponse::HTTP_OK);
+	}
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testOffloadPoolStop()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	pParams->setReactorMode(true);
+	pParams->setUseSelfReactor(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.setOffloadPool(1, 1);
+	srv.start();
+
+	int port = srv.port();
+
+	// the second request is still queued when the server is stopped,
+	// its connection must be closed instead of staying suspended
+	HTTPClientSession cs1("127.0.0.1", port);
+	HTTPRequest request1("GET", "/slow", HTTPMessage::HTTP_1_1);
+	cs1.sendRequest(request1);
+	cs1.flushRequest();
+	Poco::Thread::sleep(50);
+	HTTPClientSession cs2("127.0.0.1", port);
+	cs2.setTimeout(Poco::Timespan(5, 0));
+	HTTPRequest request2("GET", "/slow", HTTPMessage::HTTP_1_1);
+	cs2.sendRequest(request2);
+	cs2.flushRequest();
+	Poco::Thread::sleep(50);
+
+	srv.stop();
+
+	HTTPResponse response1;
+	cs1.receiveResponse(response1);
+	assertTrue(response1.getStatus() == HTTPResponse::HTTP_OK);
+	try
+	{
+		HTTPResponse response2;
+		cs2.receiveResponse(response2);
+		fail("connection must be closed");
+	}
+	catch (Poco::TimeoutException&)
+	{
+		fail("connection has not been closed");
+	}
+	catch (Poco::Exception&)
+	{
+	}
+}
+
+void HTTPReactorServerTest::testHeaderView()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	pParams->setReactorMode(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", srv.port());
+	HTTPRequest request("GET", "/view", HTTPMessage::HTTP_1_1);
+	request.set("X-Token", "abc123");
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::istream& rs = cs.receiveResponse(response);
+	std::string rbody;
+	StreamCopier::copyToString(rs, rbody);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (rbody == "abc123");
+
+	srv.stop();
+}
+
 void HTTPReactorServerTest::testNotImplementedResponseWithKeepAlive()
 {
 	HTTPServerParams* pParams = new HTTPServerParams;
@@ -799,6 +1029,11 @@ CppUnit::Test* HTTPReactorServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testChunkedWithEmptyChunks);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testConcurrentRequests);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testUseSelfReactor);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testShardedReactors);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testOffloadPool);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testOffloadPoolOverflow);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testOffloadPoolStop);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testHeaderView);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testNotImplementedResponseWithKeepAlive);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testSendTimeoutParam);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testClientAbortKeepsServerAlive);
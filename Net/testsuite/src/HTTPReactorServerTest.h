@@ -23,6 +23,11 @@ public:
 	void testChunkedWithEmptyChunks();
 	void testConcurrentRequests();
 	void testUseSelfReactor();
+	void testShardedReactors();
+	void testOffloadPool();
+	void testOffloadPoolOverflow();
+	void testOffloadPoolStop();
+	void testHeaderView();
 	void testNotImplementedResponseWithKeepAlive();
 	void testSendTimeoutParam();
 	void testClientAbortKeepsServerAlive();
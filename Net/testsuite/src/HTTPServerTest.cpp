@@ -23,6 +23,8 @@
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/HTTPServerSession.h"
 #include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketStream.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/Path.h"
 #include "Poco/FileStream.h"
@@ -42,6 +44,8 @@ using Poco::Net::HTTPResponse;
 using Poco::Net::HTTPServerResponse;
 using Poco::Net::HTTPMessage;
 using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketStream;
 using Poco::StreamCopier;
 using Poco::Path;
 using Poco::File;
@@ -114,6 +118,25 @@ namespace
 		}
 	};
 	
+	class ArenaRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			Poco::Arena* pArena = request.arena();
+			if (!pArena)
+			{
+				response.setStatusAndReason(HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+				response.send();
+				return;
+			}
+			std::string data = std::to_string(pArena->allocated());
+			Poco::ArenaResource resource(*pArena);
+			std::pmr::string buffer(1000, 'x', &resource);
+			response.sendBuffer(data.data(), data.length());
+		}
+	};
+
 	class FileRequestHandler: public HTTPRequestHandler
 	{
 	public:
@@ -170,6 +193,8 @@ namespace
 				return new TrailerRequestHandler;
 			else if (request.getURI() == "/file")
 				return new FileRequestHandler;
+			else if (request.getURI() == "/arena")
+				return new ArenaRequestHandler;
 			else
 				return nullptr;
 		}
@@ -522,6 +547,30 @@ void HTTPServerTest::testBuffer()
 	assertTrue (rbody == "xxxxxxxxxx");
 }
 
+void HTTPServerTest::testArena()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	cs.setKeepAlive(true);
+	for (int i = 0; i < 3; ++i)
+	{
+		HTTPRequest request("GET", "/arena", HTTPMessage::HTTP_1_1);
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		cs.receiveResponse(response) >> rbody;
+		assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+		// the arena is reset after every request
+		assertTrue (rbody == "0");
+	}
+}
+
+
 void HTTPServerTest::testFile()
 {
 	std::string payload(sendFileSize, 'x');
@@ -565,6 +614,50 @@ void HTTPServerTest::testChunkedTrailer()
 }
 
 
+void HTTPServerTest::testPipelining()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	// send all requests at once; the two large responses exceed
+	// the output buffer of the server session
+	std::vector<std::string> bodies{"first", std::string(40000, 'x'), std::string(40000, 'y'), "last"};
+	std::string requests;
+	for (std::size_t i = 0; i < bodies.size(); ++i)
+	{
+		HTTPRequest request("POST", "/echoBody", HTTPMessage::HTTP_1_1);
+		request.setContentType("text/plain");
+		request.setContentLength(static_cast<int>(bodies[i].size()));
+		request.setKeepAlive(i + 1 < bodies.size());
+		std::ostringstream ostr;
+		request.write(ostr);
+		requests += ostr.str();
+		requests += bodies[i];
+	}
+	StreamSocket ss;
+	ss.connect(svs.address());
+	ss.sendBytes(requests.data(), static_cast<int>(requests.size()));
+
+	// the responses must arrive in order
+	SocketStream sstr(ss);
+	for (std::size_t i = 0; i < bodies.size(); ++i)
+	{
+		HTTPResponse response;
+		response.read(sstr);
+		assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+		assertTrue (response.getContentLength() == bodies[i].size());
+		assertTrue (response.getKeepAlive() == (i + 1 < bodies.size()));
+		std::string rbody(bodies[i].size(), '\0');
+		sstr.read(&rbody[0], static_cast<std::streamsize>(rbody.size()));
+		assertTrue (rbody == bodies[i]);
+	}
+	assertTrue (sstr.get() == std::char_traits<char>::eof());
+}
+
+
 void HTTPServerTest::setUp()
 {
 }
@@ -591,8 +684,10 @@ CppUnit::Test* HTTPServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPServerTest, testAuth);
 	CppUnit_addTest(pSuite, HTTPServerTest, testNotImpl);
 	CppUnit_addTest(pSuite, HTTPServerTest, testBuffer);
+	CppUnit_addTest(pSuite, HTTPServerTest, testArena);
 	CppUnit_addTest(pSuite, HTTPServerTest, testFile);
 	CppUnit_addTest(pSuite, HTTPServerTest, testChunkedTrailer);
+	CppUnit_addTest(pSuite, HTTPServerTest, testPipelining);
 
 	return pSuite;
 }
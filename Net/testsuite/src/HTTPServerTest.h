@@ -36,8 +36,10 @@ public:
 	void testAuth();
 	void testNotImpl();
 	void testBuffer();
+	void testArena();
 	void testFile();
 	void testChunkedTrailer();
+	void testPipelining();
 
 	void setUp();
 	void tearDown();
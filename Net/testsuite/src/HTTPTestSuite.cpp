@@ -14,6 +14,8 @@
 #include "HTTPCookieTest.h"
 #include "HTTPCredentialsTest.h"
 #include "NTLMCredentialsTest.h"
+#include "HTTPHeaderViewTest.h"
+#include "HPACKTest.h"
 
 
 CppUnit::Test* HTTPTestSuite::suite()
@@ -25,6 +27,8 @@ CppUnit::Test* HTTPTestSuite::suite()
 	pSuite->addTest(HTTPCookieTest::suite());
 	pSuite->addTest(HTTPCredentialsTest::suite());
 	pSuite->addTest(NTLMCredentialsTest::suite());
+	pSuite->addTest(HTTPHeaderViewTest::suite());
+	pSuite->addTest(HPACKTest::suite());
 
 	return pSuite;
 }
@@ -489,6 +489,91 @@ void PollSetTest::testClear()
 }
 
 
+void PollSetTest::testBackend()
+{
+	assertTrue (PollSet::isAvailable(PollSet::BACKEND_NATIVE));
+	assertTrue (PollSet::getDefaultBackend() == PollSet::BACKEND_NATIVE);
+
+	PollSet ps;
+	assertTrue (ps.backend() == PollSet::BACKEND_NATIVE);
+
+	PollSet psu(PollSet::BACKEND_IO_URING);
+	if (PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+		assertTrue (psu.backend() == PollSet::BACKEND_IO_URING);
+	else
+		assertTrue (psu.backend() == PollSet::BACKEND_NATIVE);
+}
+
+
+void PollSetTest::testIOUring()
+{
+	if (!PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+	{
+		std::cout << "io_uring not available, skipping" << std::endl;
+		return;
+	}
+
+	PollSet::setDefaultBackend(PollSet::BACKEND_IO_URING);
+	try
+	{
+		testAddUpdate();
+		testTimeout();
+		testPollNB();
+		testPoll();
+		testPollNoServer();
+		testPollClosedServer();
+		testPollSetWakeUp();
+		testClear();
+	}
+	catch (...)
+	{
+		PollSet::setDefaultBackend(PollSet::BACKEND_NATIVE);
+		throw;
+	}
+	PollSet::setDefaultBackend(PollSet::BACKEND_NATIVE);
+}
+
+
+void PollSetTest::testIOUringClosedSocket()
+{
+	if (!PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+	{
+		std::cout << "io_uring not available, skipping" << std::endl;
+		return;
+	}
+
+	EchoServer echoServer;
+	StreamSocket ss;
+	ss.connect(SocketAddress("127.0.0.1", echoServer.port()));
+
+	PollSet ps(PollSet::BACKEND_IO_URING);
+	ps.add(ss, PollSet::POLL_READ);
+	assertTrue (ps.poll(Timespan(10000)).empty());
+
+	std::string str = "HELLO";
+	int len = static_cast<int>(str.length());
+	assertTrue (len == ss.sendBytes(str.data(), len));
+	Thread::sleep(200);
+
+	// The socket is closed without remove() while its completion is
+	// pending. The completion is reported, re-arming fails and the
+	// error must be reported once, not on every poll().
+	ss.close();
+	PollSet::SocketModeMap sm = ps.poll(Timespan(1000000));
+	assertTrue (sm.size() == 1);
+	assertTrue (sm.begin()->second & PollSet::POLL_READ);
+
+	sm = ps.poll(Timespan(1000000));
+	assertTrue (sm.size() == 1);
+	assertTrue (sm.begin()->second == PollSet::POLL_ERROR);
+
+	assertTrue (ps.poll(Timespan(100000)).empty());
+	assertTrue (ps.poll(Timespan(100000)).empty());
+	ps.remove(ss);
+	assertTrue (ps.empty());
+}
+
+
 void PollSetTest::setUp()
 {
 }
@@ -511,6 +596,9 @@ CppUnit::Test* PollSetTest::suite()
 	CppUnit_addTest(pSuite, PollSetTest, testPollClosedServer);
 	CppUnit_addTest(pSuite, PollSetTest, testPollSetWakeUp);
 	CppUnit_addTest(pSuite, PollSetTest, testClear);
+	CppUnit_addTest(pSuite, PollSetTest, testBackend);
+	CppUnit_addTest(pSuite, PollSetTest, testIOUring);
+	CppUnit_addTest(pSuite, PollSetTest, testIOUringClosedSocket);
 
 	return pSuite;
 }
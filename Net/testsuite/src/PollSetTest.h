@@ -32,6 +32,9 @@ public:
 	void testPollClosedServer();
 	void testPollSetWakeUp();
 	void testClear();
+	void testBackend();
+	void testIOUring();
+	void testIOUringClosedSocket();
 
 	void setUp();
 	void tearDown();
@@ -24,6 +24,7 @@ using Poco::Net::StreamSocket;
 using Poco::Net::DatagramSocket;
 using Poco::Net::ServerSocket;
 using Poco::Net::SocketAddress;
+using Poco::Net::PollSet;
 using Poco::Thread;
 using Poco::Timestamp;
 using Poco::Stopwatch;
@@ -41,8 +42,141 @@ SocketProactorTest::~SocketProactorTest()
 
 void SocketProactorTest::testTCPSocketProactor()
 {
+	tcpSocketProactor(PollSet::BACKEND_NATIVE);
+}
+
+
+void SocketProactorTest::testUDPSocketProactor()
+{
+	udpSocketProactor(PollSet::BACKEND_NATIVE);
+}
+
+
+void SocketProactorTest::testTCPSocketProactorIOUring()
+{
+	if (!PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+	{
+		std::cout << "io_uring not available, skipping" << std::endl;
+		return;
+	}
+	tcpSocketProactor(PollSet::BACKEND_IO_URING);
+}
+
+
+void SocketProactorTest::testUDPSocketProactorIOUring()
+{
+	if (!PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+	{
+		std::cout << "io_uring not available, skipping" << std::endl;
+		return;
+	}
+	udpSocketProactor(PollSet::BACKEND_IO_URING);
+}
+
+
+void SocketProactorTest::testSocketProactorIOUringRun()
+{
+	if (!PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+	{
+		std::cout << "io_uring not available, skipping" << std::endl;
+		return;
+	}
+
 	EchoServer echoServer;
-	SocketProactor proactor(false);
+	SocketProactor proactor(PollSet::BACKEND_IO_URING, false);
+	assertTrue (proactor.backend() == PollSet::BACKEND_IO_URING);
+	StreamSocket s;
+	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	Thread thread;
+	thread.start(proactor);
+
+	// several operations queued for the same socket must complete in order
+	const int count = 10;
+	std::string hello = "hello proactor world";
+	std::atomic<int> sent(0);
+	std::atomic<bool> ordered(true);
+	for (int i = 0; i < count; ++i)
+	{
+		proactor.addSend(s, SocketProactor::Buffer(hello.begin(), hello.end()),
+			[&, i](std::error_code err, int bytes)
+			{
+				if (err.value() != 0 || bytes != hello.length() || sent != i) ordered = false;
+				++sent;
+			});
+	}
+	SocketProactor::Buffer buf;
+	std::string received;
+	std::atomic<bool> done(false);
+	SocketProactor::Callback onReceive = [&](std::error_code err, int bytes)
+	{
+		if (err.value() == 0 && bytes > 0)
+			received.append(buf.begin(), buf.begin() + bytes);
+		if (err.value() != 0 || bytes == 0 || received.size() >= count*hello.size())
+		{
+			done = true;
+			return;
+		}
+		buf.clear();
+		proactor.addReceive(s, buf, SocketProactor::Callback(onReceive));
+	};
+	proactor.addReceive(s, buf, SocketProactor::Callback(onReceive));
+
+	Stopwatch sw;
+	sw.start();
+	while (!done)
+	{
+		if (sw.elapsedSeconds() > 5)
+			fail("SocketProactor receive completion timed out.", __LINE__, __FILE__);
+		Thread::sleep(10);
+	}
+	proactor.stop();
+	proactor.wakeUp();
+	thread.join();
+
+	assertEquals (count, sent.load());
+	assertTrue (ordered);
+	assertEquals (count*hello.size(), received.size());
+	std::string expected;
+	for (int i = 0; i < count; ++i) expected += hello;
+	assertTrue (received == expected);
+}
+
+
+void SocketProactorTest::testSocketProactorIOUringDestroy()
+{
+	if (!PollSet::isAvailable(PollSet::BACKEND_IO_URING))
+	{
+		std::cout << "io_uring not available, skipping" << std::endl;
+		return;
+	}
+
+	EchoServer echoServer;
+	StreamSocket s;
+	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	Thread thread;
+	SocketProactor::Buffer buf;
+	std::atomic<bool> received(false);
+	{
+		SocketProactor proactor(PollSet::BACKEND_IO_URING, false);
+		thread.start(proactor);
+		// nothing is sent, so the receive stays in flight
+		// while the running proactor is destroyed
+		proactor.addReceive(s, buf,
+			[&](std::error_code, int)
+			{
+				received = true;
+			});
+		Thread::sleep(100);
+	}
+	assertTrue (thread.tryJoin(5000));
+	assertTrue (!received);
+}
+
+
+void SocketProactorTest::tcpSocketProactor(PollSet::Backend backend)
+{
+	EchoServer echoServer;
+	SocketProactor proactor(backend, false);
 	StreamSocket s;
 	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
 	int mode = SocketProactor::POLL_READ | SocketProactor::POLL_WRITE | SocketProactor::POLL_ERROR;
@@ -131,11 +265,11 @@ void SocketProactorTest::testTCPSocketProactor()
 }
 
 
-void SocketProactorTest::testUDPSocketProactor()
+void SocketProactorTest::udpSocketProactor(PollSet::Backend backend)
 {
 	UDPEchoServer echoServer;
 	DatagramSocket s(SocketAddress::IPv4);
-	SocketProactor proactor(false);
+	SocketProactor proactor(backend, false);
 	int mode = SocketProactor::POLL_READ | SocketProactor::POLL_WRITE;
 	proactor.addSocket(s, mode);
 	std::string hello = "hello proactor world";
@@ -348,6 +482,10 @@ CppUnit::Test* SocketProactorTest::suite()
 	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactor);
 	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactor);
 	CppUnit_addTest(pSuite, SocketProactorTest, testSocketProactorStartStop);
+	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactorIOUring);
+	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactorIOUring);
+	CppUnit_addTest(pSuite, SocketProactorTest, testSocketProactorIOUringRun);
+	CppUnit_addTest(pSuite, SocketProactorTest, testSocketProactorIOUringDestroy);
 	CppUnit_addTest(pSuite, SocketProactorTest, testWork);
 	CppUnit_addTest(pSuite, SocketProactorTest, testTimedWork);
 
@@ -33,6 +33,10 @@ public:
 	void testTCPSocketProactor();
 	void testUDPSocketProactor();
 	void testSocketProactorStartStop();
+	void testTCPSocketProactorIOUring();
+	void testUDPSocketProactorIOUring();
+	void testSocketProactorIOUringRun();
+	void testSocketProactorIOUringDestroy();
 
 	void testWork();
 	void testTimedWork();
@@ -43,6 +47,8 @@ public:
 	static CppUnit::Test* suite();
 
 private:
+	void tcpSocketProactor(Poco::Net::PollSet::Backend backend);
+	void udpSocketProactor(Poco::Net::PollSet::Backend backend);
 };
 
 
@@ -25,6 +25,7 @@
 #include "Poco/Thread.h"
 #include <sstream>
 #include <chrono>
+#include <atomic>
 
 
 using Poco::Net::SocketReactor;
@@ -451,6 +452,55 @@ namespace
 	// Handler that aggressively queries and modifies reactor from within notifications
 	// Tests the NotificationCenter deadlock fix by calling removeEventHandler while
 	// holding Observer mutex, concurrent with other threads adding/removing handlers
+	class SocketTimeoutHandler
+	{
+	public:
+		SocketTimeoutHandler(): timeouts(0)
+		{
+		}
+
+		void onReadable(const AutoPtr<ReadableNotification>& pNf)
+		{
+		}
+
+		void onTimeout(const AutoPtr<TimeoutNotification>& pNf)
+		{
+			++timeouts;
+		}
+
+		std::atomic<int> timeouts;
+	};
+
+
+	class PeriodicTimeoutHandler
+		/// Keeps a short socket timeout scheduled, like a
+		/// connection with an idle timer that is re-armed.
+	{
+	public:
+		PeriodicTimeoutHandler(SocketReactor& reactor, const StreamSocket& socket):
+			_reactor(reactor),
+			_socket(socket),
+			_id(reactor.scheduleTimeout(socket, Poco::Timespan(0, 50000)))
+		{
+		}
+
+		void onReadable(const AutoPtr<ReadableNotification>& pNf)
+		{
+		}
+
+		void onTimeout(const AutoPtr<TimeoutNotification>& pNf)
+		{
+			if (!_reactor.rescheduleTimeout(_id, Poco::Timespan(0, 50000)))
+				_id = _reactor.scheduleTimeout(_socket, Poco::Timespan(0, 50000));
+		}
+
+	private:
+		SocketReactor& _reactor;
+		StreamSocket _socket;
+		SocketReactor::TimerId _id;
+	};
+
+
 	class ConcurrentRemovalHandler
 	{
 	public:
@@ -541,6 +591,27 @@ void SocketReactorTest::testSocketReactor()
 }
 
 
+void SocketReactorTest::testSocketReactorIOUring()
+{
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	SocketReactor::Params params;
+	params.pollBackend = Poco::Net::PollSet::BACKEND_IO_URING;
+	SocketReactor reactor(params);
+	SocketAcceptor<EchoServiceHandler> acceptor(ss, reactor);
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	SocketConnector<ClientServiceHandler> connector(sa, reactor);
+	ClientServiceHandler::setOnce(true);
+	ClientServiceHandler::resetData();
+	reactor.run();
+	std::string data(ClientServiceHandler::data());
+	assertTrue (data.size() == DATA_SIZE);
+	assertTrue (!ClientServiceHandler::readableError());
+	assertTrue (!ClientServiceHandler::writableError());
+	assertTrue (!ClientServiceHandler::timeoutError());
+}
+
+
 void SocketReactorTest::testSetSocketReactor()
 {
 	SocketAddress ssa;
@@ -896,6 +967,94 @@ void SocketReactorTest::testConcurrentHandlerRemoval()
 }
 
 
+void SocketReactorTest::testScheduleTimeout()
+{
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	StreamSocket sock1(sa);
+	StreamSocket accepted1 = ss.acceptConnection();
+	StreamSocket sock2(sa);
+	StreamSocket accepted2 = ss.acceptConnection();
+
+	// long poll timeout, so that only socket timeouts are dispatched
+	SocketReactor::Params params;
+	params.pollTimeout = Poco::Timespan(10, 0);
+	SocketReactor reactor(params);
+	SocketTimeoutHandler handler1;
+	SocketTimeoutHandler handler2;
+	reactor.addEventHandler(accepted1, NObserver<SocketTimeoutHandler, ReadableNotification>(handler1, &SocketTimeoutHandler::onReadable));
+	reactor.addEventHandler(accepted1, NObserver<SocketTimeoutHandler, TimeoutNotification>(handler1, &SocketTimeoutHandler::onTimeout));
+	reactor.addEventHandler(accepted2, NObserver<SocketTimeoutHandler, ReadableNotification>(handler2, &SocketTimeoutHandler::onReadable));
+	reactor.addEventHandler(accepted2, NObserver<SocketTimeoutHandler, TimeoutNotification>(handler2, &SocketTimeoutHandler::onTimeout));
+	Thread thread;
+	thread.start(reactor);
+	Thread::sleep(100);
+
+	// the reactor is woken up from its poll() to dispatch the timeout
+	Stopwatch sw;
+	sw.start();
+	SocketReactor::TimerId id1 = reactor.scheduleTimeout(accepted1, Poco::Timespan(0, 100000));
+	SocketReactor::TimerId id2 = reactor.scheduleTimeout(accepted2, Poco::Timespan(0, 200000));
+	for (int i = 0; i < 500 && handler1.timeouts < 1; ++i) Thread::sleep(10);
+	assertTrue (handler1.timeouts == 1);
+	assertTrue (sw.elapsed() >= 100000);
+	assertTrue (sw.elapsed() < 5000000);
+	assertTrue (handler2.timeouts == 0);
+	assertFalse (reactor.cancelTimeout(id1));
+	assertTrue (reactor.cancelTimeout(id2));
+
+	id1 = reactor.scheduleTimeout(accepted1, Poco::Timespan(0, 200000));
+	Thread::sleep(100);
+	assertTrue (reactor.rescheduleTimeout(id1, Poco::Timespan(0, 500000)));
+	// the original expiration time has passed
+	Thread::sleep(250);
+	assertTrue (handler1.timeouts == 1);
+	for (int i = 0; i < 500 && handler1.timeouts < 2; ++i) Thread::sleep(10);
+	assertTrue (handler1.timeouts == 2);
+	assertTrue (handler2.timeouts == 0);
+
+	reactor.stop();
+	thread.join();
+}
+
+
+void SocketReactorTest::testPollTimeoutWithScheduledTimeout()
+{
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	StreamSocket sock1(sa);
+	StreamSocket accepted1 = ss.acceptConnection();
+	StreamSocket sock2(sa);
+	StreamSocket accepted2 = ss.acceptConnection();
+
+	SocketReactor::Params params;
+	params.pollTimeout = Poco::Timespan(0, 200000);
+	SocketReactor reactor(params);
+	SocketTimeoutHandler handler;
+	reactor.addEventHandler(accepted1, NObserver<SocketTimeoutHandler, ReadableNotification>(handler, &SocketTimeoutHandler::onReadable));
+	reactor.addEventHandler(accepted1, NObserver<SocketTimeoutHandler, TimeoutNotification>(handler, &SocketTimeoutHandler::onTimeout));
+	reactor.scheduleTimeout(accepted1, Poco::Timespan(60, 0));
+
+	// the socket timeouts shorten every poll timeout,
+	// but the reactor must still time out when idle
+	PeriodicTimeoutHandler periodic(reactor, accepted2);
+	reactor.addEventHandler(accepted2, NObserver<PeriodicTimeoutHandler, ReadableNotification>(periodic, &PeriodicTimeoutHandler::onReadable));
+	reactor.addEventHandler(accepted2, NObserver<PeriodicTimeoutHandler, TimeoutNotification>(periodic, &PeriodicTimeoutHandler::onTimeout));
+	Thread thread;
+	thread.start(reactor);
+	Stopwatch sw;
+	sw.start();
+	for (int i = 0; i < 300 && handler.timeouts < 3; ++i) Thread::sleep(10);
+	assertTrue (handler.timeouts >= 3);
+	assertTrue (sw.elapsed() >= 400000);
+
+	reactor.stop();
+	thread.join();
+}
+
+
 void SocketReactorTest::onReadable(const Poco::AutoPtr<Poco::Net::ReadableNotification>& pNf)
 {
 }
@@ -922,6 +1081,7 @@ CppUnit::Test* SocketReactorTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SocketReactorTest");
 
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactor);
+	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorIOUring);
 	CppUnit_addTest(pSuite, SocketReactorTest, testSetSocketReactor);
 	CppUnit_addTest(pSuite, SocketReactorTest, testParallelSocketReactor);
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketConnectorFail);
@@ -931,6 +1091,8 @@ CppUnit::Test* SocketReactorTest::suite()
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorWakeup);
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorRemove);
 	CppUnit_addTest(pSuite, SocketReactorTest, testConcurrentHandlerRemoval);
+	CppUnit_addTest(pSuite, SocketReactorTest, testScheduleTimeout);
+	CppUnit_addTest(pSuite, SocketReactorTest, testPollTimeoutWithScheduledTimeout);
 
 	return pSuite;
 }
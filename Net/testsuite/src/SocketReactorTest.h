@@ -33,6 +33,7 @@ public:
 	~SocketReactorTest();
 
 	void testSocketReactor();
+	void testSocketReactorIOUring();
 	void testSetSocketReactor();
 	void testParallelSocketReactor();
 	void testSocketConnectorFail();
@@ -42,6 +43,8 @@ public:
 	void testSocketReactorWakeup();
 	void testSocketReactorRemove();
 	void testConcurrentHandlerRemoval();
+	void testScheduleTimeout();
+	void testPollTimeoutWithScheduledTimeout();
 
 	void setUp();
 	void tearDown();
@@ -18,6 +18,7 @@
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Thread.h"
+#include "Poco/WorkStealingThreadPool.h"
 #include "Poco/Mutex.h"
 #include <iostream>
 
@@ -32,6 +33,7 @@ using Poco::Net::StreamSocket;
 using Poco::Net::ServerSocket;
 using Poco::Net::SocketAddress;
 using Poco::Thread;
+using Poco::WorkStealingThreadPool;
 
 
 namespace
@@ -282,6 +284,56 @@ void TCPServerTest::testFilter()
 }
 
 
+void TCPServerTest::testWorkStealingThreadPool()
+{
+	WorkStealingThreadPool pool(2);
+	ServerSocket svs(0);
+	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>(), pool, svs);
+	srv.start();
+	assertTrue (srv.currentConnections() == 0);
+	assertTrue (srv.maxThreads() == 2);
+	assertTrue (srv.queuedConnections() == 0);
+
+	SocketAddress sa("127.0.0.1", svs.address().port());
+	StreamSocket ss1(sa);
+	StreamSocket ss2(sa);
+	std::string data("hello, world");
+	ss1.sendBytes(data.data(), (int) data.size());
+	ss2.sendBytes(data.data(), (int) data.size());
+
+	char buffer[256];
+	int n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (n > 0);
+	assertTrue (std::string(buffer, n) == data);
+	n = ss2.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (n > 0);
+	assertTrue (std::string(buffer, n) == data);
+
+	assertTrue (srv.currentConnections() == 2);
+	assertTrue (srv.currentThreads() == 2);
+	assertTrue (srv.totalConnections() == 2);
+
+	// both workers are busy, so the third connection is queued
+	StreamSocket ss3(sa);
+	Thread::sleep(200);
+	assertTrue (srv.queuedConnections() == 1);
+
+	ss1.close();
+	ss3.sendBytes(data.data(), (int) data.size());
+	n = ss3.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (n > 0);
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (srv.queuedConnections() == 0);
+	assertTrue (srv.totalConnections() == 3);
+
+	ss2.close();
+	ss3.close();
+	Thread::sleep(1000);
+	assertTrue (srv.currentConnections() == 0);
+	assertTrue (srv.currentThreads() == 0);
+}
+
+
 void TCPServerTest::setUp()
 {
 }
@@ -301,6 +353,7 @@ CppUnit::Test* TCPServerTest::suite()
 	CppUnit_addTest(pSuite, TCPServerTest, testMultiConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testThreadCapacity);
 	CppUnit_addTest(pSuite, TCPServerTest, testFilter);
+	CppUnit_addTest(pSuite, TCPServerTest, testWorkStealingThreadPool);
 
 	return pSuite;
 }
@@ -29,6 +29,7 @@
 #include "Poco/AutoPtr.h"
 #include <openssl/ssl.h>
 #include <cstdlib>
+#include <vector>
 
 
 namespace Poco::Net {
@@ -508,6 +509,24 @@ public:
 		/// but no close_notify alert is sent to the peer. This behaviour violates the TLS standard.
 		/// The default is a normal shutdown behaviour as described by the TLS standard.
 
+	void setALPNProtocols(const std::vector<std::string>& protocols);
+		/// Sets the protocols for Application-Layer Protocol Negotiation
+		/// (ALPN, RFC 7301), in order of preference (e.g., "h2", "http/1.1").
+		///
+		/// A client Context offers the protocols to the server.
+		/// A server Context selects the first of its protocols that
+		/// is also offered by the client. If there is no such protocol,
+		/// the handshake continues without ALPN.
+		///
+		/// The negotiated protocol can be obtained with
+		/// SecureStreamSocket::getALPNProtocol().
+		///
+		/// Throws an InvalidArgumentException if a protocol name is
+		/// empty or longer than 255 characters.
+
+	const std::vector<std::string>& getALPNProtocols() const;
+		/// Returns the protocols set with setALPNProtocols().
+
 private:
 	void init(const Params& params);
 		/// Initializes the Context with the given parameters.
@@ -522,12 +541,17 @@ private:
 	void createSSLContext();
 		/// Create a SSL_CTX object according to Context configuration.
 
+	static int onALPNSelect(SSL* pSSL, const unsigned char** out, unsigned char* outlen, const unsigned char* in, unsigned int inlen, void* arg);
+		/// ALPN selection callback for server contexts.
+
 	Usage _usage;
 	VerificationMode _mode;
 	SSL_CTX* _pSSLContext;
 	bool _extendedCertificateVerification;
 	bool _ocspStaplingResponseVerification;
 	InvalidCertificateHandlerPtr _pInvalidCertificateHandler;
+	std::vector<std::string> _alpnProtocols;
+	std::string _alpnWireFormat;
 };
 
 
@@ -540,6 +564,12 @@ inline Context::Usage Context::usage() const
 }
 
 
+inline const std::vector<std::string>& Context::getALPNProtocols() const
+{
+	return _alpnProtocols;
+}
+
+
 inline bool Context::isForServerUse() const
 {
 	return _usage == SERVER_USE
@@ -194,6 +194,10 @@ public:
 		/// no certificate is available. The caller is responsible
 		/// for releasing the returned reference with X509_free().
 
+	std::string getALPNProtocol() const;
+		/// Returns the protocol negotiated with ALPN, or an empty
+		/// string if no protocol has been negotiated.
+
 	Context::Ptr context() const;
 		/// Returns the SSL context used for this socket.
 
@@ -164,6 +164,11 @@ public:
 		/// Throws a SSLException if the peer did not
 		/// present a certificate.
 
+	std::string getALPNProtocol() const;
+		/// Returns the protocol negotiated with ALPN (see
+		/// Context::setALPNProtocols()), or an empty string if
+		/// no protocol has been negotiated.
+
 	void setPeerHostName(const std::string& hostName);
 		/// Sets the peer's host name used for certificate validation.
 
@@ -162,6 +162,10 @@ public:
 	Context::Ptr context() const;
 		/// Returns the SSL context used by this socket.
 
+	std::string getALPNProtocol() const;
+		/// Returns the protocol negotiated with ALPN, or an empty
+		/// string if no protocol has been negotiated.
+
 	void setLazyHandshake(bool flag = true);
 		/// Enable lazy SSL handshake. If enabled, the SSL handshake
 		/// will be performed the first time date is sent or
@@ -248,6 +248,53 @@ void Context::setQuietShutdown(bool flag)
 	SSL_CTX_set_quiet_shutdown(_pSSLContext, flag ? 1 : 0);
 }
 
+
+void Context::setALPNProtocols(const std::vector<std::string>& protocols)
+{
+	std::string wireFormat;
+	for (const auto& protocol: protocols)
+	{
+		if (protocol.empty() || protocol.size() > 255)
+			throw Poco::InvalidArgumentException("Invalid ALPN protocol name", protocol);
+		wireFormat += static_cast<char>(protocol.size());
+		wireFormat += protocol;
+	}
+	_alpnProtocols  = protocols;
+	_alpnWireFormat = wireFormat;
+
+	if (isForServerUse())
+	{
+		if (_alpnWireFormat.empty())
+			SSL_CTX_set_alpn_select_cb(_pSSLContext, nullptr, nullptr);
+		else
+			SSL_CTX_set_alpn_select_cb(_pSSLContext, &Context::onALPNSelect, this);
+	}
+	else
+	{
+		// note: SSL_CTX_set_alpn_protos() returns 0 on success
+		if (SSL_CTX_set_alpn_protos(_pSSLContext, reinterpret_cast<const unsigned char*>(_alpnWireFormat.data()), static_cast<unsigned>(_alpnWireFormat.size())) != 0)
+		{
+			std::string msg = Utility::getLastError();
+			throw SSLContextException("Cannot set ALPN protocols", msg);
+		}
+	}
+}
+
+
+int Context::onALPNSelect(SSL* /*pSSL*/, const unsigned char** out, unsigned char* outlen, const unsigned char* in, unsigned int inlen, void* arg)
+{
+	Context* pContext = reinterpret_cast<Context*>(arg);
+	const std::string& wireFormat = pContext->_alpnWireFormat;
+	unsigned char* selected = nullptr;
+	int rc = SSL_select_next_proto(&selected, outlen, reinterpret_cast<const unsigned char*>(wireFormat.data()), static_cast<unsigned>(wireFormat.size()), in, inlen);
+	if (rc == OPENSSL_NPN_NEGOTIATED)
+	{
+		*out = selected;
+		return SSL_TLSEXT_ERR_OK;
+	}
+	return SSL_TLSEXT_ERR_NOACK;
+}
+
 void Context::useCertificate(const Poco::Crypto::X509Certificate& certificate)
 {
 	int errCode = SSL_CTX_use_certificate(_pSSLContext, const_cast<X509*>(certificate.certificate()));
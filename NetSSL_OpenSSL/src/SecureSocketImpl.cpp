@@ -559,6 +559,20 @@ X509* SecureSocketImpl::peerCertificate() const
 }
 
 
+std::string SecureSocketImpl::getALPNProtocol() const
+{
+	LockT l(_mutex);
+
+	if (_pSSL == nullptr)
+		return std::string();
+
+	const unsigned char* data = nullptr;
+	unsigned int length = 0;
+	::SSL_get0_alpn_selected(_pSSL, &data, &length);
+	return std::string(reinterpret_cast<const char*>(data), length);
+}
+
+
 bool SecureSocketImpl::mustRetry(int rc)
 {
 	if (rc <= 0)
@@ -148,6 +148,12 @@ X509Certificate SecureStreamSocket::peerCertificate() const
 }
 
 
+std::string SecureStreamSocket::getALPNProtocol() const
+{
+	return static_cast<SecureStreamSocketImpl*>(impl())->getALPNProtocol();
+}
+
+
 void SecureStreamSocket::setPeerHostName(const std::string& hostName)
 {
 	static_cast<SecureStreamSocketImpl*>(impl())->setPeerHostName(hostName);
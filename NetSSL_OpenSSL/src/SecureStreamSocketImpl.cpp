@@ -195,6 +195,12 @@ X509Certificate SecureStreamSocketImpl::peerCertificate() const
 }
 
 
+std::string SecureStreamSocketImpl::getALPNProtocol() const
+{
+	return _impl.getALPNProtocol();
+}
+
+
 void SecureStreamSocketImpl::setLazyHandshake(bool flag)
 {
 	_lazyHandshake = flag;
@@ -23,11 +23,15 @@
 #include "Poco/TimedNotificationQueue.h"
 #include "Poco/Thread.h"
 #include "Poco/Runnable.h"
+#include <memory>
 
 
 namespace Poco::Util {
 
 
+class TimerQueue;
+
+
 class Util_API Timer: protected Poco::Runnable
 	/// A Timer allows to schedule tasks (TimerTask objects) for future execution
 	/// in a background thread. Tasks may be scheduled for one-time execution,
@@ -49,10 +53,29 @@ class Util_API Timer: protected Poco::Runnable
 	///        }),
 	///        Poco::Clock());
 	///
+	/// Scheduled tasks are kept in a TimedNotificationQueue by default.
+	/// For timers with a very large number of scheduled tasks, a
+	/// Timer can alternatively use a TimingWheel (see Backend).
+	///
 	/// Acknowledgement: The interface of this class has been inspired by
 	/// the java.util.Timer class from Java 1.3.
 {
 public:
+	enum Backend
+		/// The data structure holding the scheduled tasks.
+	{
+		BACKEND_QUEUE,
+			/// A TimedNotificationQueue. Tasks are kept sorted by
+			/// execution time, and executed with the accuracy of the
+			/// system clock. Scheduling takes logarithmic time.
+		BACKEND_TIMING_WHEEL
+			/// A TimingWheel with a resolution of one millisecond.
+			/// Scheduling takes constant time, but tasks may be
+			/// executed up to one millisecond late, and tasks due
+			/// at the same time are not executed in any particular
+			/// order.
+	};
+
 	Timer();
 		/// Creates the Timer.
 
@@ -60,6 +83,10 @@ public:
 		/// Creates the Timer, using a timer thread with
 		/// the given priority.
 
+	explicit Timer(Backend backend, Poco::Thread::Priority priority = Poco::Thread::PRIO_NORMAL);
+		/// Creates the Timer, using the given backend and
+		/// a timer thread with the given priority.
+
 	Timer(const Timer&) = delete;
 
 	Timer& operator = (const Timer&) = delete;
@@ -168,6 +195,9 @@ public:
 	std::size_t taskCount() const;
 		/// Returns the number of tasks currently scheduled in the timer.
 
+	Backend backend() const;
+		/// Returns the backend used for keeping scheduled tasks.
+
 	template <typename Fn>
 	static TimerTask::Ptr func(const Fn& fn)
 		/// Helper function template to use a functor or lambda
@@ -189,7 +219,8 @@ protected:
 	static void validateTask(const TimerTask::Ptr& pTask);
 
 private:
-	Poco::TimedNotificationQueue _queue;
+	Backend _backend;
+	std::unique_ptr<TimerQueue> _pQueue;
 	Poco::Thread _thread;
 };
 
@@ -197,15 +228,9 @@ private:
 //
 // inlines
 //
-inline bool Timer::idle() const
-{
-	return _queue.empty();
-}
-
-
-inline std::size_t Timer::taskCount() const
+inline Timer::Backend Timer::backend() const
 {
-	return _queue.size();
+	return _backend;
 }
 
 
@@ -16,6 +16,10 @@
 #include "Poco/Notification.h"
 #include "Poco/ErrorHandler.h"
 #include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/TimingWheel.h"
+#include <deque>
+#include <vector>
 
 
 using Poco::ErrorHandler;
@@ -24,10 +28,186 @@ using Poco::ErrorHandler;
 namespace Poco::Util {
 
 
+class TimerQueue
+	/// The queue holding the notifications scheduled by a Timer.
+	/// Notifications are only dequeued by the timer thread.
+{
+public:
+	virtual ~TimerQueue() = default;
+
+	virtual void enqueueNotification(Poco::Notification::Ptr pNotification, Poco::Clock clock) = 0;
+	virtual Poco::Notification* dequeueNextNotification() = 0;
+		/// Dequeues a pending notification regardless of its time.
+	virtual Poco::Notification* waitDequeueNotification() = 0;
+	virtual bool empty() const = 0;
+	virtual int size() const = 0;
+	virtual void clear() = 0;
+
+	void enqueueNotification(Poco::Notification::Ptr pNotification, Poco::Timestamp timestamp)
+	{
+		Poco::Timestamp tsNow;
+		Poco::Clock clock;
+		Poco::Timestamp::TimeDiff diff = timestamp - tsNow;
+		clock += diff;
+		enqueueNotification(pNotification, clock);
+	}
+};
+
+
+namespace
+{
+	class TimedTimerQueue: public TimerQueue
+		/// TimerQueue for Timer::BACKEND_QUEUE.
+	{
+	public:
+		using TimerQueue::enqueueNotification;
+
+		void enqueueNotification(Poco::Notification::Ptr pNotification, Poco::Clock clock) override
+		{
+			_queue.enqueueNotification(pNotification, clock);
+		}
+
+		Poco::Notification* dequeueNextNotification() override
+		{
+			return _queue.dequeueNextNotification();
+		}
+
+		Poco::Notification* waitDequeueNotification() override
+		{
+			return _queue.waitDequeueNotification();
+		}
+
+		bool empty() const override
+		{
+			return _queue.empty();
+		}
+
+		int size() const override
+		{
+			return _queue.size();
+		}
+
+		void clear() override
+		{
+			_queue.clear();
+		}
+
+	private:
+		Poco::TimedNotificationQueue _queue;
+	};
+
+
+	class TimingWheelTimerQueue: public TimerQueue
+		/// TimerQueue for Timer::BACKEND_TIMING_WHEEL.
+		///
+		/// Notifications that are already due when enqueued, and
+		/// notifications that have expired from the wheel, are
+		/// kept in a FIFO queue until they are dequeued.
+	{
+	public:
+		TimingWheelTimerQueue():
+			_wheel(RESOLUTION)
+		{
+		}
+
+		using TimerQueue::enqueueNotification;
+
+		void enqueueNotification(Poco::Notification::Ptr pNotification, Poco::Clock clock) override
+		{
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				if (clock.elapsed() >= 0)
+					_due.push_back(pNotification);
+				else
+					_wheel.schedule(clock, pNotification);
+			}
+			_nfAvailable.set();
+		}
+
+		Poco::Notification* dequeueNextNotification() override
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			if (_due.empty()) takeExpired(true);
+			return dequeueDue();
+		}
+
+		Poco::Notification* waitDequeueNotification() override
+		{
+			while (true)
+			{
+				Poco::Clock next;
+				bool scheduled;
+				{
+					Poco::FastMutex::ScopedLock lock(_mutex);
+					if (_due.empty()) takeExpired(false);
+					if (!_due.empty()) return dequeueDue();
+					scheduled = _wheel.nextExpiry(next);
+				}
+				if (scheduled)
+				{
+					Poco::Clock::ClockDiff sleep = -next.elapsed();
+					if (sleep > 0) _nfAvailable.tryWait(static_cast<long>((sleep + 999)/1000));
+				}
+				else _nfAvailable.wait();
+			}
+		}
+
+		bool empty() const override
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			return _due.empty() && _wheel.empty();
+		}
+
+		int size() const override
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			return static_cast<int>(_due.size() + _wheel.size());
+		}
+
+		void clear() override
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			_due.clear();
+			_wheel.clear();
+		}
+
+	private:
+		enum
+		{
+			RESOLUTION = 1000
+		};
+
+		void takeExpired(bool all)
+		{
+			if (all)
+				_wheel.drain(_expired);
+			else
+				_wheel.advance(Poco::Clock(), _expired);
+			for (auto& pNf: _expired) _due.push_back(std::move(pNf));
+			_expired.clear();
+		}
+
+		Poco::Notification* dequeueDue()
+		{
+			if (_due.empty()) return nullptr;
+			Poco::Notification::Ptr pNf = std::move(_due.front());
+			_due.pop_front();
+			return pNf.duplicate();
+		}
+
+		Poco::TimingWheel<Poco::Notification::Ptr> _wheel;
+		std::deque<Poco::Notification::Ptr> _due;
+		std::vector<Poco::Notification::Ptr> _expired;
+		Poco::Event _nfAvailable;
+		mutable Poco::FastMutex _mutex;
+	};
+}
+
+
 class TimerNotification: public Poco::Notification
 {
 public:
-	TimerNotification(Poco::TimedNotificationQueue& queue):
+	TimerNotification(TimerQueue& queue):
 		_queue(queue)
 	{
 	}
@@ -36,20 +216,20 @@ public:
 
 	virtual bool execute() = 0;
 
-	Poco::TimedNotificationQueue& queue()
+	TimerQueue& queue()
 	{
 		return _queue;
 	}
 
 private:
-	Poco::TimedNotificationQueue& _queue;
+	TimerQueue& _queue;
 };
 
 
 class StopNotification: public TimerNotification
 {
 public:
-	StopNotification(Poco::TimedNotificationQueue& queue):
+	StopNotification(TimerQueue& queue):
 		TimerNotification(queue)
 	{
 	}
@@ -67,7 +247,7 @@ public:
 class CancelNotification: public TimerNotification
 {
 public:
-	CancelNotification(Poco::TimedNotificationQueue& queue):
+	CancelNotification(TimerQueue& queue):
 		TimerNotification(queue)
 	{
 	}
@@ -116,7 +296,7 @@ private:
 class TaskNotification: public TimerNotification
 {
 public:
-	TaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask):
+	TaskNotification(TimerQueue& queue, TimerTask::Ptr pTask):
 		TimerNotification(queue),
 		_pTask(pTask)
 	{
@@ -162,7 +342,7 @@ private:
 class PeriodicTaskNotification: public TaskNotification
 {
 public:
-	PeriodicTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval):
+	PeriodicTaskNotification(TimerQueue& queue, TimerTask::Ptr pTask, long interval):
 		TaskNotification(queue, pTask),
 		_interval(interval)
 	{
@@ -194,7 +374,7 @@ private:
 class FixedRateTaskNotification: public TaskNotification
 {
 public:
-	FixedRateTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval, Poco::Clock clock):
+	FixedRateTaskNotification(TimerQueue& queue, TimerTask::Ptr pTask, long interval, Poco::Clock clock):
 		TaskNotification(queue, pTask),
 		_interval(interval),
 		_nextExecution(clock)
@@ -224,24 +404,40 @@ private:
 };
 
 
-Timer::Timer()
+Timer::Timer():
+	_backend(BACKEND_QUEUE),
+	_pQueue(new TimedTimerQueue)
 {
 	_thread.start(*this);
 }
 
 
-Timer::Timer(Poco::Thread::Priority priority)
+Timer::Timer(Poco::Thread::Priority priority):
+	_backend(BACKEND_QUEUE),
+	_pQueue(new TimedTimerQueue)
 {
 	_thread.setPriority(priority);
 	_thread.start(*this);
 }
 
 
+Timer::Timer(Backend backend, Poco::Thread::Priority priority):
+	_backend(backend)
+{
+	if (backend == BACKEND_TIMING_WHEEL)
+		_pQueue.reset(new TimingWheelTimerQueue);
+	else
+		_pQueue.reset(new TimedTimerQueue);
+	_thread.setPriority(priority);
+	_thread.start(*this);
+}
+
+
 Timer::~Timer()
 {
 	try
 	{
-		_queue.enqueueNotification(new StopNotification(_queue), Poco::Clock(0));
+		_pQueue->enqueueNotification(new StopNotification(*_pQueue), Poco::Clock(0));
 		_thread.join();
 	}
 	catch (...)
@@ -253,8 +449,8 @@ Timer::~Timer()
 
 void Timer::cancel(bool wait)
 {
-	Poco::AutoPtr<CancelNotification> pNf = new CancelNotification(_queue);
-	_queue.enqueueNotification(pNf, Poco::Clock(0));
+	Poco::AutoPtr<CancelNotification> pNf = new CancelNotification(*_pQueue);
+	_pQueue->enqueueNotification(pNf, Poco::Clock(0));
 	if (wait)
 	{
 		pNf->wait();
@@ -265,14 +461,14 @@ void Timer::cancel(bool wait)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
+	_pQueue->enqueueNotification(new TaskNotification(*_pQueue, pTask), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), clock);
+	_pQueue->enqueueNotification(new TaskNotification(*_pQueue, pTask), clock);
 }
 
 
@@ -287,14 +483,14 @@ void Timer::schedule(TimerTask::Ptr pTask, long delay, long interval)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), time);
+	_pQueue->enqueueNotification(new PeriodicTaskNotification(*_pQueue, pTask, interval), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), clock);
+	_pQueue->enqueueNotification(new PeriodicTaskNotification(*_pQueue, pTask, interval), clock);
 }
 
 
@@ -313,14 +509,14 @@ void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Timestamp time, long
 	Poco::Clock clock;
 	Poco::Timestamp::TimeDiff diff = time - tsNow;
 	clock += diff;
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	_pQueue->enqueueNotification(new FixedRateTaskNotification(*_pQueue, pTask, interval, clock), clock);
 }
 
 
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	_pQueue->enqueueNotification(new FixedRateTaskNotification(*_pQueue, pTask, interval, clock), clock);
 }
 
 
@@ -329,12 +525,24 @@ void Timer::run()
 	bool cont = true;
 	while (cont)
 	{
-		Poco::AutoPtr<TimerNotification> pNf = static_cast<TimerNotification*>(_queue.waitDequeueNotification());
+		Poco::AutoPtr<TimerNotification> pNf = static_cast<TimerNotification*>(_pQueue->waitDequeueNotification());
 		cont = pNf->execute();
 	}
 }
 
 
+bool Timer::idle() const
+{
+	return _pQueue->empty();
+}
+
+
+std::size_t Timer::taskCount() const
+{
+	return _pQueue->size();
+}
+
+
 void Timer::validateTask(const TimerTask::Ptr& pTask)
 {
 	if (pTask->isCancelled())
@@ -336,6 +336,66 @@ void TimerTest::testIdle()
 }
 
 
+void TimerTest::testTimingWheel()
+{
+	Timer timer(Timer::BACKEND_TIMING_WHEEL);
+	assertTrue (timer.backend() == Timer::BACKEND_TIMING_WHEEL);
+	assertTrue (timer.idle());
+
+	Timestamp time;
+	time += 500000;
+	TimerTask::Ptr pTask = new TimerTaskAdapter<TimerTest>(*this, &TimerTest::onTimer);
+	timer.schedule(pTask, time);
+	assertFalse (timer.idle());
+	_event.wait();
+	assertTrue (pTask->lastExecution() >= time);
+
+	// many tasks with different delays
+	std::atomic<int> count(0);
+	for (int i = 0; i < 1000; ++i)
+	{
+		Clock clock;
+		clock += (i % 100)*1000;
+		timer.schedule(Timer::func([&count]() { ++count; }), clock);
+	}
+	for (int i = 0; i < 100 && count < 1000; ++i)
+	{
+		Poco::Thread::sleep(20);
+	}
+	assertTrue (count == 1000);
+
+	// periodic task
+	Timestamp start;
+	pTask = new TimerTaskAdapter<TimerTest>(*this, &TimerTest::onTimer);
+	timer.schedule(pTask, 200, 200);
+	_event.wait();
+	_event.wait();
+	assertTrue (start.elapsed() >= 590000);
+	pTask->cancel();
+	timer.cancel(true);
+	assertTrue (timer.idle());
+}
+
+
+void TimerTest::testTimingWheelCancel()
+{
+	Timer timer(Timer::BACKEND_TIMING_WHEEL, Poco::Thread::PRIO_NORMAL);
+
+	TimerTask::Ptr pTask = new TimerTaskAdapter<TimerTest>(*this, &TimerTest::onTimer);
+	Timestamp time;
+	time += 100000;
+	timer.schedule(pTask, time);
+	Clock clock;
+	clock += 1000000000;
+	timer.schedule(Timer::func([]() {}), clock);
+	assertTrue (timer.taskCount() == 2);
+
+	timer.cancel(true);
+	assertTrue (timer.idle());
+	assertFalse (_event.tryWait(250));
+}
+
+
 void TimerTest::setUp()
 {
 }
@@ -369,6 +429,8 @@ CppUnit::Test* TimerTest::suite()
 	CppUnit_addTest(pSuite, TimerTest, testMultiCancelAllWaitStop);
 	CppUnit_addTest(pSuite, TimerTest, testFunc);
 	CppUnit_addTest(pSuite, TimerTest, testIdle);
+	CppUnit_addTest(pSuite, TimerTest, testTimingWheel);
+	CppUnit_addTest(pSuite, TimerTest, testTimingWheelCancel);
 
 	return pSuite;
 }
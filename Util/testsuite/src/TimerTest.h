@@ -38,6 +38,8 @@ public:
 	void testMultiCancelAllWaitStop();
 	void testFunc();
 	void testIdle();
+	void testTimingWheel();
+	void testTimingWheelCancel();
 
 	void setUp();
 	void tearDown();